@@ -0,0 +1,562 @@
+/**
+ * @file re_bench_noise.c
+ * @brief Throughput benchmark for the REMath noise families.
+ *
+ * Every noise family is timed over regular grids (2D: 64^2 .. 1024^2,
+ * 3D: 16^3 .. 128^3) in up to four modes:
+ *
+ *   scalar   one call per sample, coordinates from the grid index
+ *   batch    the SoA batch entry point over precomputed coordinates
+ *   grid     the incremental FILL_GRID entry point
+ *   mt       RE_NOISE_GEN on a worker pool (batched through the fractal
+ *            path when the family is a fractal basis, per point otherwise)
+ *
+ * Results are printed as CSV (default) or JSON, one record per
+ * family / precision / mode / grid, so runs can be diffed across releases.
+ *
+ *   re_bench_noise [--format csv|json] [--out FILE] [--threads N]
+ *                  [--min-time SEC] [--quick] [--filter TEXT]
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#include "../include/re_noise.h"
+#include "../include/re_noise_gen.h"
+#include "../include/re_noise_cellular.h"
+#include "../include/re_noise_curl.h"
+#include "../include/re_noise_fixed.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <time.h>
+#endif
+
+/* ============================================================================================
+   TIMER / BUILD INFO
+   ============================================================================================ */
+
+static RE_f64 bench_now(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (RE_f64)c.QuadPart / (RE_f64)f.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (RE_f64)t.tv_sec + (RE_f64)t.tv_nsec * 1e-9;
+#endif
+}
+
+static const char *bench_isa(void)
+{
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+    return "avx2";
+#elif defined(RE_SIMD_AVX)
+    return "avx";
+#elif defined(RE_SIMD_SSE)
+    return "sse";
+#elif defined(RE_SIMD_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+/* ============================================================================================
+   GRID + BUFFERS
+   ============================================================================================ */
+
+#define BENCH_OX    -17.3f
+#define BENCH_OY      5.1f
+#define BENCH_OZ      2.7f
+#define BENCH_W       0.37f
+#define BENCH_STEP    0.0371f
+
+typedef struct BENCH_GRID_t {
+    int nx, ny, nz;
+} BENCH_GRID;
+
+static RE_f32 *g_out, *g_x, *g_y, *g_z;
+
+static size_t bench_samples(const BENCH_GRID *g)
+{
+    return (size_t)g->nx * (size_t)g->ny * (size_t)g->nz;
+}
+
+/* SoA coordinates of every grid sample, for the batch kernels (not timed) */
+static void bench_fill_coords(const BENCH_GRID *g)
+{
+    size_t i = 0;
+    for (int z = 0; z < g->nz; z++)
+        for (int y = 0; y < g->ny; y++)
+            for (int x = 0; x < g->nx; x++, i++)
+            {
+                g_x[i] = BENCH_OX + BENCH_STEP * (RE_f32)x;
+                g_y[i] = BENCH_OY + BENCH_STEP * (RE_f32)y;
+                g_z[i] = BENCH_OZ + BENCH_STEP * (RE_f32)z;
+            }
+}
+
+/* ============================================================================================
+   KERNELS
+   ============================================================================================ */
+
+typedef void (*BENCH_KERNEL)(const BENCH_GRID *g);
+
+/* Scalar loop with the call inlined: T is the coordinate type, EXPR uses px/py/pz */
+#define BENCH_SCALAR(name, T, EXPR)                                                   \
+    static void name(const BENCH_GRID *g)                                             \
+    {                                                                                 \
+        size_t i = 0;                                                                 \
+        for (int z = 0; z < g->nz; z++)                                               \
+        {                                                                             \
+            T pz = (T)BENCH_OZ + (T)BENCH_STEP * (T)z;                                \
+            for (int y = 0; y < g->ny; y++)                                           \
+            {                                                                         \
+                T py = (T)BENCH_OY + (T)BENCH_STEP * (T)y;                            \
+                for (int x = 0; x < g->nx; x++, i++)                                  \
+                {                                                                     \
+                    T px = (T)BENCH_OX + (T)BENCH_STEP * (T)x;                        \
+                    (void)py; (void)pz;                                               \
+                    g_out[i] = (RE_f32)(EXPR);                                        \
+                }                                                                     \
+            }                                                                         \
+        }                                                                             \
+    }
+
+static const RE_NOISE_FRACTAL_DESC g_fbm = {
+    RE_NOISE_BASIS_PERLIN3, RE_NOISE_FRACTAL_FBM, 6, 2.0f, 0.5f, 1.0f, 0.0f
+};
+
+/* Reference for CURL3: central differences of the 3-channel potential (6 vector samples) */
+static RE_f32 bench_curl3_fd(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    const RE_f32 h = 1e-3f;
+    RE_f32 px[3], mx[3], py[3], my[3], pz[3], mz[3];
+
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x + h, y, z, px);
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x - h, y, z, mx);
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x, y + h, z, py);
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x, y - h, z, my);
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x, y, z + h, pz);
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x, y, z - h, mz);
+
+    return ((py[2] - my[2]) - (pz[1] - mz[1]) + (pz[0] - mz[0]) - (px[2] - mx[2])
+          + (px[1] - mx[1]) - (py[0] - my[0])) * (0.5f / h);
+}
+
+static RE_f32 bench_curl3(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_V3_f32 c = RE_NOISE_CURL3_CTX_f32(ctx, x, y, z);
+    return c.x + c.y + c.z;
+}
+
+BENCH_SCALAR(sc_value2_f32,      RE_f32, RE_NOISE_VALUE2_f32(px, py))
+BENCH_SCALAR(sc_value2_f64,      RE_f64, RE_NOISE_VALUE2_f64(px, py))
+BENCH_SCALAR(sc_value3_f32,      RE_f32, RE_NOISE_VALUE3_f32(px, py, pz))
+BENCH_SCALAR(sc_value4_f32,      RE_f32, RE_NOISE_VALUE4_f32(px, py, pz, BENCH_W))
+BENCH_SCALAR(sc_perlin2_f32,     RE_f32, RE_NOISE_PERLIN2_f32(px, py))
+BENCH_SCALAR(sc_perlin2_f64,     RE_f64, RE_NOISE_PERLIN2_f64(px, py))
+BENCH_SCALAR(sc_perlin3_f32,     RE_f32, RE_NOISE_PERLIN3_f32(px, py, pz))
+BENCH_SCALAR(sc_perlin3_f64,     RE_f64, RE_NOISE_PERLIN3_f64(px, py, pz))
+BENCH_SCALAR(sc_os2d_fast_f32,   RE_f32, RE_NOISE_OS2D_FAST_f32(px, py))
+BENCH_SCALAR(sc_os2d_fast_f64,   RE_f64, RE_NOISE_OS2D_FAST_f64(px, py))
+BENCH_SCALAR(sc_os2d_smooth_f32, RE_f32, RE_NOISE_OS2D_SMOOTH_f32(px, py))
+BENCH_SCALAR(sc_os2d_smooth_f64, RE_f64, RE_NOISE_OS2D_SMOOTH_f64(px, py))
+BENCH_SCALAR(sc_os3d_fast_f32,   RE_f32, RE_NOISE_OS3D_FAST_f32(px, py, pz))
+BENCH_SCALAR(sc_os3d_fast_f64,   RE_f64, RE_NOISE_OS3D_FAST_f64(px, py, pz))
+BENCH_SCALAR(sc_os3d_smooth_f32, RE_f32, RE_NOISE_OS3D_SMOOTH_f32(px, py, pz))
+BENCH_SCALAR(sc_os3d_smooth_f64, RE_f64, RE_NOISE_OS3D_SMOOTH_f64(px, py, pz))
+BENCH_SCALAR(sc_fbm_f32,         RE_f32, RE_NOISE_FRACTAL3_f32(&g_fbm, px, py, pz))
+BENCH_SCALAR(sc_worley2_f32,     RE_f32, RE_NOISE_WORLEY2_f32(px, py).f1)
+BENCH_SCALAR(sc_worley3_f32,     RE_f32, RE_NOISE_WORLEY3_f32(px, py, pz).f1)
+BENCH_SCALAR(sc_curl3_f32,       RE_f32, bench_curl3(&RE_NOISE_DEFAULT_CONTEXT, px, py, pz))
+BENCH_SCALAR(sc_curl3_fd_f32,    RE_f32, bench_curl3_fd(&RE_NOISE_DEFAULT_CONTEXT, px, py, pz))
+BENCH_SCALAR(sc_perlin2_q16,     RE_f32, RE_Q16_TO_f32(RE_NOISE_PERLIN2_q16(RE_Q16_FROM_f32(px), RE_Q16_FROM_f32(py))))
+BENCH_SCALAR(sc_perlin3_q16,     RE_f32, RE_Q16_TO_f32(RE_NOISE_PERLIN3_q16(RE_Q16_FROM_f32(px), RE_Q16_FROM_f32(py), RE_Q16_FROM_f32(pz))))
+BENCH_SCALAR(sc_os2d_smooth_q16, RE_f32, RE_Q16_TO_f32(RE_NOISE_OS2D_SMOOTH_q16(RE_Q16_FROM_f32(px), RE_Q16_FROM_f32(py))))
+BENCH_SCALAR(sc_os3d_fast_q16,   RE_f32, RE_Q16_TO_f32(RE_NOISE_OS3D_FAST_q16(RE_Q16_FROM_f32(px), RE_Q16_FROM_f32(py), RE_Q16_FROM_f32(pz))))
+
+static void bt_perlin2_f32(const BENCH_GRID *g)     { RE_NOISE_PERLIN2_BATCH_f32(g_x, g_y, g_out, (int)bench_samples(g)); }
+static void bt_perlin3_f32(const BENCH_GRID *g)     { RE_NOISE_PERLIN3_BATCH_f32(g_x, g_y, g_z, g_out, (int)bench_samples(g)); }
+/* The f64 batch converts the shared f32 coordinates tile by tile (included in the timing) */
+static void bt_perlin3_f64(const BENCH_GRID *g)
+{
+    RE_f64 x[256], y[256], z[256], o[256];
+    int n = (int)bench_samples(g);
+
+    for (int i = 0; i < n; i += 256)
+    {
+        int m = (n - i < 256) ? n - i : 256;
+        for (int k = 0; k < m; k++) { x[k] = g_x[i + k]; y[k] = g_y[i + k]; z[k] = g_z[i + k]; }
+        RE_NOISE_PERLIN3_BATCH_f64(x, y, z, o, m);
+        for (int k = 0; k < m; k++) g_out[i + k] = (RE_f32)o[k];
+    }
+}
+
+static void bt_os3d_fast_f32(const BENCH_GRID *g)   { RE_NOISE_OS3D_FAST_BATCH_f32(g_x, g_y, g_z, g_out, (int)bench_samples(g)); }
+static void bt_os3d_smooth_f32(const BENCH_GRID *g) { RE_NOISE_OS3D_SMOOTH_BATCH_f32(g_x, g_y, g_z, g_out, (int)bench_samples(g)); }
+static void bt_fbm_f32(const BENCH_GRID *g)         { RE_NOISE_FRACTAL3_BATCH_f32(&g_fbm, g_x, g_y, g_z, g_out, (int)bench_samples(g)); }
+static void bt_worley3_f32(const BENCH_GRID *g)     { RE_NOISE_WORLEY3_BATCH_f32(g_x, g_y, g_z, g_out, NULL, NULL, (int)bench_samples(g)); }
+
+/* Particles: SoA positions, AoS velocities reset per tile (the reset is included in the timing) */
+static void bt_curl3_f32(const BENCH_GRID *g)
+{
+    RE_V3_f32 v[256];
+    int n = (int)bench_samples(g);
+
+    for (int i = 0; i < n; i += 256)
+    {
+        int m = (n - i < 256) ? n - i : 256;
+        for (int k = 0; k < m; k++) v[k].x = v[k].y = v[k].z = 0.0f;
+        RE_NOISE_CURL3_BATCH_f32(g_x + i, g_y + i, g_z + i, 1.0f, 1.0f, v, m);
+        for (int k = 0; k < m; k++) g_out[i + k] = v[k].x + v[k].y + v[k].z;
+    }
+}
+
+/* Fixed point: coordinates converted to Q16.16 per tile (the conversion is included in the timing) */
+static void bench_to_q16(RE_q16 *q, const RE_f32 *v, int m)
+{
+    for (int k = 0; k < m; k++) q[k] = RE_Q16_FROM_f32(v[k]);
+}
+
+#define BENCH_BATCH2_Q16(name, CALL)                                                  \
+    static void name(const BENCH_GRID *g)                                             \
+    {                                                                                 \
+        RE_q16 qx[256], qy[256], qo[256];                                             \
+        int n = (int)bench_samples(g);                                                \
+        for (int i = 0; i < n; i += 256)                                              \
+        {                                                                             \
+            int m = (n - i < 256) ? n - i : 256;                                      \
+            bench_to_q16(qx, g_x + i, m);                                             \
+            bench_to_q16(qy, g_y + i, m);                                             \
+            CALL;                                                                     \
+            for (int k = 0; k < m; k++) g_out[i + k] = RE_Q16_TO_f32(qo[k]);          \
+        }                                                                             \
+    }
+
+#define BENCH_BATCH3_Q16(name, CALL)                                                  \
+    static void name(const BENCH_GRID *g)                                             \
+    {                                                                                 \
+        RE_q16 qx[256], qy[256], qz[256], qo[256];                                    \
+        int n = (int)bench_samples(g);                                                \
+        for (int i = 0; i < n; i += 256)                                              \
+        {                                                                             \
+            int m = (n - i < 256) ? n - i : 256;                                      \
+            bench_to_q16(qx, g_x + i, m);                                             \
+            bench_to_q16(qy, g_y + i, m);                                             \
+            bench_to_q16(qz, g_z + i, m);                                             \
+            CALL;                                                                     \
+            for (int k = 0; k < m; k++) g_out[i + k] = RE_Q16_TO_f32(qo[k]);          \
+        }                                                                             \
+    }
+
+BENCH_BATCH2_Q16(bt_perlin2_q16,     RE_NOISE_PERLIN2_BATCH_q16(qx, qy, qo, m))
+BENCH_BATCH3_Q16(bt_perlin3_q16,     RE_NOISE_PERLIN3_BATCH_q16(qx, qy, qz, qo, m))
+BENCH_BATCH2_Q16(bt_os2d_smooth_q16, RE_NOISE_OS2D_SMOOTH_BATCH_q16(qx, qy, qo, m))
+BENCH_BATCH3_Q16(bt_os3d_fast_q16,   RE_NOISE_OS3D_FAST_BATCH_q16(qx, qy, qz, qo, m))
+
+static void gr_value2_f32(const BENCH_GRID *g)
+{
+    RE_NOISE_VALUE2_FILL_GRID_f32(g_out, BENCH_OX, BENCH_OY, BENCH_STEP, BENCH_STEP, g->nx, g->ny);
+}
+
+static void gr_value3_f32(const BENCH_GRID *g)
+{
+    RE_NOISE_VALUE3_FILL_GRID_f32(g_out, BENCH_OX, BENCH_OY, BENCH_OZ, BENCH_STEP, BENCH_STEP, BENCH_STEP,
+                                  g->nx, g->ny, g->nz);
+}
+
+static void gr_perlin3_f32(const BENCH_GRID *g)
+{
+    RE_NOISE_PERLIN3_FILL_GRID_f32(g_out, BENCH_OX, BENCH_OY, BENCH_OZ, BENCH_STEP, BENCH_STEP, BENCH_STEP,
+                                   g->nx, g->ny, g->nz);
+}
+
+static void gr_worley2_f32(const BENCH_GRID *g)
+{
+    RE_NOISE_WORLEY2_FILL_GRID_f32(g_out, NULL, NULL, BENCH_OX, BENCH_OY, BENCH_STEP, BENCH_STEP, g->nx, g->ny);
+}
+
+static void gr_worley3_f32(const BENCH_GRID *g)
+{
+    RE_NOISE_WORLEY3_FILL_GRID_f32(g_out, NULL, NULL, BENCH_OX, BENCH_OY, BENCH_OZ,
+                                   BENCH_STEP, BENCH_STEP, BENCH_STEP, g->nx, g->ny, g->nz);
+}
+
+/* Per-point sources for the generator */
+#define BENCH_POINT(name, EXPR)                                                       \
+    static RE_f32 name(const RE_NOISE_CONTEXT *ctx, void *user, RE_f32 x, RE_f32 y, RE_f32 z) \
+    {                                                                                 \
+        (void)ctx; (void)user; (void)y; (void)z;                                      \
+        return (RE_f32)(EXPR);                                                        \
+    }
+
+BENCH_POINT(pt_value2_f32,      RE_NOISE_VALUE2_CTX_f32(ctx, x, y))
+BENCH_POINT(pt_value2_f64,      RE_NOISE_VALUE2_CTX_f64(ctx, x, y))
+BENCH_POINT(pt_value4_f32,      RE_NOISE_VALUE4_CTX_f32(ctx, x, y, z, BENCH_W))
+BENCH_POINT(pt_perlin2_f32,     RE_NOISE_PERLIN2_CTX_f32(ctx, x, y))
+BENCH_POINT(pt_perlin2_f64,     RE_NOISE_PERLIN2_CTX_f64(ctx, x, y))
+BENCH_POINT(pt_os2d_fast_f32,   RE_NOISE_OS2D_FAST_CTX_f32(ctx, x, y))
+BENCH_POINT(pt_os2d_fast_f64,   RE_NOISE_OS2D_FAST_CTX_f64(ctx, x, y))
+BENCH_POINT(pt_os2d_smooth_f32, RE_NOISE_OS2D_SMOOTH_CTX_f32(ctx, x, y))
+BENCH_POINT(pt_os2d_smooth_f64, RE_NOISE_OS2D_SMOOTH_CTX_f64(ctx, x, y))
+BENCH_POINT(pt_perlin3_f64,     RE_NOISE_PERLIN3_CTX_f64(ctx, x, y, z))
+BENCH_POINT(pt_os3d_fast_f64,   RE_NOISE_OS3D_FAST_CTX_f64(ctx, x, y, z))
+BENCH_POINT(pt_os3d_smooth_f64, RE_NOISE_OS3D_SMOOTH_CTX_f64(ctx, x, y, z))
+BENCH_POINT(pt_worley2_f32,     RE_NOISE_WORLEY2_CTX_f32(ctx, x, y).f1)
+BENCH_POINT(pt_worley3_f32,     RE_NOISE_WORLEY3_CTX_f32(ctx, x, y, z).f1)
+BENCH_POINT(pt_curl3_f32,       bench_curl3(ctx, x, y, z))
+BENCH_POINT(pt_curl3_fd_f32,    bench_curl3_fd(ctx, x, y, z))
+BENCH_POINT(pt_perlin2_q16,     RE_Q16_TO_f32(RE_NOISE_PERLIN2_CTX_q16(ctx, RE_Q16_FROM_f32(x), RE_Q16_FROM_f32(y))))
+BENCH_POINT(pt_perlin3_q16,     RE_Q16_TO_f32(RE_NOISE_PERLIN3_CTX_q16(ctx, RE_Q16_FROM_f32(x), RE_Q16_FROM_f32(y), RE_Q16_FROM_f32(z))))
+BENCH_POINT(pt_os2d_smooth_q16, RE_Q16_TO_f32(RE_NOISE_OS2D_SMOOTH_CTX_q16(ctx, RE_Q16_FROM_f32(x), RE_Q16_FROM_f32(y))))
+BENCH_POINT(pt_os3d_fast_q16,   RE_Q16_TO_f32(RE_NOISE_OS3D_FAST_CTX_q16(ctx, RE_Q16_FROM_f32(x), RE_Q16_FROM_f32(y), RE_Q16_FROM_f32(z))))
+
+/* ============================================================================================
+   FAMILY TABLE
+   ============================================================================================ */
+
+typedef struct BENCH_FAMILY_t {
+    const char           *name;
+    const char           *precision;
+    int                   dims;        /* grid dimensionality: 2 or 3 (VALUE4 runs on a 3D grid) */
+    BENCH_KERNEL          scalar;
+    BENCH_KERNEL          batch;
+    BENCH_KERNEL          grid;
+    RE_NOISE_GEN_POINT_FN gen_point;   /* mt source when the family is not a fractal basis */
+    int                   gen_basis;   /* RE_NOISE_BASIS_* or -1 */
+    int                   gen_octaves;
+} BENCH_FAMILY;
+
+static const BENCH_FAMILY g_families[] = {
+    { "VALUE2",      "f32", 2, sc_value2_f32,      NULL,               gr_value2_f32,  pt_value2_f32,      -1, 0 },
+    { "VALUE2",      "f64", 2, sc_value2_f64,      NULL,               NULL,           pt_value2_f64,      -1, 0 },
+    { "VALUE3",      "f32", 3, sc_value3_f32,      NULL,               gr_value3_f32,  NULL, RE_NOISE_BASIS_VALUE3,      1 },
+    { "VALUE4",      "f32", 3, sc_value4_f32,      NULL,               NULL,           pt_value4_f32,      -1, 0 },
+    { "PERLIN2",     "f32", 2, sc_perlin2_f32,     bt_perlin2_f32,     NULL,           pt_perlin2_f32,     -1, 0 },
+    { "PERLIN2",     "f64", 2, sc_perlin2_f64,     NULL,               NULL,           pt_perlin2_f64,     -1, 0 },
+    { "PERLIN3",     "f32", 3, sc_perlin3_f32,     bt_perlin3_f32,     gr_perlin3_f32, NULL, RE_NOISE_BASIS_PERLIN3,     1 },
+    { "PERLIN3",     "f64", 3, sc_perlin3_f64,     bt_perlin3_f64,     NULL,           pt_perlin3_f64,     -1, 0 },
+    { "OS2D_FAST",   "f32", 2, sc_os2d_fast_f32,   NULL,               NULL,           pt_os2d_fast_f32,   -1, 0 },
+    { "OS2D_FAST",   "f64", 2, sc_os2d_fast_f64,   NULL,               NULL,           pt_os2d_fast_f64,   -1, 0 },
+    { "OS2D_SMOOTH", "f32", 2, sc_os2d_smooth_f32, NULL,               NULL,           pt_os2d_smooth_f32, -1, 0 },
+    { "OS2D_SMOOTH", "f64", 2, sc_os2d_smooth_f64, NULL,               NULL,           pt_os2d_smooth_f64, -1, 0 },
+    { "OS3D_FAST",   "f32", 3, sc_os3d_fast_f32,   bt_os3d_fast_f32,   NULL,           NULL, RE_NOISE_BASIS_OS3D_FAST,   1 },
+    { "OS3D_FAST",   "f64", 3, sc_os3d_fast_f64,   NULL,               NULL,           pt_os3d_fast_f64,   -1, 0 },
+    { "OS3D_SMOOTH", "f32", 3, sc_os3d_smooth_f32, bt_os3d_smooth_f32, NULL,           NULL, RE_NOISE_BASIS_OS3D_SMOOTH, 1 },
+    { "OS3D_SMOOTH", "f64", 3, sc_os3d_smooth_f64, NULL,               NULL,           pt_os3d_smooth_f64, -1, 0 },
+    { "FBM6_PERLIN3","f32", 3, sc_fbm_f32,         bt_fbm_f32,         NULL,           NULL, RE_NOISE_BASIS_PERLIN3,     6 },
+    { "WORLEY2_F1",  "f32", 2, sc_worley2_f32,     NULL,               gr_worley2_f32, pt_worley2_f32,     -1, 0 },
+    { "WORLEY3_F1",  "f32", 3, sc_worley3_f32,     bt_worley3_f32,     gr_worley3_f32, pt_worley3_f32,     -1, 0 },
+    { "CURL3",       "f32", 3, sc_curl3_f32,       bt_curl3_f32,       NULL,           pt_curl3_f32,       -1, 0 },
+    { "CURL3_FD",    "f32", 3, sc_curl3_fd_f32,    NULL,               NULL,           pt_curl3_fd_f32,    -1, 0 },
+    { "PERLIN2",     "q16", 2, sc_perlin2_q16,     bt_perlin2_q16,     NULL,           pt_perlin2_q16,     -1, 0 },
+    { "PERLIN3",     "q16", 3, sc_perlin3_q16,     bt_perlin3_q16,     NULL,           pt_perlin3_q16,     -1, 0 },
+    { "OS2D_SMOOTH", "q16", 2, sc_os2d_smooth_q16, bt_os2d_smooth_q16, NULL,           pt_os2d_smooth_q16, -1, 0 },
+    { "OS3D_FAST",   "q16", 3, sc_os3d_fast_q16,   bt_os3d_fast_q16,   NULL,           pt_os3d_fast_q16,   -1, 0 },
+};
+
+static const BENCH_GRID g_grids2[] = { {   64,   64, 1 }, {  256,  256, 1 }, { 1024, 1024, 1 } };
+static const BENCH_GRID g_grids3[] = { {   16,   16, 16 }, {  64,   64, 64 }, {  128,  128, 128 } };
+
+#define BENCH_MAX_SAMPLES  (1024 * 1024 * 2)
+
+/* ============================================================================================
+   RUNNER
+   ============================================================================================ */
+
+typedef struct BENCH_OPTIONS_t {
+    int         json;
+    int         threads;
+    RE_f64      min_time;
+    const char *filter;
+    FILE       *out;
+} BENCH_OPTIONS;
+
+typedef struct BENCH_STATE_t {
+    const BENCH_OPTIONS *opt;
+    RE_NOISE_POOL       *pool;
+    const BENCH_FAMILY  *mt_family;
+    int                  records;
+} BENCH_STATE;
+
+static BENCH_STATE g_state;
+
+static void mt_kernel(const BENCH_GRID *g)
+{
+    const BENCH_FAMILY *f = g_state.mt_family;
+    RE_NOISE_FRACTAL_DESC fd = { 0, RE_NOISE_FRACTAL_FBM, 1, 2.0f, 0.5f, 1.0f, 0.0f };
+    RE_NOISE_GEN_DESC d;
+
+    memset(&d, 0, sizeof(d));
+    d.nx = g->nx;  d.ny = g->ny;  d.nz = g->nz;
+    d.ox = BENCH_OX; d.oy = BENCH_OY; d.oz = BENCH_OZ;
+    d.sx = d.sy = d.sz = BENCH_STEP;
+    d.out = g_out;
+
+    if (f->gen_basis >= 0)
+    {
+        fd = (f->gen_octaves > 1) ? g_fbm : fd;
+        fd.basis = f->gen_basis;
+        d.fractal = &fd;
+    }
+    else
+        d.point_fn = f->gen_point;
+
+    RE_NOISE_GEN_RUN(g_state.pool, &d);
+}
+
+static void bench_emit(const BENCH_FAMILY *f, const char *mode, const BENCH_GRID *g,
+                       int threads, int reps, RE_f64 seconds, RE_f64 checksum)
+{
+    FILE  *o   = g_state.opt->out;
+    RE_f64 n   = (RE_f64)bench_samples(g) * reps;
+    RE_f64 ns  = seconds * 1e9 / n;
+    RE_f64 sps = n / seconds;
+    char   dims[32];
+
+    if (g->nz > 1) snprintf(dims, sizeof(dims), "%dx%dx%d", g->nx, g->ny, g->nz);
+    else           snprintf(dims, sizeof(dims), "%dx%d", g->nx, g->ny);
+
+    if (g_state.opt->json)
+        fprintf(o, "%s    {\"family\": \"%s\", \"precision\": \"%s\", \"mode\": \"%s\", \"grid\": \"%s\", "
+                   "\"samples\": %zu, \"threads\": %d, \"reps\": %d, \"ns_per_sample\": %.4f, "
+                   "\"samples_per_sec\": %.0f, \"checksum\": %.6g}",
+                g_state.records ? ",\n" : "", f->name, f->precision, mode, dims,
+                bench_samples(g), threads, reps, ns, sps, checksum);
+    else
+        fprintf(o, "%s,%s,%s,%s,%zu,%d,%d,%.4f,%.0f,%.6g\n",
+                f->name, f->precision, mode, dims, bench_samples(g), threads, reps, ns, sps, checksum);
+
+    g_state.records++;
+    fflush(o);
+}
+
+static void bench_run(const BENCH_FAMILY *f, const char *mode, BENCH_KERNEL k,
+                      const BENCH_GRID *g, int threads)
+{
+    int    reps = 0;
+    RE_f64 t0, t1;
+
+    k(g);                                  /* warm caches and the pool */
+
+    t0 = bench_now();
+    do
+    {
+        k(g);
+        reps++;
+        t1 = bench_now();
+    } while (t1 - t0 < g_state.opt->min_time);
+
+    RE_f64 checksum = 0.0;
+    for (size_t i = 0; i < bench_samples(g); i += 97)
+        checksum += g_out[i];
+
+    bench_emit(f, mode, g, threads, reps, t1 - t0, checksum);
+}
+
+static void bench_family(const BENCH_FAMILY *f)
+{
+    const BENCH_GRID *grids = (f->dims == 2) ? g_grids2 : g_grids3;
+
+    for (int gi = 0; gi < 3; gi++)
+    {
+        const BENCH_GRID *g = &grids[gi];
+
+        bench_run(f, "scalar", f->scalar, g, 1);
+
+        if (f->batch)
+        {
+            bench_fill_coords(g);
+            bench_run(f, "batch", f->batch, g, 1);
+        }
+        if (f->grid)
+            bench_run(f, "grid", f->grid, g, 1);
+
+        g_state.mt_family = f;
+        bench_run(f, "mt", mt_kernel, g, g_state.pool->thread_count);
+    }
+}
+
+static void bench_usage(void)
+{
+    printf("usage: re_bench_noise [--format csv|json] [--out FILE] [--threads N]\n"
+           "                      [--min-time SEC] [--quick] [--filter TEXT]\n");
+}
+
+int main(int argc, char **argv)
+{
+    BENCH_OPTIONS opt = { 0, 0, 0.1, NULL, stdout };
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *a = argv[i];
+        const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if      (!strcmp(a, "--format") && v)   { opt.json = !strcmp(v, "json"); i++; }
+        else if (!strcmp(a, "--out") && v)      { opt.out = fopen(v, "w"); i++; }
+        else if (!strcmp(a, "--threads") && v)  { opt.threads = atoi(v); i++; }
+        else if (!strcmp(a, "--min-time") && v) { opt.min_time = atof(v); i++; }
+        else if (!strcmp(a, "--filter") && v)   { opt.filter = v; i++; }
+        else if (!strcmp(a, "--quick"))         { opt.min_time = 0.01; }
+        else
+        {
+            bench_usage();
+            return (!strcmp(a, "--help") || !strcmp(a, "-h")) ? 0 : 1;
+        }
+    }
+    if (opt.out == NULL)
+    {
+        fprintf(stderr, "re_bench_noise: cannot open output file\n");
+        return 1;
+    }
+
+    g_out = (RE_f32 *)malloc(BENCH_MAX_SAMPLES * sizeof(RE_f32));
+    g_x   = (RE_f32 *)malloc(BENCH_MAX_SAMPLES * sizeof(RE_f32));
+    g_y   = (RE_f32 *)malloc(BENCH_MAX_SAMPLES * sizeof(RE_f32));
+    g_z   = (RE_f32 *)malloc(BENCH_MAX_SAMPLES * sizeof(RE_f32));
+    if (!g_out || !g_x || !g_y || !g_z)
+    {
+        fprintf(stderr, "re_bench_noise: out of memory\n");
+        return 1;
+    }
+
+    RE_NOISE_POOL pool;
+    if (!RE_NOISE_POOL_CREATE(&pool, opt.threads))
+    {
+        fprintf(stderr, "re_bench_noise: cannot start worker threads\n");
+        return 1;
+    }
+
+    g_state.opt  = &opt;
+    g_state.pool = &pool;
+
+    if (opt.json)
+        fprintf(opt.out, "{\n  \"isa\": \"%s\",\n  \"hash_mode\": %d,\n  \"threads\": %d,\n"
+                         "  \"min_time\": %g,\n  \"results\": [\n",
+                bench_isa(), RE_NOISE_HASH_MODE, pool.thread_count, opt.min_time);
+    else
+        fprintf(opt.out, "family,precision,mode,grid,samples,threads,reps,ns_per_sample,samples_per_sec,checksum\n");
+
+    for (size_t i = 0; i < sizeof(g_families) / sizeof(g_families[0]); i++)
+    {
+        const BENCH_FAMILY *f = &g_families[i];
+        if (opt.filter && !strstr(f->name, opt.filter)) continue;
+        bench_family(f);
+    }
+
+    if (opt.json)
+        fprintf(opt.out, "\n  ]\n}\n");
+
+    RE_NOISE_POOL_DESTROY(&pool);
+    free(g_out); free(g_x); free(g_y); free(g_z);
+    if (opt.out != stdout) fclose(opt.out);
+    return 0;
+}
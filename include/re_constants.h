@@ -37,6 +37,29 @@ extern "C" {
 #define OS2D_SCALE_F64  (1.0  / 0.010016341)
 #endif
 
+// Lattice-sum smooth variants (peak |n| measured at ~0.1105 / ~0.0737 before scaling)
+#ifndef OS3D_SMOOTH_SCALE_F32
+#define OS3D_SMOOTH_SCALE_F32 9.0f
+#endif
+#ifndef OS3D_SMOOTH_SCALE_F64
+#define OS3D_SMOOTH_SCALE_F64 9.0
+#endif
+
+#ifndef OS2D_SMOOTH_SCALE_F32
+#define OS2D_SMOOTH_SCALE_F32 13.5f
+#endif
+#ifndef OS2D_SMOOTH_SCALE_F64
+#define OS2D_SMOOTH_SCALE_F64 13.5
+#endif
+
+// Two-lattice fast 3D variant, kernel radius^2 0.5 (peak |n| measured at ~0.0130 before scaling)
+#ifndef OS3D_FAST_SCALE_F32
+#define OS3D_FAST_SCALE_F32 75.0f
+#endif
+#ifndef OS3D_FAST_SCALE_F64
+#define OS3D_FAST_SCALE_F64 75.0
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -49,6 +49,25 @@ typedef int RE_BOOL;
 # endif
 #endif
 
+/* Alignment specifier (prefix form: RE_ALIGN(16) RE_f32 v[4];) */
+#ifndef RE_ALIGN
+# if defined(_MSC_VER)
+#  define RE_ALIGN(n) __declspec(align(n))
+# else
+#  define RE_ALIGN(n) __attribute__((aligned(n)))
+# endif
+#endif
+
+/* ---------------------------
+   Signed integer model
+   --------------------------- */
+
+/* REMath assumes what GCC, Clang and MSVC all do: >> of a negative signed value is an
+   arithmetic shift (rounds toward -inf), and converting an out-of-range unsigned value to a
+   signed type wraps (two's complement). Scalar fixed-point and integer lane code rely on both,
+   matching the SIMD srai / cvt instructions; a compiler that differs fails to build here. */
+typedef char RE_SIGNED_MODEL_CHECK_[((-8 >> 1) == -4 && (RE_i32)0xFFFFFFFFu == -1) ? 1 : -1];
+
 /* ---------------------------
    Bit reinterpret helpers (safe via union)
    --------------------------- */
@@ -234,15 +234,15 @@ RE_INLINE RE_f32 RE_SIGN(RE_f32 x) {
 
 // Fast inverse sqaure root (Quake III style)
 RE_INLINE RE_f32 RE_INVSQRT(RE_f32 number) {
-	long i;
+	RE_i32 i;
 	RE_f32 x2, y;
 	const RE_f32 threehalfs = 1.5f;
 
 	x2 = number * 0.5f;
 	y = number;
-	i = *(long*)&y;			// Evil floating point bit hacking
+	i = (RE_i32)RE_BITCAST_f32_TO_u32(y);	// Evil floating point bit hacking (32-bit, no aliasing UB)
 	i = 0x5f3759df - (i >> 1);	// Magic Number
-	y = *(RE_f32*)&i;
+	y = RE_BITCAST_u32_TO_f32((RE_u32)i);
 	y = y * (threehalfs - (x2 * y * y));
 	y = y * (threehalfs - (x2 * y * y)); // Second refinement iteration (added for higher accuracy)
 	return y;
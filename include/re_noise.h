@@ -2,11 +2,13 @@
 #define RE_NOISE_H
 
 #include "re_core.h"
+#include "re_simd_detect.h"
 #include "re_math_ext.h"
 #include "re_vec.h"
 #include "re_constants.h"
 
 #include <stdint.h>
+#include <stddef.h>
 
 /* ================================================================================================
    RE NOISE HASHING SYSTEM
@@ -42,12 +44,40 @@ RE_INLINE RE_u32 RE_HASH3D_PCG(RE_i32 x, RE_i32 y, RE_i32 z)
     return RE_PCG_MIX32(h);
 }
 
+/* Seed 0 is RE_HASH3D_PCG; the seed term decorrelates whole lattices */
+RE_INLINE RE_u32 RE_HASH3D_PCG_SEED(RE_u32 seed, RE_i32 x, RE_i32 y, RE_i32 z)
+{
+    RE_u32 h = (RE_u32)(x) * 73856093u
+             ^ (RE_u32)(y) * 19349663u
+             ^ (RE_u32)(z) * 83492791u
+             ^ seed * 0x9e3779b9u;
+    return RE_PCG_MIX32(h);
+}
+
+RE_INLINE RE_u32 RE_HASH4D_PCG_SEED(RE_u32 seed, RE_i32 x, RE_i32 y, RE_i32 z, RE_i32 w)
+{
+    RE_u32 h = (RE_u32)(x) * 73856093u
+             ^ (RE_u32)(y) * 19349663u
+             ^ (RE_u32)(z) * 83492791u
+             ^ (RE_u32)(w) * 0x27d4eb2du
+             ^ seed * 0x9e3779b9u;
+    return RE_PCG_MIX32(h);
+}
+
+/* Maps a full 32-bit hash to a 3D gradient index 0..11 (multiply-shift, no modulo) */
+RE_INLINE RE_u8 RE_HASH_TO_GRAD12(RE_u32 h)
+{
+    return (RE_u8)(((h >> 16) * 12u) >> 16);
+}
+
 /* ================================================================================================
    MODE 1 — 256-ENTRY CLASSIC PERLIN TABLE
    ================================================================================================ */
 
 #if RE_NOISE_HASH_MODE == 1
 
+#define RE_HASH3D_MAX 255
+
 static const RE_u8 RE_NOISE_PERM_256[512] = {
     /* 256 repeated permutation, compile-time constant */
     151,160,137,91,90,15,
@@ -106,38 +136,86 @@ RE_INLINE RE_u32 RE_HASH3D(RE_i32 x, RE_i32 y, RE_i32 z)
 #if RE_NOISE_HASH_MODE == 2
 
 #define RE_NOISE_TABLE_SIZE 1024
+#define RE_HASH3D_MAX       (RE_NOISE_TABLE_SIZE - 1)
 
-static RE_u16 RE_NOISE_PERM_1024[RE_NOISE_TABLE_SIZE * 2];
-
-static RE_bool RE_NOISE_TABLE_INITED = RE_FALSE;
+/*
+    Fisher–Yates shuffle of 0..1023 driven by RE_PCG_MIX32(i * 1664525), expanded at build
+    time. The table is constant, so mode 2 needs no initialization and is safe from any thread.
+*/
+static const RE_u16 RE_NOISE_PERM_1024[RE_NOISE_TABLE_SIZE] = {
+     248,   84,  969,  462,  847,  727,  662,  972,  239,  421,  386,  560,  519,  101,  863,  392,
+     802,  159,  120,  143,  943,  345,  416,  510,  311,  804,   64,  403,  484,  903,  647,  728,
+     499,  228,  741,   35,  470,  718,  154,  918,  528,  389,  318,  819,  296,  872,  178,  429,
+     362,  862,  596,  129,   52,  913,  132,  834,  649,  939,   65,  471,   89,  742,  376,   71,
+      74,  458,  372,  611,  640,  757,  326,  870,  868,  448,  493,  450,  776,  169,  877,  705,
+     527,  590,  482,  984,  700,  325,  265,  687,  465,  342,  408,   75,  858,  167,  881,  841,
+     954,  601,  766,  677,  234,  463,  976,   40,  632,  621,  384,  771,  112,  783,  113,  446,
+     975,   63,  246,  639,  955,  921,  364,  312,  846,  754,  252,  452,   91,  729,  146,  522,
+      77,  851,  523,  459,  554,  425,  513,  844,  925,  672,  439,  306,  973,  873,  247,  592,
+     707,  531,  558,   24,  654,   37,  263,  585,   47,  889,  355,  289,  594,  109,  733,  231,
+     335,  848,  409,  699,   22,  926,  350,  692,  116,  287,   83,   50,  279,  395,  694,  264,
+     196,  764,  660,  937,  843,  651,  670,  383, 1008,  119,  245,  796,   93,  532,  738,    2,
+     994,   38,  418,  668,  803,  207,  801,  755,  290,  861,  413,  724,  824,  995,  915,  905,
+     456,  322, 1021,  438,  430,  443,  102,  435,  836,  313,  536,  675,  148,  183,  341,  726,
+      99,  556,  352,  564,  114,  379,  752,  241,  927, 1002,  303,  382,   88,  610,  681,  747,
+     266,  390,   32, 1009,  756,  580,  940,  356,  798,  218,   56,   69,  829,  353,  302,  979,
+     305,  333,  440, 1016,  158,  797,  821,  219, 1006,  716,  652,   25,  985,  173,  953,  240,
+     365,  407,  150,   95,  736,  646,  682,  875,  900,  669,  103,  991,  525,  235,  375,  348,
+     441,  739,   98,   66,  316,  189,  813,  140,  111,  559,  476,   87,  319,  242,  929,  988,
+     575,  996, 1022,  721,  491,  784,  774,  686,  203,  453,   15,  155,  144,  912,  370,  612,
+     633,  347,  932,  702,  571,  468,  489,  854,  526,  999,  488,  772,  853,  982,  606,  928,
+     722,  472,  936,  480,  197,  852,  152,  676,  428,  673,  286,  761,  503,  907,  788,  108,
+     693,  827,  504,  137,  546,  902,  799,  888, 1007,  730,  483,  684,  600,  880,    6,  262,
+     964,  177,  565,  255,  791,    0,  567,  787,  591, 1001,    4,  828,  298,   82,  782,  734,
+     329,  947,   12,  124,  282,  956,  497,   44,  187,  397,  678,  182,  659,  381,  865,  388,
+     971,  540,  106,   80,   30,  978,  792,  436,  664,  690,  277,  494,  457,  968,  696,  910,
+      46,  455,  346,  607,   61,  582,  317,  314,  562,  268,  238,  657,  671,  498,  539,  952,
+     404,  236,  423,  981,  506,  332,  552,  725,  444,  808,  537,  117,  704,  192,  206,  909,
+      17,  882,  748,  906,  163,  431,  412,  634,  135,  992,  467,  105,  205,  125,  898,  708,
+     260,  427,  917,  588,  679,  327,  983,  369,  735,  904,  894,  942,   41,  890,  216,  908,
+     717,  923,  399,   33,  267,  123,  866,  166,  168,    5,  211,   94,  394,  259,  666,  553,
+      53,  380,  744,  920,  507,  161,  492,  284,  816,   57,   51,  845,  605,  170,  980,  157,
+     437,   26,   27,  274,  185,  514,   59,  164,  602,   39,  250,  762,  989,  285,   11,  243,
+     911,  107,  118,  272,  987, 1014,   97,   58,  186,  500,   31,  426, 1000,  961,  121,  229,
+     825,  793,  665,  451,  226,  645,   42, 1003,  638,  831,  555,  838,  343,  136,  533,  299,
+     740,  344,  360,  683,  432,  251,  635,  122,  328,  220,  781,  385,  833,  595,  626,  884,
+     832,  715,  549,  449,  534,  398,  165,  849,  750,  324,    7,  689,  622,  883,  561,  860,
+     261,  442,  420,  959,  368,   29,  473,  809,  198,  581,  773,   21,  374,  131,   54, 1023,
+     710,  760,  842,  642,  387,   67,  993, 1019,  713,  517,  545,  637,  288,  850,  930,   92,
+     357,  574,  291,  521,  126,    1,  650,  712,  179, 1011,   16,  422,  551,  656,  475,  406,
+     663,   14,  945,  661,  256,  276,   48,  377,  768,  576,  811,  283,  204,  417,   49,  775,
+     349,  839,  970,  275,  878,   34,  957, 1015,  542,  171,   18, 1017,  338,    3,  181,  415,
+     618,  254,  822, 1012,   55,  529,  557,  511,  301,  190,  864,   19,  597,  815,  608,  958,
+     490,  946,  887,  779,  134,  758,  466,  292,  378,  201,   86,  586,  391,  128,  145,  840,
+     547,  401, 1018,  230,  636,  460,   81,  667,  997,  753, 1004,  548,  587,  892,  297,  212,
+     358,   43,  998,  174,  820,  891,  141,  817,  180,  481,  737,  339,  563,  215,  871,  538,
+     990,  795,   79,   90,  351,  233,  501,  615,  104,  278,  308,  876,  584,  934,  410,  487,
+     445,  786,  653,   85,  210,  194,  469,   45,  133,  477,  770,  213,  520,  749,  837,  967,
+     589,  901,  434,  149,  530,    9,  720,  812,  701,  330,  162,  402,  933,  516,  454,  879,
+     986,  485,  885,  225,  244,  227,  569,  916,  508,  767,  962,  603,   72,  599,  396,  175,
+     310,  867,  478,  732,  331,  746,  965,  855,  535,  790,  919,  151,  273,   20,  367,  479,
+     924,  814,  949,  623,  486,  641,  745,  856,  598,   62,  221,  629,  613,  658,  515,  270,
+     295,  655,  411,  405,  550,  202,  474,  208,  200,  566,  156,  271,  688, 1010,  354,  127,
+      28,  593,  763,  806,  130,  280,  217,  424,  785,  780,  544,  309,  777,   96,   68,  895,
+     115,  609,  570,  948,  307,  731,  400,  393,  714,  361,  922,  619,  807,  281,  249,  631,
+     765,  191,  359,   70,  496,  337,   76,  897,  941,  579,  512,  604,  524,  502,   10, 1013,
+     138,  624,  433,  321,  709,  960,  293,  616,  300,  142,  188,  625,  495,  944,  648,  800,
+     195,  153,  805,  199,  893,  886,  224,  823,   36,  963,  644,  160,   13,  966,  223,  977,
+     628,  950,  685,  931,  572,  340,  719,  315,  541,  577, 1005,  269,  974,  751,  830,  674,
+     461,  232,  543,  176,  334,  320,  193,  938,   23,  818,  711,  691,  627,  323,  573,  859,
+      60,  935,  366,  630,  789,  583,  896,  578,  294,  147,  835,  874,  464,  899,   78,  723,
+     172,  759,  698,   73,  139,  869,  209,  680,  643,  222,  568,  810,  743,  509,  336,  100,
+     703,  253,  214,  304,  363,  826,  769,  257,  419,  778,  914,  614,  857,  414,  258,    8,
+     518,  951,  371,  110,  373,  447,  695, 1020,  620,  237,  617,  706,  505,  697,  794,  184
+};
 
-static void RE_NOISE_INIT_1024(void)
+/* Kept for source compatibility: the table is constant, there is nothing to initialize. */
+RE_INLINE void RE_NOISE_INIT_1024(void)
 {
-    if (RE_NOISE_TABLE_INITED) return;
-    RE_NOISE_TABLE_INITED = RE_TRUE;
-
-    /* Fill with 0..1023 */
-    for (int i = 0; i < RE_NOISE_TABLE_SIZE; i++)
-        RE_NOISE_PERM_1024[i] = (RE_u16)i;
-
-    /* Shuffle */
-    for (int i = RE_NOISE_TABLE_SIZE-1; i > 0; i--) {
-        RE_u32 r = RE_PCG_MIX32((RE_u32)i * 1664525u);
-        int j = (r % (i+1));
-        RE_u16 tmp = RE_NOISE_PERM_1024[i];
-        RE_NOISE_PERM_1024[i] = RE_NOISE_PERM_1024[j];
-        RE_NOISE_PERM_1024[j] = tmp;
-    }
-
-    /* Duplicate */
-    for (int i = 0; i < RE_NOISE_TABLE_SIZE; i++)
-        RE_NOISE_PERM_1024[i + RE_NOISE_TABLE_SIZE] = RE_NOISE_PERM_1024[i];
 }
 
 RE_INLINE RE_u32 RE_HASH3D(RE_i32 x, RE_i32 y, RE_i32 z)
 {
-    if (!RE_NOISE_TABLE_INITED) RE_NOISE_INIT_1024();
-
     RE_u32 idx =
         RE_NOISE_PERM_1024[x & (RE_NOISE_TABLE_SIZE-1)] +
         RE_NOISE_PERM_1024[y & (RE_NOISE_TABLE_SIZE-1)] +
@@ -148,25 +226,42 @@ RE_INLINE RE_u32 RE_HASH3D(RE_i32 x, RE_i32 y, RE_i32 z)
 
 #endif
 
+/* ================================================================================================
+   MODE 3 — TABLELESS HASH
+   Every lattice coordinate goes through RE_PCG_MIX32: no gathers, so the SIMD kernels hash
+   with integer multiplies, and the noise does not repeat every 256 units.
+   ================================================================================================ */
+
+#if RE_NOISE_HASH_MODE == 3
+
+#define RE_HASH3D_MAX 255
+
+RE_INLINE RE_u32 RE_HASH3D(RE_i32 x, RE_i32 y, RE_i32 z)
+{
+    return RE_HASH3D_PCG(x, y, z) & 255u;
+}
+
+#endif
+
 /* ================================================================================================
    FLOAT VERSIONS
    ================================================================================================ */
 
 RE_INLINE RE_f32 RE_HASH3D_to_f32(RE_i32 x, RE_i32 y, RE_i32 z)
 {
-    return (RE_f32)(RE_HASH3D(x,y,z)) * (1.0f / 255.0f);
+    return (RE_f32)(RE_HASH3D(x,y,z)) * (1.0f / (RE_f32)RE_HASH3D_MAX);
 }
 
 RE_INLINE RE_f64 RE_HASH3D_to_f64(RE_i32 x, RE_i32 y, RE_i32 z)
 {
-    return (RE_f64)(RE_HASH3D(x,y,z)) * (1.0 / 255.0);
+    return (RE_f64)(RE_HASH3D(x,y,z)) * (1.0 / (RE_f64)RE_HASH3D_MAX);
 }
 
 /*
     REMath Noise Common
     -------------------
     Shared core utilities for all noise functions:
-    - SIMD detection
+    - SIMD detection (re_simd_detect.h)
     - Permutation table
     - Fade curve
     - Fast floor
@@ -174,43 +269,32 @@ RE_INLINE RE_f64 RE_HASH3D_to_f64(RE_i32 x, RE_i32 y, RE_i32 z)
     - Hashing
 */
 
-/* ============================================================================================
-   SIMD DETECTION
-   ============================================================================================ */
-
-#if defined(__AVX__)
-    #define RE_SIMD_AVX 1
-#elif defined(__SSE2__) || defined(_MSC_VER)
-    #define RE_SIMD_SSE 1
-#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
-    #define RE_SIMD_NEON 1
-#else
-    #define RE_SIMD_NONE 1
-#endif
-
-
 /* ============================================================================================
    PERMUTATION TABLE (Ken Perlin's 256 perm)
+   Kept as an X-macro so the context tables below are built from the same list at compile time.
    ============================================================================================ */
 
-static const RE_u8 RE_NOISE_PERM[256] = {
-    151,160,137,91,90,15,131,13,201,95,96,53,194,233,7,225,
-    140,36,103,30,69,142,8,99,37,240,21,10,23,190, 6,148,
-    247,120,234,75, 0,26,197,62,94,252,219,203,117,35,11,32,
-     57,177,33,88,237,149,56,87,174,20,125,136,171,168, 68,175,
-     74,165,71,134,139,48,27,166, 77,146,158,231,83,111,229,122,
-     60,211,133,230,220,105, 92, 41, 55, 46,245, 40,244,102,143,54,
-     65, 25, 63,161, 1,216, 80, 73,209, 76,132,187,208, 89, 18,169,
-    200,196,135,130,116,188,159, 86,164,100,109,198,173,186, 3, 64,
-     52,217,226,250,124,123, 5,202, 38,147,118,126,255, 82, 85,212,
-    207,206, 59,227, 47, 16, 58, 17,182,189, 28, 42,223,183,170,213,
-    119,248,152,  2, 44,154,163, 70,221,153,101,155,167, 43,172, 9,
-    129, 22, 39,253, 19, 98,108,110, 79,113,224,232,178,185,112,104,
-    218,246, 97,228,251, 34,242,193,238,210,144, 12,191,179,162,241,
-     81, 51,145,235,249, 14,239,107, 49,192,214, 31,181,199,106,157,
-    184, 84,204,176,115,121, 50, 45,127,  4,150,254,138,236,205, 93,
-    222,114, 67, 29, 24, 72,243,141,128,195, 78, 66,215, 61,156,180
-};
+#define RE_NOISE_PERM_LIST(X) \
+    X(151) X(160) X(137) X( 91) X( 90) X( 15) X(131) X( 13) X(201) X( 95) X( 96) X( 53) X(194) X(233) X(  7) X(225) \
+    X(140) X( 36) X(103) X( 30) X( 69) X(142) X(  8) X( 99) X( 37) X(240) X( 21) X( 10) X( 23) X(190) X(  6) X(148) \
+    X(247) X(120) X(234) X( 75) X(  0) X( 26) X(197) X( 62) X( 94) X(252) X(219) X(203) X(117) X( 35) X( 11) X( 32) \
+    X( 57) X(177) X( 33) X( 88) X(237) X(149) X( 56) X( 87) X(174) X( 20) X(125) X(136) X(171) X(168) X( 68) X(175) \
+    X( 74) X(165) X( 71) X(134) X(139) X( 48) X( 27) X(166) X( 77) X(146) X(158) X(231) X( 83) X(111) X(229) X(122) \
+    X( 60) X(211) X(133) X(230) X(220) X(105) X( 92) X( 41) X( 55) X( 46) X(245) X( 40) X(244) X(102) X(143) X( 54) \
+    X( 65) X( 25) X( 63) X(161) X(  1) X(216) X( 80) X( 73) X(209) X( 76) X(132) X(187) X(208) X( 89) X( 18) X(169) \
+    X(200) X(196) X(135) X(130) X(116) X(188) X(159) X( 86) X(164) X(100) X(109) X(198) X(173) X(186) X(  3) X( 64) \
+    X( 52) X(217) X(226) X(250) X(124) X(123) X(  5) X(202) X( 38) X(147) X(118) X(126) X(255) X( 82) X( 85) X(212) \
+    X(207) X(206) X( 59) X(227) X( 47) X( 16) X( 58) X( 17) X(182) X(189) X( 28) X( 42) X(223) X(183) X(170) X(213) \
+    X(119) X(248) X(152) X(  2) X( 44) X(154) X(163) X( 70) X(221) X(153) X(101) X(155) X(167) X( 43) X(172) X(  9) \
+    X(129) X( 22) X( 39) X(253) X( 19) X( 98) X(108) X(110) X( 79) X(113) X(224) X(232) X(178) X(185) X(112) X(104) \
+    X(218) X(246) X( 97) X(228) X(251) X( 34) X(242) X(193) X(238) X(210) X(144) X( 12) X(191) X(179) X(162) X(241) \
+    X( 81) X( 51) X(145) X(235) X(249) X( 14) X(239) X(107) X( 49) X(192) X(214) X( 31) X(181) X(199) X(106) X(157) \
+    X(184) X( 84) X(204) X(176) X(115) X(121) X( 50) X( 45) X(127) X(  4) X(150) X(254) X(138) X(236) X(205) X( 93) \
+    X(222) X(114) X( 67) X( 29) X( 24) X( 72) X(243) X(141) X(128) X(195) X( 78) X( 66) X(215) X( 61) X(156) X(180)
+
+#define RE_NOISE_PERM_ENTRY(v)  v,
+
+static const RE_u8 RE_NOISE_PERM[256] = { RE_NOISE_PERM_LIST(RE_NOISE_PERM_ENTRY) };
 
 
 /* ============================================================================================
@@ -230,6 +314,18 @@ RE_INLINE RE_i64 RE_FASTFLOOR_f64(RE_f64 x)
     return (x < (RE_f64)xi) ? (xi - 1) : xi;
 }
 
+/* 64-bit lattice coordinate → 32-bit hash input. The identity on the RE_i32 range, so f64
+   noise matches f32 there; beyond it the high word is mixed in instead of truncated away,
+   so cells 2^32 apart do not alias. Fold every corner separately: FOLD(X + 1) is not
+   FOLD(X) + 1 across a 2^31 boundary. */
+RE_INLINE RE_i32 RE_NOISE_FOLD_i64(RE_i64 v)
+{
+    RE_u64 u  = (RE_u64)v;
+    RE_u32 lo = (RE_u32)u;
+    RE_u32 hi = (RE_u32)(u >> 32) + (lo >> 31);    /* 0 when v is a sign-extended RE_i32 */
+    return (RE_i32)(lo + hi * 0x9e3779b9u);
+}
+
 
 /* ============================================================================================
    FADE FUNCTION (Perlin S-curve)
@@ -246,6 +342,13 @@ RE_INLINE RE_f64 RE_NOISE_FADE_f64(RE_f64 t)
     return t * t * t * (t * (t * 6.0 - 15.0) + 10.0);
 }
 
+/* f'(t) = 30t^2 (t - 1)^2 */
+RE_INLINE RE_f32 RE_NOISE_FADE_DERIV_f32(RE_f32 t)
+{
+    RE_f32 s = t * (t - 1.f);
+    return 30.f * s * s;
+}
+
 
 /* ============================================================================================
    LERP
@@ -266,6 +369,25 @@ RE_INLINE RE_f64 RE_NOISE_LERP_f64(RE_f64 a, RE_f64 b, RE_f64 t)
    HASH FUNCTION
    ============================================================================================ */
 
+#if RE_NOISE_HASH_MODE == 3
+
+RE_INLINE RE_u8 RE_NOISE_HASH(RE_i32 x)
+{
+    return (RE_u8)RE_HASH3D_PCG(x, 0, 0);
+}
+
+RE_INLINE RE_u8 RE_NOISE_HASH2(RE_i32 x, RE_i32 y)
+{
+    return (RE_u8)RE_HASH3D_PCG(x, y, 0);
+}
+
+RE_INLINE RE_u8 RE_NOISE_HASH3(RE_i32 x, RE_i32 y, RE_i32 z)
+{
+    return (RE_u8)RE_HASH3D_PCG(x, y, z);
+}
+
+#else
+
 RE_INLINE RE_u8 RE_NOISE_HASH(RE_i32 x)
 {
     return RE_NOISE_PERM[(RE_u8)x];
@@ -281,6 +403,8 @@ RE_INLINE RE_u8 RE_NOISE_HASH3(RE_i32 x, RE_i32 y, RE_i32 z)
     return RE_NOISE_PERM[(RE_NOISE_HASH2(x, y) + z) & 255];
 }
 
+#endif
+
 
 /* ============================================================================================
    GRADIENTS
@@ -299,6 +423,13 @@ static const RE_i8 RE_NOISE_GRAD3[12][3] = {
     { 0, 1, 1},{ 0,-1, 1},{ 0, 1,-1},{ 0,-1,-1}
 };
 
+/* RE_NOISE_GRAD3 as doubles, rows padded to 4 for aligned 2-wide loads (f64 SIMD Perlin) */
+RE_ALIGN(16) static const RE_f64 RE_NOISE_GRAD3_f64[12][4] = {
+    { 1, 1, 0, 0},{-1, 1, 0, 0},{ 1,-1, 0, 0},{-1,-1, 0, 0},
+    { 1, 0, 1, 0},{-1, 0, 1, 0},{ 1, 0,-1, 0},{-1, 0,-1, 0},
+    { 0, 1, 1, 0},{ 0,-1, 1, 0},{ 0, 1,-1, 0},{ 0,-1,-1, 0}
+};
+
 /* 4D gradient table (Simplex) */
 static const RE_i8 RE_NOISE_GRAD4[32][4] = {
     {0,1,1,1},{0,1,1,-1},{0,1,-1,1},{0,1,-1,-1},
@@ -311,6 +442,128 @@ static const RE_i8 RE_NOISE_GRAD4[32][4] = {
     {-1,1,1,0},{-1,1,-1,0},{-1,-1,1,0},{-1,-1,-1,0}
 };
 
+/* ============================================================================================
+   NOISE CONTEXT (seedable tables)
+   --------------------------------------------------------------------------------------------
+   Every noise function has a context-taking twin (RE_NOISE_<NAME>_CTX_<sfx>) that hashes
+   through the context instead of the fixed globals. The context-free functions run on
+   RE_NOISE_DEFAULT_CONTEXT (seed 0 = Ken Perlin's table), so both produce identical output.
+
+     perm   seed-shuffled permutation, duplicated to 512 entries:
+            perm[perm[x & 255] + (y & 255)] needs no masking of the sum
+     grad3  perm[i] % 12, the 3D gradient index for the same slot
+     seed   also salts the tableless OpenSimplex2 hash
+
+   The context is read-only once initialized, so one context per seed can be shared by any
+   number of threads, and threads with different seeds never touch shared mutable state.
+   ============================================================================================ */
+
+typedef struct RE_NOISE_CONTEXT_t {
+    RE_ALIGN(64) RE_u8 perm[512];
+    RE_ALIGN(64) RE_u8 grad3[512];
+    RE_u32 seed;
+} RE_NOISE_CONTEXT;
+
+#define RE_NOISE_GRAD3_ENTRY(v) ((v) % 12),
+
+static const RE_NOISE_CONTEXT RE_NOISE_DEFAULT_CONTEXT = {
+    { RE_NOISE_PERM_LIST(RE_NOISE_PERM_ENTRY)  RE_NOISE_PERM_LIST(RE_NOISE_PERM_ENTRY)  },
+    { RE_NOISE_PERM_LIST(RE_NOISE_GRAD3_ENTRY) RE_NOISE_PERM_LIST(RE_NOISE_GRAD3_ENTRY) },
+    0u
+};
+
+/**
+ * @brief Build the tables for `seed`. Seed 0 reproduces the built-in permutation.
+ */
+RE_INLINE void RE_NOISE_CONTEXT_INIT(RE_NOISE_CONTEXT *ctx, RE_u32 seed)
+{
+    ctx->seed = seed;
+
+    for (int i = 0; i < 256; i++)
+        ctx->perm[i] = (seed == 0u) ? RE_NOISE_PERM[i] : (RE_u8)i;
+
+    /* Fisher–Yates driven by a PCG-mixed Weyl sequence */
+    if (seed != 0u)
+    {
+        RE_u32 s = seed;
+        for (int i = 255; i > 0; i--)
+        {
+            s = RE_PCG_MIX32(s + 0x9e3779b9u);
+            int j = (int)(s % (RE_u32)(i + 1));
+
+            RE_u8 tmp    = ctx->perm[i];
+            ctx->perm[i] = ctx->perm[j];
+            ctx->perm[j] = tmp;
+        }
+    }
+
+    for (int i = 0; i < 256; i++)
+    {
+        ctx->perm[i + 256]  = ctx->perm[i];
+        ctx->grad3[i]       = (RE_u8)(ctx->perm[i] % 12);
+        ctx->grad3[i + 256] = ctx->grad3[i];
+    }
+}
+
+#if RE_NOISE_HASH_MODE == 3
+
+/* Tableless: the context only contributes its seed */
+RE_INLINE RE_u8 RE_NOISE_CTX_HASH(const RE_NOISE_CONTEXT *ctx, RE_i32 x)
+{
+    return (RE_u8)RE_HASH3D_PCG_SEED(ctx->seed, x, 0, 0);
+}
+
+RE_INLINE RE_u8 RE_NOISE_CTX_HASH2(const RE_NOISE_CONTEXT *ctx, RE_i32 x, RE_i32 y)
+{
+    return (RE_u8)RE_HASH3D_PCG_SEED(ctx->seed, x, y, 0);
+}
+
+RE_INLINE RE_u8 RE_NOISE_CTX_HASH3(const RE_NOISE_CONTEXT *ctx, RE_i32 x, RE_i32 y, RE_i32 z)
+{
+    return (RE_u8)RE_HASH3D_PCG_SEED(ctx->seed, x, y, z);
+}
+
+RE_INLINE RE_u8 RE_NOISE_CTX_HASH4(const RE_NOISE_CONTEXT *ctx, RE_i32 x, RE_i32 y, RE_i32 z, RE_i32 w)
+{
+    return (RE_u8)RE_HASH4D_PCG_SEED(ctx->seed, x, y, z, w);
+}
+
+RE_INLINE RE_u8 RE_NOISE_CTX_GRAD3(const RE_NOISE_CONTEXT *ctx, RE_i32 x, RE_i32 y, RE_i32 z)
+{
+    return RE_HASH_TO_GRAD12(RE_HASH3D_PCG_SEED(ctx->seed, x, y, z));
+}
+
+#else
+
+RE_INLINE RE_u8 RE_NOISE_CTX_HASH(const RE_NOISE_CONTEXT *ctx, RE_i32 x)
+{
+    return ctx->perm[x & 255];
+}
+
+RE_INLINE RE_u8 RE_NOISE_CTX_HASH2(const RE_NOISE_CONTEXT *ctx, RE_i32 x, RE_i32 y)
+{
+    return ctx->perm[ctx->perm[x & 255] + (y & 255)];
+}
+
+RE_INLINE RE_u8 RE_NOISE_CTX_HASH3(const RE_NOISE_CONTEXT *ctx, RE_i32 x, RE_i32 y, RE_i32 z)
+{
+    return ctx->perm[RE_NOISE_CTX_HASH2(ctx, x, y) + (z & 255)];
+}
+
+RE_INLINE RE_u8 RE_NOISE_CTX_HASH4(const RE_NOISE_CONTEXT *ctx,
+                                   RE_i32 x, RE_i32 y, RE_i32 z, RE_i32 w)
+{
+    return ctx->perm[RE_NOISE_CTX_HASH3(ctx, x, y, z) + (w & 255)];
+}
+
+/* 3D gradient index (0..11) of lattice point (x,y,z) — HASH3 % 12 without the modulo */
+RE_INLINE RE_u8 RE_NOISE_CTX_GRAD3(const RE_NOISE_CONTEXT *ctx, RE_i32 x, RE_i32 y, RE_i32 z)
+{
+    return ctx->grad3[RE_NOISE_CTX_HASH2(ctx, x, y) + (z & 255)];
+}
+
+#endif
+
 /*
     REMath – Value Noise (2D / 3D / 4D)
     -----------------------------------
@@ -343,7 +596,7 @@ RE_INLINE RE_f64 RE_NOISE_VALUE_FROM_HASH_f64(RE_u8 h)
    VALUE NOISE — 2D
    ============================================================================================ */
 
-RE_INLINE RE_f32 RE_NOISE_VALUE2_f32(RE_f32 x, RE_f32 y)
+RE_INLINE RE_f32 RE_NOISE_VALUE2_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y)
 {
     RE_i32 X = RE_FASTFLOOR_f32(x);
     RE_i32 Y = RE_FASTFLOOR_f32(y);
@@ -354,10 +607,10 @@ RE_INLINE RE_f32 RE_NOISE_VALUE2_f32(RE_f32 x, RE_f32 y)
     RE_f32 u = RE_NOISE_FADE_f32(fx);
     RE_f32 v = RE_NOISE_FADE_f32(fy);
 
-    RE_f32 a  = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH2(X,   Y));
-    RE_f32 b  = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH2(X+1, Y));
-    RE_f32 c  = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH2(X,   Y+1));
-    RE_f32 d  = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH2(X+1, Y+1));
+    RE_f32 a  = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X,   Y));
+    RE_f32 b  = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X+1, Y));
+    RE_f32 c  = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X,   Y+1));
+    RE_f32 d  = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X+1, Y+1));
 
     RE_f32 i1 = RE_NOISE_LERP_f32(a, b, u);
     RE_f32 i2 = RE_NOISE_LERP_f32(c, d, u);
@@ -365,7 +618,12 @@ RE_INLINE RE_f32 RE_NOISE_VALUE2_f32(RE_f32 x, RE_f32 y)
     return RE_NOISE_LERP_f32(i1, i2, v);
 }
 
-RE_INLINE RE_f64 RE_NOISE_VALUE2_f64(RE_f64 x, RE_f64 y)
+RE_INLINE RE_f32 RE_NOISE_VALUE2_f32(RE_f32 x, RE_f32 y)
+{
+    return RE_NOISE_VALUE2_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
+RE_INLINE RE_f64 RE_NOISE_VALUE2_CTX_f64(const RE_NOISE_CONTEXT *ctx, RE_f64 x, RE_f64 y)
 {
     RE_i64 X = RE_FASTFLOOR_f64(x);
     RE_i64 Y = RE_FASTFLOOR_f64(y);
@@ -376,10 +634,13 @@ RE_INLINE RE_f64 RE_NOISE_VALUE2_f64(RE_f64 x, RE_f64 y)
     RE_f64 u = RE_NOISE_FADE_f64(fx);
     RE_f64 v = RE_NOISE_FADE_f64(fy);
 
-    RE_f64 a = RE_NOISE_VALUE_FROM_HASH_f64(RE_NOISE_HASH2((RE_i32)X,   (RE_i32)Y));
-    RE_f64 b = RE_NOISE_VALUE_FROM_HASH_f64(RE_NOISE_HASH2((RE_i32)X+1, (RE_i32)Y));
-    RE_f64 c = RE_NOISE_VALUE_FROM_HASH_f64(RE_NOISE_HASH2((RE_i32)X,   (RE_i32)Y+1));
-    RE_f64 d = RE_NOISE_VALUE_FROM_HASH_f64(RE_NOISE_HASH2((RE_i32)X+1, (RE_i32)Y+1));
+    RE_i32 X0 = RE_NOISE_FOLD_i64(X), X1 = RE_NOISE_FOLD_i64(X + 1);
+    RE_i32 Y0 = RE_NOISE_FOLD_i64(Y), Y1 = RE_NOISE_FOLD_i64(Y + 1);
+
+    RE_f64 a = RE_NOISE_VALUE_FROM_HASH_f64(RE_NOISE_CTX_HASH2(ctx, X0, Y0));
+    RE_f64 b = RE_NOISE_VALUE_FROM_HASH_f64(RE_NOISE_CTX_HASH2(ctx, X1, Y0));
+    RE_f64 c = RE_NOISE_VALUE_FROM_HASH_f64(RE_NOISE_CTX_HASH2(ctx, X0, Y1));
+    RE_f64 d = RE_NOISE_VALUE_FROM_HASH_f64(RE_NOISE_CTX_HASH2(ctx, X1, Y1));
 
     RE_f64 i1 = RE_NOISE_LERP_f64(a, b, u);
     RE_f64 i2 = RE_NOISE_LERP_f64(c, d, u);
@@ -387,11 +648,16 @@ RE_INLINE RE_f64 RE_NOISE_VALUE2_f64(RE_f64 x, RE_f64 y)
     return RE_NOISE_LERP_f64(i1, i2, v);
 }
 
+RE_INLINE RE_f64 RE_NOISE_VALUE2_f64(RE_f64 x, RE_f64 y)
+{
+    return RE_NOISE_VALUE2_CTX_f64(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
 /* ============================================================================================
    VALUE NOISE — 3D
    ============================================================================================ */
 
-RE_INLINE RE_f32 RE_NOISE_VALUE3_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+RE_INLINE RE_f32 RE_NOISE_VALUE3_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y, RE_f32 z)
 {
     RE_i32 X = RE_FASTFLOOR_f32(x);
     RE_i32 Y = RE_FASTFLOOR_f32(y);
@@ -405,15 +671,15 @@ RE_INLINE RE_f32 RE_NOISE_VALUE3_f32(RE_f32 x, RE_f32 y, RE_f32 z)
     RE_f32 v = RE_NOISE_FADE_f32(fy);
     RE_f32 w = RE_NOISE_FADE_f32(fz);
 
-    RE_f32 c000 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH3(X,   Y,   Z));
-    RE_f32 c100 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH3(X+1, Y,   Z));
-    RE_f32 c010 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH3(X,   Y+1, Z));
-    RE_f32 c110 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH3(X+1, Y+1, Z));
+    RE_f32 c000 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH3(ctx, X,   Y,   Z));
+    RE_f32 c100 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH3(ctx, X+1, Y,   Z));
+    RE_f32 c010 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH3(ctx, X,   Y+1, Z));
+    RE_f32 c110 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH3(ctx, X+1, Y+1, Z));
 
-    RE_f32 c001 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH3(X,   Y,   Z+1));
-    RE_f32 c101 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH3(X+1, Y,   Z+1));
-    RE_f32 c011 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH3(X,   Y+1, Z+1));
-    RE_f32 c111 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_HASH3(X+1, Y+1, Z+1));
+    RE_f32 c001 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH3(ctx, X,   Y,   Z+1));
+    RE_f32 c101 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH3(ctx, X+1, Y,   Z+1));
+    RE_f32 c011 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH3(ctx, X,   Y+1, Z+1));
+    RE_f32 c111 = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH3(ctx, X+1, Y+1, Z+1));
 
     RE_f32 i1 = RE_NOISE_LERP_f32(RE_NOISE_LERP_f32(c000, c100, u),
                                   RE_NOISE_LERP_f32(c010, c110, u), v);
@@ -424,16 +690,26 @@ RE_INLINE RE_f32 RE_NOISE_VALUE3_f32(RE_f32 x, RE_f32 y, RE_f32 z)
     return RE_NOISE_LERP_f32(i1, i2, w);
 }
 
+RE_INLINE RE_f32 RE_NOISE_VALUE3_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_VALUE3_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
 /* ============================================================================================
    VALUE NOISE — 4D (use hash4 = hash3 + t)
    ============================================================================================ */
 
 RE_INLINE RE_u8 RE_NOISE_HASH4(RE_i32 x, RE_i32 y, RE_i32 z, RE_i32 w)
 {
+#if RE_NOISE_HASH_MODE == 3
+    return (RE_u8)RE_HASH4D_PCG_SEED(0u, x, y, z, w);
+#else
     return RE_NOISE_PERM[(RE_NOISE_HASH3(x, y, z) + w) & 255];
+#endif
 }
 
-RE_INLINE RE_f32 RE_NOISE_VALUE4_f32(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 wv)
+RE_INLINE RE_f32 RE_NOISE_VALUE4_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                         RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 wv)
 {
     RE_i32 X = RE_FASTFLOOR_f32(x);
     RE_i32 Y = RE_FASTFLOOR_f32(y);
@@ -458,7 +734,7 @@ RE_INLINE RE_f32 RE_NOISE_VALUE4_f32(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 wv)
             for (int dx = 0; dx < 2; dx++)
                 for (int dw = 0; dw < 2; dw++)
                     accum[idx++] = RE_NOISE_VALUE_FROM_HASH_f32(
-                        RE_NOISE_HASH4(X+dx, Y+dy, Z+dz, W+dw));
+                        RE_NOISE_CTX_HASH4(ctx, X+dx, Y+dy, Z+dz, W+dw));
 
     #define L(a,b,t) RE_NOISE_LERP_f32(a,b,t)
 
@@ -475,43 +751,63 @@ RE_INLINE RE_f32 RE_NOISE_VALUE4_f32(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 wv)
     #undef L
 }
 
+RE_INLINE RE_f32 RE_NOISE_VALUE4_f32(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 wv)
+{
+    return RE_NOISE_VALUE4_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, wv);
+}
+
 /* ============================================================================================
    FRACTAL VARIANTS (FBM, TURBULENCE, RIDGED)
    ============================================================================================ */
 
-RE_INLINE RE_f32 RE_NOISE_VALUE3_FBM_f32(RE_f32 x, RE_f32 y, RE_f32 z,
-                                         int octaves, RE_f32 lac, RE_f32 gain)
+RE_INLINE RE_f32 RE_NOISE_VALUE3_FBM_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                             RE_f32 x, RE_f32 y, RE_f32 z,
+                                             int octaves, RE_f32 lac, RE_f32 gain)
 {
     RE_f32 sum = 0;
     RE_f32 amp = 1;
     for (int i=0; i<octaves; i++) {
-        sum += RE_NOISE_VALUE3_f32(x, y, z) * amp;
+        sum += RE_NOISE_VALUE3_CTX_f32(ctx, x, y, z) * amp;
         x *= lac; y *= lac; z *= lac;
         amp *= gain;
     }
     return sum;
 }
 
-RE_INLINE RE_f32 RE_NOISE_VALUE3_TURBULENCE_f32(RE_f32 x, RE_f32 y, RE_f32 z,
-                                                int octaves, RE_f32 lac, RE_f32 gain)
+RE_INLINE RE_f32 RE_NOISE_VALUE3_FBM_f32(RE_f32 x, RE_f32 y, RE_f32 z,
+                                         int octaves, RE_f32 lac, RE_f32 gain)
+{
+    return RE_NOISE_VALUE3_FBM_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, octaves, lac, gain);
+}
+
+RE_INLINE RE_f32 RE_NOISE_VALUE3_TURBULENCE_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                    RE_f32 x, RE_f32 y, RE_f32 z,
+                                                    int octaves, RE_f32 lac, RE_f32 gain)
 {
     RE_f32 sum = 0, amp = 1;
     for (int i=0; i<octaves; i++) {
-        sum += RE_FABS_f32(RE_NOISE_VALUE3_f32(x, y, z)) * amp;
+        sum += RE_FABS_f32(RE_NOISE_VALUE3_CTX_f32(ctx, x, y, z)) * amp;
         x *= lac; y *= lac; z *= lac;
         amp *= gain;
     }
     return sum;
 }
 
-RE_INLINE RE_f32 RE_NOISE_VALUE3_RIDGED_f32(RE_f32 x, RE_f32 y, RE_f32 z,
-                                            int oct, RE_f32 lac, RE_f32 gain, RE_f32 offset)
+RE_INLINE RE_f32 RE_NOISE_VALUE3_TURBULENCE_f32(RE_f32 x, RE_f32 y, RE_f32 z,
+                                                int octaves, RE_f32 lac, RE_f32 gain)
+{
+    return RE_NOISE_VALUE3_TURBULENCE_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, octaves, lac, gain);
+}
+
+RE_INLINE RE_f32 RE_NOISE_VALUE3_RIDGED_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                RE_f32 x, RE_f32 y, RE_f32 z,
+                                                int oct, RE_f32 lac, RE_f32 gain, RE_f32 offset)
 {
     RE_f32 sum = 0;
     RE_f32 amp = 0.5f;
 
     for (int i=0; i<oct; i++) {
-        RE_f32 n = RE_NOISE_VALUE3_f32(x,y,z);
+        RE_f32 n = RE_NOISE_VALUE3_CTX_f32(ctx, x,y,z);
         n = offset - RE_FABS_f32(n);
         n = n*n;
         sum += n * amp;
@@ -521,21 +817,94 @@ RE_INLINE RE_f32 RE_NOISE_VALUE3_RIDGED_f32(RE_f32 x, RE_f32 y, RE_f32 z,
     return sum;
 }
 
+RE_INLINE RE_f32 RE_NOISE_VALUE3_RIDGED_f32(RE_f32 x, RE_f32 y, RE_f32 z,
+                                            int oct, RE_f32 lac, RE_f32 gain, RE_f32 offset)
+{
+    return RE_NOISE_VALUE3_RIDGED_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, oct, lac, gain, offset);
+}
+
+/* ============================================================================================
+   PERLIN 3D — SHARED CORNER SETUP
+   Corner index c = dx + 2*dy + 4*dz, gradient index = HASH3(corner) % 12.
+   The x-row lookups (HASH(X), HASH(X+1)) and y-row lookups are shared between corners;
+   in hash mode 3 the per-axis multiplies are shared instead.
+   grad = RE_TRUE yields gradient indices (Perlin), RE_FALSE the raw HASH3 byte (value noise).
+   ============================================================================================ */
+
+/* Explicit corner coordinates: xs[d] is the lattice x of the dx = d corners (X + d, or its
+   RE_NOISE_FOLD_i64 for 64-bit lattices) */
+RE_INLINE void RE_NOISE_LATTICE3_CORNERS_AT(const RE_NOISE_CONTEXT *ctx,
+                                            const RE_i32 xs[2], const RE_i32 ys[2], const RE_i32 zs[2],
+                                            RE_i32 *out, int stride, RE_BOOL grad)
+{
+#if RE_NOISE_HASH_MODE == 3
+    RE_u32 hx[2], hy[2], hz[2];
+    for (int d = 0; d < 2; d++)
+    {
+        hx[d] = (RE_u32)xs[d] * 73856093u;
+        hy[d] = (RE_u32)ys[d] * 19349663u;
+        hz[d] = (RE_u32)zs[d] * 83492791u ^ ctx->seed * 0x9e3779b9u;
+    }
+
+    for (int c = 0; c < 8; c++)
+    {
+        RE_u32 h = RE_PCG_MIX32(hx[c & 1] ^ hy[(c >> 1) & 1] ^ hz[c >> 2]);
+        out[c * stride] = grad ? RE_HASH_TO_GRAD12(h) : (RE_i32)(h & 255u);
+    }
+#else
+    const RE_u8 *last = grad ? ctx->grad3 : ctx->perm;
+
+    for (int dx = 0; dx < 2; dx++)
+    {
+        RE_i32 a = ctx->perm[xs[dx] & 255];
+
+        for (int dy = 0; dy < 2; dy++)
+        {
+            RE_i32 b = ctx->perm[a + (ys[dy] & 255)];
+
+            out[(dx + 2*dy)     * stride] = last[b + (zs[0] & 255)];
+            out[(dx + 2*dy + 4) * stride] = last[b + (zs[1] & 255)];
+        }
+    }
+#endif
+}
+
+RE_INLINE void RE_NOISE_LATTICE3_CORNERS(const RE_NOISE_CONTEXT *ctx,
+                                         RE_i32 X, RE_i32 Y, RE_i32 Z, RE_i32 *out, int stride,
+                                         RE_BOOL grad)
+{
+    const RE_i32 xs[2] = { X, X + 1 }, ys[2] = { Y, Y + 1 }, zs[2] = { Z, Z + 1 };
+    RE_NOISE_LATTICE3_CORNERS_AT(ctx, xs, ys, zs, out, stride, grad);
+}
+
+RE_INLINE void RE_NOISE_PERLIN3_GRAD_INDICES(const RE_NOISE_CONTEXT *ctx,
+                                             RE_i32 X, RE_i32 Y, RE_i32 Z, RE_i32 *out, int stride)
+{
+    RE_NOISE_LATTICE3_CORNERS(ctx, X, Y, Z, out, stride, RE_TRUE);
+}
+
+RE_INLINE RE_f32 RE_NOISE_GRAD3_DOT_f32(RE_i32 gi, RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    const RE_i8 *g = RE_NOISE_GRAD3[gi];
+    return g[0]*x + g[1]*y + g[2]*z;
+}
+
 /* ============================================================================================
    PERLIN 3D — SCALAR VERSION (f32)
    ============================================================================================ */
 
-RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32_scalar(RE_f32 x, RE_f32 y, RE_f32 z)
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_CTX_f32_scalar(const RE_NOISE_CONTEXT *ctx,
+                                                 RE_f32 x, RE_f32 y, RE_f32 z)
 {
     /* Find unit cube origin */
-    RE_i32 X = RE_FASTFLOOR_f32(x) & 255;
-    RE_i32 Y = RE_FASTFLOOR_f32(y) & 255;
-    RE_i32 Z = RE_FASTFLOOR_f32(z) & 255;
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+    RE_i32 Z = RE_FASTFLOOR_f32(z);
 
     /* Offsets inside cube */
-    RE_f32 xf = x - (RE_f32)RE_FASTFLOOR_f32(x);
-    RE_f32 yf = y - (RE_f32)RE_FASTFLOOR_f32(y);
-    RE_f32 zf = z - (RE_f32)RE_FASTFLOOR_f32(z);
+    RE_f32 xf = x - (RE_f32)X;
+    RE_f32 yf = y - (RE_f32)Y;
+    RE_f32 zf = z - (RE_f32)Z;
 
     /* Fade */
     RE_f32 u = RE_NOISE_FADE_f32(xf);
@@ -543,117 +912,1853 @@ RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32_scalar(RE_f32 x, RE_f32 y, RE_f32 z)
     RE_f32 w = RE_NOISE_FADE_f32(zf);
 
     /* Hash cube corners */
-    RE_i32 A  = RE_NOISE_HASH2(X, Y);
-    RE_i32 AA = RE_NOISE_HASH(A + Z);
-    RE_i32 AB = RE_NOISE_HASH(A + Z + 1);
+    RE_i32 g[8];
+    RE_NOISE_PERLIN3_GRAD_INDICES(ctx, X, Y, Z, g, 1);
+
+    /* Dot products */
+    RE_f32 d000 = RE_NOISE_GRAD3_DOT_f32(g[0], xf,      yf,      zf);
+    RE_f32 d100 = RE_NOISE_GRAD3_DOT_f32(g[1], xf-1.0f, yf,      zf);
+    RE_f32 d010 = RE_NOISE_GRAD3_DOT_f32(g[2], xf,      yf-1.0f, zf);
+    RE_f32 d110 = RE_NOISE_GRAD3_DOT_f32(g[3], xf-1.0f, yf-1.0f, zf);
+    RE_f32 d001 = RE_NOISE_GRAD3_DOT_f32(g[4], xf,      yf,      zf-1.0f);
+    RE_f32 d101 = RE_NOISE_GRAD3_DOT_f32(g[5], xf-1.0f, yf,      zf-1.0f);
+    RE_f32 d011 = RE_NOISE_GRAD3_DOT_f32(g[6], xf,      yf-1.0f, zf-1.0f);
+    RE_f32 d111 = RE_NOISE_GRAD3_DOT_f32(g[7], xf-1.0f, yf-1.0f, zf-1.0f);
+
+    /* Lerp in X, then Y, then Z */
+    RE_f32 y0 = RE_NOISE_LERP_f32(RE_NOISE_LERP_f32(d000, d100, u),
+                                  RE_NOISE_LERP_f32(d010, d110, u), v);
+
+    RE_f32 y1 = RE_NOISE_LERP_f32(RE_NOISE_LERP_f32(d001, d101, u),
+                                  RE_NOISE_LERP_f32(d011, d111, u), v);
+
+    return RE_NOISE_LERP_f32(y0, y1, w);
+}
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32_scalar(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_PERLIN3_CTX_f32_scalar(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* ============================================================================================
+   ANALYTIC DERIVATIVES — VALUE 3D / PERLIN 3D
+   Value and gradient from one evaluation (one hash pass, no finite differences).
+   ============================================================================================ */
+
+RE_INLINE RE_f32 RE_NOISE_VALUE3_DERIV_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                               RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out_grad[3])
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+    RE_i32 Z = RE_FASTFLOOR_f32(z);
 
-    RE_i32 B  = RE_NOISE_HASH2(X + 1, Y);
-    RE_i32 BA = RE_NOISE_HASH(B + Z);
-    RE_i32 BB = RE_NOISE_HASH(B + Z + 1);
+    RE_f32 fx = x - (RE_f32)X;
+    RE_f32 fy = y - (RE_f32)Y;
+    RE_f32 fz = z - (RE_f32)Z;
+
+    RE_f32 u = RE_NOISE_FADE_f32(fx), du = RE_NOISE_FADE_DERIV_f32(fx);
+    RE_f32 v = RE_NOISE_FADE_f32(fy), dv = RE_NOISE_FADE_DERIV_f32(fy);
+    RE_f32 w = RE_NOISE_FADE_f32(fz), dw = RE_NOISE_FADE_DERIV_f32(fz);
+
+    RE_i32 h[8];
+    RE_NOISE_LATTICE3_CORNERS(ctx, X, Y, Z, h, 1, RE_FALSE);
+
+    RE_f32 c[8];
+    for (int i = 0; i < 8; i++)
+        c[i] = RE_NOISE_VALUE_FROM_HASH_f32((RE_u8)h[i]);
+
+    /* n = k0 + k1 u + k2 v + k3 w + k4 uv + k5 vw + k6 wu + k7 uvw */
+    RE_f32 k0 = c[0];
+    RE_f32 k1 = c[1] - c[0];
+    RE_f32 k2 = c[2] - c[0];
+    RE_f32 k3 = c[4] - c[0];
+    RE_f32 k4 = c[0] - c[1] - c[2] + c[3];
+    RE_f32 k5 = c[0] - c[2] - c[4] + c[6];
+    RE_f32 k6 = c[0] - c[1] - c[4] + c[5];
+    RE_f32 k7 = -c[0] + c[1] + c[2] - c[3] + c[4] - c[5] - c[6] + c[7];
+
+    out_grad[0] = du * (k1 + k4 * v + k6 * w + k7 * v * w);
+    out_grad[1] = dv * (k2 + k5 * w + k4 * u + k7 * w * u);
+    out_grad[2] = dw * (k3 + k6 * u + k5 * v + k7 * u * v);
+
+    return k0 + k1 * u + k2 * v + k3 * w + k4 * u * v + k5 * v * w + k6 * w * u + k7 * u * v * w;
+}
 
-    /* Select gradients */
-    #define G3(h) RE_NOISE_GRAD3[(h) % 12]
+RE_INLINE RE_f32 RE_NOISE_VALUE3_DERIV_f32(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out_grad[3])
+{
+    return RE_NOISE_VALUE3_DERIV_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out_grad);
+}
 
-    /* Dot products */
-    RE_f32 x1,y1,z1;
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_DERIV_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out_grad[3])
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+    RE_i32 Z = RE_FASTFLOOR_f32(z);
 
-    const RE_i8 *gAA = G3(AA);
-    x1 = xf;   y1 = yf;   z1 = zf;
-    RE_f32 dotAA = gAA[0]*x1 + gAA[1]*y1 + gAA[2]*z1;
+    RE_f32 p[2][3];
+    p[0][0] = x - (RE_f32)X;  p[1][0] = p[0][0] - 1.f;
+    p[0][1] = y - (RE_f32)Y;  p[1][1] = p[0][1] - 1.f;
+    p[0][2] = z - (RE_f32)Z;  p[1][2] = p[0][2] - 1.f;
 
-    const RE_i8 *gBA = G3(BA);
-    x1 = xf-1; y1 = yf;   z1 = zf;
-    RE_f32 dotBA = gBA[0]*x1 + gBA[1]*y1 + gBA[2]*z1;
+    /* Per-axis weights for the low (0) and high (1) corner and their derivatives */
+    RE_f32 a[2][3], da[2][3];
+    for (int k = 0; k < 3; k++)
+    {
+        RE_f32 f  = RE_NOISE_FADE_f32(p[0][k]);
+        RE_f32 df = RE_NOISE_FADE_DERIV_f32(p[0][k]);
+        a[0][k] = 1.f - f;  da[0][k] = -df;
+        a[1][k] = f;        da[1][k] =  df;
+    }
 
-    const RE_i8 *gAB = G3(AB);
-    x1 = xf;   y1 = yf-1; z1 = zf;
-    RE_f32 dotAB = gAB[0]*x1 + gAB[1]*y1 + gAB[2]*z1;
+    RE_i32 gi[8];
+    RE_NOISE_PERLIN3_GRAD_INDICES(ctx, X, Y, Z, gi, 1);
 
-    const RE_i8 *gBB = G3(BB);
-    x1 = xf-1; y1 = yf-1; z1 = zf;
-    RE_f32 dotBB = gBB[0]*x1 + gBB[1]*y1 + gBB[2]*z1;
+    RE_f32 n = 0.f, gx = 0.f, gy = 0.f, gz = 0.f;
+    for (int c = 0; c < 8; c++)
+    {
+        int ix = c & 1, iy = (c >> 1) & 1, iz = c >> 2;
 
-    /* Lerp in X */
-    RE_f32 xLerp1 = RE_NOISE_LERP_f32(dotAA, dotBA, u);
-    RE_f32 xLerp2 = RE_NOISE_LERP_f32(dotAB, dotBB, u);
+        const RE_i8 *g = RE_NOISE_GRAD3[gi[c]];
+        RE_f32 d = g[0] * p[ix][0] + g[1] * p[iy][1] + g[2] * p[iz][2];
 
-    /* Lerp Y */
-    RE_f32 yLerp  = RE_NOISE_LERP_f32(xLerp1, xLerp2, v);
+        RE_f32 wx = a[ix][0], wy = a[iy][1], wz = a[iz][2];
+        RE_f32 W  = wx * wy * wz;
 
-    /* Lerp Z */
-    return RE_NOISE_LERP_f32(yLerp,
-           RE_NOISE_LERP_f32(
-                RE_NOISE_LERP_f32(
-                    gAA[0]*(xf  ) + gAA[1]*(yf  ) + gAA[2]*(zf-1),
-                    gBA[0]*(xf-1) + gBA[1]*(yf  ) + gBA[2]*(zf-1), u),
-                RE_NOISE_LERP_f32(
-                    gAB[0]*(xf  ) + gAB[1]*(yf-1) + gAB[2]*(zf-1),
-                    gBB[0]*(xf-1) + gBB[1]*(yf-1) + gBB[2]*(zf-1), u),
-               v),
-            w);
+        /* d(W d) = W g + d dW */
+        n  += W * d;
+        gx += W * g[0] + d * da[ix][0] * wy * wz;
+        gy += W * g[1] + d * wx * da[iy][1] * wz;
+        gz += W * g[2] + d * wx * wy * da[iz][2];
+    }
+
+    out_grad[0] = gx;
+    out_grad[1] = gy;
+    out_grad[2] = gz;
+    return n;
+}
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_DERIV_f32(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out_grad[3])
+{
+    return RE_NOISE_PERLIN3_DERIV_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out_grad);
 }
 
 
 /* ============================================================================================
    SIMD IMPLEMENTATIONS
+   Hashing is a per-lane table gather (modes 1/2) or an in-register PCG hash (mode 3);
+   everything else runs in lanes:
+     - X4 / X8 kernels evaluate 4 / 8 sample points per call
+     - single-point versions evaluate the 8 cube corners in parallel lanes
+   Gradient dot without a table:
+     gi 0..3 → ±x ±y,  4..7 → ±x ±z,  8..11 → ±y ±z
+     bit 0 negates the first term, bit 1 negates the second
    ============================================================================================ */
 
-#if defined(RE_SIMD_SSE)
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
 
 #include <xmmintrin.h>
 #include <emmintrin.h>
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
 
-/* SSE Version — Only accelerates fade/lerp/dots */
-RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32_sse(RE_f32 x, RE_f32 y, RE_f32 z)
+RE_INLINE __m128i RE_NOISE_FLOOR_X4_f32_sse(__m128 x, __m128 *out_floor)
 {
-    /* Fall back to scalar for hashing + gradient selection */
-    return RE_NOISE_PERLIN3_f32_scalar(x,y,z);
+    __m128i xi = _mm_cvttps_epi32(x);
+    __m128  xt = _mm_cvtepi32_ps(xi);
+    __m128  m  = _mm_cmplt_ps(x, xt);        /* truncated upwards (negative input) */
+
+    *out_floor = _mm_sub_ps(xt, _mm_and_ps(m, _mm_set1_ps(1.0f)));
+    return _mm_add_epi32(xi, _mm_castps_si128(m));
 }
 
-#endif /* SSE */
+RE_INLINE __m128 RE_NOISE_FADE_X4_f32_sse(__m128 t)
+{
+    __m128 p = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)),
+                                                   _mm_set1_ps(15.0f))),
+                          _mm_set1_ps(10.0f));
+    return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), p);
+}
 
+RE_INLINE __m128 RE_NOISE_LERP_X4_f32_sse(__m128 a, __m128 b, __m128 t)
+{
+    return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+}
 
-#if defined(RE_SIMD_AVX)
+/* Low 32 bits of a 32x32 multiply. SSE2 only has the even-lane 32x32->64 form. */
+RE_INLINE __m128i RE_MULLO_X4_u32_sse(__m128i a, __m128i b)
+{
+#if defined(__SSE4_1__)
+    return _mm_mullo_epi32(a, b);
+#else
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd,  _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+}
 
-#include <immintrin.h>
+RE_INLINE __m128i RE_PCG_MIX32_X4_sse(__m128i x)
+{
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+    x = RE_MULLO_X4_u32_sse(x, _mm_set1_epi32((int)0x7feb352du));
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 15));
+    x = RE_MULLO_X4_u32_sse(x, _mm_set1_epi32((int)0x846ca68bu));
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+    return x;
+}
 
-/* AVX Version — same logic as SSE, scalar for hashing */
-RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32_avx(RE_f32 x, RE_f32 y, RE_f32 z)
+/* Lane-wise RE_HASH3D_PCG_SEED */
+RE_INLINE __m128i RE_HASH3D_PCG_SEED_X4_sse(RE_u32 seed, __m128i x, __m128i y, __m128i z)
 {
-    return RE_NOISE_PERLIN3_f32_scalar(x,y,z);
+    __m128i h = _mm_xor_si128(RE_MULLO_X4_u32_sse(x, _mm_set1_epi32(73856093)),
+                              RE_MULLO_X4_u32_sse(y, _mm_set1_epi32(19349663)));
+    h = _mm_xor_si128(h, RE_MULLO_X4_u32_sse(z, _mm_set1_epi32(83492791)));
+    h = _mm_xor_si128(h, _mm_set1_epi32((int)(seed * 0x9e3779b9u)));
+    return RE_PCG_MIX32_X4_sse(h);
 }
 
-#endif /* AVX */
+/* Lane-wise RE_HASH_TO_GRAD12: (h >> 16) * 12 >> 16, the multiply by 12 as two shifts */
+RE_INLINE __m128i RE_HASH_TO_GRAD12_X4_sse(__m128i h)
+{
+    __m128i t = _mm_srli_epi32(h, 16);
+    t = _mm_add_epi32(_mm_slli_epi32(t, 3), _mm_slli_epi32(t, 2));
+    return _mm_srli_epi32(t, 16);
+}
+
+/* Hash-mode-3 corner hashes from explicit corner coordinates (X0 = X, X1 = X + 1 or folded) */
+RE_INLINE void RE_NOISE_PCG_CORNERS3_X4_sse(const RE_NOISE_CONTEXT *ctx,
+                                            __m128i X0, __m128i X1, __m128i Y0, __m128i Y1,
+                                            __m128i Z0, __m128i Z1, RE_i32 *gi, int stride, RE_BOOL grad)
+{
+    __m128i sm = _mm_set1_epi32((int)(ctx->seed * 0x9e3779b9u));
+
+    __m128i hx[2], hy[2], hz[2];
+    hx[0] = RE_MULLO_X4_u32_sse(X0, _mm_set1_epi32(73856093));
+    hy[0] = RE_MULLO_X4_u32_sse(Y0, _mm_set1_epi32(19349663));
+    hz[0] = RE_MULLO_X4_u32_sse(Z0, _mm_set1_epi32(83492791));
+    hx[1] = RE_MULLO_X4_u32_sse(X1, _mm_set1_epi32(73856093));
+    hy[1] = RE_MULLO_X4_u32_sse(Y1, _mm_set1_epi32(19349663));
+    hz[1] = RE_MULLO_X4_u32_sse(Z1, _mm_set1_epi32(83492791));
+    hz[0] = _mm_xor_si128(hz[0], sm);
+    hz[1] = _mm_xor_si128(hz[1], sm);
+
+    for (int c = 0; c < 8; c++)
+    {
+        __m128i h = _mm_xor_si128(_mm_xor_si128(hx[c & 1], hy[(c >> 1) & 1]), hz[c >> 2]);
+        h = RE_PCG_MIX32_X4_sse(h);
+        h = grad ? RE_HASH_TO_GRAD12_X4_sse(h) : _mm_and_si128(h, _mm_set1_epi32(255));
+        _mm_storeu_si128((__m128i *)(gi + c * stride), h);
+    }
+}
+
+/* Corner hashes of 4 cells → gi[corner * stride + lane] (see RE_NOISE_LATTICE3_CORNERS) */
+RE_INLINE void RE_NOISE_LATTICE3_CORNERS_X4_sse(const RE_NOISE_CONTEXT *ctx,
+                                                __m128i X, __m128i Y, __m128i Z,
+                                                RE_i32 *gi, int stride, RE_BOOL grad)
+{
+#if RE_NOISE_HASH_MODE == 3
+    __m128i one = _mm_set1_epi32(1);
+    RE_NOISE_PCG_CORNERS3_X4_sse(ctx, X, _mm_add_epi32(X, one), Y, _mm_add_epi32(Y, one),
+                                 Z, _mm_add_epi32(Z, one), gi, stride, grad);
+#else
+    RE_i32 Xs[4], Ys[4], Zs[4];
+    _mm_storeu_si128((__m128i *)Xs, X);
+    _mm_storeu_si128((__m128i *)Ys, Y);
+    _mm_storeu_si128((__m128i *)Zs, Z);
+
+    for (int l = 0; l < 4; l++)
+        RE_NOISE_LATTICE3_CORNERS(ctx, Xs[l], Ys[l], Zs[l], gi + l, stride, grad);
+#endif
+}
+
+RE_INLINE void RE_NOISE_GRAD3_MASKS_X4_sse(__m128i gi,
+                                           __m128 *use_x, __m128 *use_y,
+                                           __m128 *sign_u, __m128 *sign_v)
+{
+    *use_x  = _mm_castsi128_ps(_mm_cmplt_epi32(gi, _mm_set1_epi32(8)));
+    *use_y  = _mm_castsi128_ps(_mm_cmplt_epi32(gi, _mm_set1_epi32(4)));
+    *sign_u = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(gi, _mm_set1_epi32(1)), 31));
+    *sign_v = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(gi, _mm_set1_epi32(2)), 30));
+}
+
+RE_INLINE __m128 RE_NOISE_GRAD3_DOT_X4_sse(__m128i gi, __m128 x, __m128 y, __m128 z)
+{
+    __m128 use_x, use_y, sign_u, sign_v;
+    RE_NOISE_GRAD3_MASKS_X4_sse(gi, &use_x, &use_y, &sign_u, &sign_v);
+
+    __m128 u = _mm_or_ps(_mm_and_ps(use_x, x), _mm_andnot_ps(use_x, y));
+    __m128 v = _mm_or_ps(_mm_and_ps(use_y, y), _mm_andnot_ps(use_y, z));
+
+    return _mm_add_ps(_mm_xor_ps(u, sign_u), _mm_xor_ps(v, sign_v));
+}
+
+/* 4 points per call */
+RE_INLINE __m128 RE_NOISE_PERLIN3_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx,
+                                                 __m128 x, __m128 y, __m128 z)
+{
+    __m128 fx, fy, fz;
+    __m128i X = RE_NOISE_FLOOR_X4_f32_sse(x, &fx);
+    __m128i Y = RE_NOISE_FLOOR_X4_f32_sse(y, &fy);
+    __m128i Z = RE_NOISE_FLOOR_X4_f32_sse(z, &fz);
+
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 x0 = _mm_sub_ps(x, fx), x1 = _mm_sub_ps(x0, one);
+    __m128 y0 = _mm_sub_ps(y, fy), y1 = _mm_sub_ps(y0, one);
+    __m128 z0 = _mm_sub_ps(z, fz), z1 = _mm_sub_ps(z0, one);
+
+    __m128 u = RE_NOISE_FADE_X4_f32_sse(x0);
+    __m128 v = RE_NOISE_FADE_X4_f32_sse(y0);
+    __m128 w = RE_NOISE_FADE_X4_f32_sse(z0);
+
+    /* Per-corner gradient indices → gi[corner * 4 + lane] */
+    RE_i32 gi[8 * 4];
+    RE_NOISE_LATTICE3_CORNERS_X4_sse(ctx, X, Y, Z, gi, 4, RE_TRUE);
+
+    #define G(c) _mm_loadu_si128((const __m128i *)(gi + (c) * 4))
+
+    __m128 d000 = RE_NOISE_GRAD3_DOT_X4_sse(G(0), x0, y0, z0);
+    __m128 d100 = RE_NOISE_GRAD3_DOT_X4_sse(G(1), x1, y0, z0);
+    __m128 d010 = RE_NOISE_GRAD3_DOT_X4_sse(G(2), x0, y1, z0);
+    __m128 d110 = RE_NOISE_GRAD3_DOT_X4_sse(G(3), x1, y1, z0);
+    __m128 d001 = RE_NOISE_GRAD3_DOT_X4_sse(G(4), x0, y0, z1);
+    __m128 d101 = RE_NOISE_GRAD3_DOT_X4_sse(G(5), x1, y0, z1);
+    __m128 d011 = RE_NOISE_GRAD3_DOT_X4_sse(G(6), x0, y1, z1);
+    __m128 d111 = RE_NOISE_GRAD3_DOT_X4_sse(G(7), x1, y1, z1);
+
+    #undef G
+
+    __m128 l0 = RE_NOISE_LERP_X4_f32_sse(RE_NOISE_LERP_X4_f32_sse(d000, d100, u),
+                                         RE_NOISE_LERP_X4_f32_sse(d010, d110, u), v);
+    __m128 l1 = RE_NOISE_LERP_X4_f32_sse(RE_NOISE_LERP_X4_f32_sse(d001, d101, u),
+                                         RE_NOISE_LERP_X4_f32_sse(d011, d111, u), v);
+
+    return RE_NOISE_LERP_X4_f32_sse(l0, l1, w);
+}
+
+RE_INLINE __m128 RE_NOISE_PERLIN3_X4_f32_sse(__m128 x, __m128 y, __m128 z)
+{
+    return RE_NOISE_PERLIN3_X4_CTX_f32_sse(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* Value noise, 4 points per call */
+RE_INLINE __m128 RE_NOISE_VALUE3_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx,
+                                                __m128 x, __m128 y, __m128 z)
+{
+    __m128 fx, fy, fz;
+    __m128i X = RE_NOISE_FLOOR_X4_f32_sse(x, &fx);
+    __m128i Y = RE_NOISE_FLOOR_X4_f32_sse(y, &fy);
+    __m128i Z = RE_NOISE_FLOOR_X4_f32_sse(z, &fz);
+
+    __m128 u = RE_NOISE_FADE_X4_f32_sse(_mm_sub_ps(x, fx));
+    __m128 v = RE_NOISE_FADE_X4_f32_sse(_mm_sub_ps(y, fy));
+    __m128 w = RE_NOISE_FADE_X4_f32_sse(_mm_sub_ps(z, fz));
+
+    RE_i32 h[8 * 4];
+    RE_NOISE_LATTICE3_CORNERS_X4_sse(ctx, X, Y, Z, h, 4, RE_FALSE);
+
+    __m128 scale = _mm_set1_ps(1.0f / 127.5f);
+    __m128 one   = _mm_set1_ps(1.0f);
+
+    #define C(c) _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(h + (c) * 4))), \
+                                       scale), one)
+
+    __m128 l0 = RE_NOISE_LERP_X4_f32_sse(RE_NOISE_LERP_X4_f32_sse(C(0), C(1), u),
+                                         RE_NOISE_LERP_X4_f32_sse(C(2), C(3), u), v);
+    __m128 l1 = RE_NOISE_LERP_X4_f32_sse(RE_NOISE_LERP_X4_f32_sse(C(4), C(5), u),
+                                         RE_NOISE_LERP_X4_f32_sse(C(6), C(7), u), v);
+
+    #undef C
+
+    return RE_NOISE_LERP_X4_f32_sse(l0, l1, w);
+}
+
+RE_INLINE __m128 RE_NOISE_VALUE3_X4_f32_sse(__m128 x, __m128 y, __m128 z)
+{
+    return RE_NOISE_VALUE3_X4_CTX_f32_sse(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* Single point — the four (x,y) corners live in lanes, one register per z plane */
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx,
+                                              RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+    RE_i32 Z = RE_FASTFLOOR_f32(z);
+
+    RE_f32 xf = x - (RE_f32)X;
+    RE_f32 yf = y - (RE_f32)Y;
+    RE_f32 zf = z - (RE_f32)Z;
+
+    RE_i32 gi[8];
+    RE_NOISE_PERLIN3_GRAD_INDICES(ctx, X, Y, Z, gi, 1);
+
+    __m128 px = _mm_setr_ps(xf, xf - 1.0f, xf,        xf - 1.0f);
+    __m128 py = _mm_setr_ps(yf, yf,        yf - 1.0f, yf - 1.0f);
+
+    __m128 d0 = RE_NOISE_GRAD3_DOT_X4_sse(_mm_loadu_si128((const __m128i *)(gi + 0)),
+                                          px, py, _mm_set1_ps(zf));
+    __m128 d1 = RE_NOISE_GRAD3_DOT_X4_sse(_mm_loadu_si128((const __m128i *)(gi + 4)),
+                                          px, py, _mm_set1_ps(zf - 1.0f));
+
+    /* Lerp Z for all four columns, then X pairwise (lane 0 / lane 2) */
+    __m128 dz = RE_NOISE_LERP_X4_f32_sse(d0, d1, _mm_set1_ps(RE_NOISE_FADE_f32(zf)));
+    __m128 dx = RE_NOISE_LERP_X4_f32_sse(dz, _mm_shuffle_ps(dz, dz, _MM_SHUFFLE(2, 3, 0, 1)),
+                                         _mm_set1_ps(RE_NOISE_FADE_f32(xf)));
+
+    RE_f32 r[4];
+    _mm_storeu_ps(r, dx);
+
+    /* Lerp Y */
+    return RE_NOISE_LERP_f32(r[0], r[2], RE_NOISE_FADE_f32(yf));
+}
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32_sse(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_PERLIN3_CTX_f32_sse(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+#endif /* SSE */
+
+
+#if defined(RE_SIMD_AVX)
+
+#include <immintrin.h>
+
+RE_INLINE __m256 RE_NOISE_FADE_X8_f32_avx(__m256 t)
+{
+    __m256 p = _mm256_add_ps(_mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)),
+                                                            _mm256_set1_ps(15.0f))),
+                             _mm256_set1_ps(10.0f));
+    return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), p);
+}
+
+RE_INLINE __m256 RE_NOISE_LERP_X8_f32_avx(__m256 a, __m256 b, __m256 t)
+{
+    return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+}
+
+#if defined(__AVX2__)
+
+RE_INLINE __m256i RE_PCG_MIX32_X8_avx2(__m256i x)
+{
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+    x = _mm256_mullo_epi32(x, _mm256_set1_epi32((int)0x7feb352du));
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 15));
+    x = _mm256_mullo_epi32(x, _mm256_set1_epi32((int)0x846ca68bu));
+    x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 16));
+    return x;
+}
+
+/* Lane-wise RE_HASH3D_PCG_SEED */
+RE_INLINE __m256i RE_HASH3D_PCG_SEED_X8_avx2(RE_u32 seed, __m256i x, __m256i y, __m256i z)
+{
+    __m256i h = _mm256_xor_si256(_mm256_mullo_epi32(x, _mm256_set1_epi32(73856093)),
+                                 _mm256_mullo_epi32(y, _mm256_set1_epi32(19349663)));
+    h = _mm256_xor_si256(h, _mm256_mullo_epi32(z, _mm256_set1_epi32(83492791)));
+    h = _mm256_xor_si256(h, _mm256_set1_epi32((int)(seed * 0x9e3779b9u)));
+    return RE_PCG_MIX32_X8_avx2(h);
+}
+
+RE_INLINE __m256i RE_HASH_TO_GRAD12_X8_avx2(__m256i h)
+{
+    __m256i t = _mm256_srli_epi32(h, 16);
+    t = _mm256_add_epi32(_mm256_slli_epi32(t, 3), _mm256_slli_epi32(t, 2));
+    return _mm256_srli_epi32(t, 16);
+}
+
+#endif
+
+/* Corner hashes of 8 cells → gi[corner * 8 + lane] (see RE_NOISE_LATTICE3_CORNERS) */
+RE_INLINE void RE_NOISE_LATTICE3_CORNERS_X8_avx(const RE_NOISE_CONTEXT *ctx,
+                                                __m256i X, __m256i Y, __m256i Z,
+                                                RE_i32 *gi, RE_BOOL grad)
+{
+#if RE_NOISE_HASH_MODE == 3 && defined(__AVX2__)
+    __m256i one = _mm256_set1_epi32(1);
+    __m256i sm  = _mm256_set1_epi32((int)(ctx->seed * 0x9e3779b9u));
+
+    __m256i hx[2], hy[2], hz[2];
+    hx[0] = _mm256_mullo_epi32(X, _mm256_set1_epi32(73856093));
+    hy[0] = _mm256_mullo_epi32(Y, _mm256_set1_epi32(19349663));
+    hz[0] = _mm256_mullo_epi32(Z, _mm256_set1_epi32(83492791));
+    hx[1] = _mm256_mullo_epi32(_mm256_add_epi32(X, one), _mm256_set1_epi32(73856093));
+    hy[1] = _mm256_mullo_epi32(_mm256_add_epi32(Y, one), _mm256_set1_epi32(19349663));
+    hz[1] = _mm256_mullo_epi32(_mm256_add_epi32(Z, one), _mm256_set1_epi32(83492791));
+    hz[0] = _mm256_xor_si256(hz[0], sm);
+    hz[1] = _mm256_xor_si256(hz[1], sm);
+
+    for (int c = 0; c < 8; c++)
+    {
+        __m256i h = _mm256_xor_si256(_mm256_xor_si256(hx[c & 1], hy[(c >> 1) & 1]), hz[c >> 2]);
+        h = RE_PCG_MIX32_X8_avx2(h);
+        h = grad ? RE_HASH_TO_GRAD12_X8_avx2(h) : _mm256_and_si256(h, _mm256_set1_epi32(255));
+        _mm256_storeu_si256((__m256i *)(gi + c * 8), h);
+    }
+#else
+    /* AVX1: 128-bit integer halves */
+    RE_NOISE_LATTICE3_CORNERS_X4_sse(ctx, _mm256_castsi256_si128(X), _mm256_castsi256_si128(Y),
+                                     _mm256_castsi256_si128(Z), gi, 8, grad);
+    RE_NOISE_LATTICE3_CORNERS_X4_sse(ctx, _mm256_extractf128_si256(X, 1),
+                                     _mm256_extractf128_si256(Y, 1),
+                                     _mm256_extractf128_si256(Z, 1), gi + 4, 8, grad);
+#endif
+}
+
+/* AVX1 has no 256-bit integer ops: the lane masks are built from two SSE halves */
+RE_INLINE __m256 RE_NOISE_GRAD3_DOT_X8_avx(const RE_i32 gi[8], __m256 x, __m256 y, __m256 z)
+{
+    __m128 ux0, uy0, su0, sv0;
+    __m128 ux1, uy1, su1, sv1;
+    RE_NOISE_GRAD3_MASKS_X4_sse(_mm_loadu_si128((const __m128i *)(gi + 0)), &ux0, &uy0, &su0, &sv0);
+    RE_NOISE_GRAD3_MASKS_X4_sse(_mm_loadu_si128((const __m128i *)(gi + 4)), &ux1, &uy1, &su1, &sv1);
+
+    #define M256(lo, hi) _mm256_insertf128_ps(_mm256_castps128_ps256(lo), (hi), 1)
+
+    __m256 use_x  = M256(ux0, ux1);
+    __m256 use_y  = M256(uy0, uy1);
+    __m256 sign_u = M256(su0, su1);
+    __m256 sign_v = M256(sv0, sv1);
+
+    #undef M256
+
+    __m256 u = _mm256_blendv_ps(y, x, use_x);
+    __m256 v = _mm256_blendv_ps(z, y, use_y);
+
+    return _mm256_add_ps(_mm256_xor_ps(u, sign_u), _mm256_xor_ps(v, sign_v));
+}
+
+/* 8 points per call */
+RE_INLINE __m256 RE_NOISE_PERLIN3_X8_CTX_f32_avx(const RE_NOISE_CONTEXT *ctx,
+                                                 __m256 x, __m256 y, __m256 z)
+{
+    __m256 fx = _mm256_floor_ps(x);
+    __m256 fy = _mm256_floor_ps(y);
+    __m256 fz = _mm256_floor_ps(z);
+
+    __m256 one = _mm256_set1_ps(1.0f);
+    __m256 x0 = _mm256_sub_ps(x, fx), x1 = _mm256_sub_ps(x0, one);
+    __m256 y0 = _mm256_sub_ps(y, fy), y1 = _mm256_sub_ps(y0, one);
+    __m256 z0 = _mm256_sub_ps(z, fz), z1 = _mm256_sub_ps(z0, one);
+
+    __m256 u = RE_NOISE_FADE_X8_f32_avx(x0);
+    __m256 v = RE_NOISE_FADE_X8_f32_avx(y0);
+    __m256 w = RE_NOISE_FADE_X8_f32_avx(z0);
+
+    /* Per-corner gradient indices → gi[corner * 8 + lane] */
+    RE_i32 gi[8 * 8];
+    RE_NOISE_LATTICE3_CORNERS_X8_avx(ctx, _mm256_cvttps_epi32(fx), _mm256_cvttps_epi32(fy),
+                                     _mm256_cvttps_epi32(fz), gi, RE_TRUE);
+
+    __m256 d000 = RE_NOISE_GRAD3_DOT_X8_avx(gi + 0*8, x0, y0, z0);
+    __m256 d100 = RE_NOISE_GRAD3_DOT_X8_avx(gi + 1*8, x1, y0, z0);
+    __m256 d010 = RE_NOISE_GRAD3_DOT_X8_avx(gi + 2*8, x0, y1, z0);
+    __m256 d110 = RE_NOISE_GRAD3_DOT_X8_avx(gi + 3*8, x1, y1, z0);
+    __m256 d001 = RE_NOISE_GRAD3_DOT_X8_avx(gi + 4*8, x0, y0, z1);
+    __m256 d101 = RE_NOISE_GRAD3_DOT_X8_avx(gi + 5*8, x1, y0, z1);
+    __m256 d011 = RE_NOISE_GRAD3_DOT_X8_avx(gi + 6*8, x0, y1, z1);
+    __m256 d111 = RE_NOISE_GRAD3_DOT_X8_avx(gi + 7*8, x1, y1, z1);
+
+    __m256 l0 = RE_NOISE_LERP_X8_f32_avx(RE_NOISE_LERP_X8_f32_avx(d000, d100, u),
+                                         RE_NOISE_LERP_X8_f32_avx(d010, d110, u), v);
+    __m256 l1 = RE_NOISE_LERP_X8_f32_avx(RE_NOISE_LERP_X8_f32_avx(d001, d101, u),
+                                         RE_NOISE_LERP_X8_f32_avx(d011, d111, u), v);
+
+    return RE_NOISE_LERP_X8_f32_avx(l0, l1, w);
+}
+
+RE_INLINE __m256 RE_NOISE_PERLIN3_X8_f32_avx(__m256 x, __m256 y, __m256 z)
+{
+    return RE_NOISE_PERLIN3_X8_CTX_f32_avx(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* Value noise, 8 points per call */
+RE_INLINE __m256 RE_NOISE_VALUE3_X8_CTX_f32_avx(const RE_NOISE_CONTEXT *ctx,
+                                                __m256 x, __m256 y, __m256 z)
+{
+    __m256 fx = _mm256_floor_ps(x);
+    __m256 fy = _mm256_floor_ps(y);
+    __m256 fz = _mm256_floor_ps(z);
+
+    __m256 u = RE_NOISE_FADE_X8_f32_avx(_mm256_sub_ps(x, fx));
+    __m256 v = RE_NOISE_FADE_X8_f32_avx(_mm256_sub_ps(y, fy));
+    __m256 w = RE_NOISE_FADE_X8_f32_avx(_mm256_sub_ps(z, fz));
+
+    RE_i32 h[8 * 8];
+    RE_NOISE_LATTICE3_CORNERS_X8_avx(ctx, _mm256_cvttps_epi32(fx), _mm256_cvttps_epi32(fy),
+                                     _mm256_cvttps_epi32(fz), h, RE_FALSE);
+
+    __m256 scale = _mm256_set1_ps(1.0f / 127.5f);
+    __m256 one   = _mm256_set1_ps(1.0f);
+
+    #define C(c) _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(                              \
+                     _mm256_loadu_si256((const __m256i *)(h + (c) * 8))), scale), one)
+
+    __m256 l0 = RE_NOISE_LERP_X8_f32_avx(RE_NOISE_LERP_X8_f32_avx(C(0), C(1), u),
+                                         RE_NOISE_LERP_X8_f32_avx(C(2), C(3), u), v);
+    __m256 l1 = RE_NOISE_LERP_X8_f32_avx(RE_NOISE_LERP_X8_f32_avx(C(4), C(5), u),
+                                         RE_NOISE_LERP_X8_f32_avx(C(6), C(7), u), v);
+
+    #undef C
+
+    return RE_NOISE_LERP_X8_f32_avx(l0, l1, w);
+}
+
+RE_INLINE __m256 RE_NOISE_VALUE3_X8_f32_avx(__m256 x, __m256 y, __m256 z)
+{
+    return RE_NOISE_VALUE3_X8_CTX_f32_avx(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* Single point — all 8 cube corners in one register (low half z, high half z+1) */
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_CTX_f32_avx(const RE_NOISE_CONTEXT *ctx,
+                                              RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+    RE_i32 Z = RE_FASTFLOOR_f32(z);
+
+    RE_f32 xf = x - (RE_f32)X;
+    RE_f32 yf = y - (RE_f32)Y;
+    RE_f32 zf = z - (RE_f32)Z;
+
+    RE_i32 gi[8];
+    RE_NOISE_PERLIN3_GRAD_INDICES(ctx, X, Y, Z, gi, 1);
+
+    __m256 px = _mm256_setr_ps(xf, xf - 1.0f, xf, xf - 1.0f, xf, xf - 1.0f, xf, xf - 1.0f);
+    __m256 py = _mm256_setr_ps(yf, yf, yf - 1.0f, yf - 1.0f, yf, yf, yf - 1.0f, yf - 1.0f);
+    __m256 pz = _mm256_setr_ps(zf, zf, zf, zf, zf - 1.0f, zf - 1.0f, zf - 1.0f, zf - 1.0f);
+
+    __m256 d = RE_NOISE_GRAD3_DOT_X8_avx(gi, px, py, pz);
+
+    __m128 dz = RE_NOISE_LERP_X4_f32_sse(_mm256_castps256_ps128(d), _mm256_extractf128_ps(d, 1),
+                                         _mm_set1_ps(RE_NOISE_FADE_f32(zf)));
+    __m128 dx = RE_NOISE_LERP_X4_f32_sse(dz, _mm_shuffle_ps(dz, dz, _MM_SHUFFLE(2, 3, 0, 1)),
+                                         _mm_set1_ps(RE_NOISE_FADE_f32(xf)));
+
+    RE_f32 r[4];
+    _mm_storeu_ps(r, dx);
+
+    return RE_NOISE_LERP_f32(r[0], r[2], RE_NOISE_FADE_f32(yf));
+}
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32_avx(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_PERLIN3_CTX_f32_avx(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+#endif /* AVX */
+
+
+#if defined(RE_SIMD_NEON)
+
+#include <arm_neon.h>
+
+RE_INLINE int32x4_t RE_NOISE_FLOOR_X4_f32_neon(float32x4_t x, float32x4_t *out_floor)
+{
+    int32x4_t   xi = vcvtq_s32_f32(x);
+    float32x4_t xt = vcvtq_f32_s32(xi);
+    uint32x4_t  m  = vcltq_f32(x, xt);
+
+    *out_floor = vsubq_f32(xt, vbslq_f32(m, vdupq_n_f32(1.0f), vdupq_n_f32(0.0f)));
+    return vaddq_s32(xi, vreinterpretq_s32_u32(m));
+}
+
+RE_INLINE float32x4_t RE_NOISE_FADE_X4_f32_neon(float32x4_t t)
+{
+    float32x4_t p = vmlaq_f32(vdupq_n_f32(-15.0f), t, vdupq_n_f32(6.0f));
+    p = vmlaq_f32(vdupq_n_f32(10.0f), t, p);
+    return vmulq_f32(vmulq_f32(vmulq_f32(t, t), t), p);
+}
+
+RE_INLINE float32x4_t RE_NOISE_LERP_X4_f32_neon(float32x4_t a, float32x4_t b, float32x4_t t)
+{
+    return vmlaq_f32(a, t, vsubq_f32(b, a));
+}
+
+RE_INLINE uint32x4_t RE_PCG_MIX32_X4_neon(uint32x4_t x)
+{
+    x = veorq_u32(x, vshrq_n_u32(x, 16));
+    x = vmulq_n_u32(x, 0x7feb352du);
+    x = veorq_u32(x, vshrq_n_u32(x, 15));
+    x = vmulq_n_u32(x, 0x846ca68bu);
+    x = veorq_u32(x, vshrq_n_u32(x, 16));
+    return x;
+}
+
+/* Lane-wise RE_HASH3D_PCG_SEED */
+RE_INLINE uint32x4_t RE_HASH3D_PCG_SEED_X4_neon(RE_u32 seed, int32x4_t x, int32x4_t y, int32x4_t z)
+{
+    uint32x4_t h = veorq_u32(vmulq_n_u32(vreinterpretq_u32_s32(x), 73856093u),
+                             vmulq_n_u32(vreinterpretq_u32_s32(y), 19349663u));
+    h = veorq_u32(h, vmulq_n_u32(vreinterpretq_u32_s32(z), 83492791u));
+    h = veorq_u32(h, vdupq_n_u32(seed * 0x9e3779b9u));
+    return RE_PCG_MIX32_X4_neon(h);
+}
+
+RE_INLINE uint32x4_t RE_HASH_TO_GRAD12_X4_neon(uint32x4_t h)
+{
+    return vshrq_n_u32(vmulq_n_u32(vshrq_n_u32(h, 16), 12u), 16);
+}
+
+/* Corner hashes of 4 cells → gi[corner * 4 + lane] (see RE_NOISE_LATTICE3_CORNERS) */
+RE_INLINE void RE_NOISE_LATTICE3_CORNERS_X4_neon(const RE_NOISE_CONTEXT *ctx,
+                                                 int32x4_t X, int32x4_t Y, int32x4_t Z,
+                                                 RE_i32 *gi, RE_BOOL grad)
+{
+#if RE_NOISE_HASH_MODE == 3
+    int32x4_t one = vdupq_n_s32(1);
+    uint32x4_t sm = vdupq_n_u32(ctx->seed * 0x9e3779b9u);
+
+    uint32x4_t hx[2], hy[2], hz[2];
+    hx[0] = vmulq_n_u32(vreinterpretq_u32_s32(X), 73856093u);
+    hy[0] = vmulq_n_u32(vreinterpretq_u32_s32(Y), 19349663u);
+    hz[0] = veorq_u32(vmulq_n_u32(vreinterpretq_u32_s32(Z), 83492791u), sm);
+    hx[1] = vmulq_n_u32(vreinterpretq_u32_s32(vaddq_s32(X, one)), 73856093u);
+    hy[1] = vmulq_n_u32(vreinterpretq_u32_s32(vaddq_s32(Y, one)), 19349663u);
+    hz[1] = veorq_u32(vmulq_n_u32(vreinterpretq_u32_s32(vaddq_s32(Z, one)), 83492791u), sm);
+
+    for (int c = 0; c < 8; c++)
+    {
+        uint32x4_t h = veorq_u32(veorq_u32(hx[c & 1], hy[(c >> 1) & 1]), hz[c >> 2]);
+        h = RE_PCG_MIX32_X4_neon(h);
+        h = grad ? RE_HASH_TO_GRAD12_X4_neon(h) : vandq_u32(h, vdupq_n_u32(255u));
+        vst1q_s32(gi + c * 4, vreinterpretq_s32_u32(h));
+    }
+#else
+    RE_i32 Xs[4], Ys[4], Zs[4];
+    vst1q_s32(Xs, X);
+    vst1q_s32(Ys, Y);
+    vst1q_s32(Zs, Z);
+
+    for (int l = 0; l < 4; l++)
+        RE_NOISE_LATTICE3_CORNERS(ctx, Xs[l], Ys[l], Zs[l], gi + l, 4, grad);
+#endif
+}
+
+RE_INLINE float32x4_t RE_NOISE_GRAD3_DOT_X4_neon(int32x4_t gi, float32x4_t x, float32x4_t y, float32x4_t z)
+{
+    uint32x4_t g      = vreinterpretq_u32_s32(gi);
+    uint32x4_t use_x  = vcltq_s32(gi, vdupq_n_s32(8));
+    uint32x4_t use_y  = vcltq_s32(gi, vdupq_n_s32(4));
+    uint32x4_t sign_u = vshlq_n_u32(vandq_u32(g, vdupq_n_u32(1)), 31);
+    uint32x4_t sign_v = vshlq_n_u32(vandq_u32(g, vdupq_n_u32(2)), 30);
+
+    uint32x4_t u = veorq_u32(vreinterpretq_u32_f32(vbslq_f32(use_x, x, y)), sign_u);
+    uint32x4_t v = veorq_u32(vreinterpretq_u32_f32(vbslq_f32(use_y, y, z)), sign_v);
+
+    return vaddq_f32(vreinterpretq_f32_u32(u), vreinterpretq_f32_u32(v));
+}
+
+/* 4 points per call */
+RE_INLINE float32x4_t RE_NOISE_PERLIN3_X4_CTX_f32_neon(const RE_NOISE_CONTEXT *ctx,
+                                                      float32x4_t x, float32x4_t y, float32x4_t z)
+{
+    float32x4_t fx, fy, fz;
+    int32x4_t X = RE_NOISE_FLOOR_X4_f32_neon(x, &fx);
+    int32x4_t Y = RE_NOISE_FLOOR_X4_f32_neon(y, &fy);
+    int32x4_t Z = RE_NOISE_FLOOR_X4_f32_neon(z, &fz);
+
+    float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t x0 = vsubq_f32(x, fx), x1 = vsubq_f32(x0, one);
+    float32x4_t y0 = vsubq_f32(y, fy), y1 = vsubq_f32(y0, one);
+    float32x4_t z0 = vsubq_f32(z, fz), z1 = vsubq_f32(z0, one);
+
+    float32x4_t u = RE_NOISE_FADE_X4_f32_neon(x0);
+    float32x4_t v = RE_NOISE_FADE_X4_f32_neon(y0);
+    float32x4_t w = RE_NOISE_FADE_X4_f32_neon(z0);
+
+    RE_i32 gi[8 * 4];
+    RE_NOISE_LATTICE3_CORNERS_X4_neon(ctx, X, Y, Z, gi, RE_TRUE);
+
+    float32x4_t d000 = RE_NOISE_GRAD3_DOT_X4_neon(vld1q_s32(gi + 0*4), x0, y0, z0);
+    float32x4_t d100 = RE_NOISE_GRAD3_DOT_X4_neon(vld1q_s32(gi + 1*4), x1, y0, z0);
+    float32x4_t d010 = RE_NOISE_GRAD3_DOT_X4_neon(vld1q_s32(gi + 2*4), x0, y1, z0);
+    float32x4_t d110 = RE_NOISE_GRAD3_DOT_X4_neon(vld1q_s32(gi + 3*4), x1, y1, z0);
+    float32x4_t d001 = RE_NOISE_GRAD3_DOT_X4_neon(vld1q_s32(gi + 4*4), x0, y0, z1);
+    float32x4_t d101 = RE_NOISE_GRAD3_DOT_X4_neon(vld1q_s32(gi + 5*4), x1, y0, z1);
+    float32x4_t d011 = RE_NOISE_GRAD3_DOT_X4_neon(vld1q_s32(gi + 6*4), x0, y1, z1);
+    float32x4_t d111 = RE_NOISE_GRAD3_DOT_X4_neon(vld1q_s32(gi + 7*4), x1, y1, z1);
+
+    float32x4_t l0 = RE_NOISE_LERP_X4_f32_neon(RE_NOISE_LERP_X4_f32_neon(d000, d100, u),
+                                               RE_NOISE_LERP_X4_f32_neon(d010, d110, u), v);
+    float32x4_t l1 = RE_NOISE_LERP_X4_f32_neon(RE_NOISE_LERP_X4_f32_neon(d001, d101, u),
+                                               RE_NOISE_LERP_X4_f32_neon(d011, d111, u), v);
+
+    return RE_NOISE_LERP_X4_f32_neon(l0, l1, w);
+}
+
+RE_INLINE float32x4_t RE_NOISE_PERLIN3_X4_f32_neon(float32x4_t x, float32x4_t y, float32x4_t z)
+{
+    return RE_NOISE_PERLIN3_X4_CTX_f32_neon(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* Value noise, 4 points per call */
+RE_INLINE float32x4_t RE_NOISE_VALUE3_X4_CTX_f32_neon(const RE_NOISE_CONTEXT *ctx,
+                                                      float32x4_t x, float32x4_t y, float32x4_t z)
+{
+    float32x4_t fx, fy, fz;
+    int32x4_t X = RE_NOISE_FLOOR_X4_f32_neon(x, &fx);
+    int32x4_t Y = RE_NOISE_FLOOR_X4_f32_neon(y, &fy);
+    int32x4_t Z = RE_NOISE_FLOOR_X4_f32_neon(z, &fz);
+
+    float32x4_t u = RE_NOISE_FADE_X4_f32_neon(vsubq_f32(x, fx));
+    float32x4_t v = RE_NOISE_FADE_X4_f32_neon(vsubq_f32(y, fy));
+    float32x4_t w = RE_NOISE_FADE_X4_f32_neon(vsubq_f32(z, fz));
+
+    RE_i32 h[8 * 4];
+    RE_NOISE_LATTICE3_CORNERS_X4_neon(ctx, X, Y, Z, h, RE_FALSE);
+
+    float32x4_t one = vdupq_n_f32(1.0f);
+
+    #define C(c) vsubq_f32(vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(h + (c) * 4)), 1.0f / 127.5f), one)
+
+    float32x4_t l0 = RE_NOISE_LERP_X4_f32_neon(RE_NOISE_LERP_X4_f32_neon(C(0), C(1), u),
+                                               RE_NOISE_LERP_X4_f32_neon(C(2), C(3), u), v);
+    float32x4_t l1 = RE_NOISE_LERP_X4_f32_neon(RE_NOISE_LERP_X4_f32_neon(C(4), C(5), u),
+                                               RE_NOISE_LERP_X4_f32_neon(C(6), C(7), u), v);
+
+    #undef C
+
+    return RE_NOISE_LERP_X4_f32_neon(l0, l1, w);
+}
+
+RE_INLINE float32x4_t RE_NOISE_VALUE3_X4_f32_neon(float32x4_t x, float32x4_t y, float32x4_t z)
+{
+    return RE_NOISE_VALUE3_X4_CTX_f32_neon(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* Single point — the four (x,y) corners live in lanes, one register per z plane */
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_CTX_f32_neon(const RE_NOISE_CONTEXT *ctx,
+                                               RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+    RE_i32 Z = RE_FASTFLOOR_f32(z);
+
+    RE_f32 xf = x - (RE_f32)X;
+    RE_f32 yf = y - (RE_f32)Y;
+    RE_f32 zf = z - (RE_f32)Z;
+
+    RE_i32 gi[8];
+    RE_NOISE_PERLIN3_GRAD_INDICES(ctx, X, Y, Z, gi, 1);
+
+    const RE_f32 pxs[4] = { xf, xf - 1.0f, xf,        xf - 1.0f };
+    const RE_f32 pys[4] = { yf, yf,        yf - 1.0f, yf - 1.0f };
+    float32x4_t px = vld1q_f32(pxs);
+    float32x4_t py = vld1q_f32(pys);
+
+    float32x4_t d0 = RE_NOISE_GRAD3_DOT_X4_neon(vld1q_s32(gi + 0), px, py, vdupq_n_f32(zf));
+    float32x4_t d1 = RE_NOISE_GRAD3_DOT_X4_neon(vld1q_s32(gi + 4), px, py, vdupq_n_f32(zf - 1.0f));
+
+    float32x4_t dz = RE_NOISE_LERP_X4_f32_neon(d0, d1, vdupq_n_f32(RE_NOISE_FADE_f32(zf)));
+    float32x4_t dx = RE_NOISE_LERP_X4_f32_neon(dz, vrev64q_f32(dz), vdupq_n_f32(RE_NOISE_FADE_f32(xf)));
+
+    return RE_NOISE_LERP_f32(vgetq_lane_f32(dx, 0), vgetq_lane_f32(dx, 2), RE_NOISE_FADE_f32(yf));
+}
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32_neon(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_PERLIN3_CTX_f32_neon(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+#endif /* NEON */
+
+
+/* ============================================================================================
+   MASTER DISPATCH FUNCTION
+   ============================================================================================ */
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y, RE_f32 z)
+{
+#if defined(RE_SIMD_AVX)
+    return RE_NOISE_PERLIN3_CTX_f32_avx(ctx, x,y,z);
+#elif defined(RE_SIMD_SSE)
+    return RE_NOISE_PERLIN3_CTX_f32_sse(ctx, x,y,z);
+#elif defined(RE_SIMD_NEON)
+    return RE_NOISE_PERLIN3_CTX_f32_neon(ctx, x,y,z);
+#else
+    return RE_NOISE_PERLIN3_CTX_f32_scalar(ctx, x,y,z);
+#endif
+}
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_PERLIN3_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* ============================================================================================
+   BATCH — out[i] = PERLIN3(x[i], y[i], z[i]), widest kernel first, scalar tail
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_PERLIN3_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                              const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                              RE_f32 *out, int count)
+{
+    int i = 0;
+
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, RE_NOISE_PERLIN3_X8_CTX_f32_avx(ctx, _mm256_loadu_ps(x + i),
+                                                              _mm256_loadu_ps(y + i),
+                                                              _mm256_loadu_ps(z + i)));
+#endif
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, RE_NOISE_PERLIN3_X4_CTX_f32_sse(ctx, _mm_loadu_ps(x + i),
+                                                           _mm_loadu_ps(y + i),
+                                                           _mm_loadu_ps(z + i)));
+#elif defined(RE_SIMD_NEON)
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(out + i, RE_NOISE_PERLIN3_X4_CTX_f32_neon(ctx, vld1q_f32(x + i),
+                                                        vld1q_f32(y + i),
+                                                        vld1q_f32(z + i)));
+#endif
+
+    for (; i < count; i++)
+        out[i] = RE_NOISE_PERLIN3_CTX_f32_scalar(ctx, x[i], y[i], z[i]);
+}
+
+RE_INLINE void RE_NOISE_PERLIN3_BATCH_f32(const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                          RE_f32 *out, int count)
+{
+    RE_NOISE_PERLIN3_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out, count);
+}
+
+/* ============================================================================================
+   GRID FILL — regular 2D / 3D lattices
+   out[(k * ny + j) * nx + i] = NOISE(ox + i*sx, oy + j*sy, oz + k*sz)
+
+   Incremental evaluation: floor/fade of y and z run once per scanline, and the corner
+   hashes + gradients are only refetched when x crosses into a new cell. With y/z fixed the
+   trilinear blend collapses to a lerp in x of two per-cell linear functions:
+       A(xf) = a0 + a1 * xf          (dx = 0 face)
+       B(xf) = b0 + b1 * (xf - 1)    (dx = 1 face)
+   so a sample costs one floor, one fade and a handful of FMAs.
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_VALUE2_FILL_GRID_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 *out,
+                                                 RE_f32 ox, RE_f32 oy,
+                                                 RE_f32 sx, RE_f32 sy,
+                                                 int nx, int ny)
+{
+    for (int j = 0; j < ny; j++)
+    {
+        RE_f32 y  = oy + (RE_f32)j * sy;
+        RE_i32 Y  = RE_FASTFLOOR_f32(y);
+        RE_f32 v  = RE_NOISE_FADE_f32(y - (RE_f32)Y);
+
+        RE_f32 *row = out + (size_t)j * (size_t)nx;
+
+        RE_BOOL have_cell = RE_FALSE;
+        RE_i32  X = 0;
+        RE_f32  A = 0.0f, B = 0.0f;
+
+        for (int i = 0; i < nx; i++)
+        {
+            RE_f32 x  = ox + (RE_f32)i * sx;
+            RE_i32 Xi = RE_FASTFLOOR_f32(x);
+
+            if (!have_cell || Xi != X)
+            {
+                X = Xi;
+                have_cell = RE_TRUE;
+
+                A = RE_NOISE_LERP_f32(RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X,   Y)),
+                                      RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X,   Y+1)), v);
+                B = RE_NOISE_LERP_f32(RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X+1, Y)),
+                                      RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X+1, Y+1)), v);
+            }
+
+            row[i] = RE_NOISE_LERP_f32(A, B, RE_NOISE_FADE_f32(x - (RE_f32)X));
+        }
+    }
+}
+
+RE_INLINE void RE_NOISE_VALUE2_FILL_GRID_f32(RE_f32 *out,
+                                             RE_f32 ox, RE_f32 oy,
+                                             RE_f32 sx, RE_f32 sy,
+                                             int nx, int ny)
+{
+    RE_NOISE_VALUE2_FILL_GRID_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, out, ox, oy, sx, sy, nx, ny);
+}
+
+RE_INLINE void RE_NOISE_VALUE3_FILL_GRID_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 *out,
+                                                 RE_f32 ox, RE_f32 oy, RE_f32 oz,
+                                                 RE_f32 sx, RE_f32 sy, RE_f32 sz,
+                                                 int nx, int ny, int nz)
+{
+    for (int k = 0; k < nz; k++)
+    {
+        RE_f32 z = oz + (RE_f32)k * sz;
+        RE_i32 Z = RE_FASTFLOOR_f32(z);
+        RE_f32 w = RE_NOISE_FADE_f32(z - (RE_f32)Z);
+
+        for (int j = 0; j < ny; j++)
+        {
+            RE_f32 y = oy + (RE_f32)j * sy;
+            RE_i32 Y = RE_FASTFLOOR_f32(y);
+            RE_f32 v = RE_NOISE_FADE_f32(y - (RE_f32)Y);
+
+            /* yz bilinear weights, (dy,dz) = 00, 10, 01, 11 */
+            const RE_f32 wyz[4] = { (1.0f - v) * (1.0f - w), v * (1.0f - w),
+                                    (1.0f - v) * w,          v * w };
+
+            RE_f32 *row = out + ((size_t)k * (size_t)ny + (size_t)j) * (size_t)nx;
+
+            RE_BOOL have_cell = RE_FALSE;
+            RE_i32  X = 0;
+            RE_f32  A = 0.0f, B = 0.0f;
+
+            for (int i = 0; i < nx; i++)
+            {
+                RE_f32 x  = ox + (RE_f32)i * sx;
+                RE_i32 Xi = RE_FASTFLOOR_f32(x);
+
+                if (!have_cell || Xi != X)
+                {
+                    X = Xi;
+                    have_cell = RE_TRUE;
+                    A = B = 0.0f;
+
+                    for (int c = 0; c < 4; c++)
+                    {
+                        RE_i32 dy = c & 1, dz = c >> 1;
+                        A += wyz[c] * RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH3(ctx, X,   Y+dy, Z+dz));
+                        B += wyz[c] * RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH3(ctx, X+1, Y+dy, Z+dz));
+                    }
+                }
+
+                row[i] = RE_NOISE_LERP_f32(A, B, RE_NOISE_FADE_f32(x - (RE_f32)X));
+            }
+        }
+    }
+}
+
+RE_INLINE void RE_NOISE_VALUE3_FILL_GRID_f32(RE_f32 *out,
+                                             RE_f32 ox, RE_f32 oy, RE_f32 oz,
+                                             RE_f32 sx, RE_f32 sy, RE_f32 sz,
+                                             int nx, int ny, int nz)
+{
+    RE_NOISE_VALUE3_FILL_GRID_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, out, ox, oy, oz, sx, sy, sz, nx, ny, nz);
+}
+
+/* nz = 1 gives a 2D Perlin slice (heightmaps) at z = oz */
+RE_INLINE void RE_NOISE_PERLIN3_FILL_GRID_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 *out,
+                                                  RE_f32 ox, RE_f32 oy, RE_f32 oz,
+                                                  RE_f32 sx, RE_f32 sy, RE_f32 sz,
+                                                  int nx, int ny, int nz)
+{
+    for (int k = 0; k < nz; k++)
+    {
+        RE_f32 z  = oz + (RE_f32)k * sz;
+        RE_i32 Z  = RE_FASTFLOOR_f32(z);
+        RE_f32 zf = z - (RE_f32)Z;
+        RE_f32 w  = RE_NOISE_FADE_f32(zf);
+
+        for (int j = 0; j < ny; j++)
+        {
+            RE_f32 y  = oy + (RE_f32)j * sy;
+            RE_i32 Y  = RE_FASTFLOOR_f32(y);
+            RE_f32 yf = y - (RE_f32)Y;
+            RE_f32 v  = RE_NOISE_FADE_f32(yf);
+
+            const RE_f32 wyz[4] = { (1.0f - v) * (1.0f - w), v * (1.0f - w),
+                                    (1.0f - v) * w,          v * w };
+
+            RE_f32 *row = out + ((size_t)k * (size_t)ny + (size_t)j) * (size_t)nx;
+
+            RE_BOOL have_cell = RE_FALSE;
+            RE_i32  X = 0;
+            RE_f32  a0 = 0.0f, a1 = 0.0f, b0 = 0.0f, b1 = 0.0f;
+
+            for (int i = 0; i < nx; i++)
+            {
+                RE_f32 x  = ox + (RE_f32)i * sx;
+                RE_i32 Xi = RE_FASTFLOOR_f32(x);
+
+                if (!have_cell || Xi != X)
+                {
+                    RE_i32 g[8];
+
+                    X = Xi;
+                    have_cell = RE_TRUE;
+                    RE_NOISE_PERLIN3_GRAD_INDICES(ctx, X, Y, Z, g, 1);
+
+                    a0 = a1 = b0 = b1 = 0.0f;
+                    for (int c = 0; c < 4; c++)
+                    {
+                        RE_i32 dy = c & 1, dz = c >> 1;
+                        RE_f32 py = yf - (RE_f32)dy;
+                        RE_f32 pz = zf - (RE_f32)dz;
+
+                        const RE_i8 *ga = RE_NOISE_GRAD3[g[2*dy + 4*dz]];
+                        const RE_i8 *gb = RE_NOISE_GRAD3[g[2*dy + 4*dz + 1]];
+
+                        a1 += wyz[c] * ga[0];
+                        a0 += wyz[c] * (ga[1] * py + ga[2] * pz);
+                        b1 += wyz[c] * gb[0];
+                        b0 += wyz[c] * (gb[1] * py + gb[2] * pz);
+                    }
+                }
+
+                RE_f32 xf = x - (RE_f32)X;
+                RE_f32 A  = a0 + a1 * xf;
+                RE_f32 B  = b0 + b1 * (xf - 1.0f);
+
+                row[i] = RE_NOISE_LERP_f32(A, B, RE_NOISE_FADE_f32(xf));
+            }
+        }
+    }
+}
+
+RE_INLINE void RE_NOISE_PERLIN3_FILL_GRID_f32(RE_f32 *out,
+                                              RE_f32 ox, RE_f32 oy, RE_f32 oz,
+                                              RE_f32 sx, RE_f32 sy, RE_f32 sz,
+                                              int nx, int ny, int nz)
+{
+    RE_NOISE_PERLIN3_FILL_GRID_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, out, ox, oy, oz, sx, sy, sz, nx, ny, nz);
+}
+
+/* ============================================================================================
+   PERLIN 3D — f64
+   --------------------------------------------------------------------------------------------
+   64-bit lattice coordinates (RE_NOISE_FOLD_i64 per corner), so the field neither aliases
+   nor loses its fraction at planet-scale coordinates. Matches RE_NOISE_PERLIN3_f32_scalar
+   (to f32 rounding) wherever the lattice fits in RE_i32.
+   SIMD: 2 points per SSE2 register, 4 per AVX register. Lattice coordinates are folded per
+   lane in scalar code (no 64-bit float→int conversion below AVX-512); in hash mode 3 the
+   corner hashes then run 4 lanes wide.
+   ============================================================================================ */
+
+RE_INLINE RE_f64 RE_NOISE_GRAD3_DOT_f64(RE_i32 gi, RE_f64 x, RE_f64 y, RE_f64 z)
+{
+    const RE_i8 *g = RE_NOISE_GRAD3[gi];
+    return g[0]*x + g[1]*y + g[2]*z;
+}
+
+RE_INLINE RE_f64 RE_NOISE_PERLIN3_CTX_f64(const RE_NOISE_CONTEXT *ctx, RE_f64 x, RE_f64 y, RE_f64 z)
+{
+    RE_i64 X = RE_FASTFLOOR_f64(x);
+    RE_i64 Y = RE_FASTFLOOR_f64(y);
+    RE_i64 Z = RE_FASTFLOOR_f64(z);
+
+    RE_f64 xf = x - (RE_f64)X;
+    RE_f64 yf = y - (RE_f64)Y;
+    RE_f64 zf = z - (RE_f64)Z;
+
+    const RE_i32 xs[2] = { RE_NOISE_FOLD_i64(X), RE_NOISE_FOLD_i64(X + 1) };
+    const RE_i32 ys[2] = { RE_NOISE_FOLD_i64(Y), RE_NOISE_FOLD_i64(Y + 1) };
+    const RE_i32 zs[2] = { RE_NOISE_FOLD_i64(Z), RE_NOISE_FOLD_i64(Z + 1) };
+
+    RE_i32 g[8];
+    RE_NOISE_LATTICE3_CORNERS_AT(ctx, xs, ys, zs, g, 1, RE_TRUE);
+
+    RE_f64 d000 = RE_NOISE_GRAD3_DOT_f64(g[0], xf,       yf,       zf);
+    RE_f64 d100 = RE_NOISE_GRAD3_DOT_f64(g[1], xf - 1.0, yf,       zf);
+    RE_f64 d010 = RE_NOISE_GRAD3_DOT_f64(g[2], xf,       yf - 1.0, zf);
+    RE_f64 d110 = RE_NOISE_GRAD3_DOT_f64(g[3], xf - 1.0, yf - 1.0, zf);
+    RE_f64 d001 = RE_NOISE_GRAD3_DOT_f64(g[4], xf,       yf,       zf - 1.0);
+    RE_f64 d101 = RE_NOISE_GRAD3_DOT_f64(g[5], xf - 1.0, yf,       zf - 1.0);
+    RE_f64 d011 = RE_NOISE_GRAD3_DOT_f64(g[6], xf,       yf - 1.0, zf - 1.0);
+    RE_f64 d111 = RE_NOISE_GRAD3_DOT_f64(g[7], xf - 1.0, yf - 1.0, zf - 1.0);
+
+    RE_f64 u = RE_NOISE_FADE_f64(xf);
+    RE_f64 v = RE_NOISE_FADE_f64(yf);
+
+    RE_f64 y0 = RE_NOISE_LERP_f64(RE_NOISE_LERP_f64(d000, d100, u),
+                                  RE_NOISE_LERP_f64(d010, d110, u), v);
+    RE_f64 y1 = RE_NOISE_LERP_f64(RE_NOISE_LERP_f64(d001, d101, u),
+                                  RE_NOISE_LERP_f64(d011, d111, u), v);
+
+    return RE_NOISE_LERP_f64(y0, y1, RE_NOISE_FADE_f64(zf));
+}
+
+RE_INLINE RE_f64 RE_NOISE_PERLIN3_f64(RE_f64 x, RE_f64 y, RE_f64 z)
+{
+    return RE_NOISE_PERLIN3_CTX_f64(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+RE_INLINE __m128d RE_NOISE_FADE_X2_f64_sse(__m128d t)
+{
+    __m128d p = _mm_add_pd(_mm_mul_pd(t, _mm_sub_pd(_mm_mul_pd(t, _mm_set1_pd(6.0)), _mm_set1_pd(15.0))),
+                           _mm_set1_pd(10.0));
+    return _mm_mul_pd(_mm_mul_pd(_mm_mul_pd(t, t), t), p);
+}
+
+RE_INLINE __m128d RE_NOISE_LERP_X2_f64_sse(__m128d a, __m128d b, __m128d t)
+{
+    return _mm_add_pd(a, _mm_mul_pd(t, _mm_sub_pd(b, a)));
+}
+
+/* 2 points per call. Two lanes leave little to vectorise in the lattice step, so floors, folds
+   and hashes stay scalar per lane and the dots gather rows of RE_NOISE_GRAD3_f64 instead of
+   building select masks. */
+RE_INLINE __m128d RE_NOISE_PERLIN3_X2_CTX_f64_sse(const RE_NOISE_CONTEXT *ctx,
+                                                  __m128d x, __m128d y, __m128d z)
+{
+    RE_f64 px[2], py[2], pz[2];
+    _mm_storeu_pd(px, x);
+    _mm_storeu_pd(py, y);
+    _mm_storeu_pd(pz, z);
+
+    RE_i64 X[2], Y[2], Z[2];
+    RE_i32 gi[2][8];
+
+    for (int l = 0; l < 2; l++)
+    {
+        X[l] = RE_FASTFLOOR_f64(px[l]);
+        Y[l] = RE_FASTFLOOR_f64(py[l]);
+        Z[l] = RE_FASTFLOOR_f64(pz[l]);
+
+        const RE_i32 xs[2] = { RE_NOISE_FOLD_i64(X[l]), RE_NOISE_FOLD_i64(X[l] + 1) };
+        const RE_i32 ys[2] = { RE_NOISE_FOLD_i64(Y[l]), RE_NOISE_FOLD_i64(Y[l] + 1) };
+        const RE_i32 zs[2] = { RE_NOISE_FOLD_i64(Z[l]), RE_NOISE_FOLD_i64(Z[l] + 1) };
+        RE_NOISE_LATTICE3_CORNERS_AT(ctx, xs, ys, zs, gi[l], 1, RE_TRUE);
+    }
+
+    __m128d one = _mm_set1_pd(1.0);
+    __m128d x0 = _mm_sub_pd(x, _mm_set_pd((RE_f64)X[1], (RE_f64)X[0])), x1 = _mm_sub_pd(x0, one);
+    __m128d y0 = _mm_sub_pd(y, _mm_set_pd((RE_f64)Y[1], (RE_f64)Y[0])), y1 = _mm_sub_pd(y0, one);
+    __m128d z0 = _mm_sub_pd(z, _mm_set_pd((RE_f64)Z[1], (RE_f64)Z[0])), z1 = _mm_sub_pd(z0, one);
+
+    __m128d d[8];
+    for (int c = 0; c < 8; c++)
+    {
+        const RE_f64 *g0 = RE_NOISE_GRAD3_f64[gi[0][c]];
+        const RE_f64 *g1 = RE_NOISE_GRAD3_f64[gi[1][c]];
+        __m128d a0 = _mm_load_pd(g0), a1 = _mm_load_pd(g1);
+
+        __m128d gx = _mm_unpacklo_pd(a0, a1);
+        __m128d gy = _mm_unpackhi_pd(a0, a1);
+        __m128d gz = _mm_unpacklo_pd(_mm_load_sd(g0 + 2), _mm_load_sd(g1 + 2));
+
+        d[c] = _mm_add_pd(_mm_add_pd(_mm_mul_pd(gx, (c & 1) ? x1 : x0),
+                                     _mm_mul_pd(gy, (c & 2) ? y1 : y0)),
+                          _mm_mul_pd(gz, (c & 4) ? z1 : z0));
+    }
 
+    __m128d u = RE_NOISE_FADE_X2_f64_sse(x0);
+    __m128d v = RE_NOISE_FADE_X2_f64_sse(y0);
 
-#if defined(RE_SIMD_NEON)
+    __m128d l0 = RE_NOISE_LERP_X2_f64_sse(RE_NOISE_LERP_X2_f64_sse(d[0], d[1], u),
+                                          RE_NOISE_LERP_X2_f64_sse(d[2], d[3], u), v);
+    __m128d l1 = RE_NOISE_LERP_X2_f64_sse(RE_NOISE_LERP_X2_f64_sse(d[4], d[5], u),
+                                          RE_NOISE_LERP_X2_f64_sse(d[6], d[7], u), v);
 
-#include <arm_neon.h>
+    return RE_NOISE_LERP_X2_f64_sse(l0, l1, RE_NOISE_FADE_X2_f64_sse(z0));
+}
 
-/* NEON Version — same: hashing prevents full SIMD */
-RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32_neon(RE_f32 x, RE_f32 y, RE_f32 z)
+RE_INLINE __m128d RE_NOISE_PERLIN3_X2_f64_sse(__m128d x, __m128d y, __m128d z)
 {
-    return RE_NOISE_PERLIN3_f32_scalar(x,y,z);
+    return RE_NOISE_PERLIN3_X2_CTX_f64_sse(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
 }
 
-#endif /* NEON */
+#endif /* SSE */
+
+#if defined(RE_SIMD_AVX)
+
+/* Gradient indices of 4 cells given their floored corners as doubles → gi[corner * 4 + lane] */
+RE_INLINE void RE_NOISE_PERLIN3_CORNERS_X4_f64(const RE_NOISE_CONTEXT *ctx, const RE_f64 *bx,
+                                               const RE_f64 *by, const RE_f64 *bz, RE_i32 *gi)
+{
+    RE_ALIGN(16) RE_i32 c[3][2][4];
+
+    for (int l = 0; l < 4; l++)
+    {
+        RE_i64 X = (RE_i64)bx[l], Y = (RE_i64)by[l], Z = (RE_i64)bz[l];
+
+        c[0][0][l] = RE_NOISE_FOLD_i64(X);  c[0][1][l] = RE_NOISE_FOLD_i64(X + 1);
+        c[1][0][l] = RE_NOISE_FOLD_i64(Y);  c[1][1][l] = RE_NOISE_FOLD_i64(Y + 1);
+        c[2][0][l] = RE_NOISE_FOLD_i64(Z);  c[2][1][l] = RE_NOISE_FOLD_i64(Z + 1);
+    }
+
+#if RE_NOISE_HASH_MODE == 3
+    #define L(a, d) _mm_load_si128((const __m128i *)c[a][d])
+    RE_NOISE_PCG_CORNERS3_X4_sse(ctx, L(0, 0), L(0, 1), L(1, 0), L(1, 1), L(2, 0), L(2, 1), gi, 4, RE_TRUE);
+    #undef L
+#else
+    for (int l = 0; l < 4; l++)
+    {
+        const RE_i32 xs[2] = { c[0][0][l], c[0][1][l] };
+        const RE_i32 ys[2] = { c[1][0][l], c[1][1][l] };
+        const RE_i32 zs[2] = { c[2][0][l], c[2][1][l] };
+        RE_NOISE_LATTICE3_CORNERS_AT(ctx, xs, ys, zs, gi + l, 4, RE_TRUE);
+    }
+#endif
+}
+
+RE_INLINE __m256d RE_NOISE_FADE_X4_f64_avx(__m256d t)
+{
+    __m256d p = _mm256_add_pd(_mm256_mul_pd(t, _mm256_sub_pd(_mm256_mul_pd(t, _mm256_set1_pd(6.0)),
+                                                             _mm256_set1_pd(15.0))),
+                              _mm256_set1_pd(10.0));
+    return _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(t, t), t), p);
+}
+
+RE_INLINE __m256d RE_NOISE_LERP_X4_f64_avx(__m256d a, __m256d b, __m256d t)
+{
+    return _mm256_add_pd(a, _mm256_mul_pd(t, _mm256_sub_pd(b, a)));
+}
+
+/* Gathers 4 rows of RE_NOISE_GRAD3_f64: (gx, gy) and (gz, 0) pairs, lanes 0/2 and 1/3 share a load */
+RE_INLINE __m256d RE_NOISE_GRAD3_DOT_X4_f64_avx(const RE_i32 gi[4], __m256d x, __m256d y, __m256d z)
+{
+    const RE_f64 *g0 = RE_NOISE_GRAD3_f64[gi[0]], *g1 = RE_NOISE_GRAD3_f64[gi[1]];
+    const RE_f64 *g2 = RE_NOISE_GRAD3_f64[gi[2]], *g3 = RE_NOISE_GRAD3_f64[gi[3]];
+
+    #define PAIR(a, b, o) _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_load_pd((a) + (o))), \
+                                               _mm_load_pd((b) + (o)), 1)
+
+    __m256d xy02 = PAIR(g0, g2, 0), xy13 = PAIR(g1, g3, 0);
+    __m256d zw02 = PAIR(g0, g2, 2), zw13 = PAIR(g1, g3, 2);
+
+    #undef PAIR
 
+    __m256d gx = _mm256_unpacklo_pd(xy02, xy13);
+    __m256d gy = _mm256_unpackhi_pd(xy02, xy13);
+    __m256d gz = _mm256_unpacklo_pd(zw02, zw13);
+
+    return _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(gx, x), _mm256_mul_pd(gy, y)), _mm256_mul_pd(gz, z));
+}
+
+/* 4 points per call */
+RE_INLINE __m256d RE_NOISE_PERLIN3_X4_CTX_f64_avx(const RE_NOISE_CONTEXT *ctx,
+                                                  __m256d x, __m256d y, __m256d z)
+{
+    __m256d fx = _mm256_floor_pd(x);
+    __m256d fy = _mm256_floor_pd(y);
+    __m256d fz = _mm256_floor_pd(z);
+
+    RE_f64 bx[4], by[4], bz[4];
+    _mm256_storeu_pd(bx, fx);
+    _mm256_storeu_pd(by, fy);
+    _mm256_storeu_pd(bz, fz);
+
+    RE_i32 gi[8 * 4];
+    RE_NOISE_PERLIN3_CORNERS_X4_f64(ctx, bx, by, bz, gi);
+
+    __m256d one = _mm256_set1_pd(1.0);
+    __m256d x0 = _mm256_sub_pd(x, fx), x1 = _mm256_sub_pd(x0, one);
+    __m256d y0 = _mm256_sub_pd(y, fy), y1 = _mm256_sub_pd(y0, one);
+    __m256d z0 = _mm256_sub_pd(z, fz), z1 = _mm256_sub_pd(z0, one);
+
+    __m256d d000 = RE_NOISE_GRAD3_DOT_X4_f64_avx(gi + 0*4, x0, y0, z0);
+    __m256d d100 = RE_NOISE_GRAD3_DOT_X4_f64_avx(gi + 1*4, x1, y0, z0);
+    __m256d d010 = RE_NOISE_GRAD3_DOT_X4_f64_avx(gi + 2*4, x0, y1, z0);
+    __m256d d110 = RE_NOISE_GRAD3_DOT_X4_f64_avx(gi + 3*4, x1, y1, z0);
+    __m256d d001 = RE_NOISE_GRAD3_DOT_X4_f64_avx(gi + 4*4, x0, y0, z1);
+    __m256d d101 = RE_NOISE_GRAD3_DOT_X4_f64_avx(gi + 5*4, x1, y0, z1);
+    __m256d d011 = RE_NOISE_GRAD3_DOT_X4_f64_avx(gi + 6*4, x0, y1, z1);
+    __m256d d111 = RE_NOISE_GRAD3_DOT_X4_f64_avx(gi + 7*4, x1, y1, z1);
+
+    __m256d u = RE_NOISE_FADE_X4_f64_avx(x0);
+    __m256d v = RE_NOISE_FADE_X4_f64_avx(y0);
+
+    __m256d l0 = RE_NOISE_LERP_X4_f64_avx(RE_NOISE_LERP_X4_f64_avx(d000, d100, u),
+                                          RE_NOISE_LERP_X4_f64_avx(d010, d110, u), v);
+    __m256d l1 = RE_NOISE_LERP_X4_f64_avx(RE_NOISE_LERP_X4_f64_avx(d001, d101, u),
+                                          RE_NOISE_LERP_X4_f64_avx(d011, d111, u), v);
+
+    return RE_NOISE_LERP_X4_f64_avx(l0, l1, RE_NOISE_FADE_X4_f64_avx(z0));
+}
+
+RE_INLINE __m256d RE_NOISE_PERLIN3_X4_f64_avx(__m256d x, __m256d y, __m256d z)
+{
+    return RE_NOISE_PERLIN3_X4_CTX_f64_avx(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+#endif /* AVX */
+
+/* out[i] = PERLIN3_f64(x[i], y[i], z[i]), widest kernel first, scalar tail */
+RE_INLINE void RE_NOISE_PERLIN3_BATCH_CTX_f64(const RE_NOISE_CONTEXT *ctx,
+                                              const RE_f64 *x, const RE_f64 *y, const RE_f64 *z,
+                                              RE_f64 *out, int count)
+{
+    int i = 0;
+
+#if defined(RE_SIMD_AVX)
+    for (; i + 4 <= count; i += 4)
+        _mm256_storeu_pd(out + i, RE_NOISE_PERLIN3_X4_CTX_f64_avx(ctx, _mm256_loadu_pd(x + i),
+                                                                       _mm256_loadu_pd(y + i),
+                                                                       _mm256_loadu_pd(z + i)));
+#endif
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 2 <= count; i += 2)
+        _mm_storeu_pd(out + i, RE_NOISE_PERLIN3_X2_CTX_f64_sse(ctx, _mm_loadu_pd(x + i),
+                                                                    _mm_loadu_pd(y + i),
+                                                                    _mm_loadu_pd(z + i)));
+#endif
+
+    for (; i < count; i++)
+        out[i] = RE_NOISE_PERLIN3_CTX_f64(ctx, x[i], y[i], z[i]);
+}
+
+RE_INLINE void RE_NOISE_PERLIN3_BATCH_f64(const RE_f64 *x, const RE_f64 *y, const RE_f64 *z,
+                                          RE_f64 *out, int count)
+{
+    RE_NOISE_PERLIN3_BATCH_CTX_f64(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out, count);
+}
 
 /* ============================================================================================
-   MASTER DISPATCH FUNCTION
+   PERLIN 2D / 1D
+   --------------------------------------------------------------------------------------------
+   2D: gradient index = HASH2(corner) & 7 into RE_NOISE_GRAD2, bilinear blend of 4 corners.
+   1D: gradient = x component of the diagonal RE_NOISE_GRAD2 entries (HASH(X) & 3 → ±1),
+       scaled by 2 so both span [-1, 1].
+   Half (2D) or a quarter (1D) of the hashing and dot products of a PERLIN3 z = 0 slice.
    ============================================================================================ */
 
-RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+/* Corner c = dx + 2*dy at explicit corner coordinates (see RE_NOISE_LATTICE3_CORNERS_AT)
+   → out[c * stride] = gradient index 0..7 */
+RE_INLINE void RE_NOISE_LATTICE2_CORNERS_AT(const RE_NOISE_CONTEXT *ctx,
+                                            const RE_i32 xs[2], const RE_i32 ys[2], RE_i32 *out, int stride)
+{
+#if RE_NOISE_HASH_MODE == 3
+    RE_u32 hx[2], hy[2];
+    for (int d = 0; d < 2; d++)
+    {
+        hx[d] = (RE_u32)xs[d] * 73856093u;
+        hy[d] = (RE_u32)ys[d] * 19349663u ^ ctx->seed * 0x9e3779b9u;
+    }
+
+    for (int c = 0; c < 4; c++)
+        out[c * stride] = (RE_i32)(RE_PCG_MIX32(hx[c & 1] ^ hy[c >> 1]) & 7u);
+#else
+    for (int dx = 0; dx < 2; dx++)
+    {
+        RE_i32 a = ctx->perm[xs[dx] & 255];
+
+        out[dx * stride]       = ctx->perm[a + (ys[0] & 255)] & 7;
+        out[(dx + 2) * stride] = ctx->perm[a + (ys[1] & 255)] & 7;
+    }
+#endif
+}
+
+RE_INLINE void RE_NOISE_LATTICE2_CORNERS(const RE_NOISE_CONTEXT *ctx, RE_i32 X, RE_i32 Y,
+                                         RE_i32 *out, int stride)
+{
+    const RE_i32 xs[2] = { X, X + 1 }, ys[2] = { Y, Y + 1 };
+    RE_NOISE_LATTICE2_CORNERS_AT(ctx, xs, ys, out, stride);
+}
+
+RE_INLINE RE_f32 RE_NOISE_GRAD2_DOT_f32(RE_i32 gi, RE_f32 x, RE_f32 y)
+{
+    const RE_i8 *g = RE_NOISE_GRAD2[gi];
+    return g[0]*x + g[1]*y;
+}
+
+RE_INLINE RE_f64 RE_NOISE_GRAD2_DOT_f64(RE_i32 gi, RE_f64 x, RE_f64 y)
+{
+    const RE_i8 *g = RE_NOISE_GRAD2[gi];
+    return g[0]*x + g[1]*y;
+}
+
+/* ±1 gradient of lattice point X */
+RE_INLINE RE_i32 RE_NOISE_PERLIN1_GRAD(const RE_NOISE_CONTEXT *ctx, RE_i32 X)
+{
+    return RE_NOISE_GRAD2[RE_NOISE_CTX_HASH(ctx, X) & 3][0];
+}
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN2_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y)
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+
+    RE_f32 xf = x - (RE_f32)X;
+    RE_f32 yf = y - (RE_f32)Y;
+
+    RE_i32 g[4];
+    RE_NOISE_LATTICE2_CORNERS(ctx, X, Y, g, 1);
+
+    RE_f32 d00 = RE_NOISE_GRAD2_DOT_f32(g[0], xf,        yf);
+    RE_f32 d10 = RE_NOISE_GRAD2_DOT_f32(g[1], xf - 1.0f, yf);
+    RE_f32 d01 = RE_NOISE_GRAD2_DOT_f32(g[2], xf,        yf - 1.0f);
+    RE_f32 d11 = RE_NOISE_GRAD2_DOT_f32(g[3], xf - 1.0f, yf - 1.0f);
+
+    RE_f32 u = RE_NOISE_FADE_f32(xf);
+
+    return RE_NOISE_LERP_f32(RE_NOISE_LERP_f32(d00, d10, u),
+                             RE_NOISE_LERP_f32(d01, d11, u), RE_NOISE_FADE_f32(yf));
+}
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN2_f32(RE_f32 x, RE_f32 y)
+{
+    return RE_NOISE_PERLIN2_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
+RE_INLINE RE_f64 RE_NOISE_PERLIN2_CTX_f64(const RE_NOISE_CONTEXT *ctx, RE_f64 x, RE_f64 y)
+{
+    RE_i64 X = RE_FASTFLOOR_f64(x);
+    RE_i64 Y = RE_FASTFLOOR_f64(y);
+
+    RE_f64 xf = x - (RE_f64)X;
+    RE_f64 yf = y - (RE_f64)Y;
+
+    const RE_i32 xs[2] = { RE_NOISE_FOLD_i64(X), RE_NOISE_FOLD_i64(X + 1) };
+    const RE_i32 ys[2] = { RE_NOISE_FOLD_i64(Y), RE_NOISE_FOLD_i64(Y + 1) };
+
+    RE_i32 g[4];
+    RE_NOISE_LATTICE2_CORNERS_AT(ctx, xs, ys, g, 1);
+
+    RE_f64 d00 = RE_NOISE_GRAD2_DOT_f64(g[0], xf,       yf);
+    RE_f64 d10 = RE_NOISE_GRAD2_DOT_f64(g[1], xf - 1.0, yf);
+    RE_f64 d01 = RE_NOISE_GRAD2_DOT_f64(g[2], xf,       yf - 1.0);
+    RE_f64 d11 = RE_NOISE_GRAD2_DOT_f64(g[3], xf - 1.0, yf - 1.0);
+
+    RE_f64 u = RE_NOISE_FADE_f64(xf);
+
+    return RE_NOISE_LERP_f64(RE_NOISE_LERP_f64(d00, d10, u),
+                             RE_NOISE_LERP_f64(d01, d11, u), RE_NOISE_FADE_f64(yf));
+}
+
+RE_INLINE RE_f64 RE_NOISE_PERLIN2_f64(RE_f64 x, RE_f64 y)
+{
+    return RE_NOISE_PERLIN2_CTX_f64(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN1_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x)
+{
+    RE_i32 X  = RE_FASTFLOOR_f32(x);
+    RE_f32 xf = x - (RE_f32)X;
+
+    RE_f32 d0 = (RE_f32)RE_NOISE_PERLIN1_GRAD(ctx, X)     * xf;
+    RE_f32 d1 = (RE_f32)RE_NOISE_PERLIN1_GRAD(ctx, X + 1) * (xf - 1.0f);
+
+    return 2.0f * RE_NOISE_LERP_f32(d0, d1, RE_NOISE_FADE_f32(xf));
+}
+
+RE_INLINE RE_f32 RE_NOISE_PERLIN1_f32(RE_f32 x)
+{
+    return RE_NOISE_PERLIN1_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x);
+}
+
+RE_INLINE RE_f64 RE_NOISE_PERLIN1_CTX_f64(const RE_NOISE_CONTEXT *ctx, RE_f64 x)
+{
+    RE_i64 X  = RE_FASTFLOOR_f64(x);
+    RE_f64 xf = x - (RE_f64)X;
+
+    RE_f64 d0 = (RE_f64)RE_NOISE_PERLIN1_GRAD(ctx, RE_NOISE_FOLD_i64(X))     * xf;
+    RE_f64 d1 = (RE_f64)RE_NOISE_PERLIN1_GRAD(ctx, RE_NOISE_FOLD_i64(X + 1)) * (xf - 1.0);
+
+    return 2.0 * RE_NOISE_LERP_f64(d0, d1, RE_NOISE_FADE_f64(xf));
+}
+
+RE_INLINE RE_f64 RE_NOISE_PERLIN1_f64(RE_f64 x)
+{
+    return RE_NOISE_PERLIN1_CTX_f64(&RE_NOISE_DEFAULT_CONTEXT, x);
+}
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+/* Lane-wise RE_NOISE_LATTICE2_CORNERS → gi[corner * stride + lane] */
+RE_INLINE void RE_NOISE_LATTICE2_CORNERS_X4_sse(const RE_NOISE_CONTEXT *ctx, __m128i X, __m128i Y,
+                                                RE_i32 *gi, int stride)
+{
+#if RE_NOISE_HASH_MODE == 3
+    __m128i one = _mm_set1_epi32(1);
+    __m128i sm  = _mm_set1_epi32((int)(ctx->seed * 0x9e3779b9u));
+
+    __m128i hx[2], hy[2];
+    hx[0] = RE_MULLO_X4_u32_sse(X, _mm_set1_epi32(73856093));
+    hx[1] = RE_MULLO_X4_u32_sse(_mm_add_epi32(X, one), _mm_set1_epi32(73856093));
+    hy[0] = _mm_xor_si128(RE_MULLO_X4_u32_sse(Y, _mm_set1_epi32(19349663)), sm);
+    hy[1] = _mm_xor_si128(RE_MULLO_X4_u32_sse(_mm_add_epi32(Y, one), _mm_set1_epi32(19349663)), sm);
+
+    for (int c = 0; c < 4; c++)
+    {
+        __m128i h = RE_PCG_MIX32_X4_sse(_mm_xor_si128(hx[c & 1], hy[c >> 1]));
+        _mm_storeu_si128((__m128i *)(gi + c * stride), _mm_and_si128(h, _mm_set1_epi32(7)));
+    }
+#else
+    RE_i32 Xs[4], Ys[4];
+    _mm_storeu_si128((__m128i *)Xs, X);
+    _mm_storeu_si128((__m128i *)Ys, Y);
+
+    for (int l = 0; l < 4; l++)
+        RE_NOISE_LATTICE2_CORNERS(ctx, Xs[l], Ys[l], gi + l, stride);
+#endif
+}
+
+/* GRAD2 entries 0..3 are (±1, ±1), 4..5 (±1, 0), 6..7 (0, ±1): sign of u from bit 0, of v from bit 1 */
+RE_INLINE void RE_NOISE_GRAD2_MASKS_X4_sse(__m128i gi, __m128 *use_x, __m128 *use_y,
+                                           __m128 *sign_u, __m128 *sign_v)
+{
+    *use_x  = _mm_castsi128_ps(_mm_cmplt_epi32(gi, _mm_set1_epi32(6)));
+    *use_y  = _mm_castsi128_ps(_mm_cmplt_epi32(gi, _mm_set1_epi32(4)));
+    *sign_u = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(gi, _mm_set1_epi32(1)), 31));
+    *sign_v = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(gi, _mm_set1_epi32(2)), 30));
+}
+
+RE_INLINE __m128 RE_NOISE_GRAD2_DOT_X4_sse(__m128i gi, __m128 x, __m128 y)
+{
+    __m128 use_x, use_y, sign_u, sign_v;
+    RE_NOISE_GRAD2_MASKS_X4_sse(gi, &use_x, &use_y, &sign_u, &sign_v);
+
+    __m128 u = _mm_or_ps(_mm_and_ps(use_x, x), _mm_andnot_ps(use_x, y));
+    __m128 v = _mm_and_ps(use_y, y);
+
+    return _mm_add_ps(_mm_xor_ps(u, sign_u), _mm_xor_ps(v, sign_v));
+}
+
+/* 4 points per call */
+RE_INLINE __m128 RE_NOISE_PERLIN2_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx, __m128 x, __m128 y)
+{
+    __m128 fx, fy;
+    __m128i X = RE_NOISE_FLOOR_X4_f32_sse(x, &fx);
+    __m128i Y = RE_NOISE_FLOOR_X4_f32_sse(y, &fy);
+
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 x0 = _mm_sub_ps(x, fx), x1 = _mm_sub_ps(x0, one);
+    __m128 y0 = _mm_sub_ps(y, fy), y1 = _mm_sub_ps(y0, one);
+
+    RE_i32 gi[4 * 4];
+    RE_NOISE_LATTICE2_CORNERS_X4_sse(ctx, X, Y, gi, 4);
+
+    #define G(c) _mm_loadu_si128((const __m128i *)(gi + (c) * 4))
+
+    __m128 d00 = RE_NOISE_GRAD2_DOT_X4_sse(G(0), x0, y0);
+    __m128 d10 = RE_NOISE_GRAD2_DOT_X4_sse(G(1), x1, y0);
+    __m128 d01 = RE_NOISE_GRAD2_DOT_X4_sse(G(2), x0, y1);
+    __m128 d11 = RE_NOISE_GRAD2_DOT_X4_sse(G(3), x1, y1);
+
+    #undef G
+
+    __m128 u = RE_NOISE_FADE_X4_f32_sse(x0);
+
+    return RE_NOISE_LERP_X4_f32_sse(RE_NOISE_LERP_X4_f32_sse(d00, d10, u),
+                                    RE_NOISE_LERP_X4_f32_sse(d01, d11, u),
+                                    RE_NOISE_FADE_X4_f32_sse(y0));
+}
+
+RE_INLINE __m128 RE_NOISE_PERLIN2_X4_f32_sse(__m128 x, __m128 y)
+{
+    return RE_NOISE_PERLIN2_X4_CTX_f32_sse(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
+/* Lane-wise ±1 gradients of X and X + 1 as float sign masks */
+RE_INLINE void RE_NOISE_PERLIN1_SIGNS_X4_sse(const RE_NOISE_CONTEXT *ctx, __m128i X,
+                                             __m128 *sign0, __m128 *sign1)
+{
+    __m128i h0, h1;
+#if RE_NOISE_HASH_MODE == 3
+    __m128i sm = _mm_set1_epi32((int)(ctx->seed * 0x9e3779b9u));
+    h0 = RE_PCG_MIX32_X4_sse(_mm_xor_si128(RE_MULLO_X4_u32_sse(X, _mm_set1_epi32(73856093)), sm));
+    h1 = RE_PCG_MIX32_X4_sse(_mm_xor_si128(RE_MULLO_X4_u32_sse(_mm_add_epi32(X, _mm_set1_epi32(1)),
+                                                               _mm_set1_epi32(73856093)), sm));
+#else
+    RE_i32 Xs[4], a[4], b[4];
+    _mm_storeu_si128((__m128i *)Xs, X);
+    for (int l = 0; l < 4; l++)
+    {
+        a[l] = RE_NOISE_CTX_HASH(ctx, Xs[l]);
+        b[l] = RE_NOISE_CTX_HASH(ctx, Xs[l] + 1);
+    }
+    h0 = _mm_loadu_si128((const __m128i *)a);
+    h1 = _mm_loadu_si128((const __m128i *)b);
+#endif
+    /* GRAD2[h & 3][0] is -1 exactly when bit 0 is set */
+    *sign0 = _mm_castsi128_ps(_mm_slli_epi32(h0, 31));
+    *sign1 = _mm_castsi128_ps(_mm_slli_epi32(h1, 31));
+}
+
+RE_INLINE __m128 RE_NOISE_PERLIN1_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx, __m128 x)
+{
+    __m128 fx;
+    __m128i X = RE_NOISE_FLOOR_X4_f32_sse(x, &fx);
+
+    __m128 x0 = _mm_sub_ps(x, fx);
+    __m128 s0, s1;
+    RE_NOISE_PERLIN1_SIGNS_X4_sse(ctx, X, &s0, &s1);
+
+    __m128 d0 = _mm_xor_ps(x0, s0);
+    __m128 d1 = _mm_xor_ps(_mm_sub_ps(x0, _mm_set1_ps(1.0f)), s1);
+
+    return _mm_mul_ps(_mm_set1_ps(2.0f), RE_NOISE_LERP_X4_f32_sse(d0, d1, RE_NOISE_FADE_X4_f32_sse(x0)));
+}
+
+RE_INLINE __m128 RE_NOISE_PERLIN1_X4_f32_sse(__m128 x)
 {
+    return RE_NOISE_PERLIN1_X4_CTX_f32_sse(&RE_NOISE_DEFAULT_CONTEXT, x);
+}
+
+#endif /* SSE */
+
 #if defined(RE_SIMD_AVX)
-    return RE_NOISE_PERLIN3_f32_avx(x,y,z);
-#elif defined(RE_SIMD_SSE)
-    return RE_NOISE_PERLIN3_f32_sse(x,y,z);
-#elif defined(RE_SIMD_NEON)
-    return RE_NOISE_PERLIN3_f32_neon(x,y,z);
+
+/* Corner gradient indices of 8 cells → gi[corner * 8 + lane] */
+RE_INLINE void RE_NOISE_LATTICE2_CORNERS_X8_avx(const RE_NOISE_CONTEXT *ctx, __m256i X, __m256i Y,
+                                                RE_i32 *gi)
+{
+#if RE_NOISE_HASH_MODE == 3 && defined(__AVX2__)
+    __m256i one = _mm256_set1_epi32(1);
+    __m256i sm  = _mm256_set1_epi32((int)(ctx->seed * 0x9e3779b9u));
+
+    __m256i hx[2], hy[2];
+    hx[0] = _mm256_mullo_epi32(X, _mm256_set1_epi32(73856093));
+    hx[1] = _mm256_mullo_epi32(_mm256_add_epi32(X, one), _mm256_set1_epi32(73856093));
+    hy[0] = _mm256_xor_si256(_mm256_mullo_epi32(Y, _mm256_set1_epi32(19349663)), sm);
+    hy[1] = _mm256_xor_si256(_mm256_mullo_epi32(_mm256_add_epi32(Y, one), _mm256_set1_epi32(19349663)), sm);
+
+    for (int c = 0; c < 4; c++)
+    {
+        __m256i h = RE_PCG_MIX32_X8_avx2(_mm256_xor_si256(hx[c & 1], hy[c >> 1]));
+        _mm256_storeu_si256((__m256i *)(gi + c * 8), _mm256_and_si256(h, _mm256_set1_epi32(7)));
+    }
 #else
-    return RE_NOISE_PERLIN3_f32_scalar(x,y,z);
+    /* AVX1: 128-bit integer halves */
+    RE_NOISE_LATTICE2_CORNERS_X4_sse(ctx, _mm256_castsi256_si128(X), _mm256_castsi256_si128(Y), gi, 8);
+    RE_NOISE_LATTICE2_CORNERS_X4_sse(ctx, _mm256_extractf128_si256(X, 1),
+                                     _mm256_extractf128_si256(Y, 1), gi + 4, 8);
+#endif
+}
+
+RE_INLINE __m256 RE_NOISE_GRAD2_DOT_X8_avx(const RE_i32 gi[8], __m256 x, __m256 y)
+{
+    __m128 ux0, uy0, su0, sv0;
+    __m128 ux1, uy1, su1, sv1;
+    RE_NOISE_GRAD2_MASKS_X4_sse(_mm_loadu_si128((const __m128i *)(gi + 0)), &ux0, &uy0, &su0, &sv0);
+    RE_NOISE_GRAD2_MASKS_X4_sse(_mm_loadu_si128((const __m128i *)(gi + 4)), &ux1, &uy1, &su1, &sv1);
+
+    #define M256(lo, hi) _mm256_insertf128_ps(_mm256_castps128_ps256(lo), (hi), 1)
+
+    __m256 use_x  = M256(ux0, ux1);
+    __m256 use_y  = M256(uy0, uy1);
+    __m256 sign_u = M256(su0, su1);
+    __m256 sign_v = M256(sv0, sv1);
+
+    #undef M256
+
+    __m256 u = _mm256_blendv_ps(y, x, use_x);
+    __m256 v = _mm256_and_ps(use_y, y);
+
+    return _mm256_add_ps(_mm256_xor_ps(u, sign_u), _mm256_xor_ps(v, sign_v));
+}
+
+/* 8 points per call */
+RE_INLINE __m256 RE_NOISE_PERLIN2_X8_CTX_f32_avx(const RE_NOISE_CONTEXT *ctx, __m256 x, __m256 y)
+{
+    __m256 fx = _mm256_floor_ps(x);
+    __m256 fy = _mm256_floor_ps(y);
+
+    __m256 one = _mm256_set1_ps(1.0f);
+    __m256 x0 = _mm256_sub_ps(x, fx), x1 = _mm256_sub_ps(x0, one);
+    __m256 y0 = _mm256_sub_ps(y, fy), y1 = _mm256_sub_ps(y0, one);
+
+    RE_i32 gi[4 * 8];
+    RE_NOISE_LATTICE2_CORNERS_X8_avx(ctx, _mm256_cvttps_epi32(fx), _mm256_cvttps_epi32(fy), gi);
+
+    __m256 d00 = RE_NOISE_GRAD2_DOT_X8_avx(gi + 0*8, x0, y0);
+    __m256 d10 = RE_NOISE_GRAD2_DOT_X8_avx(gi + 1*8, x1, y0);
+    __m256 d01 = RE_NOISE_GRAD2_DOT_X8_avx(gi + 2*8, x0, y1);
+    __m256 d11 = RE_NOISE_GRAD2_DOT_X8_avx(gi + 3*8, x1, y1);
+
+    __m256 u = RE_NOISE_FADE_X8_f32_avx(x0);
+
+    return RE_NOISE_LERP_X8_f32_avx(RE_NOISE_LERP_X8_f32_avx(d00, d10, u),
+                                    RE_NOISE_LERP_X8_f32_avx(d01, d11, u),
+                                    RE_NOISE_FADE_X8_f32_avx(y0));
+}
+
+RE_INLINE __m256 RE_NOISE_PERLIN2_X8_f32_avx(__m256 x, __m256 y)
+{
+    return RE_NOISE_PERLIN2_X8_CTX_f32_avx(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
+RE_INLINE __m256 RE_NOISE_PERLIN1_X8_CTX_f32_avx(const RE_NOISE_CONTEXT *ctx, __m256 x)
+{
+    __m256 fx = _mm256_floor_ps(x);
+    __m256 x0 = _mm256_sub_ps(x, fx);
+    __m256i X = _mm256_cvttps_epi32(fx);
+
+    __m128 s0l, s1l, s0h, s1h;
+    RE_NOISE_PERLIN1_SIGNS_X4_sse(ctx, _mm256_castsi256_si128(X),     &s0l, &s1l);
+    RE_NOISE_PERLIN1_SIGNS_X4_sse(ctx, _mm256_extractf128_si256(X, 1), &s0h, &s1h);
+
+    __m256 s0 = _mm256_insertf128_ps(_mm256_castps128_ps256(s0l), s0h, 1);
+    __m256 s1 = _mm256_insertf128_ps(_mm256_castps128_ps256(s1l), s1h, 1);
+
+    __m256 d0 = _mm256_xor_ps(x0, s0);
+    __m256 d1 = _mm256_xor_ps(_mm256_sub_ps(x0, _mm256_set1_ps(1.0f)), s1);
+
+    return _mm256_mul_ps(_mm256_set1_ps(2.0f), RE_NOISE_LERP_X8_f32_avx(d0, d1, RE_NOISE_FADE_X8_f32_avx(x0)));
+}
+
+RE_INLINE __m256 RE_NOISE_PERLIN1_X8_f32_avx(__m256 x)
+{
+    return RE_NOISE_PERLIN1_X8_CTX_f32_avx(&RE_NOISE_DEFAULT_CONTEXT, x);
+}
+
+#endif /* AVX */
+
+/* out[i] = PERLIN2(x[i], y[i]), widest kernel first, scalar tail */
+RE_INLINE void RE_NOISE_PERLIN2_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                              const RE_f32 *x, const RE_f32 *y, RE_f32 *out, int count)
+{
+    int i = 0;
+
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, RE_NOISE_PERLIN2_X8_CTX_f32_avx(ctx, _mm256_loadu_ps(x + i),
+                                                                       _mm256_loadu_ps(y + i)));
+#endif
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, RE_NOISE_PERLIN2_X4_CTX_f32_sse(ctx, _mm_loadu_ps(x + i), _mm_loadu_ps(y + i)));
+#endif
+
+    for (; i < count; i++)
+        out[i] = RE_NOISE_PERLIN2_CTX_f32(ctx, x[i], y[i]);
+}
+
+RE_INLINE void RE_NOISE_PERLIN2_BATCH_f32(const RE_f32 *x, const RE_f32 *y, RE_f32 *out, int count)
+{
+    RE_NOISE_PERLIN2_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, out, count);
+}
+
+/* out[i] = PERLIN1(x[i]) */
+RE_INLINE void RE_NOISE_PERLIN1_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                              const RE_f32 *x, RE_f32 *out, int count)
+{
+    int i = 0;
+
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, RE_NOISE_PERLIN1_X8_CTX_f32_avx(ctx, _mm256_loadu_ps(x + i)));
+#endif
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, RE_NOISE_PERLIN1_X4_CTX_f32_sse(ctx, _mm_loadu_ps(x + i)));
 #endif
+
+    for (; i < count; i++)
+        out[i] = RE_NOISE_PERLIN1_CTX_f32(ctx, x[i]);
+}
+
+RE_INLINE void RE_NOISE_PERLIN1_BATCH_f32(const RE_f32 *x, RE_f32 *out, int count)
+{
+    RE_NOISE_PERLIN1_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, out, count);
+}
+
+/* f64 batches evaluate per point; the lattice work is the same as f32 */
+RE_INLINE void RE_NOISE_PERLIN2_BATCH_CTX_f64(const RE_NOISE_CONTEXT *ctx,
+                                              const RE_f64 *x, const RE_f64 *y, RE_f64 *out, int count)
+{
+    for (int i = 0; i < count; i++)
+        out[i] = RE_NOISE_PERLIN2_CTX_f64(ctx, x[i], y[i]);
+}
+
+RE_INLINE void RE_NOISE_PERLIN1_BATCH_CTX_f64(const RE_NOISE_CONTEXT *ctx,
+                                              const RE_f64 *x, RE_f64 *out, int count)
+{
+    for (int i = 0; i < count; i++)
+        out[i] = RE_NOISE_PERLIN1_CTX_f64(ctx, x[i]);
 }
 
 /* ================================================================================================
@@ -670,23 +2775,10 @@ RE_INLINE RE_f32 RE_NOISE_PERLIN3_f32(RE_f32 x, RE_f32 y, RE_f32 z)
         - Header-only, deterministic, branch-optimized
 
     NOTE:
-        2D Perlin is in a different header.
-        This header is ONLY 3D OpenSimplex2.
-
-================================================================================================ */
+        2D / 1D Perlin live in the PERLIN 2D / 1D section above.
+        This section is ONLY 3D OpenSimplex2.
 
-/* ================================================================================================
-   SIMD Detection
 ================================================================================================ */
-#if defined(__AVX__)
-    #define RE_SIMD_AVX 1
-#elif defined(__SSE2__) || defined(_MSC_VER)
-    #define RE_SIMD_SSE 1
-#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
-    #define RE_SIMD_NEON 1
-#else
-    #define RE_SIMD_NONE 1
-#endif
 
 /* ================================================================================================
     3D Gradients (KdotJPG canonical OpenSimplex2 gradients)
@@ -738,6 +2830,25 @@ RE_INLINE RE_u32 RE_OS3D_HASH(RE_i32 x, RE_i32 y, RE_i32 z)
     return RE_PCG_MIX32_u32(h);
 }
 
+/* Seed 0 is RE_OS3D_HASH; other seeds decorrelate the whole lattice */
+RE_INLINE RE_u32 RE_OS3D_HASH_SEED(RE_u32 seed, RE_i32 x, RE_i32 y, RE_i32 z)
+{
+    RE_u32 h =
+        (RE_u32)x * 0x1bd11bdu ^
+        (RE_u32)y * 0x3ad29ddu ^
+        (RE_u32)z * 0x68431fdu ^
+        seed * 0x9e3779b9u;
+
+    return RE_PCG_MIX32_u32(h);
+}
+
+/* Gradient index (0..11) of a point on the two-lattice OpenSimplex2 grid, given in doubled
+   coordinates (2*i + l on lattice l) so both cubic sublattices hash without colliding */
+RE_INLINE RE_u32 RE_OS3D_GRAD_INDEX(RE_u32 seed, RE_i32 x2, RE_i32 y2, RE_i32 z2)
+{
+    return RE_HASH_TO_GRAD12(RE_OS3D_HASH_SEED(seed, x2, y2, z2));
+}
+
 /* ================================================================================================
    Rotation Constants (OpenSimplex2)
    These constants define the rotation that resolves the grid.
@@ -769,6 +2880,10 @@ RE_INLINE RE_f64 RE_OS3D_DOT_F64(const RE_f64 g[3], RE_f64 x, RE_f64 y, RE_f64 z
 
 /* ================================================================================================
    Simplex Coordinate Transforms + Lattice Corner Index Setup
+
+   Public helpers from the original single-lattice OS3D kernels. The noise functions below no
+   longer call them (they evaluate the reflected two-lattice grid directly); they stay public
+   for code that uses them.
 ================================================================================================ */
 
 /* --------------------------------------------------------------------------------
@@ -850,9 +2965,9 @@ typedef struct RE_OS3D_CornerF64_t {
    FAST VARIANT — 4 CORNERS (OpenSimplex2F)
 ================================================================================================ */
 
-RE_INLINE void RE_OS3D_GET_CORNERS_FAST_f32(
-        RE_f32 x, RE_f32 y, RE_f32 z,
-        RE_OS3D_CornerF32 c[4])
+RE_INLINE void RE_OS3D_GET_CORNERS_FAST_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                RE_f32 x, RE_f32 y, RE_f32 z,
+                                                RE_OS3D_CornerF32 c[4])
 {
     /* Cell origin */
     RE_i32 i = RE_FASTFLOOR_f32(x);
@@ -871,7 +2986,7 @@ RE_INLINE void RE_OS3D_GET_CORNERS_FAST_f32(
     /* First corner = cell origin */
     c[0].i = i; c[0].j = j; c[0].k = k;
     c[0].dx = fx; c[0].dy = fy; c[0].dz = fz;
-    c[0].hash = RE_OS3D_HASH(i,j,k);
+    c[0].hash = RE_OS3D_HASH_SEED(ctx->seed, i,j,k);
 
     /* Second corner */
     if (a && csel) {
@@ -884,25 +2999,32 @@ RE_INLINE void RE_OS3D_GET_CORNERS_FAST_f32(
         c[1].i = i;   c[1].j = j;   c[1].k = k+1;
         c[1].dx = fx;   c[1].dy = fy;   c[1].dz = fz-1;
     }
-    c[1].hash = RE_OS3D_HASH(c[1].i, c[1].j, c[1].k);
+    c[1].hash = RE_OS3D_HASH_SEED(ctx->seed, c[1].i, c[1].j, c[1].k);
 
     /* Remaining 2 corners always share the same pattern */
     c[2].i = i+1; c[2].j = j+1; c[2].k = k;
     c[2].dx = fx-1; c[2].dy = fy-1; c[2].dz = fz;
-    c[2].hash = RE_OS3D_HASH(c[2].i, c[2].j, c[2].k);
+    c[2].hash = RE_OS3D_HASH_SEED(ctx->seed, c[2].i, c[2].j, c[2].k);
 
     c[3].i = i; c[3].j = j+1; c[3].k = k+1;
     c[3].dx = fx; c[3].dy = fy-1; c[3].dz = fz-1;
-    c[3].hash = RE_OS3D_HASH(c[3].i, c[3].j, c[3].k);
+    c[3].hash = RE_OS3D_HASH_SEED(ctx->seed, c[3].i, c[3].j, c[3].k);
+}
+
+RE_INLINE void RE_OS3D_GET_CORNERS_FAST_f32(
+        RE_f32 x, RE_f32 y, RE_f32 z,
+        RE_OS3D_CornerF32 c[4])
+{
+    RE_OS3D_GET_CORNERS_FAST_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, c);
 }
 
 /* ================================================================================================
    SMOOTH VARIANT — 8 CORNERS (OpenSimplex2S)
 ================================================================================================ */
 
-RE_INLINE void RE_OS3D_GET_CORNERS_SMOOTH_f32(
-        RE_f32 x, RE_f32 y, RE_f32 z,
-        RE_OS3D_CornerF32 c[8])
+RE_INLINE void RE_OS3D_GET_CORNERS_SMOOTH_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                  RE_f32 x, RE_f32 y, RE_f32 z,
+                                                  RE_OS3D_CornerF32 c[8])
 {
     /* Base cell */
     RE_i32 i = RE_FASTFLOOR_f32(x);
@@ -928,11 +3050,18 @@ RE_INLINE void RE_OS3D_GET_CORNERS_SMOOTH_f32(
         c[idx].dy = fy - dy;
         c[idx].dz = fz - dz;
 
-        c[idx].hash = RE_OS3D_HASH(c[idx].i, c[idx].j, c[idx].k);
+        c[idx].hash = RE_OS3D_HASH_SEED(ctx->seed, c[idx].i, c[idx].j, c[idx].k);
         idx++;
     }
 }
 
+RE_INLINE void RE_OS3D_GET_CORNERS_SMOOTH_f32(
+        RE_f32 x, RE_f32 y, RE_f32 z,
+        RE_OS3D_CornerF32 c[8])
+{
+    RE_OS3D_GET_CORNERS_SMOOTH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, c);
+}
+
 /* ================================================================================================
    OpenSimplex2F (FAST) Kernel — 4 Corners
    Derived from the official OpenSimplex2F spec
@@ -979,497 +3108,1056 @@ RE_INLINE RE_f64 RE_OS3D_ATTENUATE_FAST_f64(RE_f64 dx, RE_f64 dy, RE_f64 dz)
 }
 
 /* ================================================================================================
-   MAIN FAST FUNCTION (OpenSimplex2F)
-   - Rotate     (R^-1)
-   - Fetch 4 corners
-   - Attenuate
-   - Accumulate
-================================================================================================ */
+   OPEN SIMPLEX 2S (SMOOTH) 3D NOISE
+   Two cubic lattices (integer and half-integer) in the reflected space. Every lattice point
+   within radius sqrt(0.75) is a corner of the enclosing cube, so each lattice checks its 8 cube
+   corners; a point contributes (0.75 - |d|^2)^4 (g . d).
+   ================================================================================================ */
 
-RE_INLINE RE_f32 RE_NOISE_OPENSIMPLEX3D_FAST_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+/* Gradient dot helper */
+RE_INLINE RE_f32 RE_OS_DOT3_f32(const RE_i8 *g, RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return g[0]*x + g[1]*y + g[2]*z;
+}
+
+RE_INLINE RE_f64 RE_OS_DOT3_f64(const RE_i8 *g, RE_f64 x, RE_f64 y, RE_f64 z)
 {
-    /* Rotate into skewed simplex “fast” coordinate space */
-    RE_OS3D_ROTATE_FAST_f32(&x, &y, &z);
+    return (RE_f64)g[0]*x + (RE_f64)g[1]*y + (RE_f64)g[2]*z;
+}
+
+/* ================================================================================================
+   OPEN SIMPLEX 2S 3D — f32
+   ================================================================================================ */
 
-    /* Get 4 corners */
-    RE_OS3D_CornerF32 c[4];
-    RE_OS3D_GET_CORNERS_FAST_f32(x, y, z, c);
+RE_INLINE RE_f32 RE_OS3D_SMOOTH_EVAL_f32(const RE_NOISE_CONTEXT *ctx,
+                                         RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 *out_grad)
+{
+    /* Reflect into lattice space: r = (2/3)(x+y+z) - x. The map is symmetric and its own inverse. */
+    RE_f32 r  = (2.0f / 3.0f) * (x + y + z);
+    RE_f32 xr = r - x;
+    RE_f32 yr = r - y;
+    RE_f32 zr = r - z;
 
-    /* Accumulate */
-    RE_f32 sum = 0.0f;
+    RE_f32 value = 0.0f, gx = 0.0f, gy = 0.0f, gz = 0.0f;
 
-    for (int i = 0; i < 4; i++)
+    /* Lattice 0: integer points; lattice 1: integer points + 1/2 */
+    for (int l = 0; l < 2; l++)
     {
-        RE_f32 att = RE_OS3D_ATTENUATE_FAST_f32(c[i].dx, c[i].dy, c[i].dz);
-        if (att > 0.0f)
+        RE_f32 ox = xr - 0.5f * l;
+        RE_f32 oy = yr - 0.5f * l;
+        RE_f32 oz = zr - 0.5f * l;
+
+        RE_i32 xb = (RE_i32)RE_FASTFLOOR_f32(ox);
+        RE_i32 yb = (RE_i32)RE_FASTFLOOR_f32(oy);
+        RE_i32 zb = (RE_i32)RE_FASTFLOOR_f32(oz);
+
+        RE_f32 fx = ox - xb;
+        RE_f32 fy = oy - yb;
+        RE_f32 fz = oz - zb;
+
+        /* Every point within the kernel radius (sqrt 0.75) is a corner of the enclosing cube */
+        for (int c = 0; c < 8; c++)
         {
-            RE_f32 dot = RE_OS3D_GRAD_DOT_FAST_f32(c[i].hash, c[i].dx, c[i].dy, c[i].dz);
-            sum += att * dot;
+            RE_i32 dx = c & 1, dy = (c >> 1) & 1, dz = c >> 2;
+
+            RE_f32 px = fx - dx;
+            RE_f32 py = fy - dy;
+            RE_f32 pz = fz - dz;
+
+            RE_f32 attn = 0.75f - (px*px + py*py + pz*pz);
+            if (attn > 0.0f)
+            {
+                const RE_i8 *g = RE_NOISE_GRAD3[RE_OS3D_GRAD_INDEX(ctx->seed, 2 * (xb + dx) + l,
+                                                                        2 * (yb + dy) + l,
+                                                                        2 * (zb + dz) + l)];
+
+                RE_f32 dot = RE_OS_DOT3_f32(g, px, py, pz);
+                RE_f32 a2  = attn * attn;
+                RE_f32 a4  = a2 * a2;
+
+                value += a4 * dot;
+
+                if (out_grad)
+                {
+                    /* d/dp [a^4 (g.p)] = a^4 g - 8 a^3 (g.p) p */
+                    RE_f32 k = -8.0f * a2 * attn * dot;
+                    gx += a4 * g[0] + k * px;
+                    gy += a4 * g[1] + k * py;
+                    gz += a4 * g[2] + k * pz;
+                }
+            }
         }
     }
 
-    /* Final scaling per OpenSimplex2F */
-    return sum * OS3D_SCALE_F32;
+    if (out_grad)
+    {
+        RE_f32 sg = (2.0f / 3.0f) * (gx + gy + gz);
+        out_grad[0] = (sg - gx) * OS3D_SMOOTH_SCALE_F32;
+        out_grad[1] = (sg - gy) * OS3D_SMOOTH_SCALE_F32;
+        out_grad[2] = (sg - gz) * OS3D_SMOOTH_SCALE_F32;
+    }
+
+    return value * OS3D_SMOOTH_SCALE_F32;
 }
 
-RE_INLINE RE_f64 RE_NOISE_OPENSIMPLEX3D_FAST_f64(RE_f64 x, RE_f64 y, RE_f64 z)
+RE_INLINE RE_f32 RE_NOISE_OS3D_SMOOTH_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                              RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_OS3D_SMOOTH_EVAL_f32(ctx, x, y, z, NULL);
+}
+
+RE_INLINE RE_f32 RE_NOISE_OS3D_SMOOTH_f32(RE_f32 x, RE_f32 y, RE_f32 z)
 {
-    RE_OS3D_ROTATE_FAST_f64(&x, &y, &z);
+    return RE_NOISE_OS3D_SMOOTH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
 
-    RE_OS3D_CornerF64 c[4];
-    /* Reuse f32 version for index logic, cast coordinates */
-    {
-        RE_OS3D_CornerF32 tmp[4];
-        RE_OS3D_GET_CORNERS_FAST_f32((RE_f32)x,(RE_f32)y,(RE_f32)z, tmp);
-
-        for (int i=0; i<4; i++){
-            c[i].i = tmp[i].i;
-            c[i].j = tmp[i].j;
-            c[i].k = tmp[i].k;
-            c[i].dx = (RE_f64)tmp[i].dx;
-            c[i].dy = (RE_f64)tmp[i].dy;
-            c[i].dz = (RE_f64)tmp[i].dz;
-            c[i].hash = tmp[i].hash;
-        }
-    }
+/* Value and analytic gradient (out_grad[3]) from the same corners and attenuation terms */
+RE_INLINE RE_f32 RE_NOISE_OS3D_SMOOTH_DERIV_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                    RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out_grad[3])
+{
+    return RE_OS3D_SMOOTH_EVAL_f32(ctx, x, y, z, out_grad);
+}
+
+RE_INLINE RE_f32 RE_NOISE_OS3D_SMOOTH_DERIV_f32(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out_grad[3])
+{
+    return RE_NOISE_OS3D_SMOOTH_DERIV_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out_grad);
+}
+
+
+/* ================================================================================================
+   OPEN SIMPLEX 2S 3D — f64
+   ================================================================================================ */
+
+RE_INLINE RE_f64 RE_OS3D_SMOOTH_EVAL_f64(const RE_NOISE_CONTEXT *ctx,
+                                         RE_f64 x, RE_f64 y, RE_f64 z, RE_f64 *out_grad)
+{
+    /* Reflect into lattice space: r = (2/3)(x+y+z) - x. The map is symmetric and its own inverse. */
+    RE_f64 r  = (2.0 / 3.0) * (x + y + z);
+    RE_f64 xr = r - x;
+    RE_f64 yr = r - y;
+    RE_f64 zr = r - z;
 
-    RE_f64 sum = 0.0;
+    RE_f64 value = 0.0, gx = 0.0, gy = 0.0, gz = 0.0;
 
-    for (int i = 0; i < 4; i++)
+    /* Lattice 0: integer points; lattice 1: integer points + 1/2 */
+    for (int l = 0; l < 2; l++)
     {
-        RE_f64 att = RE_OS3D_ATTENUATE_FAST_f64(c[i].dx, c[i].dy, c[i].dz);
-        if (att > 0.0)
+        RE_f64 ox = xr - 0.5 * l;
+        RE_f64 oy = yr - 0.5 * l;
+        RE_f64 oz = zr - 0.5 * l;
+
+        RE_i64 xb = RE_FASTFLOOR_f64(ox);
+        RE_i64 yb = RE_FASTFLOOR_f64(oy);
+        RE_i64 zb = RE_FASTFLOOR_f64(oz);
+
+        RE_f64 fx = ox - (RE_f64)xb;
+        RE_f64 fy = oy - (RE_f64)yb;
+        RE_f64 fz = oz - (RE_f64)zb;
+
+        /* Every point within the kernel radius (sqrt 0.75) is a corner of the enclosing cube */
+        for (int c = 0; c < 8; c++)
         {
-            RE_f64 dot = RE_OS3D_GRAD_DOT_FAST_f64(c[i].hash, c[i].dx, c[i].dy, c[i].dz);
-            sum += att * dot;
+            RE_i32 dx = c & 1, dy = (c >> 1) & 1, dz = c >> 2;
+
+            RE_f64 px = fx - dx;
+            RE_f64 py = fy - dy;
+            RE_f64 pz = fz - dz;
+
+            RE_f64 attn = 0.75 - (px*px + py*py + pz*pz);
+            if (attn > 0.0)
+            {
+                const RE_i8 *g = RE_NOISE_GRAD3[RE_OS3D_GRAD_INDEX(ctx->seed,
+                                                                   RE_NOISE_FOLD_i64(2 * (xb + dx) + l),
+                                                                   RE_NOISE_FOLD_i64(2 * (yb + dy) + l),
+                                                                   RE_NOISE_FOLD_i64(2 * (zb + dz) + l))];
+
+                RE_f64 dot = RE_OS_DOT3_f64(g, px, py, pz);
+                RE_f64 a2  = attn * attn;
+                RE_f64 a4  = a2 * a2;
+
+                value += a4 * dot;
+
+                if (out_grad)
+                {
+                    /* d/dp [a^4 (g.p)] = a^4 g - 8 a^3 (g.p) p */
+                    RE_f64 k = -8.0 * a2 * attn * dot;
+                    gx += a4 * g[0] + k * px;
+                    gy += a4 * g[1] + k * py;
+                    gz += a4 * g[2] + k * pz;
+                }
+            }
         }
     }
 
-    return sum * OS3D_SCALE_F64;
-}
+    if (out_grad)
+    {
+        RE_f64 sg = (2.0 / 3.0) * (gx + gy + gz);
+        out_grad[0] = (sg - gx) * OS3D_SMOOTH_SCALE_F64;
+        out_grad[1] = (sg - gy) * OS3D_SMOOTH_SCALE_F64;
+        out_grad[2] = (sg - gz) * OS3D_SMOOTH_SCALE_F64;
+    }
 
-/* ================================================================================================
-   OPEN SIMPLEX 2S (SMOOTH) 3D NOISE
-   High quality, isotropic — uses 5 corners (one extra vs FAST version).
-   ================================================================================================ */
+    return value * OS3D_SMOOTH_SCALE_F64;
+}
 
-/* Gradient dot helper */
-RE_INLINE RE_f32 RE_OS_DOT3_f32(const RE_i8 *g, RE_f32 x, RE_f32 y, RE_f32 z)
+RE_INLINE RE_f64 RE_NOISE_OS3D_SMOOTH_CTX_f64(const RE_NOISE_CONTEXT *ctx,
+                                              RE_f64 x, RE_f64 y, RE_f64 z)
 {
-    return g[0]*x + g[1]*y + g[2]*z;
+    return RE_OS3D_SMOOTH_EVAL_f64(ctx, x, y, z, NULL);
 }
 
-RE_INLINE RE_f64 RE_OS_DOT3_f64(const RE_i8 *g, RE_f64 x, RE_f64 y, RE_f64 z)
+RE_INLINE RE_f64 RE_NOISE_OS3D_SMOOTH_f64(RE_f64 x, RE_f64 y, RE_f64 z)
 {
-    return (RE_f64)g[0]*x + (RE_f64)g[1]*y + (RE_f64)g[2]*z;
+    return RE_NOISE_OS3D_SMOOTH_CTX_f64(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
 }
 
-/* ================================================================================================
-   OPEN SIMPLEX 2S 3D — f32
-   ================================================================================================ */
+/* ----------------------------------------
+    FAST OpenSimplex2 (3D)
+    Kernel radius^2 0.5 instead of 0.75: on each cubic sublattice only the nearest point
+    and its neighbour along the dominant axis can be in range, so at most 4 contributions.
+   ---------------------------------------- */
 
-RE_INLINE RE_f32 RE_NOISE_OS3D_SMOOTH_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+RE_INLINE RE_f32 RE_NOISE_OS3D_FAST_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                            RE_f32 x, RE_f32 y, RE_f32 z)
 {
-    /* Skew constants */
-    const RE_f32 R3 = (2.0f / 3.0f);      /* unskew factor */
-
-    /* Skew into BCC lattice */
-    RE_f32 s = (x + y + z) * R3;
-
-    RE_f32 xs = x + s;
-    RE_f32 ys = y + s;
-    RE_f32 zs = z + s;
-
-    RE_i32 xi = RE_FASTFLOOR_f32(xs);
-    RE_i32 yi = RE_FASTFLOOR_f32(ys);
-    RE_i32 zi = RE_FASTFLOOR_f32(zs);
-
-    /* Unskew */
-    RE_f32 t = (RE_f32)(xi + yi + zi) * R3;
-
-    RE_f32 X0 = xi - t;
-    RE_f32 Y0 = yi - t;
-    RE_f32 Z0 = zi - t;
-
-    RE_f32 x0 = x - X0;
-    RE_f32 y0 = y - Y0;
-    RE_f32 z0 = z - Z0;
-
-    /* Rank order the components */
-    RE_i32 rx = (x0 >= y0) + (x0 >= z0);
-    RE_i32 ry = (y0 >= x0) + (y0 >= z0);
-    RE_i32 rz = 3 - (rx + ry);
-
-    /* 5 corner offsets */
-    static const RE_i32 LATTICE_CORNER[5][3] = {
-        {0,0,0},
-        {1,0,0},
-        {0,1,0},
-        {0,0,1},
-        {1,1,1}
-    };
+    /* Same reflected two-lattice grid as the smooth variant */
+    RE_f32 r  = (2.0f / 3.0f) * (x + y + z);
+    RE_f32 xr = r - x;
+    RE_f32 yr = r - y;
+    RE_f32 zr = r - z;
 
-    /* Weighted contributions */
     RE_f32 value = 0.0f;
 
-    for (int i = 0; i < 5; i++)
+    for (int l = 0; l < 2; l++)
     {
-        RE_i32 dx = LATTICE_CORNER[i][0];
-        RE_i32 dy = LATTICE_CORNER[i][1];
-        RE_i32 dz = LATTICE_CORNER[i][2];
+        RE_f32 ox = xr - 0.5f * l;
+        RE_f32 oy = yr - 0.5f * l;
+        RE_f32 oz = zr - 0.5f * l;
 
-        /* Second through fourth corners use rank logic */
-        if (i == 1) dx = (rx >= 2);
-        if (i == 2) dy = (ry >= 2);
-        if (i == 3) dz = (rz >= 2);
+        /* Nearest lattice point */
+        RE_i32 xn = (RE_i32)RE_FASTFLOOR_f32(ox + 0.5f);
+        RE_i32 yn = (RE_i32)RE_FASTFLOOR_f32(oy + 0.5f);
+        RE_i32 zn = (RE_i32)RE_FASTFLOOR_f32(oz + 0.5f);
 
-        RE_f32 px = x0 - dx + R3 * i;
-        RE_f32 py = y0 - dy + R3 * i;
-        RE_f32 pz = z0 - dz + R3 * i;
+        RE_f32 px = ox - xn;
+        RE_f32 py = oy - yn;
+        RE_f32 pz = oz - zn;
 
-        RE_f32 attn = 0.6f - (px*px + py*py + pz*pz);
+        RE_f32 attn = 0.5f - (px*px + py*py + pz*pz);
         if (attn > 0.0f)
         {
-            RE_i32 hash = RE_NOISE_HASH3(xi + dx, yi + dy, zi + dz);
-            const RE_i8 *g = RE_NOISE_GRAD3[hash % 12];
+            const RE_i8 *g = RE_NOISE_GRAD3[RE_OS3D_GRAD_INDEX(ctx->seed, 2 * xn + l, 2 * yn + l, 2 * zn + l)];
+            RE_f32 dot = RE_OS_DOT3_f32(g, px, py, pz);
+            attn *= attn;
+            value += attn * attn * dot;
+        }
+
+        /* Its neighbour along the dominant axis (on a tie neither neighbour is in range) */
+        RE_f32 ax = px < 0.0f ? -px : px;
+        RE_f32 ay = py < 0.0f ? -py : py;
+        RE_f32 az = pz < 0.0f ? -pz : pz;
+        RE_i32 sx = 0, sy = 0, sz = 0;
 
+        if (ax >= ay && ax >= az) sx = px < 0.0f ? -1 : 1;
+        else if (ay >= az)        sy = py < 0.0f ? -1 : 1;
+        else                      sz = pz < 0.0f ? -1 : 1;
+
+        px -= (RE_f32)sx;
+        py -= (RE_f32)sy;
+        pz -= (RE_f32)sz;
+
+        attn = 0.5f - (px*px + py*py + pz*pz);
+        if (attn > 0.0f)
+        {
+            const RE_i8 *g = RE_NOISE_GRAD3[RE_OS3D_GRAD_INDEX(ctx->seed, 2 * (xn + sx) + l,
+                                                                            2 * (yn + sy) + l,
+                                                                            2 * (zn + sz) + l)];
             RE_f32 dot = RE_OS_DOT3_f32(g, px, py, pz);
             attn *= attn;
             value += attn * attn * dot;
         }
     }
 
-    return value * (OS3D_SCALE_F32);
+    return value * OS3D_FAST_SCALE_F32;
+}
+
+RE_INLINE RE_f32 RE_NOISE_OS3D_FAST_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_OS3D_FAST_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
 }
 
 
 /* ================================================================================================
-   OPEN SIMPLEX 2S 3D — f64
+   DOUBLE VERSION
    ================================================================================================ */
 
-RE_INLINE RE_f64 RE_NOISE_OS3D_SMOOTH_f64(RE_f64 x, RE_f64 y, RE_f64 z)
+RE_INLINE RE_f64 RE_NOISE_OS3D_FAST_CTX_f64(const RE_NOISE_CONTEXT *ctx,
+                                            RE_f64 x, RE_f64 y, RE_f64 z)
 {
-    const RE_f64 R3 = (2.0 / 3.0);
+    /* Same reflected two-lattice grid as the smooth variant */
+    RE_f64 r  = (2.0 / 3.0) * (x + y + z);
+    RE_f64 xr = r - x;
+    RE_f64 yr = r - y;
+    RE_f64 zr = r - z;
 
-    RE_f64 s = (x+y+z) * R3;
+    RE_f64 value = 0.0;
 
-    RE_f64 xs = x + s;
-    RE_f64 ys = y + s;
-    RE_f64 zs = z + s;
+    for (int l = 0; l < 2; l++)
+    {
+        RE_f64 ox = xr - 0.5 * l;
+        RE_f64 oy = yr - 0.5 * l;
+        RE_f64 oz = zr - 0.5 * l;
 
-    RE_i64 xi = RE_FASTFLOOR_f64(xs);
-    RE_i64 yi = RE_FASTFLOOR_f64(ys);
-    RE_i64 zi = RE_FASTFLOOR_f64(zs);
+        /* Nearest lattice point */
+        RE_i64 xn = RE_FASTFLOOR_f64(ox + 0.5);
+        RE_i64 yn = RE_FASTFLOOR_f64(oy + 0.5);
+        RE_i64 zn = RE_FASTFLOOR_f64(oz + 0.5);
 
-    RE_f64 t = (RE_f64)(xi + yi + zi) * R3;
+        RE_f64 px = ox - (RE_f64)xn;
+        RE_f64 py = oy - (RE_f64)yn;
+        RE_f64 pz = oz - (RE_f64)zn;
 
-    RE_f64 X0 = xi - t;
-    RE_f64 Y0 = yi - t;
-    RE_f64 Z0 = zi - t;
+        RE_f64 attn = 0.5 - (px*px + py*py + pz*pz);
+        if (attn > 0.0)
+        {
+            const RE_i8 *g = RE_NOISE_GRAD3[RE_OS3D_GRAD_INDEX(ctx->seed, RE_NOISE_FOLD_i64(2 * xn + l),
+                                                                            RE_NOISE_FOLD_i64(2 * yn + l),
+                                                                            RE_NOISE_FOLD_i64(2 * zn + l))];
+            RE_f64 dot = RE_OS_DOT3_f64(g, px, py, pz);
+            attn *= attn;
+            value += attn * attn * dot;
+        }
 
-    RE_f64 x0 = x - X0;
-    RE_f64 y0 = y - Y0;
-    RE_f64 z0 = z - Z0;
+        /* Its neighbour along the dominant axis (on a tie neither neighbour is in range) */
+        RE_f64 ax = px < 0.0 ? -px : px;
+        RE_f64 ay = py < 0.0 ? -py : py;
+        RE_f64 az = pz < 0.0 ? -pz : pz;
+        RE_i32 sx = 0, sy = 0, sz = 0;
 
-    RE_i32 rx = (x0 >= y0) + (x0 >= z0);
-    RE_i32 ry = (y0 >= x0) + (y0 >= z0);
-    RE_i32 rz = 3 - (rx + ry);
+        if (ax >= ay && ax >= az) sx = px < 0.0 ? -1 : 1;
+        else if (ay >= az)        sy = py < 0.0 ? -1 : 1;
+        else                      sz = pz < 0.0 ? -1 : 1;
 
-    static const RE_i32 LATTICE_CORNER[5][3] = {
-        {0,0,0},
-        {1,0,0},
-        {0,1,0},
-        {0,0,1},
-        {1,1,1}
-    };
+        px -= (RE_f64)sx;
+        py -= (RE_f64)sy;
+        pz -= (RE_f64)sz;
 
-    RE_f64 value = 0.0;
+        attn = 0.5 - (px*px + py*py + pz*pz);
+        if (attn > 0.0)
+        {
+            const RE_i8 *g = RE_NOISE_GRAD3[RE_OS3D_GRAD_INDEX(ctx->seed, RE_NOISE_FOLD_i64(2 * (xn + sx) + l),
+                                                                            RE_NOISE_FOLD_i64(2 * (yn + sy) + l),
+                                                                            RE_NOISE_FOLD_i64(2 * (zn + sz) + l))];
+            RE_f64 dot = RE_OS_DOT3_f64(g, px, py, pz);
+            attn *= attn;
+            value += attn * attn * dot;
+        }
+    }
 
-    for (int i = 0; i < 5; i++)
-    {
-        RE_i32 dx = LATTICE_CORNER[i][0];
-        RE_i32 dy = LATTICE_CORNER[i][1];
-        RE_i32 dz = LATTICE_CORNER[i][2];
+    return value * OS3D_FAST_SCALE_F64;
+}
+
+RE_INLINE RE_f64 RE_NOISE_OS3D_FAST_f64(RE_f64 x, RE_f64 y, RE_f64 z)
+{
+    return RE_NOISE_OS3D_FAST_CTX_f64(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
 
-        if (i == 1) dx = (rx >= 2);
-        if (i == 2) dy = (ry >= 2);
-        if (i == 3) dz = (rz >= 2);
+/* ================================================================================================
+   MAIN FAST FUNCTION (OpenSimplex2F)
+   Same field as RE_NOISE_OS3D_FAST; kept under its original name.
+================================================================================================ */
 
-        RE_f64 px = x0 - dx + R3 * i;
-        RE_f64 py = y0 - dy + R3 * i;
-        RE_f64 pz = z0 - dz + R3 * i;
+RE_INLINE RE_f32 RE_NOISE_OPENSIMPLEX3D_FAST_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                     RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_OS3D_FAST_CTX_f32(ctx, x, y, z);
+}
 
-        RE_f64 attn = 0.6 - (px*px + py*py + pz*pz);
-        if (attn > 0.0)
+RE_INLINE RE_f32 RE_NOISE_OPENSIMPLEX3D_FAST_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_OPENSIMPLEX3D_FAST_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+RE_INLINE RE_f64 RE_NOISE_OPENSIMPLEX3D_FAST_CTX_f64(const RE_NOISE_CONTEXT *ctx,
+                                                     RE_f64 x, RE_f64 y, RE_f64 z)
+{
+    return RE_NOISE_OS3D_FAST_CTX_f64(ctx, x, y, z);
+}
+
+RE_INLINE RE_f64 RE_NOISE_OPENSIMPLEX3D_FAST_f64(RE_f64 x, RE_f64 y, RE_f64 z)
+{
+    return RE_NOISE_OPENSIMPLEX3D_FAST_CTX_f64(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* ================================================================================================
+   OPEN SIMPLEX 2 3D — LANE-PARALLEL (SoA batch)
+   ------------------------------------------------------------------------------------------------
+   Same math as the scalar FAST / SMOOTH functions with the points in lanes: 8 per iteration on
+   AVX2, 4 on SSE2. Out-of-range corners are not skipped; their attenuation is clamped to 0, so
+   every lane runs the same instruction stream. RE_OS3D_HASH runs on integer lanes, and the
+   gradient dot is the masked RE_NOISE_GRAD3 form used by the Perlin kernels.
+================================================================================================ */
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+/* Lane-wise RE_OS3D_HASH_SEED */
+RE_INLINE __m128i RE_OS3D_HASH_SEED_X4_sse(RE_u32 seed, __m128i x, __m128i y, __m128i z)
+{
+    __m128i h = _mm_xor_si128(RE_MULLO_X4_u32_sse(x, _mm_set1_epi32(0x1bd11bd)),
+                              RE_MULLO_X4_u32_sse(y, _mm_set1_epi32(0x3ad29dd)));
+    h = _mm_xor_si128(h, RE_MULLO_X4_u32_sse(z, _mm_set1_epi32(0x68431fd)));
+    h = _mm_xor_si128(h, _mm_set1_epi32((int)(seed * 0x9e3779b9u)));
+    return RE_PCG_MIX32_X4_sse(h);
+}
+
+/* a^4 (g . p) with a = max(attn, 0) */
+RE_INLINE __m128 RE_OS3D_CONTRIB_X4_sse(RE_u32 seed, __m128i x2, __m128i y2, __m128i z2,
+                                        __m128 px, __m128 py, __m128 pz, __m128 radius2)
+{
+    __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, px), _mm_mul_ps(py, py)), _mm_mul_ps(pz, pz));
+    __m128 a  = _mm_max_ps(_mm_sub_ps(radius2, d2), _mm_setzero_ps());
+    __m128i g = RE_HASH_TO_GRAD12_X4_sse(RE_OS3D_HASH_SEED_X4_sse(seed, x2, y2, z2));
+
+    a = _mm_mul_ps(a, a);
+    return _mm_mul_ps(_mm_mul_ps(a, a), RE_NOISE_GRAD3_DOT_X4_sse(g, px, py, pz));
+}
+
+RE_INLINE __m128 RE_NOISE_OS3D_SMOOTH_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx,
+                                                     __m128 x, __m128 y, __m128 z)
+{
+    __m128 r  = _mm_mul_ps(_mm_set1_ps(2.0f / 3.0f), _mm_add_ps(_mm_add_ps(x, y), z));
+    __m128 xr = _mm_sub_ps(r, x);
+    __m128 yr = _mm_sub_ps(r, y);
+    __m128 zr = _mm_sub_ps(r, z);
+
+    __m128 one   = _mm_set1_ps(1.0f);
+    __m128 rad   = _mm_set1_ps(0.75f);
+    __m128 value = _mm_setzero_ps();
+
+    for (int l = 0; l < 2; l++)
+    {
+        __m128 sh = _mm_set1_ps(0.5f * l);
+        __m128 bx, by, bz;
+        __m128i xb = RE_NOISE_FLOOR_X4_f32_sse(_mm_sub_ps(xr, sh), &bx);
+        __m128i yb = RE_NOISE_FLOOR_X4_f32_sse(_mm_sub_ps(yr, sh), &by);
+        __m128i zb = RE_NOISE_FLOOR_X4_f32_sse(_mm_sub_ps(zr, sh), &bz);
+
+        __m128 f[2][3];
+        f[0][0] = _mm_sub_ps(_mm_sub_ps(xr, sh), bx);  f[1][0] = _mm_sub_ps(f[0][0], one);
+        f[0][1] = _mm_sub_ps(_mm_sub_ps(yr, sh), by);  f[1][1] = _mm_sub_ps(f[0][1], one);
+        f[0][2] = _mm_sub_ps(_mm_sub_ps(zr, sh), bz);  f[1][2] = _mm_sub_ps(f[0][2], one);
+
+        /* Doubled lattice coordinates of the d = 0 and d = 1 corners */
+        __m128i li = _mm_set1_epi32(l), two = _mm_set1_epi32(2);
+        __m128i c[2][3];
+        c[0][0] = _mm_add_epi32(_mm_slli_epi32(xb, 1), li);  c[1][0] = _mm_add_epi32(c[0][0], two);
+        c[0][1] = _mm_add_epi32(_mm_slli_epi32(yb, 1), li);  c[1][1] = _mm_add_epi32(c[0][1], two);
+        c[0][2] = _mm_add_epi32(_mm_slli_epi32(zb, 1), li);  c[1][2] = _mm_add_epi32(c[0][2], two);
+
+        for (int k = 0; k < 8; k++)
         {
-            RE_i32 hash = RE_NOISE_HASH3((RE_i32)(xi+dx), (RE_i32)(yi+dy), (RE_i32)(zi+dz));
-            const RE_i8 *g = RE_NOISE_GRAD3[hash % 12];
+            int dx = k & 1, dy = (k >> 1) & 1, dz = k >> 2;
+            value = _mm_add_ps(value, RE_OS3D_CONTRIB_X4_sse(ctx->seed, c[dx][0], c[dy][1], c[dz][2],
+                                                             f[dx][0], f[dy][1], f[dz][2], rad));
+        }
+    }
 
-            RE_f64 dot = RE_OS_DOT3_f64(g, px, py, pz);
+    return _mm_mul_ps(value, _mm_set1_ps(OS3D_SMOOTH_SCALE_F32));
+}
 
-            attn *= attn;
-            value += attn * attn * dot;
+RE_INLINE __m128 RE_NOISE_OS3D_FAST_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx,
+                                                   __m128 x, __m128 y, __m128 z)
+{
+    __m128 r  = _mm_mul_ps(_mm_set1_ps(2.0f / 3.0f), _mm_add_ps(_mm_add_ps(x, y), z));
+    __m128 xr = _mm_sub_ps(r, x);
+    __m128 yr = _mm_sub_ps(r, y);
+    __m128 zr = _mm_sub_ps(r, z);
+
+    __m128 half  = _mm_set1_ps(0.5f);
+    __m128 one   = _mm_set1_ps(1.0f);
+    __m128 sign  = _mm_set1_ps(-0.0f);
+    __m128 value = _mm_setzero_ps();
+
+    for (int l = 0; l < 2; l++)
+    {
+        __m128 sh = _mm_set1_ps(0.5f * l);
+        __m128 ox = _mm_sub_ps(xr, sh);
+        __m128 oy = _mm_sub_ps(yr, sh);
+        __m128 oz = _mm_sub_ps(zr, sh);
+
+        /* Nearest lattice point */
+        __m128 nx, ny, nz;
+        __m128i xn = RE_NOISE_FLOOR_X4_f32_sse(_mm_add_ps(ox, half), &nx);
+        __m128i yn = RE_NOISE_FLOOR_X4_f32_sse(_mm_add_ps(oy, half), &ny);
+        __m128i zn = RE_NOISE_FLOOR_X4_f32_sse(_mm_add_ps(oz, half), &nz);
+
+        __m128 px = _mm_sub_ps(ox, nx);
+        __m128 py = _mm_sub_ps(oy, ny);
+        __m128 pz = _mm_sub_ps(oz, nz);
+
+        __m128i li = _mm_set1_epi32(l);
+        __m128i x2 = _mm_add_epi32(_mm_slli_epi32(xn, 1), li);
+        __m128i y2 = _mm_add_epi32(_mm_slli_epi32(yn, 1), li);
+        __m128i z2 = _mm_add_epi32(_mm_slli_epi32(zn, 1), li);
+
+        value = _mm_add_ps(value, RE_OS3D_CONTRIB_X4_sse(ctx->seed, x2, y2, z2, px, py, pz, half));
+
+        /* Dominant-axis neighbour: step = ±1 on that axis, 0 elsewhere */
+        __m128 ax = _mm_andnot_ps(sign, px);
+        __m128 ay = _mm_andnot_ps(sign, py);
+        __m128 az = _mm_andnot_ps(sign, pz);
+
+        __m128 mx = _mm_and_ps(_mm_cmpge_ps(ax, ay), _mm_cmpge_ps(ax, az));
+        __m128 my = _mm_andnot_ps(mx, _mm_cmpge_ps(ay, az));
+        __m128 mz = _mm_andnot_ps(_mm_or_ps(mx, my), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+
+        #define STEP(p, m) _mm_and_ps(m, _mm_or_ps(_mm_and_ps(_mm_cmplt_ps(p, _mm_setzero_ps()), sign), one))
+
+        __m128 sx = STEP(px, mx);
+        __m128 sy = STEP(py, my);
+        __m128 sz = STEP(pz, mz);
+
+        #undef STEP
+
+        x2 = _mm_add_epi32(x2, _mm_slli_epi32(_mm_cvttps_epi32(sx), 1));
+        y2 = _mm_add_epi32(y2, _mm_slli_epi32(_mm_cvttps_epi32(sy), 1));
+        z2 = _mm_add_epi32(z2, _mm_slli_epi32(_mm_cvttps_epi32(sz), 1));
+
+        value = _mm_add_ps(value, RE_OS3D_CONTRIB_X4_sse(ctx->seed, x2, y2, z2,
+                                                         _mm_sub_ps(px, sx), _mm_sub_ps(py, sy),
+                                                         _mm_sub_ps(pz, sz), half));
+    }
+
+    return _mm_mul_ps(value, _mm_set1_ps(OS3D_FAST_SCALE_F32));
+}
+
+#endif /* SSE */
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+
+/* Lane-wise RE_OS3D_HASH_SEED */
+RE_INLINE __m256i RE_OS3D_HASH_SEED_X8_avx2(RE_u32 seed, __m256i x, __m256i y, __m256i z)
+{
+    __m256i h = _mm256_xor_si256(_mm256_mullo_epi32(x, _mm256_set1_epi32(0x1bd11bd)),
+                                 _mm256_mullo_epi32(y, _mm256_set1_epi32(0x3ad29dd)));
+    h = _mm256_xor_si256(h, _mm256_mullo_epi32(z, _mm256_set1_epi32(0x68431fd)));
+    h = _mm256_xor_si256(h, _mm256_set1_epi32((int)(seed * 0x9e3779b9u)));
+    return RE_PCG_MIX32_X8_avx2(h);
+}
+
+/* RE_NOISE_GRAD3_DOT on a register of gradient indices */
+RE_INLINE __m256 RE_NOISE_GRAD3_DOT_X8_avx2(__m256i gi, __m256 x, __m256 y, __m256 z)
+{
+    __m256 use_x  = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(8), gi));
+    __m256 use_y  = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), gi));
+    __m256 sign_u = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(gi, _mm256_set1_epi32(1)), 31));
+    __m256 sign_v = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(gi, _mm256_set1_epi32(2)), 30));
+
+    __m256 u = _mm256_blendv_ps(y, x, use_x);
+    __m256 v = _mm256_blendv_ps(z, y, use_y);
+
+    return _mm256_add_ps(_mm256_xor_ps(u, sign_u), _mm256_xor_ps(v, sign_v));
+}
+
+RE_INLINE __m256 RE_OS3D_CONTRIB_X8_avx2(RE_u32 seed, __m256i x2, __m256i y2, __m256i z2,
+                                         __m256 px, __m256 py, __m256 pz, __m256 radius2)
+{
+    __m256 d2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(px, px), _mm256_mul_ps(py, py)),
+                              _mm256_mul_ps(pz, pz));
+    __m256 a  = _mm256_max_ps(_mm256_sub_ps(radius2, d2), _mm256_setzero_ps());
+    __m256i g = RE_HASH_TO_GRAD12_X8_avx2(RE_OS3D_HASH_SEED_X8_avx2(seed, x2, y2, z2));
+
+    a = _mm256_mul_ps(a, a);
+    return _mm256_mul_ps(_mm256_mul_ps(a, a), RE_NOISE_GRAD3_DOT_X8_avx2(g, px, py, pz));
+}
+
+RE_INLINE __m256 RE_NOISE_OS3D_SMOOTH_X8_CTX_f32_avx2(const RE_NOISE_CONTEXT *ctx,
+                                                      __m256 x, __m256 y, __m256 z)
+{
+    __m256 r  = _mm256_mul_ps(_mm256_set1_ps(2.0f / 3.0f), _mm256_add_ps(_mm256_add_ps(x, y), z));
+    __m256 xr = _mm256_sub_ps(r, x);
+    __m256 yr = _mm256_sub_ps(r, y);
+    __m256 zr = _mm256_sub_ps(r, z);
+
+    __m256 one   = _mm256_set1_ps(1.0f);
+    __m256 rad   = _mm256_set1_ps(0.75f);
+    __m256 value = _mm256_setzero_ps();
+
+    for (int l = 0; l < 2; l++)
+    {
+        __m256 sh = _mm256_set1_ps(0.5f * l);
+        __m256 ox = _mm256_sub_ps(xr, sh);
+        __m256 oy = _mm256_sub_ps(yr, sh);
+        __m256 oz = _mm256_sub_ps(zr, sh);
+
+        __m256 bx = _mm256_floor_ps(ox);
+        __m256 by = _mm256_floor_ps(oy);
+        __m256 bz = _mm256_floor_ps(oz);
+
+        __m256 f[2][3];
+        f[0][0] = _mm256_sub_ps(ox, bx);  f[1][0] = _mm256_sub_ps(f[0][0], one);
+        f[0][1] = _mm256_sub_ps(oy, by);  f[1][1] = _mm256_sub_ps(f[0][1], one);
+        f[0][2] = _mm256_sub_ps(oz, bz);  f[1][2] = _mm256_sub_ps(f[0][2], one);
+
+        /* Doubled lattice coordinates of the d = 0 and d = 1 corners */
+        __m256i li = _mm256_set1_epi32(l), two = _mm256_set1_epi32(2);
+        __m256i c[2][3];
+        c[0][0] = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(bx), 1), li);
+        c[0][1] = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(by), 1), li);
+        c[0][2] = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(bz), 1), li);
+        c[1][0] = _mm256_add_epi32(c[0][0], two);
+        c[1][1] = _mm256_add_epi32(c[0][1], two);
+        c[1][2] = _mm256_add_epi32(c[0][2], two);
+
+        for (int k = 0; k < 8; k++)
+        {
+            int dx = k & 1, dy = (k >> 1) & 1, dz = k >> 2;
+            value = _mm256_add_ps(value, RE_OS3D_CONTRIB_X8_avx2(ctx->seed, c[dx][0], c[dy][1], c[dz][2],
+                                                                 f[dx][0], f[dy][1], f[dz][2], rad));
         }
     }
 
-    return value * (OS3D_SCALE_F64);
+    return _mm256_mul_ps(value, _mm256_set1_ps(OS3D_SMOOTH_SCALE_F32));
+}
+
+RE_INLINE __m256 RE_NOISE_OS3D_FAST_X8_CTX_f32_avx2(const RE_NOISE_CONTEXT *ctx,
+                                                    __m256 x, __m256 y, __m256 z)
+{
+    __m256 r  = _mm256_mul_ps(_mm256_set1_ps(2.0f / 3.0f), _mm256_add_ps(_mm256_add_ps(x, y), z));
+    __m256 xr = _mm256_sub_ps(r, x);
+    __m256 yr = _mm256_sub_ps(r, y);
+    __m256 zr = _mm256_sub_ps(r, z);
+
+    __m256 half  = _mm256_set1_ps(0.5f);
+    __m256 one   = _mm256_set1_ps(1.0f);
+    __m256 sign  = _mm256_set1_ps(-0.0f);
+    __m256 value = _mm256_setzero_ps();
+
+    for (int l = 0; l < 2; l++)
+    {
+        __m256 sh = _mm256_set1_ps(0.5f * l);
+        __m256 ox = _mm256_sub_ps(xr, sh);
+        __m256 oy = _mm256_sub_ps(yr, sh);
+        __m256 oz = _mm256_sub_ps(zr, sh);
+
+        /* Nearest lattice point */
+        __m256 nx = _mm256_floor_ps(_mm256_add_ps(ox, half));
+        __m256 ny = _mm256_floor_ps(_mm256_add_ps(oy, half));
+        __m256 nz = _mm256_floor_ps(_mm256_add_ps(oz, half));
+
+        __m256 px = _mm256_sub_ps(ox, nx);
+        __m256 py = _mm256_sub_ps(oy, ny);
+        __m256 pz = _mm256_sub_ps(oz, nz);
+
+        __m256i li = _mm256_set1_epi32(l);
+        __m256i x2 = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(nx), 1), li);
+        __m256i y2 = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(ny), 1), li);
+        __m256i z2 = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(nz), 1), li);
+
+        value = _mm256_add_ps(value, RE_OS3D_CONTRIB_X8_avx2(ctx->seed, x2, y2, z2, px, py, pz, half));
+
+        /* Dominant-axis neighbour: step = ±1 on that axis, 0 elsewhere */
+        __m256 ax = _mm256_andnot_ps(sign, px);
+        __m256 ay = _mm256_andnot_ps(sign, py);
+        __m256 az = _mm256_andnot_ps(sign, pz);
+
+        __m256 mx = _mm256_and_ps(_mm256_cmp_ps(ax, ay, _CMP_GE_OQ), _mm256_cmp_ps(ax, az, _CMP_GE_OQ));
+        __m256 my = _mm256_andnot_ps(mx, _mm256_cmp_ps(ay, az, _CMP_GE_OQ));
+        __m256 mz = _mm256_andnot_ps(_mm256_or_ps(mx, my), _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+
+        #define STEP(p, m) _mm256_and_ps(m, _mm256_or_ps(_mm256_and_ps(                           \
+                               _mm256_cmp_ps(p, _mm256_setzero_ps(), _CMP_LT_OQ), sign), one))
+
+        __m256 sx = STEP(px, mx);
+        __m256 sy = STEP(py, my);
+        __m256 sz = STEP(pz, mz);
+
+        #undef STEP
+
+        x2 = _mm256_add_epi32(x2, _mm256_slli_epi32(_mm256_cvttps_epi32(sx), 1));
+        y2 = _mm256_add_epi32(y2, _mm256_slli_epi32(_mm256_cvttps_epi32(sy), 1));
+        z2 = _mm256_add_epi32(z2, _mm256_slli_epi32(_mm256_cvttps_epi32(sz), 1));
+
+        value = _mm256_add_ps(value, RE_OS3D_CONTRIB_X8_avx2(ctx->seed, x2, y2, z2,
+                                                             _mm256_sub_ps(px, sx), _mm256_sub_ps(py, sy),
+                                                             _mm256_sub_ps(pz, sz), half));
+    }
+
+    return _mm256_mul_ps(value, _mm256_set1_ps(OS3D_FAST_SCALE_F32));
+}
+
+#endif /* AVX2 */
+
+/* SoA batch: out[i] = RE_NOISE_OS3D_FAST_CTX_f32(ctx, x[i], y[i], z[i]) */
+RE_INLINE void RE_NOISE_OS3D_FAST_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                                RE_f32 *out, int count)
+{
+    int i = 0;
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, RE_NOISE_OS3D_FAST_X8_CTX_f32_avx2(ctx, _mm256_loadu_ps(x + i),
+                                                                     _mm256_loadu_ps(y + i),
+                                                                     _mm256_loadu_ps(z + i)));
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, RE_NOISE_OS3D_FAST_X4_CTX_f32_sse(ctx, _mm_loadu_ps(x + i),
+                                                                 _mm_loadu_ps(y + i),
+                                                                 _mm_loadu_ps(z + i)));
+#endif
+
+    for (; i < count; i++)
+        out[i] = RE_NOISE_OS3D_FAST_CTX_f32(ctx, x[i], y[i], z[i]);
+}
+
+RE_INLINE void RE_NOISE_OS3D_FAST_BATCH_f32(const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                            RE_f32 *out, int count)
+{
+    RE_NOISE_OS3D_FAST_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out, count);
+}
+
+RE_INLINE void RE_NOISE_OPENSIMPLEX3D_FAST_BATCH_f32(const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                                     RE_f32 *out, int count)
+{
+    RE_NOISE_OS3D_FAST_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out, count);
+}
+
+/* SoA batch: out[i] = RE_NOISE_OS3D_SMOOTH_CTX_f32(ctx, x[i], y[i], z[i]) */
+RE_INLINE void RE_NOISE_OS3D_SMOOTH_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                  const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                                  RE_f32 *out, int count)
+{
+    int i = 0;
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, RE_NOISE_OS3D_SMOOTH_X8_CTX_f32_avx2(ctx, _mm256_loadu_ps(x + i),
+                                                                       _mm256_loadu_ps(y + i),
+                                                                       _mm256_loadu_ps(z + i)));
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, RE_NOISE_OS3D_SMOOTH_X4_CTX_f32_sse(ctx, _mm_loadu_ps(x + i),
+                                                                   _mm_loadu_ps(y + i),
+                                                                   _mm_loadu_ps(z + i)));
+#endif
+
+    for (; i < count; i++)
+        out[i] = RE_NOISE_OS3D_SMOOTH_CTX_f32(ctx, x[i], y[i], z[i]);
+}
+
+RE_INLINE void RE_NOISE_OS3D_SMOOTH_BATCH_f32(const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                              RE_f32 *out, int count)
+{
+    RE_NOISE_OS3D_SMOOTH_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out, count);
 }
 
-/* ----------------------------------------
-    FAST OpenSimplex2 (3D)
-    Uses 4 contributions instead of 5
-   ---------------------------------------- */
+/* =============================================================================================
+   OPEN SIMPLEX 2S (SMOOTH) — 2D — f32
+   ============================================================================================= */
 
-RE_INLINE RE_f32 RE_NOISE_OS3D_FAST_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+RE_INLINE RE_f32 RE_OS2D_SMOOTH_EVAL_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y, RE_f32 *out_grad)
 {
-    /* Skew constant */
-    const RE_f32 R3 = (2.0f / 3.0f);
+    const RE_f32 S2 = 0.366025403784439f;  /* (sqrt(3)-1)/2 */
+    const RE_f32 U2 = 0.211324865405187f;  /* (3-sqrt(3))/6 */
 
-    /* Skew into stretched BCC lattice */
-    RE_f32 s = (x + y + z) * R3;
-    RE_f32 xs = x + s;
-    RE_f32 ys = y + s;
-    RE_f32 zs = z + s;
-
-    RE_i32 xi = RE_FASTFLOOR_f32(xs);
-    RE_i32 yi = RE_FASTFLOOR_f32(ys);
-    RE_i32 zi = RE_FASTFLOOR_f32(zs);
-
-    /* Unskew */
-    RE_f32 t = (RE_f32)(xi + yi + zi) * R3;
-    RE_f32 X0 = xi - t;
-    RE_f32 Y0 = yi - t;
-    RE_f32 Z0 = zi - t;
-
-    /* Distances */
-    RE_f32 x0 = x - X0;
-    RE_f32 y0 = y - Y0;
-    RE_f32 z0 = z - Z0;
-
-    /* Rank components */
-    RE_i32 rx = (x0 >= y0) + (x0 >= z0);
-    RE_i32 ry = (y0 >= x0) + (y0 >= z0);
-    RE_i32 rz = 3 - (rx + ry);
-
-    /* Corner offsets */
-    static const RE_i32 LATTICE[4][3] = {
-        {0,0,0},     /* first */
-        {1,0,0},     /* sorted by rank */
-        {0,1,0},
-        {0,0,1}
+    /* Skewed base cell */
+    RE_f32 s = (x + y) * S2;
+    RE_i32 i = (RE_i32)RE_FASTFLOOR_f32(x + s);
+    RE_i32 j = (RE_i32)RE_FASTFLOOR_f32(y + s);
+
+    /* Offset from the unskewed base vertex */
+    RE_f32 t  = (RE_f32)(i + j) * U2;
+    RE_f32 x0 = x - ((RE_f32)i - t);
+    RE_f32 y0 = y - ((RE_f32)j - t);
+
+    /* Every vertex within the kernel radius (sqrt 2/3) is one of these */
+    static const RE_i32 OFF[8][2] = {
+        {0,0}, {1,0}, {0,1}, {1,1},
+        {-1,0}, {0,-1}, {2,1}, {1,2}
     };
 
-    RE_f32 value = 0.0f;
+    RE_f32 value = 0.0f, gx = 0.0f, gy = 0.0f;
 
-    for (int i = 0; i < 4; i++)
+    for (int c = 0; c < 8; c++)
     {
-        RE_i32 dx = LATTICE[i][0];
-        RE_i32 dy = LATTICE[i][1];
-        RE_i32 dz = LATTICE[i][2];
-
-        /* Choose the right ranked component for 2nd, 3rd, 4th corners */
-        if (i == 1) dx = (rx >= 2);
-        if (i == 2) dy = (ry >= 2);
-        if (i == 3) dz = (rz >= 2);
+        RE_f32 dx = x0 - (OFF[c][0] - (OFF[c][0] + OFF[c][1]) * U2);
+        RE_f32 dy = y0 - (OFF[c][1] - (OFF[c][0] + OFF[c][1]) * U2);
 
-        RE_f32 px = x0 - dx + R3 * i;
-        RE_f32 py = y0 - dy + R3 * i;
-        RE_f32 pz = z0 - dz + R3 * i;
-
-        RE_f32 attn = 0.75f - (px*px + py*py + pz*pz);
+        RE_f32 attn = (2.0f / 3.0f) - dx*dx - dy*dy;
         if (attn > 0.0f)
         {
-            RE_i32 hash = RE_NOISE_HASH3(xi+dx, yi+dy, zi+dz);
-            const RE_i8 *g = RE_NOISE_GRAD3[hash % 12];
+            RE_u8 h = RE_NOISE_CTX_HASH2(ctx, i + OFF[c][0], j + OFF[c][1]);
+            const RE_i8 *g = RE_NOISE_GRAD2[h & 7];
 
-            RE_f32 dot = g[0]*px + g[1]*py + g[2]*pz;
+            RE_f32 dot = g[0]*dx + g[1]*dy;
+            RE_f32 a2  = attn * attn;
+            RE_f32 a4  = a2 * a2;
 
-            attn *= attn;
-            value += attn * attn * dot;
+            value += a4 * dot;
+
+            if (out_grad)
+            {
+                RE_f32 k = -8.0f * a2 * attn * dot;
+                gx += a4 * g[0] + k * dx;
+                gy += a4 * g[1] + k * dy;
+            }
         }
     }
 
-    return value * OS3D_SCALE_F32;
-}
-
+    if (out_grad)
+    {
+        out_grad[0] = gx * OS2D_SMOOTH_SCALE_F32;
+        out_grad[1] = gy * OS2D_SMOOTH_SCALE_F32;
+    }
 
-/* ================================================================================================
-   DOUBLE VERSION
-   ================================================================================================ */
+    return value * OS2D_SMOOTH_SCALE_F32;
+}
 
-RE_INLINE RE_f64 RE_NOISE_OS3D_FAST_f64(RE_f64 x, RE_f64 y, RE_f64 z)
+RE_INLINE RE_f32 RE_NOISE_OS2D_SMOOTH_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y)
 {
-    const RE_f64 R3 = (2.0 / 3.0);
-
-    RE_f64 s = (x+y+z) * R3;
-    RE_f64 xs = x + s;
-    RE_f64 ys = y + s;
-    RE_f64 zs = z + s;
+    return RE_OS2D_SMOOTH_EVAL_f32(ctx, x, y, NULL);
+}
 
-    RE_i64 xi = RE_FASTFLOOR_f64(xs);
-    RE_i64 yi = RE_FASTFLOOR_f64(ys);
-    RE_i64 zi = RE_FASTFLOOR_f64(zs);
+RE_INLINE RE_f32 RE_NOISE_OS2D_SMOOTH_f32(RE_f32 x, RE_f32 y)
+{
+    return RE_NOISE_OS2D_SMOOTH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
 
-    RE_f64 t = (RE_f64)(xi + yi + zi) * R3;
+/* Value and analytic gradient (out_grad[2]) from the same vertices and attenuation terms */
+RE_INLINE RE_f32 RE_NOISE_OS2D_SMOOTH_DERIV_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                    RE_f32 x, RE_f32 y, RE_f32 out_grad[2])
+{
+    return RE_OS2D_SMOOTH_EVAL_f32(ctx, x, y, out_grad);
+}
 
-    RE_f64 X0 = xi - t;
-    RE_f64 Y0 = yi - t;
-    RE_f64 Z0 = zi - t;
+RE_INLINE RE_f32 RE_NOISE_OS2D_SMOOTH_DERIV_f32(RE_f32 x, RE_f32 y, RE_f32 out_grad[2])
+{
+    return RE_NOISE_OS2D_SMOOTH_DERIV_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, out_grad);
+}
 
-    RE_f64 x0 = x - X0;
-    RE_f64 y0 = y - Y0;
-    RE_f64 z0 = z - Z0;
+/* =============================================================================================
+   OPEN SIMPLEX 2S (SMOOTH) — 2D — f64
+   ============================================================================================= */
 
-    RE_i32 rx = (x0 >= y0) + (x0 >= z0);
-    RE_i32 ry = (y0 >= x0) + (y0 >= z0);
-    RE_i32 rz = 3 - (rx + ry);
+RE_INLINE RE_f64 RE_OS2D_SMOOTH_EVAL_f64(const RE_NOISE_CONTEXT *ctx, RE_f64 x, RE_f64 y, RE_f64 *out_grad)
+{
+    const RE_f64 S2 = 0.366025403784439;  /* (sqrt(3)-1)/2 */
+    const RE_f64 U2 = 0.211324865405187;  /* (3-sqrt(3))/6 */
 
-    static const RE_i32 LATTICE[4][3] = {
-        {0,0,0},
-        {1,0,0},
-        {0,1,0},
-        {0,0,1}
+    /* Skewed base cell */
+    RE_f64 s = (x + y) * S2;
+    RE_i64 i = RE_FASTFLOOR_f64(x + s);
+    RE_i64 j = RE_FASTFLOOR_f64(y + s);
+
+    /* Offset from the unskewed base vertex */
+    RE_f64 t  = (RE_f64)(i + j) * U2;
+    RE_f64 x0 = x - ((RE_f64)i - t);
+    RE_f64 y0 = y - ((RE_f64)j - t);
+
+    /* Every vertex within the kernel radius (sqrt 2/3) is one of these */
+    static const RE_i32 OFF[8][2] = {
+        {0,0}, {1,0}, {0,1}, {1,1},
+        {-1,0}, {0,-1}, {2,1}, {1,2}
     };
 
-    RE_f64 value = 0.0;
+    RE_f64 value = 0.0, gx = 0.0, gy = 0.0;
 
-    for (int i = 0; i < 4; i++)
+    for (int c = 0; c < 8; c++)
     {
-        RE_i32 dx = LATTICE[i][0];
-        RE_i32 dy = LATTICE[i][1];
-        RE_i32 dz = LATTICE[i][2];
+        RE_f64 dx = x0 - (OFF[c][0] - (OFF[c][0] + OFF[c][1]) * U2);
+        RE_f64 dy = y0 - (OFF[c][1] - (OFF[c][0] + OFF[c][1]) * U2);
 
-        if (i == 1) dx = (rx >= 2);
-        if (i == 2) dy = (ry >= 2);
-        if (i == 3) dz = (rz >= 2);
-
-        RE_f64 px = x0 - dx + R3 * i;
-        RE_f64 py = y0 - dy + R3 * i;
-        RE_f64 pz = z0 - dz + R3 * i;
-
-        RE_f64 attn = 0.75 - (px*px + py*py + pz*pz);
+        RE_f64 attn = (2.0 / 3.0) - dx*dx - dy*dy;
         if (attn > 0.0)
         {
-            RE_i32 h = RE_NOISE_HASH3((RE_i32)(xi+dx), (RE_i32)(yi+dy), (RE_i32)(zi+dz));
-            const RE_i8 *g = RE_NOISE_GRAD3[h % 12];
+            RE_u8 h = RE_NOISE_CTX_HASH2(ctx, RE_NOISE_FOLD_i64(i + OFF[c][0]), RE_NOISE_FOLD_i64(j + OFF[c][1]));
+            const RE_i8 *g = RE_NOISE_GRAD2[h & 7];
 
-            RE_f64 dot = (RE_f64)g[0]*px + (RE_f64)g[1]*py + (RE_f64)g[2]*pz;
+            RE_f64 dot = g[0]*dx + g[1]*dy;
+            RE_f64 a2  = attn * attn;
+            RE_f64 a4  = a2 * a2;
 
-            attn *= attn;
-            value += attn * attn * dot;
+            value += a4 * dot;
+
+            if (out_grad)
+            {
+                RE_f64 k = -8.0 * a2 * attn * dot;
+                gx += a4 * g[0] + k * dx;
+                gy += a4 * g[1] + k * dy;
+            }
         }
     }
 
-    return value * OS3D_SCALE_F64;
+    if (out_grad)
+    {
+        out_grad[0] = gx * OS2D_SMOOTH_SCALE_F64;
+        out_grad[1] = gy * OS2D_SMOOTH_SCALE_F64;
+    }
+
+    return value * OS2D_SMOOTH_SCALE_F64;
+}
+
+RE_INLINE RE_f64 RE_NOISE_OS2D_SMOOTH_CTX_f64(const RE_NOISE_CONTEXT *ctx, RE_f64 x, RE_f64 y)
+{
+    return RE_OS2D_SMOOTH_EVAL_f64(ctx, x, y, NULL);
+}
+
+RE_INLINE RE_f64 RE_NOISE_OS2D_SMOOTH_f64(RE_f64 x, RE_f64 y)
+{
+    return RE_NOISE_OS2D_SMOOTH_CTX_f64(&RE_NOISE_DEFAULT_CONTEXT, x, y);
 }
 
 /* =============================================================================================
-   OPEN SIMPLEX 2S (SMOOTH) — 2D — f32
+   PERIODIC (TILEABLE) VARIANTS — f32
+   Lattice coordinates are wrapped modulo the period before hashing, so the field repeats
+   exactly and a texture baked over one period tiles without seams. Periods are in lattice
+   cells (integers); a period <= 0 leaves that axis unwrapped. Inside the first period, away
+   from the wrapped edge cells, the result equals the non-periodic function.
    ============================================================================================= */
 
-RE_INLINE RE_f32 RE_NOISE_OS2D_SMOOTH_f32(RE_f32 x, RE_f32 y)
+/* Positive modulo; p <= 0 disables wrapping */
+RE_INLINE RE_i32 RE_NOISE_WRAP_i32(RE_i32 x, RE_i32 p)
 {
-    /* Stretch constant */
-    const RE_f32 S2 = 0.366025403f;  /* (sqrt(3)-1)/2 */
+    if (p <= 0) return x;
+    RE_i32 r = x % p;
+    return r < 0 ? r + p : r;
+}
 
-    /* Unstretch */
-    RE_f32 s = (x + y) * S2;
-    RE_f32 xs = x + s;
-    RE_f32 ys = y + s;
+RE_INLINE RE_f32 RE_NOISE_VALUE2_PERIODIC_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y,
+                                                  RE_i32 px, RE_i32 py)
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
 
-    /* Base grid cell */
-    RE_i32 i = RE_FASTFLOOR_f32(xs);
-    RE_i32 j = RE_FASTFLOOR_f32(ys);
+    RE_f32 fx = x - (RE_f32)X;
+    RE_f32 fy = y - (RE_f32)Y;
 
-    /* Unskew */
-    const RE_f32 U2 = 0.211324865f;  /* (3-sqrt(3))/6 */
+    RE_f32 u = RE_NOISE_FADE_f32(fx);
+    RE_f32 v = RE_NOISE_FADE_f32(fy);
 
-    RE_f32 xi = xs - i;
-    RE_f32 yi = ys - j;
+    RE_i32 X0 = RE_NOISE_WRAP_i32(X, px), X1 = RE_NOISE_WRAP_i32(X + 1, px);
+    RE_i32 Y0 = RE_NOISE_WRAP_i32(Y, py), Y1 = RE_NOISE_WRAP_i32(Y + 1, py);
 
-    RE_f32 x0 = x - (i - (xi + yi) * U2);
-    RE_f32 y0 = y - (j - (xi + yi) * U2);
+    RE_f32 a = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X0, Y0));
+    RE_f32 b = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X1, Y0));
+    RE_f32 c = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X0, Y1));
+    RE_f32 d = RE_NOISE_VALUE_FROM_HASH_f32(RE_NOISE_CTX_HASH2(ctx, X1, Y1));
 
-    RE_f32 value = 0.0f;
+    RE_f32 i1 = RE_NOISE_LERP_f32(a, b, u);
+    RE_f32 i2 = RE_NOISE_LERP_f32(c, d, u);
 
-    /* Contributions of 6 corners */
-    for (int c = 0; c < 6; c++)
-    {
-        static const RE_i32 OFF[][2] = {
-            {0,0}, {1,0}, {0,1},
-            {1,1}, {2,0}, {0,2}
-        };
+    return RE_NOISE_LERP_f32(i1, i2, v);
+}
 
-        RE_f32 dx = x0 - OFF[c][0] * U2;
-        RE_f32 dy = y0 - OFF[c][1] * U2;
+RE_INLINE RE_f32 RE_NOISE_VALUE2_PERIODIC_f32(RE_f32 x, RE_f32 y, RE_i32 px, RE_i32 py)
+{
+    return RE_NOISE_VALUE2_PERIODIC_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, px, py);
+}
 
-        RE_f32 attn = 0.5f - dx*dx - dy*dy;
-        if (attn > 0.f)
-        {
-            RE_u8 h = RE_NOISE_HASH2(i + OFF[c][0], j + OFF[c][1]);
-            const RE_i8 *g = RE_NOISE_GRAD2[h & 7];
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_PERIODIC_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                   RE_f32 x, RE_f32 y, RE_f32 z,
+                                                   RE_i32 px, RE_i32 py, RE_i32 pz)
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+    RE_i32 Z = RE_FASTFLOOR_f32(z);
 
-            RE_f32 dot = g[0]*dx + g[1]*dy;
+    RE_f32 xf = x - (RE_f32)X;
+    RE_f32 yf = y - (RE_f32)Y;
+    RE_f32 zf = z - (RE_f32)Z;
 
-            attn *= attn;
-            value += attn * attn * dot;
-        }
+    RE_f32 u = RE_NOISE_FADE_f32(xf);
+    RE_f32 v = RE_NOISE_FADE_f32(yf);
+    RE_f32 w = RE_NOISE_FADE_f32(zf);
+
+    RE_i32 xs[2] = { RE_NOISE_WRAP_i32(X, px), RE_NOISE_WRAP_i32(X + 1, px) };
+    RE_i32 ys[2] = { RE_NOISE_WRAP_i32(Y, py), RE_NOISE_WRAP_i32(Y + 1, py) };
+    RE_i32 zs[2] = { RE_NOISE_WRAP_i32(Z, pz), RE_NOISE_WRAP_i32(Z + 1, pz) };
+
+    /* Corner c = dx + 2*dy + 4*dz, as in RE_NOISE_LATTICE3_CORNERS */
+    RE_f32 d[8];
+    for (int c = 0; c < 8; c++)
+    {
+        int dx = c & 1, dy = (c >> 1) & 1, dz = c >> 2;
+        RE_i32 gi = RE_NOISE_CTX_GRAD3(ctx, xs[dx], ys[dy], zs[dz]);
+        d[c] = RE_NOISE_GRAD3_DOT_f32(gi, xf - (RE_f32)dx, yf - (RE_f32)dy, zf - (RE_f32)dz);
     }
 
-    return value * OS2D_SCALE_F32;
-}
+    RE_f32 y0 = RE_NOISE_LERP_f32(RE_NOISE_LERP_f32(d[0], d[1], u),
+                                  RE_NOISE_LERP_f32(d[2], d[3], u), v);
 
-/* =============================================================================================
-   OPEN SIMPLEX 2S (SMOOTH) — 2D — f64
-   ============================================================================================= */
+    RE_f32 y1 = RE_NOISE_LERP_f32(RE_NOISE_LERP_f32(d[4], d[5], u),
+                                  RE_NOISE_LERP_f32(d[6], d[7], u), v);
 
-RE_INLINE RE_f64 RE_NOISE_OS2D_SMOOTH_f64(RE_f64 x, RE_f64 y)
-{
-    const RE_f64 S2 = 0.3660254037844386467637231707;
-    RE_f64 s = (x + y) * S2;
+    return RE_NOISE_LERP_f32(y0, y1, w);
+}
 
-    RE_f64 xs = x + s;
-    RE_f64 ys = y + s;
+RE_INLINE RE_f32 RE_NOISE_PERLIN3_PERIODIC_f32(RE_f32 x, RE_f32 y, RE_f32 z,
+                                               RE_i32 px, RE_i32 py, RE_i32 pz)
+{
+    return RE_NOISE_PERLIN3_PERIODIC_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, px, py, pz);
+}
 
-    RE_i64 i = RE_FASTFLOOR_f64(xs);
-    RE_i64 j = RE_FASTFLOOR_f64(ys);
+/*
+    OpenSimplex2S on the triangular lattice has no lattice vector along the x or y axis, so
+    it cannot repeat on an axis-aligned rectangle in its own input space. The periodic variant
+    therefore takes (u, v) in skewed lattice coordinates: lattice vertex (i, j) sits at integer
+    (u, v), the point evaluated is the unskewed (u - (u+v)*U2, v - (u+v)*U2), and the result
+    repeats every pu along u and pv along v. Sampling u, v over [0, pu) x [0, pv) bakes a
+    rectangular seamless tile; features are the same as RE_NOISE_OS2D_SMOOTH_f32 seen through
+    that shear.
+*/
+RE_INLINE RE_f32 RE_NOISE_OS2D_SMOOTH_PERIODIC_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 u, RE_f32 v,
+                                                       RE_i32 pu, RE_i32 pv)
+{
+    const RE_f32 U2 = 0.211324865405187f;  /* (3-sqrt(3))/6 */
 
-    const RE_f64 U2 = 0.2113248654051871177454256097;
+    RE_i32 i = RE_FASTFLOOR_f32(u);
+    RE_i32 j = RE_FASTFLOOR_f32(v);
 
-    RE_f64 xi = xs - i;
-    RE_f64 yi = ys - j;
+    /* Offset from the base vertex, unskewed from the fractional lattice position */
+    RE_f32 fu = u - (RE_f32)i;
+    RE_f32 fv = v - (RE_f32)j;
+    RE_f32 t  = (fu + fv) * U2;
+    RE_f32 x0 = fu - t;
+    RE_f32 y0 = fv - t;
 
-    RE_f64 x0 = x - (i - (xi + yi) * U2);
-    RE_f64 y0 = y - (j - (xi + yi) * U2);
+    static const RE_i32 OFF[8][2] = {
+        {0,0}, {1,0}, {0,1}, {1,1},
+        {-1,0}, {0,-1}, {2,1}, {1,2}
+    };
 
-    RE_f64 value = 0.0;
+    RE_f32 value = 0.0f;
 
-    for (int c = 0; c < 6; c++)
+    for (int c = 0; c < 8; c++)
     {
-        static const RE_i32 OFF[][2] = {
-            {0,0},{1,0},{0,1},{1,1},{2,0},{0,2}
-        };
-
-        RE_f64 dx = x0 - OFF[c][0] * U2;
-        RE_f64 dy = y0 - OFF[c][1] * U2;
+        RE_f32 dx = x0 - (OFF[c][0] - (OFF[c][0] + OFF[c][1]) * U2);
+        RE_f32 dy = y0 - (OFF[c][1] - (OFF[c][0] + OFF[c][1]) * U2);
 
-        RE_f64 attn = 0.5 - dx*dx - dy*dy;
-        if (attn > 0.0)
+        RE_f32 attn = (2.0f / 3.0f) - dx*dx - dy*dy;
+        if (attn > 0.0f)
         {
-            RE_u8 h = RE_NOISE_HASH2((RE_i32)(i + OFF[c][0]), (RE_i32)(j + OFF[c][1]));
+            RE_u8 h = RE_NOISE_CTX_HASH2(ctx, RE_NOISE_WRAP_i32(i + OFF[c][0], pu),
+                                              RE_NOISE_WRAP_i32(j + OFF[c][1], pv));
             const RE_i8 *g = RE_NOISE_GRAD2[h & 7];
 
-            RE_f64 dot = (RE_f64)g[0]*dx + (RE_f64)g[1]*dy;
-
-            attn *= attn;
-            value += attn * attn * dot;
+            RE_f32 a2 = attn * attn;
+            value += a2 * a2 * (g[0]*dx + g[1]*dy);
         }
     }
 
-    return value * OS2D_SCALE_F64;
+    return value * OS2D_SMOOTH_SCALE_F32;
 }
 
-RE_INLINE RE_f32 RE_NOISE_OS2D_FAST_f32(RE_f32 x, RE_f32 y)
+RE_INLINE RE_f32 RE_NOISE_OS2D_SMOOTH_PERIODIC_f32(RE_f32 u, RE_f32 v, RE_i32 pu, RE_i32 pv)
+{
+    return RE_NOISE_OS2D_SMOOTH_PERIODIC_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, u, v, pu, pv);
+}
+
+RE_INLINE RE_f32 RE_NOISE_OS2D_FAST_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y)
 {
     const RE_f32 S2 = 0.366025403f;
 
@@ -1502,7 +4190,7 @@ RE_INLINE RE_f32 RE_NOISE_OS2D_FAST_f32(RE_f32 x, RE_f32 y)
         RE_f32 attn = 0.5f - dx*dx - dy*dy;
         if (attn > 0.0f)
         {
-            RE_u8 h = RE_NOISE_HASH2(i + OFF[c][0], j + OFF[c][1]);
+            RE_u8 h = RE_NOISE_CTX_HASH2(ctx, i + OFF[c][0], j + OFF[c][1]);
             const RE_i8 *g = RE_NOISE_GRAD2[h & 7];
 
             RE_f32 dot = g[0]*dx + g[1]*dy;
@@ -1515,11 +4203,16 @@ RE_INLINE RE_f32 RE_NOISE_OS2D_FAST_f32(RE_f32 x, RE_f32 y)
     return value * OS2D_SCALE_F32;
 }
 
+RE_INLINE RE_f32 RE_NOISE_OS2D_FAST_f32(RE_f32 x, RE_f32 y)
+{
+    return RE_NOISE_OS2D_FAST_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
 /* =============================================================================================
    OPEN SIMPLEX 2F (FAST) — 2D — f64
    ============================================================================================= */
 
-RE_INLINE RE_f64 RE_NOISE_OS2D_FAST_f64(RE_f64 x, RE_f64 y)
+RE_INLINE RE_f64 RE_NOISE_OS2D_FAST_CTX_f64(const RE_NOISE_CONTEXT *ctx, RE_f64 x, RE_f64 y)
 {
     const RE_f64 S2 = 0.36602540378443864676;
 
@@ -1552,7 +4245,7 @@ RE_INLINE RE_f64 RE_NOISE_OS2D_FAST_f64(RE_f64 x, RE_f64 y)
         RE_f64 attn = 0.5 - dx*dx - dy*dy;
         if (attn > 0.0)
         {
-            RE_u8 h = RE_NOISE_HASH2((RE_i32)(i+OFF[c][0]), (RE_i32)(j+OFF[c][1]));
+            RE_u8 h = RE_NOISE_CTX_HASH2(ctx, RE_NOISE_FOLD_i64(i + OFF[c][0]), RE_NOISE_FOLD_i64(j + OFF[c][1]));
             const RE_i8 *g = RE_NOISE_GRAD2[h & 7];
 
             RE_f64 dot = (RE_f64)g[0]*dx + (RE_f64)g[1]*dy;
@@ -1565,4 +4258,298 @@ RE_INLINE RE_f64 RE_NOISE_OS2D_FAST_f64(RE_f64 x, RE_f64 y)
     return value * OS2D_SCALE_F64;
 }
 
+RE_INLINE RE_f64 RE_NOISE_OS2D_FAST_f64(RE_f64 x, RE_f64 y)
+{
+    return RE_NOISE_OS2D_FAST_CTX_f64(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
+/* ================================================================================================
+   FRACTAL BATCH (FBM / TURBULENCE / RIDGED over any 3D basis)
+   ------------------------------------------------------------------------------------------------
+   N points x K octaves per call. Octave frequencies and amplitudes are resolved once per call;
+   the points run in SIMD lanes (8 AVX, 4 SSE/NEON) with the coordinates and the running sum
+   kept in registers across all octaves.
+
+   Semantics match RE_NOISE_VALUE3_FBM/TURBULENCE/RIDGED_f32 for any basis:
+     FBM         sum += n * amp                       amp starts at 1
+     TURBULENCE  sum += |n| * amp                     amp starts at 1
+     RIDGED      sum += (offset - |n|)^2 * amp        amp starts at 0.5
+
+   amp_epsilon: octaves whose amplitude is below it are dropped (0 = evaluate all).
+   All bases run in lanes (OpenSimplex2 per lane only on NEON).
+================================================================================================ */
+
+#define RE_NOISE_BASIS_VALUE3          0
+#define RE_NOISE_BASIS_PERLIN3         1
+#define RE_NOISE_BASIS_OS3D_FAST       2
+#define RE_NOISE_BASIS_OS3D_SMOOTH     3
+
+#define RE_NOISE_FRACTAL_FBM           0
+#define RE_NOISE_FRACTAL_TURBULENCE    1
+#define RE_NOISE_FRACTAL_RIDGED        2
+
+#define RE_NOISE_FRACTAL_MAX_OCTAVES   32
+
+typedef struct RE_NOISE_FRACTAL_DESC_t {
+    int    basis;          /* RE_NOISE_BASIS_*                           */
+    int    type;           /* RE_NOISE_FRACTAL_*                         */
+    int    octaves;        /* clamped to RE_NOISE_FRACTAL_MAX_OCTAVES    */
+    RE_f32 lacunarity;
+    RE_f32 gain;
+    RE_f32 offset;         /* ridged only                                */
+    RE_f32 amp_epsilon;
+} RE_NOISE_FRACTAL_DESC;
+
+/* Per-octave frequency/amplitude; returns the number of octaves left after the epsilon cut */
+RE_INLINE int RE_NOISE_FRACTAL_OCTAVES(const RE_NOISE_FRACTAL_DESC *d, RE_f32 *freq, RE_f32 *amp)
+{
+    int    n = d->octaves < RE_NOISE_FRACTAL_MAX_OCTAVES ? d->octaves : RE_NOISE_FRACTAL_MAX_OCTAVES;
+    RE_f32 f = 1.0f;
+    RE_f32 a = (d->type == RE_NOISE_FRACTAL_RIDGED) ? 0.5f : 1.0f;
+    int    k = 0;
+
+    for (; k < n; k++)
+    {
+        if (RE_FABS_f32(a) < d->amp_epsilon) break;
+        freq[k] = f;
+        amp[k]  = a;
+        f *= d->lacunarity;
+        a *= d->gain;
+    }
+    return k;
+}
+
+RE_INLINE RE_f32 RE_NOISE_BASIS3_CTX_f32(const RE_NOISE_CONTEXT *ctx, int basis,
+                                         RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    switch (basis)
+    {
+        case RE_NOISE_BASIS_VALUE3:      return RE_NOISE_VALUE3_CTX_f32(ctx, x, y, z);
+        case RE_NOISE_BASIS_PERLIN3:     return RE_NOISE_PERLIN3_CTX_f32(ctx, x, y, z);
+        case RE_NOISE_BASIS_OS3D_FAST:   return RE_NOISE_OS3D_FAST_CTX_f32(ctx, x, y, z);
+        case RE_NOISE_BASIS_OS3D_SMOOTH: return RE_NOISE_OS3D_SMOOTH_CTX_f32(ctx, x, y, z);
+        default:                         return 0.0f;
+    }
+}
+
+RE_INLINE RE_f32 RE_NOISE_FRACTAL_SHAPE_f32(int type, RE_f32 n, RE_f32 offset)
+{
+    if (type == RE_NOISE_FRACTAL_TURBULENCE) return RE_FABS_f32(n);
+    if (type == RE_NOISE_FRACTAL_RIDGED)
+    {
+        n = offset - RE_FABS_f32(n);
+        return n * n;
+    }
+    return n;
+}
+
+/* Single point (also the batch tail) */
+RE_INLINE RE_f32 RE_NOISE_FRACTAL3_CTX_f32(const RE_NOISE_CONTEXT *ctx, const RE_NOISE_FRACTAL_DESC *d,
+                                           RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_f32 freq[RE_NOISE_FRACTAL_MAX_OCTAVES], amp[RE_NOISE_FRACTAL_MAX_OCTAVES];
+    int K = RE_NOISE_FRACTAL_OCTAVES(d, freq, amp);
+
+    RE_f32 sum = 0.0f;
+    for (int k = 0; k < K; k++)
+    {
+        RE_f32 n = RE_NOISE_BASIS3_CTX_f32(ctx, d->basis, x * freq[k], y * freq[k], z * freq[k]);
+        sum += RE_NOISE_FRACTAL_SHAPE_f32(d->type, n, d->offset) * amp[k];
+    }
+    return sum;
+}
+
+RE_INLINE RE_f32 RE_NOISE_FRACTAL3_f32(const RE_NOISE_FRACTAL_DESC *d, RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_FRACTAL3_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, d, x, y, z);
+}
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+RE_INLINE __m128 RE_NOISE_BASIS3_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx, int basis,
+                                                __m128 x, __m128 y, __m128 z)
+{
+    if (basis == RE_NOISE_BASIS_VALUE3)  return RE_NOISE_VALUE3_X4_CTX_f32_sse(ctx, x, y, z);
+    if (basis == RE_NOISE_BASIS_PERLIN3) return RE_NOISE_PERLIN3_X4_CTX_f32_sse(ctx, x, y, z);
+    if (basis == RE_NOISE_BASIS_OS3D_FAST) return RE_NOISE_OS3D_FAST_X4_CTX_f32_sse(ctx, x, y, z);
+    return RE_NOISE_OS3D_SMOOTH_X4_CTX_f32_sse(ctx, x, y, z);
+}
+
+RE_INLINE __m128 RE_NOISE_FRACTAL_SHAPE_X4_f32_sse(int type, __m128 n, __m128 offset)
+{
+    if (type == RE_NOISE_FRACTAL_FBM) return n;
+
+    n = _mm_andnot_ps(_mm_set1_ps(-0.0f), n);
+    if (type == RE_NOISE_FRACTAL_RIDGED)
+    {
+        n = _mm_sub_ps(offset, n);
+        n = _mm_mul_ps(n, n);
+    }
+    return n;
+}
+
+#endif /* SSE */
+
+#if defined(RE_SIMD_AVX)
+
+RE_INLINE __m256 RE_NOISE_BASIS3_X8_CTX_f32_avx(const RE_NOISE_CONTEXT *ctx, int basis,
+                                                __m256 x, __m256 y, __m256 z)
+{
+    if (basis == RE_NOISE_BASIS_VALUE3)  return RE_NOISE_VALUE3_X8_CTX_f32_avx(ctx, x, y, z);
+    if (basis == RE_NOISE_BASIS_PERLIN3) return RE_NOISE_PERLIN3_X8_CTX_f32_avx(ctx, x, y, z);
+
+#if defined(__AVX2__)
+    if (basis == RE_NOISE_BASIS_OS3D_FAST) return RE_NOISE_OS3D_FAST_X8_CTX_f32_avx2(ctx, x, y, z);
+    return RE_NOISE_OS3D_SMOOTH_X8_CTX_f32_avx2(ctx, x, y, z);
+#else
+    /* AVX1: the OpenSimplex2 kernels need integer lanes, run them as two SSE halves */
+    __m128 lo = RE_NOISE_BASIS3_X4_CTX_f32_sse(ctx, basis, _mm256_castps256_ps128(x),
+                                               _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+    __m128 hi = RE_NOISE_BASIS3_X4_CTX_f32_sse(ctx, basis, _mm256_extractf128_ps(x, 1),
+                                               _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+#endif
+}
+
+RE_INLINE __m256 RE_NOISE_FRACTAL_SHAPE_X8_f32_avx(int type, __m256 n, __m256 offset)
+{
+    if (type == RE_NOISE_FRACTAL_FBM) return n;
+
+    n = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), n);
+    if (type == RE_NOISE_FRACTAL_RIDGED)
+    {
+        n = _mm256_sub_ps(offset, n);
+        n = _mm256_mul_ps(n, n);
+    }
+    return n;
+}
+
+#endif /* AVX */
+
+#if defined(RE_SIMD_NEON)
+
+RE_INLINE float32x4_t RE_NOISE_BASIS3_X4_CTX_f32_neon(const RE_NOISE_CONTEXT *ctx, int basis,
+                                                      float32x4_t x, float32x4_t y, float32x4_t z)
+{
+    if (basis == RE_NOISE_BASIS_VALUE3)  return RE_NOISE_VALUE3_X4_CTX_f32_neon(ctx, x, y, z);
+    if (basis == RE_NOISE_BASIS_PERLIN3) return RE_NOISE_PERLIN3_X4_CTX_f32_neon(ctx, x, y, z);
+
+    RE_f32 xs[4], ys[4], zs[4], r[4];
+    vst1q_f32(xs, x);
+    vst1q_f32(ys, y);
+    vst1q_f32(zs, z);
+    for (int l = 0; l < 4; l++)
+        r[l] = RE_NOISE_BASIS3_CTX_f32(ctx, basis, xs[l], ys[l], zs[l]);
+    return vld1q_f32(r);
+}
+
+RE_INLINE float32x4_t RE_NOISE_FRACTAL_SHAPE_X4_f32_neon(int type, float32x4_t n, float32x4_t offset)
+{
+    if (type == RE_NOISE_FRACTAL_FBM) return n;
+
+    n = vabsq_f32(n);
+    if (type == RE_NOISE_FRACTAL_RIDGED)
+    {
+        n = vsubq_f32(offset, n);
+        n = vmulq_f32(n, n);
+    }
+    return n;
+}
+
+#endif /* NEON */
+
+RE_INLINE void RE_NOISE_FRACTAL3_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx, const RE_NOISE_FRACTAL_DESC *d,
+                                               const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                               RE_f32 *out, int count)
+{
+    RE_f32 freq[RE_NOISE_FRACTAL_MAX_OCTAVES], amp[RE_NOISE_FRACTAL_MAX_OCTAVES];
+    int K = RE_NOISE_FRACTAL_OCTAVES(d, freq, amp);
+    int i = 0;
+
+#if defined(RE_SIMD_AVX)
+    {
+        __m256 off = _mm256_set1_ps(d->offset);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 px = _mm256_loadu_ps(x + i);
+            __m256 py = _mm256_loadu_ps(y + i);
+            __m256 pz = _mm256_loadu_ps(z + i);
+            __m256 sum = _mm256_setzero_ps();
+
+            for (int k = 0; k < K; k++)
+            {
+                __m256 f = _mm256_set1_ps(freq[k]);
+                __m256 n = RE_NOISE_BASIS3_X8_CTX_f32_avx(ctx, d->basis, _mm256_mul_ps(px, f),
+                                                          _mm256_mul_ps(py, f), _mm256_mul_ps(pz, f));
+                n   = RE_NOISE_FRACTAL_SHAPE_X8_f32_avx(d->type, n, off);
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(n, _mm256_set1_ps(amp[k])));
+            }
+            _mm256_storeu_ps(out + i, sum);
+        }
+    }
+#endif
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    {
+        __m128 off = _mm_set1_ps(d->offset);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 px = _mm_loadu_ps(x + i);
+            __m128 py = _mm_loadu_ps(y + i);
+            __m128 pz = _mm_loadu_ps(z + i);
+            __m128 sum = _mm_setzero_ps();
+
+            for (int k = 0; k < K; k++)
+            {
+                __m128 f = _mm_set1_ps(freq[k]);
+                __m128 n = RE_NOISE_BASIS3_X4_CTX_f32_sse(ctx, d->basis, _mm_mul_ps(px, f),
+                                                          _mm_mul_ps(py, f), _mm_mul_ps(pz, f));
+                n   = RE_NOISE_FRACTAL_SHAPE_X4_f32_sse(d->type, n, off);
+                sum = _mm_add_ps(sum, _mm_mul_ps(n, _mm_set1_ps(amp[k])));
+            }
+            _mm_storeu_ps(out + i, sum);
+        }
+    }
+#elif defined(RE_SIMD_NEON)
+    {
+        float32x4_t off = vdupq_n_f32(d->offset);
+        for (; i + 4 <= count; i += 4)
+        {
+            float32x4_t px = vld1q_f32(x + i);
+            float32x4_t py = vld1q_f32(y + i);
+            float32x4_t pz = vld1q_f32(z + i);
+            float32x4_t sum = vdupq_n_f32(0.0f);
+
+            for (int k = 0; k < K; k++)
+            {
+                float32x4_t n = RE_NOISE_BASIS3_X4_CTX_f32_neon(ctx, d->basis, vmulq_n_f32(px, freq[k]),
+                                                                vmulq_n_f32(py, freq[k]),
+                                                                vmulq_n_f32(pz, freq[k]));
+                n   = RE_NOISE_FRACTAL_SHAPE_X4_f32_neon(d->type, n, off);
+                sum = vmlaq_n_f32(sum, n, amp[k]);
+            }
+            vst1q_f32(out + i, sum);
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        RE_f32 sum = 0.0f;
+        for (int k = 0; k < K; k++)
+        {
+            RE_f32 n = RE_NOISE_BASIS3_CTX_f32(ctx, d->basis, x[i] * freq[k], y[i] * freq[k], z[i] * freq[k]);
+            sum += RE_NOISE_FRACTAL_SHAPE_f32(d->type, n, d->offset) * amp[k];
+        }
+        out[i] = sum;
+    }
+}
+
+RE_INLINE void RE_NOISE_FRACTAL3_BATCH_f32(const RE_NOISE_FRACTAL_DESC *d,
+                                           const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                           RE_f32 *out, int count)
+{
+    RE_NOISE_FRACTAL3_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, d, x, y, z, out, count);
+}
+
 #endif /* RE_NOISE_H */
@@ -0,0 +1,488 @@
+/**
+ * @file re_noise_cache.h
+ * @brief Chunk-keyed noise tile cache with LRU eviction and lock striping.
+ *
+ * Tiles are keyed on (function, seed, chunk x / y / z, LOD) and generated on
+ * a miss by a fill callback; a hit skips generation entirely. Since every
+ * RE_NOISE_* generator is deterministic, an evicted tile that is requested
+ * again is recomputed bit-identically.
+ *
+ * Memory: the caller hands the cache one block (the budget); entry headers,
+ * hash buckets and tile storage are all carved out of it, nothing is
+ * allocated. RE_NOISE_CACHE_INIT returns how many tiles fit.
+ *
+ * Concurrency: the key hash selects one of up to RE_NOISE_CACHE_MAX_STRIPES
+ * stripes, each with its own lock, hash table, LRU list, counters and share
+ * of the tiles (so LRU order is per stripe). A tile is pinned between
+ * ACQUIRE and RELEASE and never evicted while pinned. A miss generates
+ * outside the lock; other threads asking for the same tile meanwhile wait
+ * for it instead of generating it twice.
+ *
+ *   RE_NOISE_CACHE cache;
+ *   RE_NOISE_CACHE_INIT(&cache, memory, bytes, 32 * 32 * 32, 16);
+ *   if (!RE_NOISE_CACHE_GEN_SOURCE_INIT(&source, &desc, &cache)) ... chunk too big ...
+ *   const RE_f32 *t = RE_NOISE_CACHE_ACQUIRE(&cache, &key, RE_NOISE_CACHE_FILL_GEN, &source);
+ *   ... read t ...
+ *   RE_NOISE_CACHE_RELEASE(&cache, t);
+ *
+ * RE_NOISE_CACHE_FILL_GEN evaluates a chunk of a RE_NOISE_GEN_DESC source
+ * (fractal, graph or per-point callback) on the calling thread. The source is
+ * set up with RE_NOISE_CACHE_GEN_SOURCE_INIT, which rejects a chunk that does
+ * not fit the cache's tiles.
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_NOISE_CACHE_H
+#define RE_NOISE_CACHE_H
+
+#include "re_core.h"
+#include "re_noise.h"
+#include "re_noise_gen.h"
+#include "re_thread.h"
+
+#define RE_NOISE_CACHE_MAX_STRIPES   64
+#define RE_NOISE_CACHE_ALIGN         64     /* tile storage alignment, in bytes */
+
+/* Entry states */
+#define RE_NOISE_CACHE_EMPTY         0
+#define RE_NOISE_CACHE_PENDING       1      /* being generated by the thread that missed */
+#define RE_NOISE_CACHE_READY         2
+
+typedef struct RE_NOISE_CACHE_KEY_t {
+    RE_u64 function;                         /* caller-chosen id of the source               */
+    RE_u32 seed;
+    RE_i32 cx, cy, cz;                       /* chunk coordinates                            */
+    RE_i32 lod;                              /* 0..30, the step doubles per level            */
+} RE_NOISE_CACHE_KEY;
+
+/* Writes `samples` floats of the tile for `key` */
+typedef void (*RE_NOISE_CACHE_FILL_FN)(void *user, const RE_NOISE_CACHE_KEY *key, RE_f32 *out, int samples);
+
+typedef struct RE_NOISE_CACHE_STATS_t {
+    RE_u64 hits;
+    RE_u64 misses;
+    RE_u64 evictions;
+    int    resident;                         /* tiles currently held                         */
+    int    capacity;
+} RE_NOISE_CACHE_STATS;
+
+typedef struct RE_NOISE_CACHE_ENTRY_t {
+    RE_NOISE_CACHE_KEY key;
+    RE_u32 hash;
+    RE_i32 state;
+    RE_i32 pins;
+    RE_i32 chain;                            /* next entry in the bucket, -1 = end           */
+    RE_i32 prev, next;                       /* LRU list (head = most recent), -1 = end      */
+} RE_NOISE_CACHE_ENTRY;
+
+typedef struct RE_NOISE_CACHE_STRIPE_t {
+    RE_MUTEX lock;
+    RE_COND  ready;                          /* a PENDING entry of this stripe became READY  */
+    RE_i32  *buckets;
+    RE_u32   bucket_mask;
+    RE_i32   first;                          /* global index of the stripe's first entry     */
+    RE_i32   lru_head, lru_tail;
+    RE_i32   free_list;                      /* unused entries, linked through `next`        */
+    int      resident;
+    RE_u64   hits, misses, evictions;
+} RE_NOISE_CACHE_STRIPE;
+
+typedef struct RE_NOISE_CACHE_t {
+    int                   tile_samples;
+    size_t                tile_stride;      /* floats between tiles                         */
+    int                   stripe_count;
+    int                   per_stripe;       /* entries per stripe                           */
+    RE_NOISE_CACHE_ENTRY *entries;
+    RE_f32               *tiles;
+    RE_NOISE_CACHE_STRIPE stripes[RE_NOISE_CACHE_MAX_STRIPES];
+} RE_NOISE_CACHE;
+
+/* ============================================================================================
+   KEYS
+   ============================================================================================ */
+
+RE_INLINE RE_u32 RE_NOISE_CACHE_HASH(const RE_NOISE_CACHE_KEY *k)
+{
+    RE_u32 h = RE_PCG_MIX32((RE_u32)k->function ^ RE_PCG_MIX32((RE_u32)(k->function >> 32) + k->seed));
+    h = RE_PCG_MIX32(h ^ (RE_u32)k->cx * 73856093u ^ (RE_u32)k->cy * 19349663u ^ (RE_u32)k->cz * 83492791u);
+    return RE_PCG_MIX32(h + (RE_u32)k->lod * 0x9e3779b9u);
+}
+
+RE_INLINE RE_BOOL RE_NOISE_CACHE_KEY_EQUAL(const RE_NOISE_CACHE_KEY *a, const RE_NOISE_CACHE_KEY *b)
+{
+    return a->function == b->function && a->seed == b->seed && a->cx == b->cx && a->cy == b->cy
+        && a->cz == b->cz && a->lod == b->lod;
+}
+
+/* Stripe from the high bits, bucket from the low bits */
+RE_INLINE int RE_NOISE_CACHE_STRIPE_OF(const RE_NOISE_CACHE *c, RE_u32 hash)
+{
+    return (int)((RE_u64)(hash >> 16) * (RE_u64)c->stripe_count >> 16);
+}
+
+/* ============================================================================================
+   SETUP
+   ============================================================================================ */
+
+/**
+ * @brief Lay the cache out in `memory` (`bytes` long). Returns the number of tiles that fit
+ *        (a multiple of the stripe count), or 0 if not even one per stripe does.
+ */
+RE_INLINE int RE_NOISE_CACHE_INIT(RE_NOISE_CACHE *c, void *memory, size_t bytes, int tile_samples, int stripes)
+{
+    if (stripes < 1) stripes = 1;
+    if (stripes > RE_NOISE_CACHE_MAX_STRIPES) stripes = RE_NOISE_CACHE_MAX_STRIPES;
+    if (tile_samples < 1 || memory == NULL) return 0;
+
+    const size_t a = RE_NOISE_CACHE_ALIGN;
+    size_t tile_bytes = ((size_t)tile_samples * sizeof(RE_f32) + a - 1) / a * a;
+
+    /* Per tile: its storage, its entry and at most 4 bucket heads (buckets = pow2 >= 2 x tiles) */
+    size_t per_tile = tile_bytes + sizeof(RE_NOISE_CACHE_ENTRY) + 4 * sizeof(RE_i32);
+    size_t usable   = (bytes > 2 * a) ? bytes - 2 * a : 0;
+    int per = (int)(usable / per_tile / (size_t)stripes);
+    if (per < 1) return 0;
+
+    int buckets = 1;
+    while (buckets < 2 * per) buckets <<= 1;
+
+    c->tile_samples = tile_samples;
+    c->tile_stride  = tile_bytes / sizeof(RE_f32);
+    c->stripe_count = stripes;
+    c->per_stripe   = per;
+
+    /* [tiles][entries][buckets], tiles first so they start on the aligned base */
+    RE_u8 *p = (RE_u8 *)(((size_t)memory + a - 1) / a * a);
+    int total = per * stripes;
+
+    c->tiles   = (RE_f32 *)p;                                   p += (size_t)total * tile_bytes;
+    c->entries = (RE_NOISE_CACHE_ENTRY *)p;                     p += (size_t)total * sizeof(RE_NOISE_CACHE_ENTRY);
+    RE_i32 *bucket_base = (RE_i32 *)p;
+
+    for (int s = 0; s < stripes; s++)
+    {
+        RE_NOISE_CACHE_STRIPE *st = &c->stripes[s];
+
+        RE_MUTEX_INIT(&st->lock);
+        RE_COND_INIT(&st->ready);
+        st->buckets     = bucket_base + (size_t)s * buckets;
+        st->bucket_mask = (RE_u32)buckets - 1u;
+        st->first       = s * per;
+        st->lru_head    = st->lru_tail = -1;
+        st->free_list   = st->first;
+        st->resident    = 0;
+        st->hits = st->misses = st->evictions = 0;
+
+        for (int b = 0; b < buckets; b++) st->buckets[b] = -1;
+        for (int i = 0; i < per; i++)
+        {
+            RE_NOISE_CACHE_ENTRY *e = &c->entries[st->first + i];
+            e->state = RE_NOISE_CACHE_EMPTY;
+            e->pins  = 0;
+            e->next  = (i + 1 < per) ? st->first + i + 1 : -1;
+        }
+    }
+    return total;
+}
+
+/** @brief Release the locks. No tile may be pinned; the memory block stays the caller's. */
+RE_INLINE void RE_NOISE_CACHE_DESTROY(RE_NOISE_CACHE *c)
+{
+    for (int s = 0; s < c->stripe_count; s++)
+    {
+        RE_COND_DESTROY(&c->stripes[s].ready);
+        RE_MUTEX_DESTROY(&c->stripes[s].lock);
+    }
+}
+
+/* ============================================================================================
+   STRIPE INTERNALS (stripe lock held)
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_CACHE_LRU_UNLINK_(RE_NOISE_CACHE *c, RE_NOISE_CACHE_STRIPE *st, RE_i32 i)
+{
+    RE_NOISE_CACHE_ENTRY *e = &c->entries[i];
+    if (e->prev >= 0) c->entries[e->prev].next = e->next; else st->lru_head = e->next;
+    if (e->next >= 0) c->entries[e->next].prev = e->prev; else st->lru_tail = e->prev;
+}
+
+RE_INLINE void RE_NOISE_CACHE_LRU_PUSH_(RE_NOISE_CACHE *c, RE_NOISE_CACHE_STRIPE *st, RE_i32 i)
+{
+    RE_NOISE_CACHE_ENTRY *e = &c->entries[i];
+    e->prev = -1;
+    e->next = st->lru_head;
+    if (st->lru_head >= 0) c->entries[st->lru_head].prev = i; else st->lru_tail = i;
+    st->lru_head = i;
+}
+
+RE_INLINE RE_i32 RE_NOISE_CACHE_FIND_(RE_NOISE_CACHE *c, RE_NOISE_CACHE_STRIPE *st,
+                                      const RE_NOISE_CACHE_KEY *key, RE_u32 hash)
+{
+    for (RE_i32 i = st->buckets[hash & st->bucket_mask]; i >= 0; i = c->entries[i].chain)
+        if (c->entries[i].hash == hash && RE_NOISE_CACHE_KEY_EQUAL(&c->entries[i].key, key))
+            return i;
+    return -1;
+}
+
+/* Drop a resident entry from its bucket and the LRU list */
+RE_INLINE void RE_NOISE_CACHE_REMOVE_(RE_NOISE_CACHE *c, RE_NOISE_CACHE_STRIPE *st, RE_i32 i)
+{
+    RE_i32 *link = &st->buckets[c->entries[i].hash & st->bucket_mask];
+    while (*link != i) link = &c->entries[*link].chain;
+    *link = c->entries[i].chain;
+
+    RE_NOISE_CACHE_LRU_UNLINK_(c, st, i);
+    c->entries[i].state = RE_NOISE_CACHE_EMPTY;
+    st->resident--;
+}
+
+/* A free entry, or the least recently used unpinned one (evicted); -1 if every entry is pinned */
+RE_INLINE RE_i32 RE_NOISE_CACHE_TAKE_(RE_NOISE_CACHE *c, RE_NOISE_CACHE_STRIPE *st)
+{
+    RE_i32 i = st->free_list;
+    if (i >= 0)
+    {
+        st->free_list = c->entries[i].next;
+        return i;
+    }
+
+    for (i = st->lru_tail; i >= 0; i = c->entries[i].prev)
+        if (c->entries[i].pins == 0)
+        {
+            RE_NOISE_CACHE_REMOVE_(c, st, i);
+            st->evictions++;
+            return i;
+        }
+    return -1;
+}
+
+RE_INLINE RE_f32 *RE_NOISE_CACHE_TILE_(const RE_NOISE_CACHE *c, RE_i32 i)
+{
+    return c->tiles + (size_t)i * c->tile_stride;
+}
+
+/* ============================================================================================
+   ACCESS
+   ============================================================================================ */
+
+/**
+ * @brief Pinned pointer to the tile for `key`, generated with fill(user, key, ...) on a miss.
+ *        Must be paired with RE_NOISE_CACHE_RELEASE. Returns NULL only when every tile of the
+ *        key's stripe is pinned (the caller then generates into its own buffer).
+ */
+RE_INLINE const RE_f32 *RE_NOISE_CACHE_ACQUIRE(RE_NOISE_CACHE *c, const RE_NOISE_CACHE_KEY *key,
+                                               RE_NOISE_CACHE_FILL_FN fill, void *user)
+{
+    RE_u32 hash = RE_NOISE_CACHE_HASH(key);
+    RE_NOISE_CACHE_STRIPE *st = &c->stripes[RE_NOISE_CACHE_STRIPE_OF(c, hash)];
+
+    RE_MUTEX_LOCK(&st->lock);
+
+    RE_i32 i;
+    while ((i = RE_NOISE_CACHE_FIND_(c, st, key, hash)) >= 0 && c->entries[i].state == RE_NOISE_CACHE_PENDING)
+        RE_COND_WAIT(&st->ready, &st->lock);
+
+    if (i >= 0)
+    {
+        c->entries[i].pins++;
+        RE_NOISE_CACHE_LRU_UNLINK_(c, st, i);
+        RE_NOISE_CACHE_LRU_PUSH_(c, st, i);
+        st->hits++;
+        RE_MUTEX_UNLOCK(&st->lock);
+        return RE_NOISE_CACHE_TILE_(c, i);
+    }
+
+    st->misses++;
+    i = RE_NOISE_CACHE_TAKE_(c, st);
+    if (i < 0)
+    {
+        RE_MUTEX_UNLOCK(&st->lock);
+        return NULL;
+    }
+
+    RE_NOISE_CACHE_ENTRY *e = &c->entries[i];
+    e->key   = *key;
+    e->hash  = hash;
+    e->state = RE_NOISE_CACHE_PENDING;
+    e->pins  = 1;
+    e->chain = st->buckets[hash & st->bucket_mask];
+    st->buckets[hash & st->bucket_mask] = i;
+    RE_NOISE_CACHE_LRU_PUSH_(c, st, i);
+    st->resident++;
+
+    RE_MUTEX_UNLOCK(&st->lock);
+
+    RE_f32 *tile = RE_NOISE_CACHE_TILE_(c, i);
+    fill(user, key, tile, c->tile_samples);
+
+    RE_MUTEX_LOCK(&st->lock);
+    e->state = RE_NOISE_CACHE_READY;
+    RE_COND_BROADCAST(&st->ready);
+    RE_MUTEX_UNLOCK(&st->lock);
+
+    return tile;
+}
+
+/** @brief Unpin a tile returned by RE_NOISE_CACHE_ACQUIRE. */
+RE_INLINE void RE_NOISE_CACHE_RELEASE(RE_NOISE_CACHE *c, const RE_f32 *tile)
+{
+    RE_i32 i = (RE_i32)((size_t)(tile - c->tiles) / c->tile_stride);
+    RE_NOISE_CACHE_STRIPE *st = &c->stripes[i / c->per_stripe];
+
+    RE_MUTEX_LOCK(&st->lock);
+    c->entries[i].pins--;
+    RE_MUTEX_UNLOCK(&st->lock);
+}
+
+/**
+ * @brief Copy the tile for `key` into out[tile_samples], through the cache when possible.
+ */
+RE_INLINE void RE_NOISE_CACHE_READ(RE_NOISE_CACHE *c, const RE_NOISE_CACHE_KEY *key,
+                                   RE_NOISE_CACHE_FILL_FN fill, void *user, RE_f32 *out)
+{
+    const RE_f32 *t = RE_NOISE_CACHE_ACQUIRE(c, key, fill, user);
+    if (t == NULL)
+    {
+        fill(user, key, out, c->tile_samples);
+        return;
+    }
+
+    for (int i = 0; i < c->tile_samples; i++) out[i] = t[i];
+    RE_NOISE_CACHE_RELEASE(c, t);
+}
+
+/**
+ * @brief Drop every unpinned tile (e.g. after the source behind a function id changed).
+ *        Counters are kept.
+ */
+RE_INLINE void RE_NOISE_CACHE_CLEAR(RE_NOISE_CACHE *c)
+{
+    for (int s = 0; s < c->stripe_count; s++)
+    {
+        RE_NOISE_CACHE_STRIPE *st = &c->stripes[s];
+
+        RE_MUTEX_LOCK(&st->lock);
+        for (RE_i32 i = st->lru_tail; i >= 0; )
+        {
+            RE_i32 prev = c->entries[i].prev;
+            if (c->entries[i].pins == 0)
+            {
+                RE_NOISE_CACHE_REMOVE_(c, st, i);
+                c->entries[i].next = st->free_list;
+                st->free_list = i;
+            }
+            i = prev;
+        }
+        RE_MUTEX_UNLOCK(&st->lock);
+    }
+}
+
+/* ============================================================================================
+   COUNTERS
+   ============================================================================================ */
+
+/** @brief Sum of the per-stripe counters (each stripe read under its lock). */
+RE_INLINE RE_NOISE_CACHE_STATS RE_NOISE_CACHE_GET_STATS(RE_NOISE_CACHE *c)
+{
+    RE_NOISE_CACHE_STATS r = { 0, 0, 0, 0, c->per_stripe * c->stripe_count };
+
+    for (int s = 0; s < c->stripe_count; s++)
+    {
+        RE_NOISE_CACHE_STRIPE *st = &c->stripes[s];
+
+        RE_MUTEX_LOCK(&st->lock);
+        r.hits      += st->hits;
+        r.misses    += st->misses;
+        r.evictions += st->evictions;
+        r.resident  += st->resident;
+        RE_MUTEX_UNLOCK(&st->lock);
+    }
+    return r;
+}
+
+RE_INLINE void RE_NOISE_CACHE_RESET_STATS(RE_NOISE_CACHE *c)
+{
+    for (int s = 0; s < c->stripe_count; s++)
+    {
+        RE_NOISE_CACHE_STRIPE *st = &c->stripes[s];
+
+        RE_MUTEX_LOCK(&st->lock);
+        st->hits = st->misses = st->evictions = 0;
+        RE_MUTEX_UNLOCK(&st->lock);
+    }
+}
+
+/* ============================================================================================
+   GENERATOR SOURCE
+   ============================================================================================ */
+
+/**
+ * user for RE_NOISE_CACHE_FILL_GEN. `desc` supplies the source (fractal / graph / point_fn),
+ * the LOD 0 origin and step, and the tile size in chunk_x / chunk_y / chunk_z; its
+ * nx / ny / nz, layout, out and ctx are ignored.
+ */
+typedef struct RE_NOISE_CACHE_GEN_SOURCE_t {
+    RE_NOISE_GEN_DESC desc;
+    int               samples;              /* chunk_x * chunk_y * chunk_z, 0 if rejected   */
+} RE_NOISE_CACHE_GEN_SOURCE;
+
+/**
+ * @brief Set up `src` from `desc` for use with cache `c`. Returns RE_FALSE, leaving `src`
+ *        rejected, if a chunk dimension is not positive or the chunk holds more samples than
+ *        one of c's tiles.
+ */
+RE_INLINE RE_BOOL RE_NOISE_CACHE_GEN_SOURCE_INIT(RE_NOISE_CACHE_GEN_SOURCE *src, const RE_NOISE_GEN_DESC *desc,
+                                                 const RE_NOISE_CACHE *c)
+{
+    src->desc    = *desc;
+    src->samples = 0;
+
+    if (desc->chunk_x < 1 || desc->chunk_y < 1 || desc->chunk_z < 1) return RE_FALSE;
+
+    RE_i64 n = (RE_i64)desc->chunk_x * desc->chunk_y * desc->chunk_z;
+    if (n > (RE_i64)c->tile_samples) return RE_FALSE;
+
+    src->samples = (int)n;
+    return RE_TRUE;
+}
+
+/**
+ * @brief Tile (cx, cy, cz) at LOD L covers samples o + (c * chunk + i) * s * 2^L, x fastest,
+ *        generated on the calling thread with a context seeded from key->seed.
+ *
+ * `user` must be a source accepted by RE_NOISE_CACHE_GEN_SOURCE_INIT for this cache. A
+ * rejected one never writes past the tile; it fills it with zeros.
+ */
+RE_INLINE void RE_NOISE_CACHE_FILL_GEN(void *user, const RE_NOISE_CACHE_KEY *key, RE_f32 *out, int samples)
+{
+    const RE_NOISE_CACHE_GEN_SOURCE *src = (const RE_NOISE_CACHE_GEN_SOURCE *)user;
+    RE_NOISE_GEN_DESC d = src->desc;
+    RE_NOISE_CONTEXT ctx;
+
+    if (src->samples < 1 || src->samples > samples)
+    {
+        for (int i = 0; i < samples; i++) out[i] = 0.0f;
+        return;
+    }
+
+    RE_NOISE_CONTEXT_INIT(&ctx, key->seed);
+
+    int    lod   = (key->lod < 0) ? 0 : (key->lod > 30) ? 30 : key->lod;
+    RE_f32 scale = (RE_f32)(1 << lod);
+    d.sx *= scale;  d.sy *= scale;  d.sz *= scale;
+
+    d.nx = d.chunk_x;  d.ny = d.chunk_y;  d.nz = d.chunk_z;
+    d.ox += d.sx * (RE_f32)((RE_i64)key->cx * d.chunk_x);
+    d.oy += d.sy * (RE_f32)((RE_i64)key->cy * d.chunk_y);
+    d.oz += d.sz * (RE_f32)((RE_i64)key->cz * d.chunk_z);
+
+    d.layout = RE_NOISE_GEN_LAYOUT_GRID;
+    d.out    = out;
+    d.ctx    = &ctx;
+
+    RE_NOISE_GEN_RUN(NULL, &d);
+}
+
+#endif /* RE_NOISE_CACHE_H */
@@ -0,0 +1,673 @@
+/**
+ * @file re_noise_cellular.h
+ * @brief Cellular (Worley) noise in 2D / 3D: F1, F2 and the ID of the nearest cell.
+ *
+ * Every unit cell holds one feature point, placed from the cell's
+ * RE_HASH3D_PCG_SEED(ctx->seed, X, Y, Z) (Z = 0 in 2D; seed 0 is RE_HASH3D_PCG)
+ * within +-0.25 of the cell centre.
+ * F1 / F2 are the Euclidean distances to the nearest and second-nearest
+ * feature points, and the cell ID is the full 32-bit hash of the F1 cell —
+ * stable per cell, so it can drive per-cell colours or materials.
+ *
+ * The search covers the 3x3 (3x3x3) neighbourhood of the sample's cell,
+ * nearest cells first (centre, faces, edges, corners). A neighbour is skipped
+ * when the closest position its feature point could take is already no closer
+ * than the current F2. Keeping the points 0.25 inside their cells is what makes
+ * this exact: any point two or more cells away is at least as far as the two
+ * nearest points of the 3^n neighbourhood, so F1 and F2 are both exact.
+ *
+ * Entry points:
+ *   RE_NOISE_WORLEY{2,3}_CTX_f32           one point, returns RE_NOISE_WORLEY_RESULT
+ *   RE_NOISE_WORLEY{2,3}_X4_CTX_f32_sse    4 points (lanes = points), pruning by movemask
+ *   RE_NOISE_WORLEY{2,3}_X8_CTX_f32_avx2   8 points
+ *   RE_NOISE_WORLEY{2,3}_BATCH_CTX_f32     SoA arrays, widest kernel first
+ *   RE_NOISE_WORLEY{2,3}_FILL_GRID_CTX_f32 regular grid, RE_NOISE_*_FILL_GRID layout
+ * Batch / grid outputs (f1, f2, id) may each be NULL when not needed.
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_NOISE_CELLULAR_H
+#define RE_NOISE_CELLULAR_H
+
+#include "re_core.h"
+#include "re_math.h"
+#include "re_noise.h"
+
+typedef struct RE_NOISE_WORLEY_RESULT
+{
+    RE_f32 f1;      /* distance to the nearest feature point        */
+    RE_f32 f2;      /* distance to the second-nearest feature point */
+    RE_u32 id;      /* hash of the cell holding the nearest point   */
+} RE_NOISE_WORLEY_RESULT;
+
+/* Squared distance larger than anything the 3^n neighbourhood can produce */
+#define RE_NOISE_WORLEY_FAR_f32     64.0f
+
+/* Feature points lie in [MARGIN, 1 - MARGIN) of their cell on every axis */
+#define RE_NOISE_WORLEY_MARGIN_f32  0.25f
+
+/* ============================================================================================
+   FEATURE POINTS AND SEARCH ORDER
+   3D: 10 bits of the cell hash per axis. 2D: 16 bits per axis. Each is scaled to the
+   half-cell-wide jitter range starting at RE_NOISE_WORLEY_MARGIN_f32.
+   ============================================================================================ */
+
+static const RE_i8 RE_NOISE_WORLEY2_OFFSETS[9][2] = {
+    { 0, 0},
+    {-1, 0}, { 1, 0}, { 0,-1}, { 0, 1},
+    {-1,-1}, { 1,-1}, {-1, 1}, { 1, 1}
+};
+
+static const RE_i8 RE_NOISE_WORLEY3_OFFSETS[27][3] = {
+    { 0, 0, 0},
+    {-1, 0, 0}, { 1, 0, 0}, { 0,-1, 0}, { 0, 1, 0}, { 0, 0,-1}, { 0, 0, 1},
+    {-1,-1, 0}, { 1,-1, 0}, {-1, 1, 0}, { 1, 1, 0},
+    {-1, 0,-1}, { 1, 0,-1}, {-1, 0, 1}, { 1, 0, 1},
+    { 0,-1,-1}, { 0, 1,-1}, { 0,-1, 1}, { 0, 1, 1},
+    {-1,-1,-1}, { 1,-1,-1}, {-1, 1,-1}, { 1, 1,-1},
+    {-1,-1, 1}, { 1,-1, 1}, {-1, 1, 1}, { 1, 1, 1}
+};
+
+RE_INLINE void RE_NOISE_WORLEY_UPDATE_f32(RE_f32 d, RE_u32 h, RE_f32 *f1, RE_f32 *f2, RE_u32 *id)
+{
+    if (d < *f1)
+    {
+        *f2 = *f1;
+        *f1 = d;
+        *id = h;
+    }
+    else if (d < *f2)
+    {
+        *f2 = d;
+    }
+}
+
+/* Squared distance from the sample (cell fraction f) to the nearest feature point position of
+   neighbour o on one axis */
+RE_INLINE RE_f32 RE_NOISE_WORLEY_BOUND_f32(int o, RE_f32 f)
+{
+    RE_f32 g = (o < 0) ? f + RE_NOISE_WORLEY_MARGIN_f32
+             : (o > 0) ? (1.0f + RE_NOISE_WORLEY_MARGIN_f32) - f : 0.0f;
+    return g * g;
+}
+
+/* ============================================================================================
+   SCALAR — ONE POINT
+   ============================================================================================ */
+
+RE_INLINE RE_NOISE_WORLEY_RESULT RE_NOISE_WORLEY2_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y)
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+
+    RE_f32 fx = x - (RE_f32)X;
+    RE_f32 fy = y - (RE_f32)Y;
+
+    RE_f32 f1 = RE_NOISE_WORLEY_FAR_f32, f2 = RE_NOISE_WORLEY_FAR_f32;
+    RE_u32 id = 0;
+
+    for (int c = 0; c < 9; c++)
+    {
+        int ox = RE_NOISE_WORLEY2_OFFSETS[c][0];
+        int oy = RE_NOISE_WORLEY2_OFFSETS[c][1];
+
+        if (RE_NOISE_WORLEY_BOUND_f32(ox, fx) + RE_NOISE_WORLEY_BOUND_f32(oy, fy) >= f2)
+            continue;
+
+        RE_u32 h  = RE_HASH3D_PCG_SEED(ctx->seed, X + ox, Y + oy, 0);
+        RE_f32 cx = (RE_f32)ox + RE_NOISE_WORLEY_MARGIN_f32;
+        RE_f32 cy = (RE_f32)oy + RE_NOISE_WORLEY_MARGIN_f32;
+        RE_f32 dx = (cx + (RE_f32)(h & 0xFFFFu) * (1.0f / 131072.0f)) - fx;
+        RE_f32 dy = (cy + (RE_f32)(h >> 16)     * (1.0f / 131072.0f)) - fy;
+
+        RE_NOISE_WORLEY_UPDATE_f32(dx*dx + dy*dy, h, &f1, &f2, &id);
+    }
+
+    RE_NOISE_WORLEY_RESULT r = { RE_SQRT(f1), RE_SQRT(f2), id };
+    return r;
+}
+
+RE_INLINE RE_NOISE_WORLEY_RESULT RE_NOISE_WORLEY2_f32(RE_f32 x, RE_f32 y)
+{
+    return RE_NOISE_WORLEY2_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
+RE_INLINE RE_NOISE_WORLEY_RESULT RE_NOISE_WORLEY3_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                          RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+    RE_i32 Z = RE_FASTFLOOR_f32(z);
+
+    RE_f32 fx = x - (RE_f32)X;
+    RE_f32 fy = y - (RE_f32)Y;
+    RE_f32 fz = z - (RE_f32)Z;
+
+    RE_f32 f1 = RE_NOISE_WORLEY_FAR_f32, f2 = RE_NOISE_WORLEY_FAR_f32;
+    RE_u32 id = 0;
+
+    for (int c = 0; c < 27; c++)
+    {
+        int ox = RE_NOISE_WORLEY3_OFFSETS[c][0];
+        int oy = RE_NOISE_WORLEY3_OFFSETS[c][1];
+        int oz = RE_NOISE_WORLEY3_OFFSETS[c][2];
+
+        if (RE_NOISE_WORLEY_BOUND_f32(ox, fx) + RE_NOISE_WORLEY_BOUND_f32(oy, fy)
+          + RE_NOISE_WORLEY_BOUND_f32(oz, fz) >= f2)
+            continue;
+
+        RE_u32 h  = RE_HASH3D_PCG_SEED(ctx->seed, X + ox, Y + oy, Z + oz);
+        RE_f32 cx = (RE_f32)ox + RE_NOISE_WORLEY_MARGIN_f32;
+        RE_f32 cy = (RE_f32)oy + RE_NOISE_WORLEY_MARGIN_f32;
+        RE_f32 cz = (RE_f32)oz + RE_NOISE_WORLEY_MARGIN_f32;
+        RE_f32 dx = (cx + (RE_f32)( h        & 0x3FFu) * (1.0f / 2048.0f)) - fx;
+        RE_f32 dy = (cy + (RE_f32)((h >> 10) & 0x3FFu) * (1.0f / 2048.0f)) - fy;
+        RE_f32 dz = (cz + (RE_f32)((h >> 20) & 0x3FFu) * (1.0f / 2048.0f)) - fz;
+
+        RE_NOISE_WORLEY_UPDATE_f32(dx*dx + dy*dy + dz*dz, h, &f1, &f2, &id);
+    }
+
+    RE_NOISE_WORLEY_RESULT r = { RE_SQRT(f1), RE_SQRT(f2), id };
+    return r;
+}
+
+RE_INLINE RE_NOISE_WORLEY_RESULT RE_NOISE_WORLEY3_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_WORLEY3_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* ============================================================================================
+   SSE — 4 POINTS (lanes = points)
+   Every lane walks the same neighbour order; a neighbour is skipped only when it is pruned
+   in all four lanes.
+   ============================================================================================ */
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+RE_INLINE void RE_NOISE_WORLEY_UPDATE_X4_sse(__m128 d, __m128i h, __m128 *f1, __m128 *f2, __m128i *id)
+{
+    __m128 lt = _mm_cmplt_ps(d, *f1);
+
+    *f2 = _mm_or_ps(_mm_and_ps(lt, *f1), _mm_andnot_ps(lt, _mm_min_ps(*f2, d)));
+    *f1 = _mm_min_ps(*f1, d);
+    *id = _mm_or_si128(_mm_and_si128(_mm_castps_si128(lt), h),
+                       _mm_andnot_si128(_mm_castps_si128(lt), *id));
+}
+
+/* Per-axis pruning terms, as RE_NOISE_WORLEY_BOUND_f32: lo = (f + margin)^2 (neighbour below),
+   hi = (1 + margin - f)^2 (neighbour above) */
+RE_INLINE void RE_NOISE_WORLEY_BOUNDS_X4_sse(__m128 f, __m128 *lo, __m128 *hi)
+{
+    __m128 a = _mm_add_ps(f, _mm_set1_ps(RE_NOISE_WORLEY_MARGIN_f32));
+    __m128 b = _mm_sub_ps(_mm_set1_ps(1.0f + RE_NOISE_WORLEY_MARGIN_f32), f);
+    *lo = _mm_mul_ps(a, a);
+    *hi = _mm_mul_ps(b, b);
+}
+
+RE_INLINE __m128 RE_NOISE_WORLEY_BOUND_X4_sse(int o, __m128 lo, __m128 hi)
+{
+    return (o < 0) ? lo : (o > 0) ? hi : _mm_setzero_ps();
+}
+
+RE_INLINE void RE_NOISE_WORLEY2_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx, __m128 x, __m128 y,
+                                               __m128 *out_f1, __m128 *out_f2, __m128i *out_id)
+{
+    __m128  flx, fly;
+    __m128i X = RE_NOISE_FLOOR_X4_f32_sse(x, &flx);
+    __m128i Y = RE_NOISE_FLOOR_X4_f32_sse(y, &fly);
+
+    __m128 fx = _mm_sub_ps(x, flx);
+    __m128 fy = _mm_sub_ps(y, fly);
+
+    __m128 lox, hix, loy, hiy;
+    RE_NOISE_WORLEY_BOUNDS_X4_sse(fx, &lox, &hix);
+    RE_NOISE_WORLEY_BOUNDS_X4_sse(fy, &loy, &hiy);
+
+    const __m128i m16   = _mm_set1_epi32(0xFFFF);
+    const __m128  scale = _mm_set1_ps(1.0f / 131072.0f);
+
+    __m128  f1 = _mm_set1_ps(RE_NOISE_WORLEY_FAR_f32), f2 = f1;
+    __m128i id = _mm_setzero_si128();
+
+    for (int c = 0; c < 9; c++)
+    {
+        int ox = RE_NOISE_WORLEY2_OFFSETS[c][0];
+        int oy = RE_NOISE_WORLEY2_OFFSETS[c][1];
+
+        __m128 bound = _mm_add_ps(RE_NOISE_WORLEY_BOUND_X4_sse(ox, lox, hix),
+                                  RE_NOISE_WORLEY_BOUND_X4_sse(oy, loy, hiy));
+        if (_mm_movemask_ps(_mm_cmplt_ps(bound, f2)) == 0)
+            continue;
+
+        __m128i h = RE_HASH3D_PCG_SEED_X4_sse(ctx->seed,
+                                              _mm_add_epi32(X, _mm_set1_epi32(ox)),
+                                              _mm_add_epi32(Y, _mm_set1_epi32(oy)),
+                                              _mm_setzero_si128());
+
+        __m128 jx = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(h, m16)), scale);
+        __m128 jy = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(h, 16)), scale);
+
+        __m128 dx = _mm_sub_ps(_mm_add_ps(_mm_set1_ps((RE_f32)ox + RE_NOISE_WORLEY_MARGIN_f32), jx), fx);
+        __m128 dy = _mm_sub_ps(_mm_add_ps(_mm_set1_ps((RE_f32)oy + RE_NOISE_WORLEY_MARGIN_f32), jy), fy);
+
+        RE_NOISE_WORLEY_UPDATE_X4_sse(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), h, &f1, &f2, &id);
+    }
+
+    *out_f1 = _mm_sqrt_ps(f1);
+    *out_f2 = _mm_sqrt_ps(f2);
+    *out_id = id;
+}
+
+RE_INLINE void RE_NOISE_WORLEY3_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx, __m128 x, __m128 y, __m128 z,
+                                               __m128 *out_f1, __m128 *out_f2, __m128i *out_id)
+{
+    __m128  flx, fly, flz;
+    __m128i X = RE_NOISE_FLOOR_X4_f32_sse(x, &flx);
+    __m128i Y = RE_NOISE_FLOOR_X4_f32_sse(y, &fly);
+    __m128i Z = RE_NOISE_FLOOR_X4_f32_sse(z, &flz);
+
+    __m128 fx = _mm_sub_ps(x, flx);
+    __m128 fy = _mm_sub_ps(y, fly);
+    __m128 fz = _mm_sub_ps(z, flz);
+
+    __m128 lox, hix, loy, hiy, loz, hiz;
+    RE_NOISE_WORLEY_BOUNDS_X4_sse(fx, &lox, &hix);
+    RE_NOISE_WORLEY_BOUNDS_X4_sse(fy, &loy, &hiy);
+    RE_NOISE_WORLEY_BOUNDS_X4_sse(fz, &loz, &hiz);
+
+    const __m128i m10   = _mm_set1_epi32(0x3FF);
+    const __m128  scale = _mm_set1_ps(1.0f / 2048.0f);
+
+    __m128  f1 = _mm_set1_ps(RE_NOISE_WORLEY_FAR_f32), f2 = f1;
+    __m128i id = _mm_setzero_si128();
+
+    for (int c = 0; c < 27; c++)
+    {
+        int ox = RE_NOISE_WORLEY3_OFFSETS[c][0];
+        int oy = RE_NOISE_WORLEY3_OFFSETS[c][1];
+        int oz = RE_NOISE_WORLEY3_OFFSETS[c][2];
+
+        __m128 bound = _mm_add_ps(_mm_add_ps(RE_NOISE_WORLEY_BOUND_X4_sse(ox, lox, hix),
+                                             RE_NOISE_WORLEY_BOUND_X4_sse(oy, loy, hiy)),
+                                  RE_NOISE_WORLEY_BOUND_X4_sse(oz, loz, hiz));
+        if (_mm_movemask_ps(_mm_cmplt_ps(bound, f2)) == 0)
+            continue;
+
+        __m128i h = RE_HASH3D_PCG_SEED_X4_sse(ctx->seed,
+                                              _mm_add_epi32(X, _mm_set1_epi32(ox)),
+                                              _mm_add_epi32(Y, _mm_set1_epi32(oy)),
+                                              _mm_add_epi32(Z, _mm_set1_epi32(oz)));
+
+        __m128 jx = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(h, m10)), scale);
+        __m128 jy = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(h, 10), m10)), scale);
+        __m128 jz = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(h, 20), m10)), scale);
+
+        __m128 dx = _mm_sub_ps(_mm_add_ps(_mm_set1_ps((RE_f32)ox + RE_NOISE_WORLEY_MARGIN_f32), jx), fx);
+        __m128 dy = _mm_sub_ps(_mm_add_ps(_mm_set1_ps((RE_f32)oy + RE_NOISE_WORLEY_MARGIN_f32), jy), fy);
+        __m128 dz = _mm_sub_ps(_mm_add_ps(_mm_set1_ps((RE_f32)oz + RE_NOISE_WORLEY_MARGIN_f32), jz), fz);
+
+        __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        RE_NOISE_WORLEY_UPDATE_X4_sse(d, h, &f1, &f2, &id);
+    }
+
+    *out_f1 = _mm_sqrt_ps(f1);
+    *out_f2 = _mm_sqrt_ps(f2);
+    *out_id = id;
+}
+
+/* Store lanes [i, i+4) of the requested outputs */
+RE_INLINE void RE_NOISE_WORLEY_STORE_X4_sse(__m128 f1, __m128 f2, __m128i id,
+                                            RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id, size_t i)
+{
+    if (out_f1) _mm_storeu_ps(out_f1 + i, f1);
+    if (out_f2) _mm_storeu_ps(out_f2 + i, f2);
+    if (out_id) _mm_storeu_si128((__m128i *)(out_id + i), id);
+}
+
+#endif
+
+/* ============================================================================================
+   AVX2 — 8 POINTS (lanes = points)
+   ============================================================================================ */
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+
+RE_INLINE void RE_NOISE_WORLEY_UPDATE_X8_avx2(__m256 d, __m256i h, __m256 *f1, __m256 *f2, __m256i *id)
+{
+    __m256 lt = _mm256_cmp_ps(d, *f1, _CMP_LT_OQ);
+
+    *f2 = _mm256_blendv_ps(_mm256_min_ps(*f2, d), *f1, lt);
+    *f1 = _mm256_min_ps(*f1, d);
+    *id = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(*id), _mm256_castsi256_ps(h), lt));
+}
+
+RE_INLINE void RE_NOISE_WORLEY_BOUNDS_X8_avx2(__m256 f, __m256 *lo, __m256 *hi)
+{
+    __m256 a = _mm256_add_ps(f, _mm256_set1_ps(RE_NOISE_WORLEY_MARGIN_f32));
+    __m256 b = _mm256_sub_ps(_mm256_set1_ps(1.0f + RE_NOISE_WORLEY_MARGIN_f32), f);
+    *lo = _mm256_mul_ps(a, a);
+    *hi = _mm256_mul_ps(b, b);
+}
+
+RE_INLINE __m256 RE_NOISE_WORLEY_BOUND_X8_avx2(int o, __m256 lo, __m256 hi)
+{
+    return (o < 0) ? lo : (o > 0) ? hi : _mm256_setzero_ps();
+}
+
+RE_INLINE void RE_NOISE_WORLEY2_X8_CTX_f32_avx2(const RE_NOISE_CONTEXT *ctx, __m256 x, __m256 y,
+                                                __m256 *out_f1, __m256 *out_f2, __m256i *out_id)
+{
+    __m256 flx = _mm256_floor_ps(x);
+    __m256 fly = _mm256_floor_ps(y);
+
+    __m256i X = _mm256_cvttps_epi32(flx);
+    __m256i Y = _mm256_cvttps_epi32(fly);
+
+    __m256 fx = _mm256_sub_ps(x, flx);
+    __m256 fy = _mm256_sub_ps(y, fly);
+
+    __m256 lox, hix, loy, hiy;
+    RE_NOISE_WORLEY_BOUNDS_X8_avx2(fx, &lox, &hix);
+    RE_NOISE_WORLEY_BOUNDS_X8_avx2(fy, &loy, &hiy);
+
+    const __m256i m16   = _mm256_set1_epi32(0xFFFF);
+    const __m256  scale = _mm256_set1_ps(1.0f / 131072.0f);
+
+    __m256  f1 = _mm256_set1_ps(RE_NOISE_WORLEY_FAR_f32), f2 = f1;
+    __m256i id = _mm256_setzero_si256();
+
+    for (int c = 0; c < 9; c++)
+    {
+        int ox = RE_NOISE_WORLEY2_OFFSETS[c][0];
+        int oy = RE_NOISE_WORLEY2_OFFSETS[c][1];
+
+        __m256 bound = _mm256_add_ps(RE_NOISE_WORLEY_BOUND_X8_avx2(ox, lox, hix),
+                                     RE_NOISE_WORLEY_BOUND_X8_avx2(oy, loy, hiy));
+        if (_mm256_movemask_ps(_mm256_cmp_ps(bound, f2, _CMP_LT_OQ)) == 0)
+            continue;
+
+        __m256i h = RE_HASH3D_PCG_SEED_X8_avx2(ctx->seed,
+                                               _mm256_add_epi32(X, _mm256_set1_epi32(ox)),
+                                               _mm256_add_epi32(Y, _mm256_set1_epi32(oy)),
+                                               _mm256_setzero_si256());
+
+        __m256 jx = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(h, m16)), scale);
+        __m256 jy = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(h, 16)), scale);
+
+        __m256 dx = _mm256_sub_ps(_mm256_add_ps(_mm256_set1_ps((RE_f32)ox + RE_NOISE_WORLEY_MARGIN_f32), jx), fx);
+        __m256 dy = _mm256_sub_ps(_mm256_add_ps(_mm256_set1_ps((RE_f32)oy + RE_NOISE_WORLEY_MARGIN_f32), jy), fy);
+
+        RE_NOISE_WORLEY_UPDATE_X8_avx2(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)),
+                                       h, &f1, &f2, &id);
+    }
+
+    *out_f1 = _mm256_sqrt_ps(f1);
+    *out_f2 = _mm256_sqrt_ps(f2);
+    *out_id = id;
+}
+
+RE_INLINE void RE_NOISE_WORLEY3_X8_CTX_f32_avx2(const RE_NOISE_CONTEXT *ctx, __m256 x, __m256 y, __m256 z,
+                                                __m256 *out_f1, __m256 *out_f2, __m256i *out_id)
+{
+    __m256 flx = _mm256_floor_ps(x);
+    __m256 fly = _mm256_floor_ps(y);
+    __m256 flz = _mm256_floor_ps(z);
+
+    __m256i X = _mm256_cvttps_epi32(flx);
+    __m256i Y = _mm256_cvttps_epi32(fly);
+    __m256i Z = _mm256_cvttps_epi32(flz);
+
+    __m256 fx = _mm256_sub_ps(x, flx);
+    __m256 fy = _mm256_sub_ps(y, fly);
+    __m256 fz = _mm256_sub_ps(z, flz);
+
+    __m256 lox, hix, loy, hiy, loz, hiz;
+    RE_NOISE_WORLEY_BOUNDS_X8_avx2(fx, &lox, &hix);
+    RE_NOISE_WORLEY_BOUNDS_X8_avx2(fy, &loy, &hiy);
+    RE_NOISE_WORLEY_BOUNDS_X8_avx2(fz, &loz, &hiz);
+
+    const __m256i m10   = _mm256_set1_epi32(0x3FF);
+    const __m256  scale = _mm256_set1_ps(1.0f / 2048.0f);
+
+    __m256  f1 = _mm256_set1_ps(RE_NOISE_WORLEY_FAR_f32), f2 = f1;
+    __m256i id = _mm256_setzero_si256();
+
+    for (int c = 0; c < 27; c++)
+    {
+        int ox = RE_NOISE_WORLEY3_OFFSETS[c][0];
+        int oy = RE_NOISE_WORLEY3_OFFSETS[c][1];
+        int oz = RE_NOISE_WORLEY3_OFFSETS[c][2];
+
+        __m256 bound = _mm256_add_ps(_mm256_add_ps(RE_NOISE_WORLEY_BOUND_X8_avx2(ox, lox, hix),
+                                                   RE_NOISE_WORLEY_BOUND_X8_avx2(oy, loy, hiy)),
+                                     RE_NOISE_WORLEY_BOUND_X8_avx2(oz, loz, hiz));
+        if (_mm256_movemask_ps(_mm256_cmp_ps(bound, f2, _CMP_LT_OQ)) == 0)
+            continue;
+
+        __m256i h = RE_HASH3D_PCG_SEED_X8_avx2(ctx->seed,
+                                               _mm256_add_epi32(X, _mm256_set1_epi32(ox)),
+                                               _mm256_add_epi32(Y, _mm256_set1_epi32(oy)),
+                                               _mm256_add_epi32(Z, _mm256_set1_epi32(oz)));
+
+        __m256 jx = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(h, m10)), scale);
+        __m256 jy = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(h, 10), m10)), scale);
+        __m256 jz = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(h, 20), m10)), scale);
+
+        __m256 dx = _mm256_sub_ps(_mm256_add_ps(_mm256_set1_ps((RE_f32)ox + RE_NOISE_WORLEY_MARGIN_f32), jx), fx);
+        __m256 dy = _mm256_sub_ps(_mm256_add_ps(_mm256_set1_ps((RE_f32)oy + RE_NOISE_WORLEY_MARGIN_f32), jy), fy);
+        __m256 dz = _mm256_sub_ps(_mm256_add_ps(_mm256_set1_ps((RE_f32)oz + RE_NOISE_WORLEY_MARGIN_f32), jz), fz);
+
+        __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)),
+                                 _mm256_mul_ps(dz, dz));
+        RE_NOISE_WORLEY_UPDATE_X8_avx2(d, h, &f1, &f2, &id);
+    }
+
+    *out_f1 = _mm256_sqrt_ps(f1);
+    *out_f2 = _mm256_sqrt_ps(f2);
+    *out_id = id;
+}
+
+RE_INLINE void RE_NOISE_WORLEY_STORE_X8_avx2(__m256 f1, __m256 f2, __m256i id,
+                                             RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id, size_t i)
+{
+    if (out_f1) _mm256_storeu_ps(out_f1 + i, f1);
+    if (out_f2) _mm256_storeu_ps(out_f2 + i, f2);
+    if (out_id) _mm256_storeu_si256((__m256i *)(out_id + i), id);
+}
+
+#endif
+
+/* ============================================================================================
+   BATCH — SoA arrays, widest kernel first, scalar tail
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_WORLEY_STORE_f32(RE_NOISE_WORLEY_RESULT r,
+                                         RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id, size_t i)
+{
+    if (out_f1) out_f1[i] = r.f1;
+    if (out_f2) out_f2[i] = r.f2;
+    if (out_id) out_id[i] = r.id;
+}
+
+RE_INLINE void RE_NOISE_WORLEY2_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                              const RE_f32 *x, const RE_f32 *y,
+                                              RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id, int count)
+{
+    int i = 0;
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 f1, f2; __m256i id;
+        RE_NOISE_WORLEY2_X8_CTX_f32_avx2(ctx, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), &f1, &f2, &id);
+        RE_NOISE_WORLEY_STORE_X8_avx2(f1, f2, id, out_f1, out_f2, out_id, (size_t)i);
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 f1, f2; __m128i id;
+        RE_NOISE_WORLEY2_X4_CTX_f32_sse(ctx, _mm_loadu_ps(x + i), _mm_loadu_ps(y + i), &f1, &f2, &id);
+        RE_NOISE_WORLEY_STORE_X4_sse(f1, f2, id, out_f1, out_f2, out_id, (size_t)i);
+    }
+#endif
+
+    for (; i < count; i++)
+        RE_NOISE_WORLEY_STORE_f32(RE_NOISE_WORLEY2_CTX_f32(ctx, x[i], y[i]), out_f1, out_f2, out_id, (size_t)i);
+}
+
+RE_INLINE void RE_NOISE_WORLEY2_BATCH_f32(const RE_f32 *x, const RE_f32 *y,
+                                          RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id, int count)
+{
+    RE_NOISE_WORLEY2_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, out_f1, out_f2, out_id, count);
+}
+
+RE_INLINE void RE_NOISE_WORLEY3_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                              const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                              RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id, int count)
+{
+    int i = 0;
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 f1, f2; __m256i id;
+        RE_NOISE_WORLEY3_X8_CTX_f32_avx2(ctx, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i),
+                                         _mm256_loadu_ps(z + i), &f1, &f2, &id);
+        RE_NOISE_WORLEY_STORE_X8_avx2(f1, f2, id, out_f1, out_f2, out_id, (size_t)i);
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 f1, f2; __m128i id;
+        RE_NOISE_WORLEY3_X4_CTX_f32_sse(ctx, _mm_loadu_ps(x + i), _mm_loadu_ps(y + i),
+                                        _mm_loadu_ps(z + i), &f1, &f2, &id);
+        RE_NOISE_WORLEY_STORE_X4_sse(f1, f2, id, out_f1, out_f2, out_id, (size_t)i);
+    }
+#endif
+
+    for (; i < count; i++)
+        RE_NOISE_WORLEY_STORE_f32(RE_NOISE_WORLEY3_CTX_f32(ctx, x[i], y[i], z[i]),
+                                  out_f1, out_f2, out_id, (size_t)i);
+}
+
+RE_INLINE void RE_NOISE_WORLEY3_BATCH_f32(const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                          RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id, int count)
+{
+    RE_NOISE_WORLEY3_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out_f1, out_f2, out_id, count);
+}
+
+/* ============================================================================================
+   GRID FILL — out[(k * ny + j) * nx + i] for the sample (ox + i*sx, oy + j*sy, oz + k*sz)
+   Rows run through the lane kernels with x generated from the column index.
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_WORLEY2_FILL_GRID_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                  RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id,
+                                                  RE_f32 ox, RE_f32 oy, RE_f32 sx, RE_f32 sy,
+                                                  int nx, int ny)
+{
+    for (int j = 0; j < ny; j++)
+    {
+        RE_f32 y   = oy + (RE_f32)j * sy;
+        size_t row = (size_t)j * (size_t)nx;
+        int i = 0;
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+        const __m256 lane8 = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+        for (; i + 8 <= nx; i += 8)
+        {
+            __m256 xs = _mm256_add_ps(_mm256_set1_ps(ox),
+                                      _mm256_mul_ps(_mm256_add_ps(_mm256_set1_ps((RE_f32)i), lane8),
+                                                    _mm256_set1_ps(sx)));
+            __m256 f1, f2; __m256i id;
+            RE_NOISE_WORLEY2_X8_CTX_f32_avx2(ctx, xs, _mm256_set1_ps(y), &f1, &f2, &id);
+            RE_NOISE_WORLEY_STORE_X8_avx2(f1, f2, id, out_f1, out_f2, out_id, row + (size_t)i);
+        }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+        const __m128 lane4 = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+        for (; i + 4 <= nx; i += 4)
+        {
+            __m128 xs = _mm_add_ps(_mm_set1_ps(ox),
+                                   _mm_mul_ps(_mm_add_ps(_mm_set1_ps((RE_f32)i), lane4), _mm_set1_ps(sx)));
+            __m128 f1, f2; __m128i id;
+            RE_NOISE_WORLEY2_X4_CTX_f32_sse(ctx, xs, _mm_set1_ps(y), &f1, &f2, &id);
+            RE_NOISE_WORLEY_STORE_X4_sse(f1, f2, id, out_f1, out_f2, out_id, row + (size_t)i);
+        }
+#endif
+
+        for (; i < nx; i++)
+            RE_NOISE_WORLEY_STORE_f32(RE_NOISE_WORLEY2_CTX_f32(ctx, ox + (RE_f32)i * sx, y),
+                                      out_f1, out_f2, out_id, row + (size_t)i);
+    }
+}
+
+RE_INLINE void RE_NOISE_WORLEY2_FILL_GRID_f32(RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id,
+                                              RE_f32 ox, RE_f32 oy, RE_f32 sx, RE_f32 sy,
+                                              int nx, int ny)
+{
+    RE_NOISE_WORLEY2_FILL_GRID_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, out_f1, out_f2, out_id,
+                                       ox, oy, sx, sy, nx, ny);
+}
+
+RE_INLINE void RE_NOISE_WORLEY3_FILL_GRID_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                  RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id,
+                                                  RE_f32 ox, RE_f32 oy, RE_f32 oz,
+                                                  RE_f32 sx, RE_f32 sy, RE_f32 sz,
+                                                  int nx, int ny, int nz)
+{
+    for (int k = 0; k < nz; k++)
+    {
+        RE_f32 z = oz + (RE_f32)k * sz;
+
+        for (int j = 0; j < ny; j++)
+        {
+            RE_f32 y   = oy + (RE_f32)j * sy;
+            size_t row = ((size_t)k * (size_t)ny + (size_t)j) * (size_t)nx;
+            int i = 0;
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+            const __m256 lane8 = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+            for (; i + 8 <= nx; i += 8)
+            {
+                __m256 xs = _mm256_add_ps(_mm256_set1_ps(ox),
+                                          _mm256_mul_ps(_mm256_add_ps(_mm256_set1_ps((RE_f32)i), lane8),
+                                                        _mm256_set1_ps(sx)));
+                __m256 f1, f2; __m256i id;
+                RE_NOISE_WORLEY3_X8_CTX_f32_avx2(ctx, xs, _mm256_set1_ps(y), _mm256_set1_ps(z), &f1, &f2, &id);
+                RE_NOISE_WORLEY_STORE_X8_avx2(f1, f2, id, out_f1, out_f2, out_id, row + (size_t)i);
+            }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+            const __m128 lane4 = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+            for (; i + 4 <= nx; i += 4)
+            {
+                __m128 xs = _mm_add_ps(_mm_set1_ps(ox),
+                                       _mm_mul_ps(_mm_add_ps(_mm_set1_ps((RE_f32)i), lane4), _mm_set1_ps(sx)));
+                __m128 f1, f2; __m128i id;
+                RE_NOISE_WORLEY3_X4_CTX_f32_sse(ctx, xs, _mm_set1_ps(y), _mm_set1_ps(z), &f1, &f2, &id);
+                RE_NOISE_WORLEY_STORE_X4_sse(f1, f2, id, out_f1, out_f2, out_id, row + (size_t)i);
+            }
+#endif
+
+            for (; i < nx; i++)
+                RE_NOISE_WORLEY_STORE_f32(RE_NOISE_WORLEY3_CTX_f32(ctx, ox + (RE_f32)i * sx, y, z),
+                                          out_f1, out_f2, out_id, row + (size_t)i);
+        }
+    }
+}
+
+RE_INLINE void RE_NOISE_WORLEY3_FILL_GRID_f32(RE_f32 *out_f1, RE_f32 *out_f2, RE_u32 *out_id,
+                                              RE_f32 ox, RE_f32 oy, RE_f32 oz,
+                                              RE_f32 sx, RE_f32 sy, RE_f32 sz,
+                                              int nx, int ny, int nz)
+{
+    RE_NOISE_WORLEY3_FILL_GRID_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, out_f1, out_f2, out_id,
+                                       ox, oy, oz, sx, sy, sz, nx, ny, nz);
+}
+
+#endif /* RE_NOISE_CELLULAR_H */
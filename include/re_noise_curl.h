@@ -0,0 +1,381 @@
+/**
+ * @file re_noise_curl.h
+ * @brief Curl noise: divergence-free velocity fields for particle advection.
+ *
+ * v = curl(psi), with psi the 3-channel OpenSimplex2S potential of
+ * re_noise_warp.h (three decorrelated gradients from one corner hash).
+ * The Jacobian of psi comes from the analytic derivative of every kernel
+ * term,
+ *
+ *   d/dp [a^4 (g.p)] = a^4 g - 8 a^3 (g.p) p,
+ *
+ * accumulated in lattice space and mapped back through the (symmetric)
+ * OpenSimplex2S skew. One pass over the 16 corners yields all nine partials.
+ * Finite differences would need 18 evaluations: 3 potentials x 6 samples.
+ *
+ * The curl is the field's own (unscaled) curl: a particle at p samples
+ * curl(psi)(p * frequency) and the velocity it receives is independent of
+ * the frequency.
+ *
+ * Entry points:
+ *   RE_NOISE_CURL3_CTX_f32                 curl at one point
+ *   RE_NOISE_CURL3_X4_CTX_f32_sse          4 points in lanes
+ *   RE_NOISE_CURL3_X8_CTX_f32_avx2         8 points in lanes
+ *   RE_NOISE_CURL3_BATCH_CTX_f32           SoA positions, vel[i] += strength * curl
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_NOISE_CURL_H
+#define RE_NOISE_CURL_H
+
+#include "re_core.h"
+#include "re_noise.h"
+#include "re_noise_warp.h"
+
+/* ============================================================================================
+   SCALAR
+   ============================================================================================ */
+
+/* curl from the lattice-space gradients L[channel][axis] (input-space J = (2/3) sum(L) - L) */
+RE_INLINE RE_V3_f32 RE_NOISE_CURL3_FROM_LATTICE_f32(const RE_f32 L[3][3])
+{
+    RE_f32 s0 = (2.0f / 3.0f) * (L[0][0] + L[0][1] + L[0][2]);
+    RE_f32 s1 = (2.0f / 3.0f) * (L[1][0] + L[1][1] + L[1][2]);
+    RE_f32 s2 = (2.0f / 3.0f) * (L[2][0] + L[2][1] + L[2][2]);
+
+    RE_V3_f32 c;
+    c.x = ((s2 - L[2][1]) - (s1 - L[1][2])) * OS3D_SMOOTH_SCALE_F32;
+    c.y = ((s0 - L[0][2]) - (s2 - L[2][0])) * OS3D_SMOOTH_SCALE_F32;
+    c.z = ((s1 - L[1][0]) - (s0 - L[0][1])) * OS3D_SMOOTH_SCALE_F32;
+    return c;
+}
+
+RE_INLINE RE_V3_f32 RE_NOISE_CURL3_CTX_f32(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_f32 r  = (2.0f / 3.0f) * (x + y + z);
+    RE_f32 xr = r - x;
+    RE_f32 yr = r - y;
+    RE_f32 zr = r - z;
+
+    RE_f32 L[3][3] = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+
+    for (int l = 0; l < 2; l++)
+    {
+        RE_f32 ox = xr - 0.5f * l;
+        RE_f32 oy = yr - 0.5f * l;
+        RE_f32 oz = zr - 0.5f * l;
+
+        RE_i32 xb = (RE_i32)RE_FASTFLOOR_f32(ox);
+        RE_i32 yb = (RE_i32)RE_FASTFLOOR_f32(oy);
+        RE_i32 zb = (RE_i32)RE_FASTFLOOR_f32(oz);
+
+        RE_f32 fx = ox - xb;
+        RE_f32 fy = oy - yb;
+        RE_f32 fz = oz - zb;
+
+        for (int c = 0; c < 8; c++)
+        {
+            RE_i32 dx = c & 1, dy = (c >> 1) & 1, dz = c >> 2;
+
+            RE_f32 px = fx - dx;
+            RE_f32 py = fy - dy;
+            RE_f32 pz = fz - dz;
+
+            RE_f32 attn = 0.75f - (px*px + py*py + pz*pz);
+            if (attn > 0.0f)
+            {
+                RE_u32 h  = RE_OS3D_HASH_SEED(ctx->seed, 2 * (xb + dx) + l, 2 * (yb + dy) + l, 2 * (zb + dz) + l);
+                RE_f32 a2 = attn * attn;
+                RE_f32 a4 = a2 * a2;
+
+                const RE_i8 *g[3] = { RE_NOISE_GRAD3[RE_HASH_TO_GRAD12(h)],
+                                      RE_NOISE_GRAD3[RE_NOISE_WARP_GRAD_CH1(h)],
+                                      RE_NOISE_GRAD3[RE_NOISE_WARP_GRAD_CH2(h)] };
+
+                for (int k = 0; k < 3; k++)
+                {
+                    RE_f32 t = -8.0f * a2 * attn * RE_OS_DOT3_f32(g[k], px, py, pz);
+                    L[k][0] += a4 * g[k][0] + t * px;
+                    L[k][1] += a4 * g[k][1] + t * py;
+                    L[k][2] += a4 * g[k][2] + t * pz;
+                }
+            }
+        }
+    }
+
+    return RE_NOISE_CURL3_FROM_LATTICE_f32((const RE_f32 (*)[3])L);
+}
+
+RE_INLINE RE_V3_f32 RE_NOISE_CURL3_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_CURL3_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* ============================================================================================
+   SSE (4 points in lanes)
+   ============================================================================================ */
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+/* L += a^4 g + t (g.p) p for one channel, t = -8 a^3. The a^4 g term is ±a^4 on the dot's u axis
+   (x, or y when !use_x) and v axis (y when use_y, else z). */
+RE_INLINE void RE_NOISE_CURL3_ACCUM_X4_sse(__m128i gi, __m128 a4, __m128 t,
+                                           __m128 px, __m128 py, __m128 pz, __m128 L[3])
+{
+    __m128 use_x, use_y, sign_u, sign_v;
+    RE_NOISE_GRAD3_MASKS_X4_sse(gi, &use_x, &use_y, &sign_u, &sign_v);
+
+    __m128 u   = _mm_or_ps(_mm_and_ps(use_x, px), _mm_andnot_ps(use_x, py));
+    __m128 v   = _mm_or_ps(_mm_and_ps(use_y, py), _mm_andnot_ps(use_y, pz));
+    __m128 tdp = _mm_mul_ps(t, _mm_add_ps(_mm_xor_ps(u, sign_u), _mm_xor_ps(v, sign_v)));
+
+    __m128 su = _mm_xor_ps(a4, sign_u);
+    __m128 sv = _mm_xor_ps(a4, sign_v);
+
+    L[0] = _mm_add_ps(L[0], _mm_add_ps(_mm_and_ps(use_x, su), _mm_mul_ps(tdp, px)));
+    L[1] = _mm_add_ps(L[1], _mm_add_ps(_mm_or_ps(_mm_andnot_ps(use_x, su), _mm_and_ps(use_y, sv)),
+                                       _mm_mul_ps(tdp, py)));
+    L[2] = _mm_add_ps(L[2], _mm_add_ps(_mm_andnot_ps(use_y, sv), _mm_mul_ps(tdp, pz)));
+}
+
+RE_INLINE void RE_NOISE_CURL3_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx,
+                                             __m128 x, __m128 y, __m128 z, __m128 out[3])
+{
+    __m128 r  = _mm_mul_ps(_mm_set1_ps(2.0f / 3.0f), _mm_add_ps(_mm_add_ps(x, y), z));
+    __m128 xr = _mm_sub_ps(r, x);
+    __m128 yr = _mm_sub_ps(r, y);
+    __m128 zr = _mm_sub_ps(r, z);
+
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 rad = _mm_set1_ps(0.75f);
+    __m128 L[3][3];
+    for (int k = 0; k < 3; k++)
+        L[k][0] = L[k][1] = L[k][2] = _mm_setzero_ps();
+
+    for (int l = 0; l < 2; l++)
+    {
+        __m128 sh = _mm_set1_ps(0.5f * l);
+        __m128 bx, by, bz;
+        __m128i xb = RE_NOISE_FLOOR_X4_f32_sse(_mm_sub_ps(xr, sh), &bx);
+        __m128i yb = RE_NOISE_FLOOR_X4_f32_sse(_mm_sub_ps(yr, sh), &by);
+        __m128i zb = RE_NOISE_FLOOR_X4_f32_sse(_mm_sub_ps(zr, sh), &bz);
+
+        __m128 f[2][3];
+        f[0][0] = _mm_sub_ps(_mm_sub_ps(xr, sh), bx);  f[1][0] = _mm_sub_ps(f[0][0], one);
+        f[0][1] = _mm_sub_ps(_mm_sub_ps(yr, sh), by);  f[1][1] = _mm_sub_ps(f[0][1], one);
+        f[0][2] = _mm_sub_ps(_mm_sub_ps(zr, sh), bz);  f[1][2] = _mm_sub_ps(f[0][2], one);
+
+        __m128i li = _mm_set1_epi32(l), two = _mm_set1_epi32(2);
+        __m128i c[2][3];
+        c[0][0] = _mm_add_epi32(_mm_slli_epi32(xb, 1), li);  c[1][0] = _mm_add_epi32(c[0][0], two);
+        c[0][1] = _mm_add_epi32(_mm_slli_epi32(yb, 1), li);  c[1][1] = _mm_add_epi32(c[0][1], two);
+        c[0][2] = _mm_add_epi32(_mm_slli_epi32(zb, 1), li);  c[1][2] = _mm_add_epi32(c[0][2], two);
+
+        for (int k = 0; k < 8; k++)
+        {
+            int dx = k & 1, dy = (k >> 1) & 1, dz = k >> 2;
+            __m128 px = f[dx][0], py = f[dy][1], pz = f[dz][2];
+
+            /* Shared per corner: attenuation terms and hash */
+            __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, px), _mm_mul_ps(py, py)), _mm_mul_ps(pz, pz));
+            __m128 a  = _mm_max_ps(_mm_sub_ps(rad, d2), _mm_setzero_ps());
+            __m128 a2 = _mm_mul_ps(a, a);
+            __m128 a4 = _mm_mul_ps(a2, a2);
+            __m128 t  = _mm_mul_ps(_mm_set1_ps(-8.0f), _mm_mul_ps(a2, a));
+
+            __m128i h = RE_OS3D_HASH_SEED_X4_sse(ctx->seed, c[dx][0], c[dy][1], c[dz][2]);
+
+            RE_NOISE_CURL3_ACCUM_X4_sse(RE_HASH_TO_GRAD12_X4_sse(h),      a4, t, px, py, pz, L[0]);
+            RE_NOISE_CURL3_ACCUM_X4_sse(RE_NOISE_WARP_GRAD_CH1_X4_sse(h), a4, t, px, py, pz, L[1]);
+            RE_NOISE_CURL3_ACCUM_X4_sse(RE_NOISE_WARP_GRAD_CH2_X4_sse(h), a4, t, px, py, pz, L[2]);
+        }
+    }
+
+    __m128 s[3];
+    for (int k = 0; k < 3; k++)
+        s[k] = _mm_mul_ps(_mm_set1_ps(2.0f / 3.0f), _mm_add_ps(_mm_add_ps(L[k][0], L[k][1]), L[k][2]));
+
+    const __m128 sc = _mm_set1_ps(OS3D_SMOOTH_SCALE_F32);
+    out[0] = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(s[2], L[2][1]), _mm_sub_ps(s[1], L[1][2])), sc);
+    out[1] = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(s[0], L[0][2]), _mm_sub_ps(s[2], L[2][0])), sc);
+    out[2] = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(s[1], L[1][0]), _mm_sub_ps(s[0], L[0][1])), sc);
+}
+
+#endif
+
+/* ============================================================================================
+   AVX2 (8 points in lanes)
+   ============================================================================================ */
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+
+RE_INLINE void RE_NOISE_CURL3_ACCUM_X8_avx2(__m256i gi, __m256 a4, __m256 t,
+                                            __m256 px, __m256 py, __m256 pz, __m256 L[3])
+{
+    __m256 use_x  = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(8), gi));
+    __m256 use_y  = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), gi));
+    __m256 sign_u = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(gi, _mm256_set1_epi32(1)), 31));
+    __m256 sign_v = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(gi, _mm256_set1_epi32(2)), 30));
+
+    __m256 u   = _mm256_blendv_ps(py, px, use_x);
+    __m256 v   = _mm256_blendv_ps(pz, py, use_y);
+    __m256 tdp = _mm256_mul_ps(t, _mm256_add_ps(_mm256_xor_ps(u, sign_u), _mm256_xor_ps(v, sign_v)));
+
+    __m256 su = _mm256_xor_ps(a4, sign_u);
+    __m256 sv = _mm256_xor_ps(a4, sign_v);
+
+    L[0] = _mm256_add_ps(L[0], _mm256_add_ps(_mm256_and_ps(use_x, su), _mm256_mul_ps(tdp, px)));
+    L[1] = _mm256_add_ps(L[1], _mm256_add_ps(_mm256_blendv_ps(su, _mm256_and_ps(use_y, sv), use_x),
+                                             _mm256_mul_ps(tdp, py)));
+    L[2] = _mm256_add_ps(L[2], _mm256_add_ps(_mm256_andnot_ps(use_y, sv), _mm256_mul_ps(tdp, pz)));
+}
+
+RE_INLINE void RE_NOISE_CURL3_X8_CTX_f32_avx2(const RE_NOISE_CONTEXT *ctx,
+                                              __m256 x, __m256 y, __m256 z, __m256 out[3])
+{
+    __m256 r  = _mm256_mul_ps(_mm256_set1_ps(2.0f / 3.0f), _mm256_add_ps(_mm256_add_ps(x, y), z));
+    __m256 xr = _mm256_sub_ps(r, x);
+    __m256 yr = _mm256_sub_ps(r, y);
+    __m256 zr = _mm256_sub_ps(r, z);
+
+    __m256 one = _mm256_set1_ps(1.0f);
+    __m256 rad = _mm256_set1_ps(0.75f);
+    __m256 L[3][3];
+    for (int k = 0; k < 3; k++)
+        L[k][0] = L[k][1] = L[k][2] = _mm256_setzero_ps();
+
+    for (int l = 0; l < 2; l++)
+    {
+        __m256 sh = _mm256_set1_ps(0.5f * l);
+        __m256 ox = _mm256_sub_ps(xr, sh);
+        __m256 oy = _mm256_sub_ps(yr, sh);
+        __m256 oz = _mm256_sub_ps(zr, sh);
+
+        __m256 bx = _mm256_floor_ps(ox);
+        __m256 by = _mm256_floor_ps(oy);
+        __m256 bz = _mm256_floor_ps(oz);
+
+        __m256 f[2][3];
+        f[0][0] = _mm256_sub_ps(ox, bx);  f[1][0] = _mm256_sub_ps(f[0][0], one);
+        f[0][1] = _mm256_sub_ps(oy, by);  f[1][1] = _mm256_sub_ps(f[0][1], one);
+        f[0][2] = _mm256_sub_ps(oz, bz);  f[1][2] = _mm256_sub_ps(f[0][2], one);
+
+        __m256i li = _mm256_set1_epi32(l), two = _mm256_set1_epi32(2);
+        __m256i c[2][3];
+        c[0][0] = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(bx), 1), li);
+        c[0][1] = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(by), 1), li);
+        c[0][2] = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(bz), 1), li);
+        c[1][0] = _mm256_add_epi32(c[0][0], two);
+        c[1][1] = _mm256_add_epi32(c[0][1], two);
+        c[1][2] = _mm256_add_epi32(c[0][2], two);
+
+        for (int k = 0; k < 8; k++)
+        {
+            int dx = k & 1, dy = (k >> 1) & 1, dz = k >> 2;
+            __m256 px = f[dx][0], py = f[dy][1], pz = f[dz][2];
+
+            __m256 d2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(px, px), _mm256_mul_ps(py, py)),
+                                      _mm256_mul_ps(pz, pz));
+            __m256 a  = _mm256_max_ps(_mm256_sub_ps(rad, d2), _mm256_setzero_ps());
+            __m256 a2 = _mm256_mul_ps(a, a);
+            __m256 a4 = _mm256_mul_ps(a2, a2);
+            __m256 t  = _mm256_mul_ps(_mm256_set1_ps(-8.0f), _mm256_mul_ps(a2, a));
+
+            __m256i h = RE_OS3D_HASH_SEED_X8_avx2(ctx->seed, c[dx][0], c[dy][1], c[dz][2]);
+
+            RE_NOISE_CURL3_ACCUM_X8_avx2(RE_HASH_TO_GRAD12_X8_avx2(h),      a4, t, px, py, pz, L[0]);
+            RE_NOISE_CURL3_ACCUM_X8_avx2(RE_NOISE_WARP_GRAD_CH1_X8_avx2(h), a4, t, px, py, pz, L[1]);
+            RE_NOISE_CURL3_ACCUM_X8_avx2(RE_NOISE_WARP_GRAD_CH2_X8_avx2(h), a4, t, px, py, pz, L[2]);
+        }
+    }
+
+    __m256 s[3];
+    for (int k = 0; k < 3; k++)
+        s[k] = _mm256_mul_ps(_mm256_set1_ps(2.0f / 3.0f),
+                             _mm256_add_ps(_mm256_add_ps(L[k][0], L[k][1]), L[k][2]));
+
+    const __m256 sc = _mm256_set1_ps(OS3D_SMOOTH_SCALE_F32);
+    out[0] = _mm256_mul_ps(_mm256_sub_ps(_mm256_sub_ps(s[2], L[2][1]), _mm256_sub_ps(s[1], L[1][2])), sc);
+    out[1] = _mm256_mul_ps(_mm256_sub_ps(_mm256_sub_ps(s[0], L[0][2]), _mm256_sub_ps(s[2], L[2][0])), sc);
+    out[2] = _mm256_mul_ps(_mm256_sub_ps(_mm256_sub_ps(s[1], L[1][0]), _mm256_sub_ps(s[0], L[0][1])), sc);
+}
+
+#endif
+
+/* ============================================================================================
+   PARTICLES (SoA positions)
+   ============================================================================================ */
+
+/* vel[i] += strength * curl(psi)(p[i] * frequency). Lane results are added to the AoS
+   velocities one particle at a time. */
+RE_INLINE void RE_NOISE_CURL3_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                            const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                            RE_f32 frequency, RE_f32 strength, RE_V3_f32 *vel, int count)
+{
+    int i = 0;
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+    {
+        const __m256 vf = _mm256_set1_ps(frequency), vs = _mm256_set1_ps(strength);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 c[3];
+            RE_ALIGN(32) RE_f32 o[3][8];
+
+            RE_NOISE_CURL3_X8_CTX_f32_avx2(ctx, _mm256_mul_ps(_mm256_loadu_ps(x + i), vf),
+                                                _mm256_mul_ps(_mm256_loadu_ps(y + i), vf),
+                                                _mm256_mul_ps(_mm256_loadu_ps(z + i), vf), c);
+            for (int k = 0; k < 3; k++)
+                _mm256_store_ps(o[k], _mm256_mul_ps(c[k], vs));
+
+            for (int l = 0; l < 8; l++)
+            {
+                vel[i + l].x += o[0][l];
+                vel[i + l].y += o[1][l];
+                vel[i + l].z += o[2][l];
+            }
+        }
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    {
+        const __m128 vf = _mm_set1_ps(frequency), vs = _mm_set1_ps(strength);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 c[3];
+            RE_ALIGN(16) RE_f32 o[3][4];
+
+            RE_NOISE_CURL3_X4_CTX_f32_sse(ctx, _mm_mul_ps(_mm_loadu_ps(x + i), vf),
+                                               _mm_mul_ps(_mm_loadu_ps(y + i), vf),
+                                               _mm_mul_ps(_mm_loadu_ps(z + i), vf), c);
+            for (int k = 0; k < 3; k++)
+                _mm_store_ps(o[k], _mm_mul_ps(c[k], vs));
+
+            for (int l = 0; l < 4; l++)
+            {
+                vel[i + l].x += o[0][l];
+                vel[i + l].y += o[1][l];
+                vel[i + l].z += o[2][l];
+            }
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        RE_V3_f32 c = RE_NOISE_CURL3_CTX_f32(ctx, x[i] * frequency, y[i] * frequency, z[i] * frequency);
+        vel[i].x += strength * c.x;
+        vel[i].y += strength * c.y;
+        vel[i].z += strength * c.z;
+    }
+}
+
+RE_INLINE void RE_NOISE_CURL3_BATCH_f32(const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                        RE_f32 frequency, RE_f32 strength, RE_V3_f32 *vel, int count)
+{
+    RE_NOISE_CURL3_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, frequency, strength, vel, count);
+}
+
+#endif /* RE_NOISE_CURL_H */
@@ -0,0 +1,1140 @@
+/**
+ * @file re_noise_fixed.h
+ * @brief Deterministic fixed-point noise (Q16.16) for lockstep simulation.
+ *
+ * Value, Perlin and OpenSimplex2 in 2D / 3D evaluated with integer arithmetic
+ * only: the result depends on the input bits, the context and the hash mode,
+ * never on the compiler, FMA contraction or the instruction set. Lattice
+ * hashing is shared with the float noise (RE_NOISE_CTX_HASH2, the LATTICE
+ * corner helpers, RE_OS3D_HASH_SEED, i.e. RE_PCG_MIX32 / the perm tables), so
+ * each function tracks its float counterpart to within a few 1e-4.
+ *
+ * Formats
+ *   input / output   RE_q16, Q16.16 in an RE_i32 (noise in [-1, 1] -> [-65536, 65536])
+ *   fractions, fade  Q16 in [0, 65536)
+ *   every product    floor(a * t / 2^16) split into two 32-bit multiplies
+ *                    (RE_Q16_MUL_FRAC), so nothing needs a 64-bit lane
+ *
+ * Domain: Value and Perlin take any RE_q16. OpenSimplex2 forms its skew in
+ * Q16.16 and needs |x|, |y| < 16384 (2D) and |x|, |y|, |z| < 8192 (3D).
+ *
+ * The SSE2 (4 lanes, SSE4.1 multiply when available) and AVX2 (8 lanes) batch
+ * kernels perform the same integer operations as the scalar code, so a batch
+ * is bit-identical to per-point calls. Right shifts of negative values are
+ * arithmetic (the signed integer model checked in re_core.h).
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_NOISE_FIXED_H
+#define RE_NOISE_FIXED_H
+
+#include "re_core.h"
+#include "re_noise.h"
+
+typedef RE_i32 RE_q16;
+
+#define RE_Q16_ONE          65536
+#define RE_Q16_FROM_i32(i)  ((RE_q16)((RE_u32)(i) << 16))
+
+/* Setup-time conversions (the float rounding here is the caller's, not the noise's) */
+RE_INLINE RE_q16 RE_Q16_FROM_f32(RE_f32 v)
+{
+    return (RE_q16)RE_FASTFLOOR_f32(v * 65536.0f + 0.5f);
+}
+
+RE_INLINE RE_f32 RE_Q16_TO_f32(RE_q16 v)
+{
+    return (RE_f32)v * (1.0f / 65536.0f);
+}
+
+/* ============================================================================================
+   ARITHMETIC
+   ============================================================================================ */
+
+/* floor(a * t / 2^16) for 0 <= t <= 65536: high half of a times t, plus the low half's
+   product shifted; exact as long as (a >> 16) * t fits */
+RE_INLINE RE_i32 RE_Q16_MUL_FRAC(RE_i32 a, RE_i32 t)
+{
+    return (a >> 16) * t + (RE_i32)((((RE_u32)a & 0xFFFFu) * (RE_u32)t) >> 16);
+}
+
+/* 6t^5 - 15t^4 + 10t^3 on a Q16 fraction */
+RE_INLINE RE_i32 RE_Q16_FADE(RE_i32 t)
+{
+    RE_i32 t2 = (RE_i32)(((RE_u32)t * (RE_u32)t) >> 16);
+    RE_i32 t3 = RE_Q16_MUL_FRAC(t2, t);
+    RE_i32 p  = RE_Q16_MUL_FRAC(t * 6 - 15 * 65536, t) + 10 * 65536;
+    return RE_Q16_MUL_FRAC(p, t3);
+}
+
+RE_INLINE RE_i32 RE_Q16_LERP(RE_i32 a, RE_i32 b, RE_i32 t)
+{
+    return a + RE_Q16_MUL_FRAC(b - a, t);
+}
+
+/* h / 127.5 - 1 = (2h - 255) / 255 ≈ (2h - 255) * 257 / 2^16 */
+RE_INLINE RE_i32 RE_Q16_VALUE_FROM_HASH(RE_i32 h)
+{
+    return (2 * h - 255) * 257;
+}
+
+RE_INLINE RE_i32 RE_Q16_GRAD3_DOT(RE_i32 gi, RE_i32 x, RE_i32 y, RE_i32 z)
+{
+    const RE_i8 *g = RE_NOISE_GRAD3[gi];
+    return g[0] * x + g[1] * y + g[2] * z;
+}
+
+RE_INLINE RE_i32 RE_Q16_GRAD2_DOT(RE_i32 gi, RE_i32 x, RE_i32 y)
+{
+    const RE_i8 *g = RE_NOISE_GRAD2[gi];
+    return g[0] * x + g[1] * y;
+}
+
+/* floor(a / 3) for |a| <= 49151: biased to [1, 98303], where n * 43691 >> 17 is exact and
+   the product still fits 32 unsigned bits */
+RE_INLINE RE_i32 RE_Q16_FLOORDIV3(RE_i32 a)
+{
+    return (RE_i32)(((RE_u32)(a + 49152) * 43691u) >> 17) - 16384;
+}
+
+/* OpenSimplex2 constants (see the float kernels): 2D skew / unskew in Q16, kernel radii */
+#define RE_Q16_OS2_S2         23987          /* (sqrt(3) - 1) / 2 */
+#define RE_Q16_OS2_U2         13849          /* (3 - sqrt(3)) / 6, plus 109 / 2^24 below */
+#define RE_Q16_OS2_R2_Q26     44739243       /* 2/3 in Q26 */
+#define RE_Q16_OS3_R2_Q28     134217728      /* 1/2 in Q28 */
+
+/* ============================================================================================
+   VALUE NOISE — 2D / 3D
+   ============================================================================================ */
+
+RE_INLINE RE_q16 RE_NOISE_VALUE2_CTX_q16(const RE_NOISE_CONTEXT *ctx, RE_q16 x, RE_q16 y)
+{
+    RE_i32 X = x >> 16, Y = y >> 16;
+    RE_i32 u = RE_Q16_FADE(x & 0xFFFF);
+    RE_i32 v = RE_Q16_FADE(y & 0xFFFF);
+
+    RE_i32 a = RE_Q16_VALUE_FROM_HASH(RE_NOISE_CTX_HASH2(ctx, X,     Y));
+    RE_i32 b = RE_Q16_VALUE_FROM_HASH(RE_NOISE_CTX_HASH2(ctx, X + 1, Y));
+    RE_i32 c = RE_Q16_VALUE_FROM_HASH(RE_NOISE_CTX_HASH2(ctx, X,     Y + 1));
+    RE_i32 d = RE_Q16_VALUE_FROM_HASH(RE_NOISE_CTX_HASH2(ctx, X + 1, Y + 1));
+
+    return RE_Q16_LERP(RE_Q16_LERP(a, b, u), RE_Q16_LERP(c, d, u), v);
+}
+
+RE_INLINE RE_q16 RE_NOISE_VALUE2_q16(RE_q16 x, RE_q16 y)
+{
+    return RE_NOISE_VALUE2_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
+RE_INLINE RE_q16 RE_NOISE_VALUE3_CTX_q16(const RE_NOISE_CONTEXT *ctx, RE_q16 x, RE_q16 y, RE_q16 z)
+{
+    RE_i32 u = RE_Q16_FADE(x & 0xFFFF);
+    RE_i32 v = RE_Q16_FADE(y & 0xFFFF);
+    RE_i32 w = RE_Q16_FADE(z & 0xFFFF);
+
+    RE_i32 h[8];
+    RE_NOISE_LATTICE3_CORNERS(ctx, x >> 16, y >> 16, z >> 16, h, 1, RE_FALSE);
+
+    RE_i32 c[8];
+    for (int i = 0; i < 8; i++) c[i] = RE_Q16_VALUE_FROM_HASH(h[i]);
+
+    RE_i32 l0 = RE_Q16_LERP(RE_Q16_LERP(c[0], c[1], u), RE_Q16_LERP(c[2], c[3], u), v);
+    RE_i32 l1 = RE_Q16_LERP(RE_Q16_LERP(c[4], c[5], u), RE_Q16_LERP(c[6], c[7], u), v);
+
+    return RE_Q16_LERP(l0, l1, w);
+}
+
+RE_INLINE RE_q16 RE_NOISE_VALUE3_q16(RE_q16 x, RE_q16 y, RE_q16 z)
+{
+    return RE_NOISE_VALUE3_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* ============================================================================================
+   PERLIN — 2D / 3D
+   ============================================================================================ */
+
+RE_INLINE RE_q16 RE_NOISE_PERLIN2_CTX_q16(const RE_NOISE_CONTEXT *ctx, RE_q16 x, RE_q16 y)
+{
+    RE_i32 x0 = x & 0xFFFF, x1 = x0 - 65536;
+    RE_i32 y0 = y & 0xFFFF, y1 = y0 - 65536;
+
+    RE_i32 g[4];
+    RE_NOISE_LATTICE2_CORNERS(ctx, x >> 16, y >> 16, g, 1);
+
+    RE_i32 u = RE_Q16_FADE(x0);
+    RE_i32 v = RE_Q16_FADE(y0);
+
+    return RE_Q16_LERP(RE_Q16_LERP(RE_Q16_GRAD2_DOT(g[0], x0, y0), RE_Q16_GRAD2_DOT(g[1], x1, y0), u),
+                       RE_Q16_LERP(RE_Q16_GRAD2_DOT(g[2], x0, y1), RE_Q16_GRAD2_DOT(g[3], x1, y1), u), v);
+}
+
+RE_INLINE RE_q16 RE_NOISE_PERLIN2_q16(RE_q16 x, RE_q16 y)
+{
+    return RE_NOISE_PERLIN2_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
+RE_INLINE RE_q16 RE_NOISE_PERLIN3_CTX_q16(const RE_NOISE_CONTEXT *ctx, RE_q16 x, RE_q16 y, RE_q16 z)
+{
+    RE_i32 x0 = x & 0xFFFF, x1 = x0 - 65536;
+    RE_i32 y0 = y & 0xFFFF, y1 = y0 - 65536;
+    RE_i32 z0 = z & 0xFFFF, z1 = z0 - 65536;
+
+    RE_i32 g[8];
+    RE_NOISE_PERLIN3_GRAD_INDICES(ctx, x >> 16, y >> 16, z >> 16, g, 1);
+
+    RE_i32 u = RE_Q16_FADE(x0);
+    RE_i32 v = RE_Q16_FADE(y0);
+    RE_i32 w = RE_Q16_FADE(z0);
+
+    RE_i32 l0 = RE_Q16_LERP(RE_Q16_LERP(RE_Q16_GRAD3_DOT(g[0], x0, y0, z0), RE_Q16_GRAD3_DOT(g[1], x1, y0, z0), u),
+                            RE_Q16_LERP(RE_Q16_GRAD3_DOT(g[2], x0, y1, z0), RE_Q16_GRAD3_DOT(g[3], x1, y1, z0), u), v);
+    RE_i32 l1 = RE_Q16_LERP(RE_Q16_LERP(RE_Q16_GRAD3_DOT(g[4], x0, y0, z1), RE_Q16_GRAD3_DOT(g[5], x1, y0, z1), u),
+                            RE_Q16_LERP(RE_Q16_GRAD3_DOT(g[6], x0, y1, z1), RE_Q16_GRAD3_DOT(g[7], x1, y1, z1), u), v);
+
+    return RE_Q16_LERP(l0, l1, w);
+}
+
+RE_INLINE RE_q16 RE_NOISE_PERLIN3_q16(RE_q16 x, RE_q16 y, RE_q16 z)
+{
+    return RE_NOISE_PERLIN3_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* ============================================================================================
+   OPEN SIMPLEX 2S (SMOOTH) — 2D
+   --------------------------------------------------------------------------------------------
+   Vertex (i, j) sits at (i, j) - RE_Q16_OS2_UNSKEW(i + j), an exact function of the vertex,
+   so neighbouring cells see identical vertex positions. The Q16 skew only approximates its
+   inverse (off by up to ~0.1 cells at the domain edge), so the base cell is corrected once
+   against the skewed coordinates (37838 u = 51687 x0 + 13849 y0, tested in Q13).
+   Kernel terms: a' = 1.5 (2/3 - d^2) in Q15, a'^4 (g . d) >> 2 summed in Q29, scaled by
+   13.5 / 1.5^4 at the end.
+   ============================================================================================ */
+
+static const RE_i32 RE_Q16_OS2_OFF[8][2] = {
+    { 0, 0}, { 1, 0}, { 0, 1}, { 1, 1},
+    {-1, 0}, { 0,-1}, { 2, 1}, { 1, 2}
+};
+
+/* n * U2 in Q16 with U2 carried to Q24 (lattice drift ~1e-7 per cell instead of ~6e-6) */
+RE_INLINE RE_i32 RE_Q16_OS2_UNSKEW(RE_i32 n)
+{
+    return n * RE_Q16_OS2_U2 + ((n * 109) >> 8);
+}
+
+/* Base cell (i, j) of the point */
+RE_INLINE void RE_Q16_OS2_BASE(RE_q16 x, RE_q16 y, RE_i32 *i, RE_i32 *j)
+{
+    RE_i32 s  = RE_Q16_MUL_FRAC(x + y, RE_Q16_OS2_S2);
+    RE_i32 bi = (x + s) >> 16;
+    RE_i32 bj = (y + s) >> 16;
+
+    RE_i32 t  = RE_Q16_OS2_UNSKEW(bi + bj);
+    RE_i32 dx = x - (RE_i32)((RE_u32)bi << 16) + t;
+    RE_i32 dy = y - (RE_i32)((RE_u32)bj << 16) + t;
+
+    RE_i32 su = 51687 * (dx >> 3) + 13849 * (dy >> 3);
+    RE_i32 sv = 13849 * (dx >> 3) + 51687 * (dy >> 3);
+    RE_i32 di = (su < 0) ? -1 : (su >= 37838 * 8192) ? 1 : 0;
+    RE_i32 dj = (sv < 0) ? -1 : (sv >= 37838 * 8192) ? 1 : 0;
+
+    *i = bi + di;
+    *j = bj + dj;
+}
+
+/* a'^4 (g . d) >> 2 for an offset (dx, dy) and gradient index gi; 0 outside the kernel */
+RE_INLINE RE_i32 RE_Q16_OS2_TERM(RE_i32 gi, RE_i32 dx, RE_i32 dy)
+{
+    RE_i32 qx = dx >> 3, qy = dy >> 3;
+    RE_i32 attn = RE_Q16_OS2_R2_Q26 - (qx * qx + qy * qy);
+    if (attn <= 0) return 0;
+
+    RE_i32 a  = (attn * 3) >> 12;
+    RE_i32 a2 = (a * a) >> 15;
+    RE_i32 a4 = (a2 * a2) >> 15;
+    return (a4 * RE_Q16_GRAD2_DOT(gi, dx, dy)) >> 2;
+}
+
+RE_INLINE RE_q16 RE_NOISE_OS2D_SMOOTH_CTX_q16(const RE_NOISE_CONTEXT *ctx, RE_q16 x, RE_q16 y)
+{
+    RE_i32 i, j;
+    RE_Q16_OS2_BASE(x, y, &i, &j);
+
+    RE_i32 x0 = x - (RE_i32)((RE_u32)i << 16);
+    RE_i32 y0 = y - (RE_i32)((RE_u32)j << 16);
+
+    RE_i32 value = 0;
+    for (int c = 0; c < 8; c++)
+    {
+        RE_i32 ox = RE_Q16_OS2_OFF[c][0], oy = RE_Q16_OS2_OFF[c][1];
+        RE_i32 t  = RE_Q16_OS2_UNSKEW(i + j + ox + oy);
+        RE_i32 gi = RE_NOISE_CTX_HASH2(ctx, i + ox, j + oy) & 7;
+
+        value += RE_Q16_OS2_TERM(gi, x0 - ox * 65536 + t, y0 - oy * 65536 + t);
+    }
+
+    /* 13.5 / 1.5^4 = 8/3 ≈ 10923 / 4096 */
+    return ((value >> 13) * 10923) >> 12;
+}
+
+RE_INLINE RE_q16 RE_NOISE_OS2D_SMOOTH_q16(RE_q16 x, RE_q16 y)
+{
+    return RE_NOISE_OS2D_SMOOTH_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y);
+}
+
+/* ============================================================================================
+   OPEN SIMPLEX 2F (FAST) — 3D
+   --------------------------------------------------------------------------------------------
+   Same two-lattice construction as RE_NOISE_OS3D_FAST_CTX_f32. The rotation r = 2/3 (x+y+z) is
+   rational: 3 xr = -x + 2y + 2z is formed exactly from integer and fraction parts, the nearest
+   lattice point is an exact floor division by 3 and only the small remainder is divided.
+   Kernel terms: a' = 2 (1/2 - d^2) in Q15, a'^4 (g . p) >> 2 in Q29, scaled by 75 / 16.
+   ============================================================================================ */
+
+/* 3 xr of the rotation, split into an integer part and a Q16 fraction */
+RE_INLINE void RE_Q16_OS3_ROTATE(RE_i32 X, RE_i32 Y, RE_i32 Z, RE_i32 fx, RE_i32 fy, RE_i32 fz,
+                                 RE_i32 *ti, RE_i32 *tf)
+{
+    RE_i32 f = 2 * (fy + fz) - fx;
+    *ti = 2 * (Y + Z) - X + (f >> 16);
+    *tf = f & 0xFFFF;
+}
+
+/* Nearest point of lattice l along one axis and the offset from it (Q16) */
+RE_INLINE RE_i32 RE_Q16_OS3_NEAREST(RE_i32 ti, RE_i32 tf, int l, RE_i32 *p)
+{
+    RE_i32 n = RE_Q16_FLOORDIV3(ti + ((tf + (1 - l) * 98304) >> 16));
+    *p = RE_Q16_MUL_FRAC((ti - 3 * n) * 65536 + tf - l * 98304, 21845);
+    return n;
+}
+
+RE_INLINE RE_i32 RE_Q16_OS3_TERM(RE_u32 seed, RE_i32 x2, RE_i32 y2, RE_i32 z2,
+                                 RE_i32 px, RE_i32 py, RE_i32 pz)
+{
+    RE_i32 qx = px >> 2, qy = py >> 2, qz = pz >> 2;
+    RE_i32 attn = RE_Q16_OS3_R2_Q28 - (qx * qx + qy * qy + qz * qz);
+    if (attn <= 0) return 0;
+
+    RE_i32 a  = attn >> 12;
+    RE_i32 a2 = (a * a) >> 15;
+    RE_i32 a4 = (a2 * a2) >> 15;
+    RE_i32 gi = (RE_i32)RE_OS3D_GRAD_INDEX(seed, x2, y2, z2);
+    return (a4 * RE_Q16_GRAD3_DOT(gi, px, py, pz)) >> 2;
+}
+
+RE_INLINE RE_q16 RE_NOISE_OS3D_FAST_CTX_q16(const RE_NOISE_CONTEXT *ctx, RE_q16 x, RE_q16 y, RE_q16 z)
+{
+    RE_i32 X = x >> 16, Y = y >> 16, Z = z >> 16;
+    RE_i32 fx = x & 0xFFFF, fy = y & 0xFFFF, fz = z & 0xFFFF;
+
+    RE_i32 tix, tfx, tiy, tfy, tiz, tfz;
+    RE_Q16_OS3_ROTATE(X, Y, Z, fx, fy, fz, &tix, &tfx);
+    RE_Q16_OS3_ROTATE(Y, Z, X, fy, fz, fx, &tiy, &tfy);
+    RE_Q16_OS3_ROTATE(Z, X, Y, fz, fx, fy, &tiz, &tfz);
+
+    RE_i32 value = 0;
+
+    for (int l = 0; l < 2; l++)
+    {
+        RE_i32 px, py, pz;
+        RE_i32 xn = RE_Q16_OS3_NEAREST(tix, tfx, l, &px);
+        RE_i32 yn = RE_Q16_OS3_NEAREST(tiy, tfy, l, &py);
+        RE_i32 zn = RE_Q16_OS3_NEAREST(tiz, tfz, l, &pz);
+
+        value += RE_Q16_OS3_TERM(ctx->seed, 2 * xn + l, 2 * yn + l, 2 * zn + l, px, py, pz);
+
+        /* Neighbour along the dominant axis */
+        RE_i32 ax = px < 0 ? -px : px;
+        RE_i32 ay = py < 0 ? -py : py;
+        RE_i32 az = pz < 0 ? -pz : pz;
+        RE_i32 sx = 0, sy = 0, sz = 0;
+
+        if (ax >= ay && ax >= az) sx = px < 0 ? -1 : 1;
+        else if (ay >= az)        sy = py < 0 ? -1 : 1;
+        else                      sz = pz < 0 ? -1 : 1;
+
+        value += RE_Q16_OS3_TERM(ctx->seed, 2 * (xn + sx) + l, 2 * (yn + sy) + l, 2 * (zn + sz) + l,
+                                 px - sx * 65536, py - sy * 65536, pz - sz * 65536);
+    }
+
+    /* 75 / 16 = 19200 / 4096 */
+    return ((value >> 13) * 19200) >> 12;
+}
+
+RE_INLINE RE_q16 RE_NOISE_OS3D_FAST_q16(RE_q16 x, RE_q16 y, RE_q16 z)
+{
+    return RE_NOISE_OS3D_FAST_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y, z);
+}
+
+/* ============================================================================================
+   SIMD — SSE2, 4 points per call
+   Integer lanes throughout; out-of-range simplex terms are masked to 0 instead of skipped.
+   ============================================================================================ */
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+RE_INLINE __m128i RE_Q16_MUL_FRAC_X4_sse(__m128i a, __m128i t)
+{
+    __m128i hi = RE_MULLO_X4_u32_sse(_mm_srai_epi32(a, 16), t);
+    __m128i lo = RE_MULLO_X4_u32_sse(_mm_and_si128(a, _mm_set1_epi32(0xFFFF)), t);
+    return _mm_add_epi32(hi, _mm_srli_epi32(lo, 16));
+}
+
+RE_INLINE __m128i RE_Q16_FADE_X4_sse(__m128i t)
+{
+    __m128i t2 = _mm_srli_epi32(RE_MULLO_X4_u32_sse(t, t), 16);
+    __m128i t3 = RE_Q16_MUL_FRAC_X4_sse(t2, t);
+    __m128i p  = _mm_sub_epi32(_mm_add_epi32(_mm_slli_epi32(t, 2), _mm_slli_epi32(t, 1)),
+                               _mm_set1_epi32(15 * 65536));
+    p = _mm_add_epi32(RE_Q16_MUL_FRAC_X4_sse(p, t), _mm_set1_epi32(10 * 65536));
+    return RE_Q16_MUL_FRAC_X4_sse(p, t3);
+}
+
+RE_INLINE __m128i RE_Q16_LERP_X4_sse(__m128i a, __m128i b, __m128i t)
+{
+    return _mm_add_epi32(a, RE_Q16_MUL_FRAC_X4_sse(_mm_sub_epi32(b, a), t));
+}
+
+RE_INLINE __m128i RE_Q16_SELECT_X4_sse(__m128i m, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+}
+
+/* (v ^ m) - m: v where m = 0, -v where m = -1 */
+RE_INLINE __m128i RE_Q16_NEGATE_IF_X4_sse(__m128i v, __m128i m)
+{
+    return _mm_sub_epi32(_mm_xor_si128(v, m), m);
+}
+
+/* Table-free RE_Q16_GRAD3_DOT (see RE_NOISE_GRAD3_DOT_X4_sse) */
+RE_INLINE __m128i RE_Q16_GRAD3_DOT_X4_sse(__m128i gi, __m128i x, __m128i y, __m128i z)
+{
+    __m128i u  = RE_Q16_SELECT_X4_sse(_mm_cmplt_epi32(gi, _mm_set1_epi32(8)), x, y);
+    __m128i v  = RE_Q16_SELECT_X4_sse(_mm_cmplt_epi32(gi, _mm_set1_epi32(4)), y, z);
+    __m128i su = _mm_srai_epi32(_mm_slli_epi32(gi, 31), 31);
+    __m128i sv = _mm_srai_epi32(_mm_slli_epi32(gi, 30), 31);
+    return _mm_add_epi32(RE_Q16_NEGATE_IF_X4_sse(u, su), RE_Q16_NEGATE_IF_X4_sse(v, sv));
+}
+
+/* Table-free RE_Q16_GRAD2_DOT (see RE_NOISE_GRAD2_MASKS_X4_sse) */
+RE_INLINE __m128i RE_Q16_GRAD2_DOT_X4_sse(__m128i gi, __m128i x, __m128i y)
+{
+    __m128i u  = RE_Q16_SELECT_X4_sse(_mm_cmplt_epi32(gi, _mm_set1_epi32(6)), x, y);
+    __m128i v  = _mm_and_si128(_mm_cmplt_epi32(gi, _mm_set1_epi32(4)), y);
+    __m128i su = _mm_srai_epi32(_mm_slli_epi32(gi, 31), 31);
+    __m128i sv = _mm_srai_epi32(_mm_slli_epi32(gi, 30), 31);
+    return _mm_add_epi32(RE_Q16_NEGATE_IF_X4_sse(u, su), RE_Q16_NEGATE_IF_X4_sse(v, sv));
+}
+
+/* Lane-wise RE_NOISE_CTX_HASH2 */
+RE_INLINE __m128i RE_Q16_HASH2_X4_sse(const RE_NOISE_CONTEXT *ctx, __m128i X, __m128i Y)
+{
+#if RE_NOISE_HASH_MODE == 3
+    return _mm_and_si128(RE_HASH3D_PCG_SEED_X4_sse(ctx->seed, X, Y, _mm_setzero_si128()),
+                         _mm_set1_epi32(255));
+#else
+    RE_i32 xs[4], ys[4], h[4];
+    _mm_storeu_si128((__m128i *)xs, X);
+    _mm_storeu_si128((__m128i *)ys, Y);
+    for (int l = 0; l < 4; l++) h[l] = RE_NOISE_CTX_HASH2(ctx, xs[l], ys[l]);
+    return _mm_loadu_si128((const __m128i *)h);
+#endif
+}
+
+RE_INLINE __m128i RE_Q16_VALUE_FROM_HASH_X4_sse(__m128i h)
+{
+    return RE_MULLO_X4_u32_sse(_mm_sub_epi32(_mm_slli_epi32(h, 1), _mm_set1_epi32(255)), _mm_set1_epi32(257));
+}
+
+RE_INLINE __m128i RE_NOISE_VALUE2_X4_CTX_q16_sse(const RE_NOISE_CONTEXT *ctx, __m128i x, __m128i y)
+{
+    __m128i m16 = _mm_set1_epi32(0xFFFF), one = _mm_set1_epi32(1);
+    __m128i X = _mm_srai_epi32(x, 16), X1 = _mm_add_epi32(X, one);
+    __m128i Y = _mm_srai_epi32(y, 16), Y1 = _mm_add_epi32(Y, one);
+
+    __m128i u = RE_Q16_FADE_X4_sse(_mm_and_si128(x, m16));
+    __m128i v = RE_Q16_FADE_X4_sse(_mm_and_si128(y, m16));
+
+    __m128i a = RE_Q16_VALUE_FROM_HASH_X4_sse(RE_Q16_HASH2_X4_sse(ctx, X,  Y));
+    __m128i b = RE_Q16_VALUE_FROM_HASH_X4_sse(RE_Q16_HASH2_X4_sse(ctx, X1, Y));
+    __m128i c = RE_Q16_VALUE_FROM_HASH_X4_sse(RE_Q16_HASH2_X4_sse(ctx, X,  Y1));
+    __m128i d = RE_Q16_VALUE_FROM_HASH_X4_sse(RE_Q16_HASH2_X4_sse(ctx, X1, Y1));
+
+    return RE_Q16_LERP_X4_sse(RE_Q16_LERP_X4_sse(a, b, u), RE_Q16_LERP_X4_sse(c, d, u), v);
+}
+
+RE_INLINE __m128i RE_NOISE_VALUE3_X4_CTX_q16_sse(const RE_NOISE_CONTEXT *ctx,
+                                                 __m128i x, __m128i y, __m128i z)
+{
+    __m128i m16 = _mm_set1_epi32(0xFFFF);
+    __m128i u = RE_Q16_FADE_X4_sse(_mm_and_si128(x, m16));
+    __m128i v = RE_Q16_FADE_X4_sse(_mm_and_si128(y, m16));
+    __m128i w = RE_Q16_FADE_X4_sse(_mm_and_si128(z, m16));
+
+    RE_i32 h[8 * 4];
+    RE_NOISE_LATTICE3_CORNERS_X4_sse(ctx, _mm_srai_epi32(x, 16), _mm_srai_epi32(y, 16),
+                                     _mm_srai_epi32(z, 16), h, 4, RE_FALSE);
+
+    #define C(c) RE_Q16_VALUE_FROM_HASH_X4_sse(_mm_loadu_si128((const __m128i *)(h + (c) * 4)))
+
+    __m128i l0 = RE_Q16_LERP_X4_sse(RE_Q16_LERP_X4_sse(C(0), C(1), u), RE_Q16_LERP_X4_sse(C(2), C(3), u), v);
+    __m128i l1 = RE_Q16_LERP_X4_sse(RE_Q16_LERP_X4_sse(C(4), C(5), u), RE_Q16_LERP_X4_sse(C(6), C(7), u), v);
+
+    #undef C
+
+    return RE_Q16_LERP_X4_sse(l0, l1, w);
+}
+
+RE_INLINE __m128i RE_NOISE_PERLIN2_X4_CTX_q16_sse(const RE_NOISE_CONTEXT *ctx, __m128i x, __m128i y)
+{
+    __m128i m16 = _mm_set1_epi32(0xFFFF), one = _mm_set1_epi32(65536);
+    __m128i x0 = _mm_and_si128(x, m16), x1 = _mm_sub_epi32(x0, one);
+    __m128i y0 = _mm_and_si128(y, m16), y1 = _mm_sub_epi32(y0, one);
+
+    RE_i32 gi[4 * 4];
+    RE_NOISE_LATTICE2_CORNERS_X4_sse(ctx, _mm_srai_epi32(x, 16), _mm_srai_epi32(y, 16), gi, 4);
+
+    #define G(c) _mm_loadu_si128((const __m128i *)(gi + (c) * 4))
+
+    __m128i u = RE_Q16_FADE_X4_sse(x0);
+    __m128i v = RE_Q16_FADE_X4_sse(y0);
+
+    __m128i r = RE_Q16_LERP_X4_sse(RE_Q16_LERP_X4_sse(RE_Q16_GRAD2_DOT_X4_sse(G(0), x0, y0),
+                                                      RE_Q16_GRAD2_DOT_X4_sse(G(1), x1, y0), u),
+                                   RE_Q16_LERP_X4_sse(RE_Q16_GRAD2_DOT_X4_sse(G(2), x0, y1),
+                                                      RE_Q16_GRAD2_DOT_X4_sse(G(3), x1, y1), u), v);
+    #undef G
+
+    return r;
+}
+
+RE_INLINE __m128i RE_NOISE_PERLIN3_X4_CTX_q16_sse(const RE_NOISE_CONTEXT *ctx,
+                                                  __m128i x, __m128i y, __m128i z)
+{
+    __m128i m16 = _mm_set1_epi32(0xFFFF), one = _mm_set1_epi32(65536);
+    __m128i x0 = _mm_and_si128(x, m16), x1 = _mm_sub_epi32(x0, one);
+    __m128i y0 = _mm_and_si128(y, m16), y1 = _mm_sub_epi32(y0, one);
+    __m128i z0 = _mm_and_si128(z, m16), z1 = _mm_sub_epi32(z0, one);
+
+    RE_i32 gi[8 * 4];
+    RE_NOISE_LATTICE3_CORNERS_X4_sse(ctx, _mm_srai_epi32(x, 16), _mm_srai_epi32(y, 16),
+                                     _mm_srai_epi32(z, 16), gi, 4, RE_TRUE);
+
+    __m128i u = RE_Q16_FADE_X4_sse(x0);
+    __m128i v = RE_Q16_FADE_X4_sse(y0);
+    __m128i w = RE_Q16_FADE_X4_sse(z0);
+
+    #define D(c, px, py, pz) RE_Q16_GRAD3_DOT_X4_sse(_mm_loadu_si128((const __m128i *)(gi + (c) * 4)), px, py, pz)
+
+    __m128i l0 = RE_Q16_LERP_X4_sse(RE_Q16_LERP_X4_sse(D(0, x0, y0, z0), D(1, x1, y0, z0), u),
+                                    RE_Q16_LERP_X4_sse(D(2, x0, y1, z0), D(3, x1, y1, z0), u), v);
+    __m128i l1 = RE_Q16_LERP_X4_sse(RE_Q16_LERP_X4_sse(D(4, x0, y0, z1), D(5, x1, y0, z1), u),
+                                    RE_Q16_LERP_X4_sse(D(6, x0, y1, z1), D(7, x1, y1, z1), u), v);
+    #undef D
+
+    return RE_Q16_LERP_X4_sse(l0, l1, w);
+}
+
+/* a'^4 (g . d) >> 2 with a' = max(attn, 0) (see RE_Q16_OS2_TERM / RE_Q16_OS3_TERM) */
+RE_INLINE __m128i RE_Q16_SIMPLEX_TERM_X4_sse(__m128i attn, __m128i dot)
+{
+    __m128i a2 = _mm_srai_epi32(RE_MULLO_X4_u32_sse(attn, attn), 15);
+    __m128i a4 = _mm_srai_epi32(RE_MULLO_X4_u32_sse(a2, a2), 15);
+    return _mm_srai_epi32(RE_MULLO_X4_u32_sse(a4, dot), 2);
+}
+
+RE_INLINE __m128i RE_Q16_OS2_UNSKEW_X4_sse(__m128i n)
+{
+    return _mm_add_epi32(RE_MULLO_X4_u32_sse(n, _mm_set1_epi32(RE_Q16_OS2_U2)),
+                         _mm_srai_epi32(RE_MULLO_X4_u32_sse(n, _mm_set1_epi32(109)), 8));
+}
+
+RE_INLINE __m128i RE_NOISE_OS2D_SMOOTH_X4_CTX_q16_sse(const RE_NOISE_CONTEXT *ctx, __m128i x, __m128i y)
+{
+    __m128i zero = _mm_setzero_si128();
+
+    /* Base cell, then the exact-lattice correction of RE_Q16_OS2_BASE */
+    __m128i s  = RE_Q16_MUL_FRAC_X4_sse(_mm_add_epi32(x, y), _mm_set1_epi32(RE_Q16_OS2_S2));
+    __m128i bi = _mm_srai_epi32(_mm_add_epi32(x, s), 16);
+    __m128i bj = _mm_srai_epi32(_mm_add_epi32(y, s), 16);
+
+    __m128i t  = RE_Q16_OS2_UNSKEW_X4_sse(_mm_add_epi32(bi, bj));
+    __m128i dx = _mm_add_epi32(_mm_sub_epi32(x, _mm_slli_epi32(bi, 16)), t);
+    __m128i dy = _mm_add_epi32(_mm_sub_epi32(y, _mm_slli_epi32(bj, 16)), t);
+
+    __m128i qx = _mm_srai_epi32(dx, 3), qy = _mm_srai_epi32(dy, 3);
+    __m128i k0 = _mm_set1_epi32(51687), k1 = _mm_set1_epi32(13849), lim = _mm_set1_epi32(37838 * 8192 - 1);
+    __m128i su = _mm_add_epi32(RE_MULLO_X4_u32_sse(k0, qx), RE_MULLO_X4_u32_sse(k1, qy));
+    __m128i sv = _mm_add_epi32(RE_MULLO_X4_u32_sse(k1, qx), RE_MULLO_X4_u32_sse(k0, qy));
+
+    /* -1 below, +1 at or above the cell: compare masks are -1 where true */
+    __m128i di = _mm_sub_epi32(_mm_cmpgt_epi32(su, lim), _mm_cmplt_epi32(su, zero));
+    __m128i dj = _mm_sub_epi32(_mm_cmpgt_epi32(sv, lim), _mm_cmplt_epi32(sv, zero));
+    di = _mm_sub_epi32(zero, di);
+    dj = _mm_sub_epi32(zero, dj);
+
+    __m128i i  = _mm_add_epi32(bi, di);
+    __m128i j  = _mm_add_epi32(bj, dj);
+    __m128i x0 = _mm_sub_epi32(x, _mm_slli_epi32(i, 16));
+    __m128i y0 = _mm_sub_epi32(y, _mm_slli_epi32(j, 16));
+
+    /* Unskew of i + j + k for the vertex sums k = -1 .. 3 */
+    __m128i n = _mm_add_epi32(i, j), tk[5];
+    for (int k = 0; k < 5; k++) tk[k] = RE_Q16_OS2_UNSKEW_X4_sse(_mm_add_epi32(n, _mm_set1_epi32(k - 1)));
+
+    __m128i value = zero;
+
+    for (int c = 0; c < 8; c++)
+    {
+        RE_i32 ox = RE_Q16_OS2_OFF[c][0], oy = RE_Q16_OS2_OFF[c][1];
+        __m128i tc = tk[ox + oy + 1];
+
+        __m128i px = _mm_add_epi32(_mm_sub_epi32(x0, _mm_set1_epi32(ox * 65536)), tc);
+        __m128i py = _mm_add_epi32(_mm_sub_epi32(y0, _mm_set1_epi32(oy * 65536)), tc);
+
+        __m128i ax = _mm_srai_epi32(px, 3), ay = _mm_srai_epi32(py, 3);
+        __m128i attn = _mm_sub_epi32(_mm_set1_epi32(RE_Q16_OS2_R2_Q26),
+                                     _mm_add_epi32(RE_MULLO_X4_u32_sse(ax, ax), RE_MULLO_X4_u32_sse(ay, ay)));
+        attn = _mm_and_si128(attn, _mm_cmpgt_epi32(attn, zero));
+        attn = _mm_srai_epi32(RE_MULLO_X4_u32_sse(attn, _mm_set1_epi32(3)), 12);
+
+        __m128i gi = _mm_and_si128(RE_Q16_HASH2_X4_sse(ctx, _mm_add_epi32(i, _mm_set1_epi32(ox)),
+                                                       _mm_add_epi32(j, _mm_set1_epi32(oy))),
+                                   _mm_set1_epi32(7));
+
+        value = _mm_add_epi32(value, RE_Q16_SIMPLEX_TERM_X4_sse(attn, RE_Q16_GRAD2_DOT_X4_sse(gi, px, py)));
+    }
+
+    return _mm_srai_epi32(RE_MULLO_X4_u32_sse(_mm_srai_epi32(value, 13), _mm_set1_epi32(10923)), 12);
+}
+
+/* RE_Q16_OS3_ROTATE / RE_Q16_OS3_NEAREST in lanes */
+RE_INLINE void RE_Q16_OS3_ROTATE_X4_sse(__m128i X, __m128i Y, __m128i Z, __m128i fx, __m128i fy, __m128i fz,
+                                        __m128i *ti, __m128i *tf)
+{
+    __m128i f = _mm_sub_epi32(_mm_slli_epi32(_mm_add_epi32(fy, fz), 1), fx);
+    *ti = _mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(_mm_add_epi32(Y, Z), 1), X), _mm_srai_epi32(f, 16));
+    *tf = _mm_and_si128(f, _mm_set1_epi32(0xFFFF));
+}
+
+RE_INLINE __m128i RE_Q16_OS3_NEAREST_X4_sse(__m128i ti, __m128i tf, int l, __m128i *p)
+{
+    __m128i a = _mm_add_epi32(ti, _mm_srai_epi32(_mm_add_epi32(tf, _mm_set1_epi32((1 - l) * 98304)), 16));
+    __m128i n = RE_MULLO_X4_u32_sse(_mm_add_epi32(a, _mm_set1_epi32(49152)), _mm_set1_epi32(43691));
+    n = _mm_sub_epi32(_mm_srli_epi32(n, 17), _mm_set1_epi32(16384));
+
+    __m128i r = _mm_sub_epi32(ti, _mm_add_epi32(_mm_slli_epi32(n, 1), n));
+    r = _mm_add_epi32(_mm_slli_epi32(r, 16), _mm_sub_epi32(tf, _mm_set1_epi32(l * 98304)));
+    *p = RE_Q16_MUL_FRAC_X4_sse(r, _mm_set1_epi32(21845));
+    return n;
+}
+
+RE_INLINE __m128i RE_Q16_OS3_TERM_X4_sse(RE_u32 seed, __m128i x2, __m128i y2, __m128i z2,
+                                         __m128i px, __m128i py, __m128i pz)
+{
+    __m128i qx = _mm_srai_epi32(px, 2), qy = _mm_srai_epi32(py, 2), qz = _mm_srai_epi32(pz, 2);
+    __m128i d2 = _mm_add_epi32(_mm_add_epi32(RE_MULLO_X4_u32_sse(qx, qx), RE_MULLO_X4_u32_sse(qy, qy)),
+                               RE_MULLO_X4_u32_sse(qz, qz));
+    __m128i attn = _mm_sub_epi32(_mm_set1_epi32(RE_Q16_OS3_R2_Q28), d2);
+    attn = _mm_srai_epi32(_mm_and_si128(attn, _mm_cmpgt_epi32(attn, _mm_setzero_si128())), 12);
+
+    __m128i gi = RE_HASH_TO_GRAD12_X4_sse(RE_OS3D_HASH_SEED_X4_sse(seed, x2, y2, z2));
+    return RE_Q16_SIMPLEX_TERM_X4_sse(attn, RE_Q16_GRAD3_DOT_X4_sse(gi, px, py, pz));
+}
+
+RE_INLINE __m128i RE_NOISE_OS3D_FAST_X4_CTX_q16_sse(const RE_NOISE_CONTEXT *ctx,
+                                                    __m128i x, __m128i y, __m128i z)
+{
+    __m128i m16 = _mm_set1_epi32(0xFFFF);
+    __m128i X = _mm_srai_epi32(x, 16), fx = _mm_and_si128(x, m16);
+    __m128i Y = _mm_srai_epi32(y, 16), fy = _mm_and_si128(y, m16);
+    __m128i Z = _mm_srai_epi32(z, 16), fz = _mm_and_si128(z, m16);
+
+    __m128i tix, tfx, tiy, tfy, tiz, tfz;
+    RE_Q16_OS3_ROTATE_X4_sse(X, Y, Z, fx, fy, fz, &tix, &tfx);
+    RE_Q16_OS3_ROTATE_X4_sse(Y, Z, X, fy, fz, fx, &tiy, &tfy);
+    RE_Q16_OS3_ROTATE_X4_sse(Z, X, Y, fz, fx, fy, &tiz, &tfz);
+
+    __m128i one = _mm_set1_epi32(1), value = _mm_setzero_si128();
+
+    for (int l = 0; l < 2; l++)
+    {
+        __m128i px, py, pz, L = _mm_set1_epi32(l);
+        __m128i xn = RE_Q16_OS3_NEAREST_X4_sse(tix, tfx, l, &px);
+        __m128i yn = RE_Q16_OS3_NEAREST_X4_sse(tiy, tfy, l, &py);
+        __m128i zn = RE_Q16_OS3_NEAREST_X4_sse(tiz, tfz, l, &pz);
+
+        value = _mm_add_epi32(value, RE_Q16_OS3_TERM_X4_sse(ctx->seed,
+                                         _mm_add_epi32(_mm_slli_epi32(xn, 1), L),
+                                         _mm_add_epi32(_mm_slli_epi32(yn, 1), L),
+                                         _mm_add_epi32(_mm_slli_epi32(zn, 1), L), px, py, pz));
+
+        /* Dominant axis: x if |px| >= |py|, |pz|, else y if |py| >= |pz|, else z */
+        __m128i mx = _mm_srai_epi32(px, 31), my = _mm_srai_epi32(py, 31), mz = _mm_srai_epi32(pz, 31);
+        __m128i ax = RE_Q16_NEGATE_IF_X4_sse(px, mx);
+        __m128i ay = RE_Q16_NEGATE_IF_X4_sse(py, my);
+        __m128i az = RE_Q16_NEGATE_IF_X4_sse(pz, mz);
+
+        __m128i selx = _mm_andnot_si128(_mm_or_si128(_mm_cmpgt_epi32(ay, ax), _mm_cmpgt_epi32(az, ax)),
+                                        _mm_set1_epi32(-1));
+        __m128i sely = _mm_andnot_si128(_mm_or_si128(selx, _mm_cmpgt_epi32(az, ay)), _mm_set1_epi32(-1));
+        __m128i selz = _mm_andnot_si128(_mm_or_si128(selx, sely), _mm_set1_epi32(-1));
+
+        __m128i sx = _mm_and_si128(selx, _mm_or_si128(mx, one));
+        __m128i sy = _mm_and_si128(sely, _mm_or_si128(my, one));
+        __m128i sz = _mm_and_si128(selz, _mm_or_si128(mz, one));
+
+        value = _mm_add_epi32(value, RE_Q16_OS3_TERM_X4_sse(ctx->seed,
+                                         _mm_add_epi32(_mm_slli_epi32(_mm_add_epi32(xn, sx), 1), L),
+                                         _mm_add_epi32(_mm_slli_epi32(_mm_add_epi32(yn, sy), 1), L),
+                                         _mm_add_epi32(_mm_slli_epi32(_mm_add_epi32(zn, sz), 1), L),
+                                         _mm_sub_epi32(px, _mm_slli_epi32(sx, 16)),
+                                         _mm_sub_epi32(py, _mm_slli_epi32(sy, 16)),
+                                         _mm_sub_epi32(pz, _mm_slli_epi32(sz, 16))));
+    }
+
+    return _mm_srai_epi32(RE_MULLO_X4_u32_sse(_mm_srai_epi32(value, 13), _mm_set1_epi32(19200)), 12);
+}
+
+#endif /* SSE */
+
+/* ============================================================================================
+   SIMD — AVX2, 8 points per call (same operations as the SSE2 kernels)
+   ============================================================================================ */
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+
+RE_INLINE __m256i RE_Q16_MUL_FRAC_X8_avx2(__m256i a, __m256i t)
+{
+    __m256i hi = _mm256_mullo_epi32(_mm256_srai_epi32(a, 16), t);
+    __m256i lo = _mm256_mullo_epi32(_mm256_and_si256(a, _mm256_set1_epi32(0xFFFF)), t);
+    return _mm256_add_epi32(hi, _mm256_srli_epi32(lo, 16));
+}
+
+RE_INLINE __m256i RE_Q16_FADE_X8_avx2(__m256i t)
+{
+    __m256i t2 = _mm256_srli_epi32(_mm256_mullo_epi32(t, t), 16);
+    __m256i t3 = RE_Q16_MUL_FRAC_X8_avx2(t2, t);
+    __m256i p  = _mm256_sub_epi32(_mm256_mullo_epi32(t, _mm256_set1_epi32(6)), _mm256_set1_epi32(15 * 65536));
+    p = _mm256_add_epi32(RE_Q16_MUL_FRAC_X8_avx2(p, t), _mm256_set1_epi32(10 * 65536));
+    return RE_Q16_MUL_FRAC_X8_avx2(p, t3);
+}
+
+RE_INLINE __m256i RE_Q16_LERP_X8_avx2(__m256i a, __m256i b, __m256i t)
+{
+    return _mm256_add_epi32(a, RE_Q16_MUL_FRAC_X8_avx2(_mm256_sub_epi32(b, a), t));
+}
+
+RE_INLINE __m256i RE_Q16_NEGATE_IF_X8_avx2(__m256i v, __m256i m)
+{
+    return _mm256_sub_epi32(_mm256_xor_si256(v, m), m);
+}
+
+RE_INLINE __m256i RE_Q16_GRAD3_DOT_X8_avx2(__m256i gi, __m256i x, __m256i y, __m256i z)
+{
+    __m256i u  = _mm256_blendv_epi8(y, x, _mm256_cmpgt_epi32(_mm256_set1_epi32(8), gi));
+    __m256i v  = _mm256_blendv_epi8(z, y, _mm256_cmpgt_epi32(_mm256_set1_epi32(4), gi));
+    __m256i su = _mm256_srai_epi32(_mm256_slli_epi32(gi, 31), 31);
+    __m256i sv = _mm256_srai_epi32(_mm256_slli_epi32(gi, 30), 31);
+    return _mm256_add_epi32(RE_Q16_NEGATE_IF_X8_avx2(u, su), RE_Q16_NEGATE_IF_X8_avx2(v, sv));
+}
+
+RE_INLINE __m256i RE_Q16_GRAD2_DOT_X8_avx2(__m256i gi, __m256i x, __m256i y)
+{
+    __m256i u  = _mm256_blendv_epi8(y, x, _mm256_cmpgt_epi32(_mm256_set1_epi32(6), gi));
+    __m256i v  = _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), gi), y);
+    __m256i su = _mm256_srai_epi32(_mm256_slli_epi32(gi, 31), 31);
+    __m256i sv = _mm256_srai_epi32(_mm256_slli_epi32(gi, 30), 31);
+    return _mm256_add_epi32(RE_Q16_NEGATE_IF_X8_avx2(u, su), RE_Q16_NEGATE_IF_X8_avx2(v, sv));
+}
+
+RE_INLINE __m256i RE_Q16_HASH2_X8_avx2(const RE_NOISE_CONTEXT *ctx, __m256i X, __m256i Y)
+{
+#if RE_NOISE_HASH_MODE == 3
+    return _mm256_and_si256(RE_HASH3D_PCG_SEED_X8_avx2(ctx->seed, X, Y, _mm256_setzero_si256()),
+                            _mm256_set1_epi32(255));
+#else
+    RE_i32 xs[8], ys[8], h[8];
+    _mm256_storeu_si256((__m256i *)xs, X);
+    _mm256_storeu_si256((__m256i *)ys, Y);
+    for (int l = 0; l < 8; l++) h[l] = RE_NOISE_CTX_HASH2(ctx, xs[l], ys[l]);
+    return _mm256_loadu_si256((const __m256i *)h);
+#endif
+}
+
+RE_INLINE __m256i RE_Q16_VALUE_FROM_HASH_X8_avx2(__m256i h)
+{
+    return _mm256_mullo_epi32(_mm256_sub_epi32(_mm256_slli_epi32(h, 1), _mm256_set1_epi32(255)),
+                              _mm256_set1_epi32(257));
+}
+
+RE_INLINE __m256i RE_NOISE_VALUE2_X8_CTX_q16_avx2(const RE_NOISE_CONTEXT *ctx, __m256i x, __m256i y)
+{
+    __m256i m16 = _mm256_set1_epi32(0xFFFF), one = _mm256_set1_epi32(1);
+    __m256i X = _mm256_srai_epi32(x, 16), X1 = _mm256_add_epi32(X, one);
+    __m256i Y = _mm256_srai_epi32(y, 16), Y1 = _mm256_add_epi32(Y, one);
+
+    __m256i u = RE_Q16_FADE_X8_avx2(_mm256_and_si256(x, m16));
+    __m256i v = RE_Q16_FADE_X8_avx2(_mm256_and_si256(y, m16));
+
+    __m256i a = RE_Q16_VALUE_FROM_HASH_X8_avx2(RE_Q16_HASH2_X8_avx2(ctx, X,  Y));
+    __m256i b = RE_Q16_VALUE_FROM_HASH_X8_avx2(RE_Q16_HASH2_X8_avx2(ctx, X1, Y));
+    __m256i c = RE_Q16_VALUE_FROM_HASH_X8_avx2(RE_Q16_HASH2_X8_avx2(ctx, X,  Y1));
+    __m256i d = RE_Q16_VALUE_FROM_HASH_X8_avx2(RE_Q16_HASH2_X8_avx2(ctx, X1, Y1));
+
+    return RE_Q16_LERP_X8_avx2(RE_Q16_LERP_X8_avx2(a, b, u), RE_Q16_LERP_X8_avx2(c, d, u), v);
+}
+
+RE_INLINE __m256i RE_NOISE_VALUE3_X8_CTX_q16_avx2(const RE_NOISE_CONTEXT *ctx,
+                                                  __m256i x, __m256i y, __m256i z)
+{
+    __m256i m16 = _mm256_set1_epi32(0xFFFF);
+    __m256i u = RE_Q16_FADE_X8_avx2(_mm256_and_si256(x, m16));
+    __m256i v = RE_Q16_FADE_X8_avx2(_mm256_and_si256(y, m16));
+    __m256i w = RE_Q16_FADE_X8_avx2(_mm256_and_si256(z, m16));
+
+    RE_i32 h[8 * 8];
+    RE_NOISE_LATTICE3_CORNERS_X8_avx(ctx, _mm256_srai_epi32(x, 16), _mm256_srai_epi32(y, 16),
+                                     _mm256_srai_epi32(z, 16), h, RE_FALSE);
+
+    #define C(c) RE_Q16_VALUE_FROM_HASH_X8_avx2(_mm256_loadu_si256((const __m256i *)(h + (c) * 8)))
+
+    __m256i l0 = RE_Q16_LERP_X8_avx2(RE_Q16_LERP_X8_avx2(C(0), C(1), u), RE_Q16_LERP_X8_avx2(C(2), C(3), u), v);
+    __m256i l1 = RE_Q16_LERP_X8_avx2(RE_Q16_LERP_X8_avx2(C(4), C(5), u), RE_Q16_LERP_X8_avx2(C(6), C(7), u), v);
+
+    #undef C
+
+    return RE_Q16_LERP_X8_avx2(l0, l1, w);
+}
+
+RE_INLINE __m256i RE_NOISE_PERLIN2_X8_CTX_q16_avx2(const RE_NOISE_CONTEXT *ctx, __m256i x, __m256i y)
+{
+    __m256i m16 = _mm256_set1_epi32(0xFFFF), one = _mm256_set1_epi32(65536);
+    __m256i x0 = _mm256_and_si256(x, m16), x1 = _mm256_sub_epi32(x0, one);
+    __m256i y0 = _mm256_and_si256(y, m16), y1 = _mm256_sub_epi32(y0, one);
+
+    RE_i32 gi[4 * 8];
+    RE_NOISE_LATTICE2_CORNERS_X8_avx(ctx, _mm256_srai_epi32(x, 16), _mm256_srai_epi32(y, 16), gi);
+
+    #define G(c) _mm256_loadu_si256((const __m256i *)(gi + (c) * 8))
+
+    __m256i u = RE_Q16_FADE_X8_avx2(x0);
+    __m256i v = RE_Q16_FADE_X8_avx2(y0);
+
+    __m256i r = RE_Q16_LERP_X8_avx2(RE_Q16_LERP_X8_avx2(RE_Q16_GRAD2_DOT_X8_avx2(G(0), x0, y0),
+                                                        RE_Q16_GRAD2_DOT_X8_avx2(G(1), x1, y0), u),
+                                    RE_Q16_LERP_X8_avx2(RE_Q16_GRAD2_DOT_X8_avx2(G(2), x0, y1),
+                                                        RE_Q16_GRAD2_DOT_X8_avx2(G(3), x1, y1), u), v);
+    #undef G
+
+    return r;
+}
+
+RE_INLINE __m256i RE_NOISE_PERLIN3_X8_CTX_q16_avx2(const RE_NOISE_CONTEXT *ctx,
+                                                   __m256i x, __m256i y, __m256i z)
+{
+    __m256i m16 = _mm256_set1_epi32(0xFFFF), one = _mm256_set1_epi32(65536);
+    __m256i x0 = _mm256_and_si256(x, m16), x1 = _mm256_sub_epi32(x0, one);
+    __m256i y0 = _mm256_and_si256(y, m16), y1 = _mm256_sub_epi32(y0, one);
+    __m256i z0 = _mm256_and_si256(z, m16), z1 = _mm256_sub_epi32(z0, one);
+
+    RE_i32 gi[8 * 8];
+    RE_NOISE_LATTICE3_CORNERS_X8_avx(ctx, _mm256_srai_epi32(x, 16), _mm256_srai_epi32(y, 16),
+                                     _mm256_srai_epi32(z, 16), gi, RE_TRUE);
+
+    __m256i u = RE_Q16_FADE_X8_avx2(x0);
+    __m256i v = RE_Q16_FADE_X8_avx2(y0);
+    __m256i w = RE_Q16_FADE_X8_avx2(z0);
+
+    #define D(c, px, py, pz) RE_Q16_GRAD3_DOT_X8_avx2(_mm256_loadu_si256((const __m256i *)(gi + (c) * 8)), px, py, pz)
+
+    __m256i l0 = RE_Q16_LERP_X8_avx2(RE_Q16_LERP_X8_avx2(D(0, x0, y0, z0), D(1, x1, y0, z0), u),
+                                     RE_Q16_LERP_X8_avx2(D(2, x0, y1, z0), D(3, x1, y1, z0), u), v);
+    __m256i l1 = RE_Q16_LERP_X8_avx2(RE_Q16_LERP_X8_avx2(D(4, x0, y0, z1), D(5, x1, y0, z1), u),
+                                     RE_Q16_LERP_X8_avx2(D(6, x0, y1, z1), D(7, x1, y1, z1), u), v);
+    #undef D
+
+    return RE_Q16_LERP_X8_avx2(l0, l1, w);
+}
+
+RE_INLINE __m256i RE_Q16_SIMPLEX_TERM_X8_avx2(__m256i attn, __m256i dot)
+{
+    __m256i a2 = _mm256_srai_epi32(_mm256_mullo_epi32(attn, attn), 15);
+    __m256i a4 = _mm256_srai_epi32(_mm256_mullo_epi32(a2, a2), 15);
+    return _mm256_srai_epi32(_mm256_mullo_epi32(a4, dot), 2);
+}
+
+RE_INLINE __m256i RE_Q16_OS2_UNSKEW_X8_avx2(__m256i n)
+{
+    return _mm256_add_epi32(_mm256_mullo_epi32(n, _mm256_set1_epi32(RE_Q16_OS2_U2)),
+                            _mm256_srai_epi32(_mm256_mullo_epi32(n, _mm256_set1_epi32(109)), 8));
+}
+
+RE_INLINE __m256i RE_NOISE_OS2D_SMOOTH_X8_CTX_q16_avx2(const RE_NOISE_CONTEXT *ctx, __m256i x, __m256i y)
+{
+    __m256i zero = _mm256_setzero_si256();
+
+    __m256i s  = RE_Q16_MUL_FRAC_X8_avx2(_mm256_add_epi32(x, y), _mm256_set1_epi32(RE_Q16_OS2_S2));
+    __m256i bi = _mm256_srai_epi32(_mm256_add_epi32(x, s), 16);
+    __m256i bj = _mm256_srai_epi32(_mm256_add_epi32(y, s), 16);
+
+    __m256i t  = RE_Q16_OS2_UNSKEW_X8_avx2(_mm256_add_epi32(bi, bj));
+    __m256i dx = _mm256_add_epi32(_mm256_sub_epi32(x, _mm256_slli_epi32(bi, 16)), t);
+    __m256i dy = _mm256_add_epi32(_mm256_sub_epi32(y, _mm256_slli_epi32(bj, 16)), t);
+
+    __m256i qx = _mm256_srai_epi32(dx, 3), qy = _mm256_srai_epi32(dy, 3);
+    __m256i k0 = _mm256_set1_epi32(51687), k1 = _mm256_set1_epi32(13849), lim = _mm256_set1_epi32(37838 * 8192 - 1);
+    __m256i su = _mm256_add_epi32(_mm256_mullo_epi32(k0, qx), _mm256_mullo_epi32(k1, qy));
+    __m256i sv = _mm256_add_epi32(_mm256_mullo_epi32(k1, qx), _mm256_mullo_epi32(k0, qy));
+
+    __m256i di = _mm256_sub_epi32(_mm256_cmpgt_epi32(su, lim), _mm256_cmpgt_epi32(zero, su));
+    __m256i dj = _mm256_sub_epi32(_mm256_cmpgt_epi32(sv, lim), _mm256_cmpgt_epi32(zero, sv));
+    di = _mm256_sub_epi32(zero, di);
+    dj = _mm256_sub_epi32(zero, dj);
+
+    __m256i i  = _mm256_add_epi32(bi, di);
+    __m256i j  = _mm256_add_epi32(bj, dj);
+    __m256i x0 = _mm256_sub_epi32(x, _mm256_slli_epi32(i, 16));
+    __m256i y0 = _mm256_sub_epi32(y, _mm256_slli_epi32(j, 16));
+
+    __m256i n = _mm256_add_epi32(i, j), tk[5];
+    for (int k = 0; k < 5; k++) tk[k] = RE_Q16_OS2_UNSKEW_X8_avx2(_mm256_add_epi32(n, _mm256_set1_epi32(k - 1)));
+
+    __m256i value = zero;
+
+    for (int c = 0; c < 8; c++)
+    {
+        RE_i32 ox = RE_Q16_OS2_OFF[c][0], oy = RE_Q16_OS2_OFF[c][1];
+        __m256i tc = tk[ox + oy + 1];
+
+        __m256i px = _mm256_add_epi32(_mm256_sub_epi32(x0, _mm256_set1_epi32(ox * 65536)), tc);
+        __m256i py = _mm256_add_epi32(_mm256_sub_epi32(y0, _mm256_set1_epi32(oy * 65536)), tc);
+
+        __m256i ax = _mm256_srai_epi32(px, 3), ay = _mm256_srai_epi32(py, 3);
+        __m256i attn = _mm256_sub_epi32(_mm256_set1_epi32(RE_Q16_OS2_R2_Q26),
+                                        _mm256_add_epi32(_mm256_mullo_epi32(ax, ax), _mm256_mullo_epi32(ay, ay)));
+        attn = _mm256_max_epi32(attn, zero);
+        attn = _mm256_srai_epi32(_mm256_mullo_epi32(attn, _mm256_set1_epi32(3)), 12);
+
+        __m256i gi = _mm256_and_si256(RE_Q16_HASH2_X8_avx2(ctx, _mm256_add_epi32(i, _mm256_set1_epi32(ox)),
+                                                          _mm256_add_epi32(j, _mm256_set1_epi32(oy))),
+                                      _mm256_set1_epi32(7));
+
+        value = _mm256_add_epi32(value, RE_Q16_SIMPLEX_TERM_X8_avx2(attn, RE_Q16_GRAD2_DOT_X8_avx2(gi, px, py)));
+    }
+
+    return _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(value, 13), _mm256_set1_epi32(10923)), 12);
+}
+
+RE_INLINE void RE_Q16_OS3_ROTATE_X8_avx2(__m256i X, __m256i Y, __m256i Z, __m256i fx, __m256i fy, __m256i fz,
+                                         __m256i *ti, __m256i *tf)
+{
+    __m256i f = _mm256_sub_epi32(_mm256_slli_epi32(_mm256_add_epi32(fy, fz), 1), fx);
+    *ti = _mm256_add_epi32(_mm256_sub_epi32(_mm256_slli_epi32(_mm256_add_epi32(Y, Z), 1), X),
+                           _mm256_srai_epi32(f, 16));
+    *tf = _mm256_and_si256(f, _mm256_set1_epi32(0xFFFF));
+}
+
+RE_INLINE __m256i RE_Q16_OS3_NEAREST_X8_avx2(__m256i ti, __m256i tf, int l, __m256i *p)
+{
+    __m256i a = _mm256_add_epi32(ti, _mm256_srai_epi32(_mm256_add_epi32(tf, _mm256_set1_epi32((1 - l) * 98304)), 16));
+    __m256i n = _mm256_mullo_epi32(_mm256_add_epi32(a, _mm256_set1_epi32(49152)), _mm256_set1_epi32(43691));
+    n = _mm256_sub_epi32(_mm256_srli_epi32(n, 17), _mm256_set1_epi32(16384));
+
+    __m256i r = _mm256_sub_epi32(ti, _mm256_mullo_epi32(n, _mm256_set1_epi32(3)));
+    r = _mm256_add_epi32(_mm256_slli_epi32(r, 16), _mm256_sub_epi32(tf, _mm256_set1_epi32(l * 98304)));
+    *p = RE_Q16_MUL_FRAC_X8_avx2(r, _mm256_set1_epi32(21845));
+    return n;
+}
+
+RE_INLINE __m256i RE_Q16_OS3_TERM_X8_avx2(RE_u32 seed, __m256i x2, __m256i y2, __m256i z2,
+                                          __m256i px, __m256i py, __m256i pz)
+{
+    __m256i qx = _mm256_srai_epi32(px, 2), qy = _mm256_srai_epi32(py, 2), qz = _mm256_srai_epi32(pz, 2);
+    __m256i d2 = _mm256_add_epi32(_mm256_add_epi32(_mm256_mullo_epi32(qx, qx), _mm256_mullo_epi32(qy, qy)),
+                                  _mm256_mullo_epi32(qz, qz));
+    __m256i attn = _mm256_sub_epi32(_mm256_set1_epi32(RE_Q16_OS3_R2_Q28), d2);
+    attn = _mm256_srai_epi32(_mm256_max_epi32(attn, _mm256_setzero_si256()), 12);
+
+    __m256i gi = RE_HASH_TO_GRAD12_X8_avx2(RE_OS3D_HASH_SEED_X8_avx2(seed, x2, y2, z2));
+    return RE_Q16_SIMPLEX_TERM_X8_avx2(attn, RE_Q16_GRAD3_DOT_X8_avx2(gi, px, py, pz));
+}
+
+RE_INLINE __m256i RE_NOISE_OS3D_FAST_X8_CTX_q16_avx2(const RE_NOISE_CONTEXT *ctx,
+                                                     __m256i x, __m256i y, __m256i z)
+{
+    __m256i m16 = _mm256_set1_epi32(0xFFFF);
+    __m256i X = _mm256_srai_epi32(x, 16), fx = _mm256_and_si256(x, m16);
+    __m256i Y = _mm256_srai_epi32(y, 16), fy = _mm256_and_si256(y, m16);
+    __m256i Z = _mm256_srai_epi32(z, 16), fz = _mm256_and_si256(z, m16);
+
+    __m256i tix, tfx, tiy, tfy, tiz, tfz;
+    RE_Q16_OS3_ROTATE_X8_avx2(X, Y, Z, fx, fy, fz, &tix, &tfx);
+    RE_Q16_OS3_ROTATE_X8_avx2(Y, Z, X, fy, fz, fx, &tiy, &tfy);
+    RE_Q16_OS3_ROTATE_X8_avx2(Z, X, Y, fz, fx, fy, &tiz, &tfz);
+
+    __m256i one = _mm256_set1_epi32(1), value = _mm256_setzero_si256();
+
+    for (int l = 0; l < 2; l++)
+    {
+        __m256i px, py, pz, L = _mm256_set1_epi32(l);
+        __m256i xn = RE_Q16_OS3_NEAREST_X8_avx2(tix, tfx, l, &px);
+        __m256i yn = RE_Q16_OS3_NEAREST_X8_avx2(tiy, tfy, l, &py);
+        __m256i zn = RE_Q16_OS3_NEAREST_X8_avx2(tiz, tfz, l, &pz);
+
+        value = _mm256_add_epi32(value, RE_Q16_OS3_TERM_X8_avx2(ctx->seed,
+                                            _mm256_add_epi32(_mm256_slli_epi32(xn, 1), L),
+                                            _mm256_add_epi32(_mm256_slli_epi32(yn, 1), L),
+                                            _mm256_add_epi32(_mm256_slli_epi32(zn, 1), L), px, py, pz));
+
+        __m256i ax = _mm256_abs_epi32(px), ay = _mm256_abs_epi32(py), az = _mm256_abs_epi32(pz);
+        __m256i ones = _mm256_set1_epi32(-1);
+
+        __m256i selx = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpgt_epi32(ay, ax), _mm256_cmpgt_epi32(az, ax)), ones);
+        __m256i sely = _mm256_andnot_si256(_mm256_or_si256(selx, _mm256_cmpgt_epi32(az, ay)), ones);
+        __m256i selz = _mm256_andnot_si256(_mm256_or_si256(selx, sely), ones);
+
+        __m256i sx = _mm256_and_si256(selx, _mm256_or_si256(_mm256_srai_epi32(px, 31), one));
+        __m256i sy = _mm256_and_si256(sely, _mm256_or_si256(_mm256_srai_epi32(py, 31), one));
+        __m256i sz = _mm256_and_si256(selz, _mm256_or_si256(_mm256_srai_epi32(pz, 31), one));
+
+        value = _mm256_add_epi32(value, RE_Q16_OS3_TERM_X8_avx2(ctx->seed,
+                                            _mm256_add_epi32(_mm256_slli_epi32(_mm256_add_epi32(xn, sx), 1), L),
+                                            _mm256_add_epi32(_mm256_slli_epi32(_mm256_add_epi32(yn, sy), 1), L),
+                                            _mm256_add_epi32(_mm256_slli_epi32(_mm256_add_epi32(zn, sz), 1), L),
+                                            _mm256_sub_epi32(px, _mm256_slli_epi32(sx, 16)),
+                                            _mm256_sub_epi32(py, _mm256_slli_epi32(sy, 16)),
+                                            _mm256_sub_epi32(pz, _mm256_slli_epi32(sz, 16))));
+    }
+
+    return _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_srai_epi32(value, 13), _mm256_set1_epi32(19200)), 12);
+}
+
+#endif /* AVX2 */
+
+/* ============================================================================================
+   BATCH — out[i] = f(x[i], y[i] (, z[i])), widest kernel first, scalar tail; bit-identical
+   to the per-point functions
+   ============================================================================================ */
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+#define RE_Q16_BATCH_X8_2D(kernel)                                                                  \
+    for (; i + 8 <= count; i += 8)                                                                  \
+        _mm256_storeu_si256((__m256i *)(out + i), kernel(ctx, _mm256_loadu_si256((const __m256i *)(x + i)), \
+                                                              _mm256_loadu_si256((const __m256i *)(y + i))));
+#define RE_Q16_BATCH_X8_3D(kernel)                                                                  \
+    for (; i + 8 <= count; i += 8)                                                                  \
+        _mm256_storeu_si256((__m256i *)(out + i), kernel(ctx, _mm256_loadu_si256((const __m256i *)(x + i)), \
+                                                              _mm256_loadu_si256((const __m256i *)(y + i)), \
+                                                              _mm256_loadu_si256((const __m256i *)(z + i))));
+#else
+#define RE_Q16_BATCH_X8_2D(kernel)
+#define RE_Q16_BATCH_X8_3D(kernel)
+#endif
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+#define RE_Q16_BATCH_X4_2D(kernel)                                                                  \
+    for (; i + 4 <= count; i += 4)                                                                  \
+        _mm_storeu_si128((__m128i *)(out + i), kernel(ctx, _mm_loadu_si128((const __m128i *)(x + i)), \
+                                                           _mm_loadu_si128((const __m128i *)(y + i))));
+#define RE_Q16_BATCH_X4_3D(kernel)                                                                  \
+    for (; i + 4 <= count; i += 4)                                                                  \
+        _mm_storeu_si128((__m128i *)(out + i), kernel(ctx, _mm_loadu_si128((const __m128i *)(x + i)), \
+                                                           _mm_loadu_si128((const __m128i *)(y + i)), \
+                                                           _mm_loadu_si128((const __m128i *)(z + i))));
+#else
+#define RE_Q16_BATCH_X4_2D(kernel)
+#define RE_Q16_BATCH_X4_3D(kernel)
+#endif
+
+RE_INLINE void RE_NOISE_VALUE2_BATCH_CTX_q16(const RE_NOISE_CONTEXT *ctx,
+                                             const RE_q16 *x, const RE_q16 *y, RE_q16 *out, int count)
+{
+    int i = 0;
+    RE_Q16_BATCH_X8_2D(RE_NOISE_VALUE2_X8_CTX_q16_avx2)
+    RE_Q16_BATCH_X4_2D(RE_NOISE_VALUE2_X4_CTX_q16_sse)
+    for (; i < count; i++) out[i] = RE_NOISE_VALUE2_CTX_q16(ctx, x[i], y[i]);
+}
+
+RE_INLINE void RE_NOISE_VALUE3_BATCH_CTX_q16(const RE_NOISE_CONTEXT *ctx, const RE_q16 *x,
+                                             const RE_q16 *y, const RE_q16 *z, RE_q16 *out, int count)
+{
+    int i = 0;
+    RE_Q16_BATCH_X8_3D(RE_NOISE_VALUE3_X8_CTX_q16_avx2)
+    RE_Q16_BATCH_X4_3D(RE_NOISE_VALUE3_X4_CTX_q16_sse)
+    for (; i < count; i++) out[i] = RE_NOISE_VALUE3_CTX_q16(ctx, x[i], y[i], z[i]);
+}
+
+RE_INLINE void RE_NOISE_PERLIN2_BATCH_CTX_q16(const RE_NOISE_CONTEXT *ctx,
+                                              const RE_q16 *x, const RE_q16 *y, RE_q16 *out, int count)
+{
+    int i = 0;
+    RE_Q16_BATCH_X8_2D(RE_NOISE_PERLIN2_X8_CTX_q16_avx2)
+    RE_Q16_BATCH_X4_2D(RE_NOISE_PERLIN2_X4_CTX_q16_sse)
+    for (; i < count; i++) out[i] = RE_NOISE_PERLIN2_CTX_q16(ctx, x[i], y[i]);
+}
+
+RE_INLINE void RE_NOISE_PERLIN3_BATCH_CTX_q16(const RE_NOISE_CONTEXT *ctx, const RE_q16 *x,
+                                              const RE_q16 *y, const RE_q16 *z, RE_q16 *out, int count)
+{
+    int i = 0;
+    RE_Q16_BATCH_X8_3D(RE_NOISE_PERLIN3_X8_CTX_q16_avx2)
+    RE_Q16_BATCH_X4_3D(RE_NOISE_PERLIN3_X4_CTX_q16_sse)
+    for (; i < count; i++) out[i] = RE_NOISE_PERLIN3_CTX_q16(ctx, x[i], y[i], z[i]);
+}
+
+RE_INLINE void RE_NOISE_OS2D_SMOOTH_BATCH_CTX_q16(const RE_NOISE_CONTEXT *ctx,
+                                                  const RE_q16 *x, const RE_q16 *y, RE_q16 *out, int count)
+{
+    int i = 0;
+    RE_Q16_BATCH_X8_2D(RE_NOISE_OS2D_SMOOTH_X8_CTX_q16_avx2)
+    RE_Q16_BATCH_X4_2D(RE_NOISE_OS2D_SMOOTH_X4_CTX_q16_sse)
+    for (; i < count; i++) out[i] = RE_NOISE_OS2D_SMOOTH_CTX_q16(ctx, x[i], y[i]);
+}
+
+RE_INLINE void RE_NOISE_OS3D_FAST_BATCH_CTX_q16(const RE_NOISE_CONTEXT *ctx, const RE_q16 *x,
+                                                const RE_q16 *y, const RE_q16 *z, RE_q16 *out, int count)
+{
+    int i = 0;
+    RE_Q16_BATCH_X8_3D(RE_NOISE_OS3D_FAST_X8_CTX_q16_avx2)
+    RE_Q16_BATCH_X4_3D(RE_NOISE_OS3D_FAST_X4_CTX_q16_sse)
+    for (; i < count; i++) out[i] = RE_NOISE_OS3D_FAST_CTX_q16(ctx, x[i], y[i], z[i]);
+}
+
+#undef RE_Q16_BATCH_X8_2D
+#undef RE_Q16_BATCH_X8_3D
+#undef RE_Q16_BATCH_X4_2D
+#undef RE_Q16_BATCH_X4_3D
+
+RE_INLINE void RE_NOISE_VALUE2_BATCH_q16(const RE_q16 *x, const RE_q16 *y, RE_q16 *out, int count)
+{
+    RE_NOISE_VALUE2_BATCH_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y, out, count);
+}
+
+RE_INLINE void RE_NOISE_VALUE3_BATCH_q16(const RE_q16 *x, const RE_q16 *y, const RE_q16 *z, RE_q16 *out, int count)
+{
+    RE_NOISE_VALUE3_BATCH_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out, count);
+}
+
+RE_INLINE void RE_NOISE_PERLIN2_BATCH_q16(const RE_q16 *x, const RE_q16 *y, RE_q16 *out, int count)
+{
+    RE_NOISE_PERLIN2_BATCH_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y, out, count);
+}
+
+RE_INLINE void RE_NOISE_PERLIN3_BATCH_q16(const RE_q16 *x, const RE_q16 *y, const RE_q16 *z, RE_q16 *out, int count)
+{
+    RE_NOISE_PERLIN3_BATCH_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out, count);
+}
+
+RE_INLINE void RE_NOISE_OS2D_SMOOTH_BATCH_q16(const RE_q16 *x, const RE_q16 *y, RE_q16 *out, int count)
+{
+    RE_NOISE_OS2D_SMOOTH_BATCH_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y, out, count);
+}
+
+RE_INLINE void RE_NOISE_OS3D_FAST_BATCH_q16(const RE_q16 *x, const RE_q16 *y, const RE_q16 *z, RE_q16 *out, int count)
+{
+    RE_NOISE_OS3D_FAST_BATCH_CTX_q16(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out, count);
+}
+
+#endif /* RE_NOISE_FIXED_H */
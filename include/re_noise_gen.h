@@ -0,0 +1,454 @@
+/**
+ * @file re_noise_gen.h
+ * @brief Multi-threaded chunked noise generator for 2D terrain / 3D volumes.
+ *
+ * A regular grid (origin + step per axis, same convention as the
+ * RE_NOISE_*_FILL_GRID functions) is split into chunks, and the chunks are
+ * evaluated by a persistent pool of worker threads with range stealing:
+ *
+ *   - every worker starts with a contiguous run of chunk indices [begin, end)
+ *     packed into one 64-bit word;
+ *   - the owner pops from the front with a CAS;
+ *   - a worker whose run is empty steals the back half of another worker's run.
+ *
+ * Each sample's coordinate is computed from its integer grid index
+ * (o + s * i), never accumulated, and a chunk is always evaluated the same
+ * way whichever worker picks it up, so the output is bit-identical for any
+ * thread count or schedule. (Changing the chunk size only moves samples
+ * between SIMD lanes and scalar tails: equal to float rounding.)
+ *
+ * Sources: a RE_NOISE_FRACTAL_DESC (FBM / turbulence / ridged over any 3D
+ * basis, evaluated row-wise through RE_NOISE_FRACTAL3_BATCH_CTX_f32), a
+ * compiled RE_NOISE_GRAPH (evaluated row-wise, one tile per row), or any
+ * per-point callback (wrap any RE_NOISE_*_CTX function).
+ *
+ * Typical use:
+ *
+ *   RE_NOISE_POOL pool;          RE_NOISE_POOL_CREATE(&pool, 0);
+ *   RE_NOISE_GEN_JOB job;        RE_NOISE_GEN_START(&pool, &job, &desc);
+ *   while (!RE_NOISE_GEN_IS_DONE(&job)) { show(RE_NOISE_GEN_PROGRESS(&job)); }
+ *   RE_NOISE_GEN_WAIT(&pool, &job);
+ *   RE_NOISE_POOL_DESTROY(&pool);
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_NOISE_GEN_H
+#define RE_NOISE_GEN_H
+
+#include "re_core.h"
+#include "re_noise.h"
+#include "re_noise_graph.h"
+#include "re_thread.h"
+
+#define RE_NOISE_GEN_MAX_THREADS     64
+#define RE_NOISE_GEN_MAX_ROW         256    /* rows longer than this are evaluated in pieces */
+
+/* Output layouts */
+#define RE_NOISE_GEN_LAYOUT_GRID     0      /* out[(z * ny + y) * nx + x], x fastest           */
+#define RE_NOISE_GEN_LAYOUT_CHUNKED  1      /* chunk c at out + c * chunk volume, x fastest;
+                                               edge chunks keep the full row/slice pitch       */
+
+/* Per-point source: any noise, with the job's context */
+typedef RE_f32 (*RE_NOISE_GEN_POINT_FN)(const RE_NOISE_CONTEXT *ctx, void *user,
+                                        RE_f32 x, RE_f32 y, RE_f32 z);
+
+typedef struct RE_NOISE_GEN_DESC_t {
+    int    nx, ny, nz;                       /* samples per axis (2D: nz = 1)                  */
+    RE_f32 ox, oy, oz;                       /* coordinate of sample (0,0,0); 2D uses z = oz   */
+    RE_f32 sx, sy, sz;                       /* step between samples                           */
+    int    chunk_x, chunk_y, chunk_z;        /* chunk size in samples (0 = 64 x 64 x 1 / 32^3) */
+    int    layout;                           /* RE_NOISE_GEN_LAYOUT_*                          */
+    RE_f32 *out;
+
+    const RE_NOISE_CONTEXT     *ctx;         /* NULL = RE_NOISE_DEFAULT_CONTEXT                */
+    const RE_NOISE_FRACTAL_DESC *fractal;    /* used when point_fn and graph are NULL          */
+    RE_NOISE_GEN_POINT_FN       point_fn;
+    void                       *user;
+    const RE_NOISE_GRAPH        *graph;      /* compiled graph, used when point_fn is NULL     */
+} RE_NOISE_GEN_DESC;
+
+/* Chunk placement inside the grid */
+typedef struct RE_NOISE_GEN_CHUNK_t {
+    int x0, y0, z0;                          /* first sample                                   */
+    int nx, ny, nz;                          /* valid samples (smaller at the far edges)        */
+    RE_f32 *out;                             /* first sample in the output buffer              */
+    int row_pitch, slice_pitch;              /* in floats                                      */
+} RE_NOISE_GEN_CHUNK;
+
+/* One worker's run of chunk indices: (end << 32) | begin, padded to its own cache line */
+typedef struct RE_NOISE_GEN_RANGE_t {
+    volatile RE_u64 run;
+    RE_u8 pad[64 - sizeof(RE_u64)];
+} RE_NOISE_GEN_RANGE;
+
+typedef struct RE_NOISE_GEN_JOB_t {
+    RE_NOISE_GEN_DESC  desc;
+    int                cx, cy, cz;           /* chunks per axis                                */
+    int                chunk_count;
+    int                worker_count;
+    volatile RE_i32    chunks_done;
+    volatile RE_i32    cancel;
+    volatile RE_i32    workers_active;
+    RE_NOISE_GEN_RANGE ranges[RE_NOISE_GEN_MAX_THREADS];
+} RE_NOISE_GEN_JOB;
+
+typedef struct RE_NOISE_POOL_t RE_NOISE_POOL;
+
+typedef struct RE_NOISE_POOL_WORKER_t {
+    RE_NOISE_POOL *pool;
+    int            index;
+    RE_THREAD      thread;
+} RE_NOISE_POOL_WORKER;
+
+struct RE_NOISE_POOL_t {
+    int                  thread_count;
+    RE_NOISE_POOL_WORKER workers[RE_NOISE_GEN_MAX_THREADS];
+
+    RE_MUTEX             lock;
+    RE_COND              wake;               /* workers: new job or shutdown                   */
+    RE_COND              idle;               /* waiters: last worker left the job              */
+    RE_NOISE_GEN_JOB    *job;
+    RE_u32               generation;         /* bumped per job so workers run each job once    */
+    RE_BOOL              shutdown;
+};
+
+/* ============================================================================================
+   CHUNK GEOMETRY
+   ============================================================================================ */
+
+#define RE_NOISE_GEN_PACK_RUN(b, e)   (((RE_u64)(RE_u32)(e) << 32) | (RE_u64)(RE_u32)(b))
+
+RE_INLINE void RE_NOISE_GEN_CHUNK_DIMS(const RE_NOISE_GEN_DESC *d, int *wx, int *wy, int *wz)
+{
+    int is3d = d->nz > 1;
+    *wx = d->chunk_x > 0 ? d->chunk_x : (is3d ? 32 : 64);
+    *wy = d->chunk_y > 0 ? d->chunk_y : (is3d ? 32 : 64);
+    *wz = d->chunk_z > 0 ? d->chunk_z : (is3d ? 32 : 1);
+}
+
+/**
+ * @brief Where chunk `index` (x fastest) sits in the grid and the output buffer.
+ */
+RE_INLINE void RE_NOISE_GEN_CHUNK_INFO(const RE_NOISE_GEN_JOB *job, int index, RE_NOISE_GEN_CHUNK *c)
+{
+    const RE_NOISE_GEN_DESC *d = &job->desc;
+    int wx, wy, wz;
+    RE_NOISE_GEN_CHUNK_DIMS(d, &wx, &wy, &wz);
+
+    int ix = index % job->cx;
+    int iy = (index / job->cx) % job->cy;
+    int iz = index / (job->cx * job->cy);
+
+    c->x0 = ix * wx;  c->nx = (c->x0 + wx <= d->nx) ? wx : d->nx - c->x0;
+    c->y0 = iy * wy;  c->ny = (c->y0 + wy <= d->ny) ? wy : d->ny - c->y0;
+    c->z0 = iz * wz;  c->nz = (c->z0 + wz <= d->nz) ? wz : d->nz - c->z0;
+
+    if (d->layout == RE_NOISE_GEN_LAYOUT_CHUNKED)
+    {
+        c->row_pitch   = wx;
+        c->slice_pitch = wx * wy;
+        c->out = d->out + (size_t)index * (size_t)(wx * wy * wz);
+    }
+    else
+    {
+        c->row_pitch   = d->nx;
+        c->slice_pitch = d->nx * d->ny;
+        c->out = d->out + ((size_t)c->z0 * d->ny + c->y0) * d->nx + c->x0;
+    }
+}
+
+/**
+ * @brief Evaluate one chunk on the calling thread.
+ */
+RE_INLINE void RE_NOISE_GEN_RUN_CHUNK(const RE_NOISE_GEN_JOB *job, int index)
+{
+    const RE_NOISE_GEN_DESC *d   = &job->desc;
+    const RE_NOISE_CONTEXT  *ctx = d->ctx ? d->ctx : &RE_NOISE_DEFAULT_CONTEXT;
+    RE_f32 xs[RE_NOISE_GEN_MAX_ROW], ys[RE_NOISE_GEN_MAX_ROW], zs[RE_NOISE_GEN_MAX_ROW];
+    RE_NOISE_GEN_CHUNK c;
+
+    RE_NOISE_GEN_CHUNK_INFO(job, index, &c);
+
+    for (int z = 0; z < c.nz; z++)
+    {
+        RE_f32 pz = d->oz + d->sz * (RE_f32)(c.z0 + z);
+
+        for (int y = 0; y < c.ny; y++)
+        {
+            RE_f32 py  = d->oy + d->sy * (RE_f32)(c.y0 + y);
+            RE_f32 *row = c.out + (size_t)z * c.slice_pitch + (size_t)y * c.row_pitch;
+
+            for (int x = 0; x < c.nx; x += RE_NOISE_GEN_MAX_ROW)
+            {
+                int n = (c.nx - x < RE_NOISE_GEN_MAX_ROW) ? c.nx - x : RE_NOISE_GEN_MAX_ROW;
+
+                if (d->point_fn)
+                {
+                    for (int i = 0; i < n; i++)
+                        row[x + i] = d->point_fn(ctx, d->user, d->ox + d->sx * (RE_f32)(c.x0 + x + i), py, pz);
+                    continue;
+                }
+
+                for (int i = 0; i < n; i++)
+                {
+                    xs[i] = d->ox + d->sx * (RE_f32)(c.x0 + x + i);
+                    ys[i] = py;
+                    zs[i] = pz;
+                }
+                if (d->graph)
+                    RE_NOISE_GRAPH_EVAL_CTX_f32(d->graph, ctx, xs, ys, zs, row + x, n);
+                else
+                    RE_NOISE_FRACTAL3_BATCH_CTX_f32(ctx, d->fractal, xs, ys, zs, row + x, n);
+            }
+        }
+    }
+}
+
+/* ============================================================================================
+   SCHEDULER (range stealing)
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_GEN_JOB_INIT(RE_NOISE_GEN_JOB *job, const RE_NOISE_GEN_DESC *desc, int workers)
+{
+    int wx, wy, wz;
+
+    job->desc = *desc;
+    if (job->desc.nz < 1) job->desc.nz = 1;
+    RE_NOISE_GEN_CHUNK_DIMS(&job->desc, &wx, &wy, &wz);
+
+    job->cx = (job->desc.nx + wx - 1) / wx;
+    job->cy = (job->desc.ny + wy - 1) / wy;
+    job->cz = (job->desc.nz + wz - 1) / wz;
+    job->chunk_count = job->cx * job->cy * job->cz;
+
+    if (workers < 1) workers = 1;
+    if (workers > RE_NOISE_GEN_MAX_THREADS) workers = RE_NOISE_GEN_MAX_THREADS;
+    job->worker_count = workers;
+
+    job->chunks_done    = 0;
+    job->cancel         = 0;
+    job->workers_active = 0;
+
+    /* Contiguous runs keep neighbouring chunks (and their cache lines) on one worker */
+    for (int w = 0; w < workers; w++)
+    {
+        int b = (int)((RE_i64)job->chunk_count * w / workers);
+        int e = (int)((RE_i64)job->chunk_count * (w + 1) / workers);
+        job->ranges[w].run = RE_NOISE_GEN_PACK_RUN(b, e);
+    }
+}
+
+/* Pop the front of our own run; -1 when it is empty */
+RE_INLINE int RE_NOISE_GEN_POP_(RE_NOISE_GEN_RANGE *r)
+{
+    for (;;)
+    {
+        RE_u64 run = RE_ATOMIC_LOAD_U64(&r->run);
+        RE_u32 b = (RE_u32)run, e = (RE_u32)(run >> 32);
+        if (b >= e) return -1;
+        if (RE_ATOMIC_CAS_U64(&r->run, run, RE_NOISE_GEN_PACK_RUN(b + 1, e))) return (int)b;
+    }
+}
+
+/* Move the back half of some other worker's run into ours; RE_FALSE when every run is empty */
+RE_INLINE RE_BOOL RE_NOISE_GEN_STEAL_(RE_NOISE_GEN_JOB *job, int self)
+{
+    for (int k = 1; k < job->worker_count; k++)
+    {
+        RE_NOISE_GEN_RANGE *v = &job->ranges[(self + k) % job->worker_count];
+
+        for (;;)
+        {
+            RE_u64 run = RE_ATOMIC_LOAD_U64(&v->run);
+            RE_u32 b = (RE_u32)run, e = (RE_u32)(run >> 32);
+            if (b >= e) break;
+
+            RE_u32 mid = e - (e - b + 1) / 2;
+            if (RE_ATOMIC_CAS_U64(&v->run, run, RE_NOISE_GEN_PACK_RUN(b, mid)))
+            {
+                RE_ATOMIC_STORE_U64(&job->ranges[self].run, RE_NOISE_GEN_PACK_RUN(mid, e));
+                return RE_TRUE;
+            }
+        }
+    }
+    return RE_FALSE;
+}
+
+/**
+ * @brief Worker body: drain our run, then steal until no work is left or the job is cancelled.
+ */
+RE_INLINE void RE_NOISE_GEN_WORK(RE_NOISE_GEN_JOB *job, int self)
+{
+    while (!RE_ATOMIC_LOAD_i32(&job->cancel))
+    {
+        int c = RE_NOISE_GEN_POP_(&job->ranges[self]);
+        if (c < 0)
+        {
+            if (!RE_NOISE_GEN_STEAL_(job, self)) break;
+            continue;
+        }
+        RE_NOISE_GEN_RUN_CHUNK(job, c);
+        RE_ATOMIC_ADD_i32(&job->chunks_done, 1);
+    }
+}
+
+/* ============================================================================================
+   THREAD POOL
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_POOL_THREAD_(void *arg)
+{
+    RE_NOISE_POOL_WORKER *w = (RE_NOISE_POOL_WORKER *)arg;
+    RE_NOISE_POOL *pool = w->pool;
+    RE_u32 seen = 0;
+
+    RE_MUTEX_LOCK(&pool->lock);
+    for (;;)
+    {
+        while (!pool->shutdown && pool->generation == seen)
+            RE_COND_WAIT(&pool->wake, &pool->lock);
+        if (pool->shutdown) break;
+
+        seen = pool->generation;
+        RE_NOISE_GEN_JOB *job = pool->job;
+        RE_MUTEX_UNLOCK(&pool->lock);
+
+        RE_NOISE_GEN_WORK(job, w->index);
+
+        RE_MUTEX_LOCK(&pool->lock);
+        if (RE_ATOMIC_ADD_i32(&job->workers_active, -1) == 0)
+            RE_COND_BROADCAST(&pool->idle);
+    }
+    RE_MUTEX_UNLOCK(&pool->lock);
+}
+
+/**
+ * @brief Start `thread_count` workers (0 = one per hardware thread). Returns RE_FALSE on failure.
+ */
+RE_INLINE RE_BOOL RE_NOISE_POOL_CREATE(RE_NOISE_POOL *pool, int thread_count)
+{
+    if (thread_count <= 0) thread_count = RE_THREAD_HARDWARE_CONCURRENCY();
+    if (thread_count > RE_NOISE_GEN_MAX_THREADS) thread_count = RE_NOISE_GEN_MAX_THREADS;
+
+    RE_MUTEX_INIT(&pool->lock);
+    RE_COND_INIT(&pool->wake);
+    RE_COND_INIT(&pool->idle);
+    pool->job          = NULL;
+    pool->generation   = 0;
+    pool->shutdown     = RE_FALSE;
+    pool->thread_count = 0;
+
+    for (int i = 0; i < thread_count; i++)
+    {
+        RE_NOISE_POOL_WORKER *w = &pool->workers[i];
+        w->pool  = pool;
+        w->index = i;
+        if (!RE_THREAD_START(&w->thread, RE_NOISE_POOL_THREAD_, w)) break;
+        pool->thread_count++;
+    }
+    return pool->thread_count == thread_count;
+}
+
+/**
+ * @brief Stop and join all workers. Any running job must have been waited on first.
+ */
+RE_INLINE void RE_NOISE_POOL_DESTROY(RE_NOISE_POOL *pool)
+{
+    RE_MUTEX_LOCK(&pool->lock);
+    pool->shutdown = RE_TRUE;
+    RE_COND_BROADCAST(&pool->wake);
+    RE_MUTEX_UNLOCK(&pool->lock);
+
+    for (int i = 0; i < pool->thread_count; i++)
+        RE_THREAD_JOIN(&pool->workers[i].thread);
+
+    RE_COND_DESTROY(&pool->idle);
+    RE_COND_DESTROY(&pool->wake);
+    RE_MUTEX_DESTROY(&pool->lock);
+}
+
+/* ============================================================================================
+   JOB API
+   ============================================================================================ */
+
+/**
+ * @brief Queue `desc` on the pool and return immediately. One job runs per pool at a time;
+ *        returns RE_FALSE if the pool is busy or has no workers. `job` must outlive the run.
+ */
+RE_INLINE RE_BOOL RE_NOISE_GEN_START(RE_NOISE_POOL *pool, RE_NOISE_GEN_JOB *job, const RE_NOISE_GEN_DESC *desc)
+{
+    RE_BOOL ok = RE_FALSE;
+
+    RE_MUTEX_LOCK(&pool->lock);
+    if (pool->job == NULL && pool->thread_count > 0)
+    {
+        RE_NOISE_GEN_JOB_INIT(job, desc, pool->thread_count);
+        job->workers_active = pool->thread_count;
+        pool->job = job;
+        pool->generation++;
+        RE_COND_BROADCAST(&pool->wake);
+        ok = RE_TRUE;
+    }
+    RE_MUTEX_UNLOCK(&pool->lock);
+    return ok;
+}
+
+/**
+ * @brief Block until every worker has left the job. Returns RE_TRUE if all chunks were written,
+ *        RE_FALSE if it was cancelled first (chunks that finished are still valid).
+ */
+RE_INLINE RE_BOOL RE_NOISE_GEN_WAIT(RE_NOISE_POOL *pool, RE_NOISE_GEN_JOB *job)
+{
+    RE_MUTEX_LOCK(&pool->lock);
+    while (RE_ATOMIC_LOAD_i32(&job->workers_active) > 0)
+        RE_COND_WAIT(&pool->idle, &pool->lock);
+    if (pool->job == job) pool->job = NULL;
+    RE_MUTEX_UNLOCK(&pool->lock);
+
+    return RE_ATOMIC_LOAD_i32(&job->chunks_done) == job->chunk_count;
+}
+
+/** @brief Ask the workers to stop after their current chunk. Safe from any thread. */
+RE_INLINE void RE_NOISE_GEN_CANCEL(RE_NOISE_GEN_JOB *job)
+{
+    RE_ATOMIC_STORE_i32(&job->cancel, 1);
+}
+
+RE_INLINE int RE_NOISE_GEN_CHUNKS_DONE(RE_NOISE_GEN_JOB *job)
+{
+    return RE_ATOMIC_LOAD_i32(&job->chunks_done);
+}
+
+/** @brief Fraction of chunks finished, 0..1. */
+RE_INLINE RE_f32 RE_NOISE_GEN_PROGRESS(RE_NOISE_GEN_JOB *job)
+{
+    return job->chunk_count ? (RE_f32)RE_NOISE_GEN_CHUNKS_DONE(job) / (RE_f32)job->chunk_count : 1.0f;
+}
+
+/** @brief RE_TRUE once no worker is inside the job (finished or cancelled). */
+RE_INLINE RE_BOOL RE_NOISE_GEN_IS_DONE(RE_NOISE_GEN_JOB *job)
+{
+    return RE_ATOMIC_LOAD_i32(&job->workers_active) == 0;
+}
+
+/**
+ * @brief Synchronous generate. With pool == NULL the chunks run on the calling thread.
+ */
+RE_INLINE RE_BOOL RE_NOISE_GEN_RUN(RE_NOISE_POOL *pool, const RE_NOISE_GEN_DESC *desc)
+{
+    RE_NOISE_GEN_JOB job;
+
+    if (pool == NULL)
+    {
+        RE_NOISE_GEN_JOB_INIT(&job, desc, 1);
+        RE_NOISE_GEN_WORK(&job, 0);
+        return job.chunks_done == job.chunk_count;
+    }
+
+    if (!RE_NOISE_GEN_START(pool, &job, desc)) return RE_FALSE;
+    return RE_NOISE_GEN_WAIT(pool, &job);
+}
+
+#endif /* RE_NOISE_GEN_H */
@@ -0,0 +1,504 @@
+/**
+ * @file re_noise_graph.h
+ * @brief Noise graphs: compose sources, warps and remaps, evaluate them fused per tile.
+ *
+ * A graph is a list of nodes (noise / fractal / cellular sources, coordinate
+ * warps, arithmetic, clamp, remap, curve, select). Nodes only reference nodes
+ * created before them, so the node list is already a valid evaluation order
+ * and cycles cannot be built.
+ *
+ * RE_NOISE_GRAPH_COMPILE keeps the nodes the output depends on and gives each
+ * intermediate a tile buffer, reusing a buffer as soon as its last reader has
+ * run. Evaluation then walks the input RE_NOISE_GRAPH_TILE samples at a time:
+ * every node runs over the whole tile (through the SIMD batch kernels for the
+ * noise sources) before the next node starts, and all intermediates stay in
+ * a few KB of stack instead of full-size buffers streamed through memory once
+ * per stage.
+ *
+ * Typical use (warped, remapped FBM):
+ *
+ *   RE_NOISE_GRAPH g;                RE_NOISE_GRAPH_INIT(&g);
+ *   int w  = RE_NOISE_GRAPH_NOISE(&g, RE_NOISE_BASIS_OS3D_FAST, 0.5f,
+ *                                 RE_NOISE_GRAPH_X, RE_NOISE_GRAPH_Y, RE_NOISE_GRAPH_Z);
+ *   int wx = RE_NOISE_GRAPH_WARP(&g, RE_NOISE_GRAPH_X, w, 2.0f);
+ *   int f  = RE_NOISE_GRAPH_FRACTAL(&g, &fbm, 1.0f, wx, RE_NOISE_GRAPH_Y, RE_NOISE_GRAPH_Z);
+ *   int h  = RE_NOISE_GRAPH_REMAP(&g, f, -1.0f, 1.0f, 0.0f, 255.0f);
+ *   RE_NOISE_GRAPH_COMPILE(&g, h);
+ *   RE_NOISE_GRAPH_FILL_GRID_f32(&g, out, ox, oy, oz, sx, sy, sz, nx, ny, nz);
+ *
+ * Builders return the new node's index, or -1 when the graph is full or an
+ * input is invalid (a -1 input propagates, so a chain can be checked once at
+ * the end). A compiled graph is read-only during evaluation: any number of
+ * threads may evaluate it at once (it is also a RE_NOISE_GEN_DESC source).
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_NOISE_GRAPH_H
+#define RE_NOISE_GRAPH_H
+
+#include "re_core.h"
+#include "re_math_ext.h"
+#include "re_noise.h"
+#include "re_noise_cellular.h"
+
+#include <string.h>
+
+#define RE_NOISE_GRAPH_MAX_NODES     64
+#define RE_NOISE_GRAPH_MAX_SLOTS     16     /* live intermediates at any one time            */
+#define RE_NOISE_GRAPH_MAX_CURVE     16     /* control points per CURVE node                  */
+#define RE_NOISE_GRAPH_TILE          256    /* samples per tile: 1 KB per intermediate        */
+
+/* Sample coordinates: always nodes 0, 1, 2 */
+#define RE_NOISE_GRAPH_X             0
+#define RE_NOISE_GRAPH_Y             1
+#define RE_NOISE_GRAPH_Z             2
+
+/* Node ops (a, b, c = inputs; p[] = parameters) */
+#define RE_NOISE_NODE_POS_X          0
+#define RE_NOISE_NODE_POS_Y          1
+#define RE_NOISE_NODE_POS_Z          2
+#define RE_NOISE_NODE_CONST          3      /* p0                                             */
+#define RE_NOISE_NODE_FRACTAL        4      /* fractal(a, b, c) * p0 frequency                */
+#define RE_NOISE_NODE_WORLEY         5      /* Worley 3D of (a, b, c) * p0; p1 = output       */
+#define RE_NOISE_NODE_ADD            6
+#define RE_NOISE_NODE_SUB            7
+#define RE_NOISE_NODE_MUL            8
+#define RE_NOISE_NODE_MIN            9
+#define RE_NOISE_NODE_MAX            10
+#define RE_NOISE_NODE_SCALE_BIAS     11     /* a * p0 + p1                                    */
+#define RE_NOISE_NODE_WARP           12     /* a + b * p0 (coordinate + strength * offset)    */
+#define RE_NOISE_NODE_CLAMP          13     /* clamp(a, p0, p1)                               */
+#define RE_NOISE_NODE_REMAP          14     /* RE_REMAP_f32(a, p0, p1, p2, p3)                */
+#define RE_NOISE_NODE_CURVE          15     /* piecewise linear through the control points    */
+#define RE_NOISE_NODE_LERP           16     /* a + (b - a) * c                                */
+#define RE_NOISE_NODE_SELECT         17     /* a below threshold p0 of c, b above; p1 falloff */
+
+/* WORLEY node outputs */
+#define RE_NOISE_GRAPH_WORLEY_F1     0
+#define RE_NOISE_GRAPH_WORLEY_F2     1
+#define RE_NOISE_GRAPH_WORLEY_F2_F1  2
+
+typedef struct RE_NOISE_GRAPH_NODE_t {
+    int    op;                                  /* RE_NOISE_NODE_*                            */
+    int    in[3];                               /* input nodes, -1 = unused                   */
+    RE_f32 p[4];
+    RE_NOISE_FRACTAL_DESC fractal;              /* FRACTAL only                               */
+    int    curve_n;                             /* CURVE only                                 */
+    RE_f32 curve_x[RE_NOISE_GRAPH_MAX_CURVE];   /* ascending                                  */
+    RE_f32 curve_y[RE_NOISE_GRAPH_MAX_CURVE];
+} RE_NOISE_GRAPH_NODE;
+
+typedef struct RE_NOISE_GRAPH_t {
+    RE_NOISE_GRAPH_NODE nodes[RE_NOISE_GRAPH_MAX_NODES];
+    int count;
+
+    /* Filled by RE_NOISE_GRAPH_COMPILE */
+    int output;
+    int steps;                                  /* 0 = not compiled                           */
+    int order[RE_NOISE_GRAPH_MAX_NODES];        /* node evaluated at each step                */
+    int slot[RE_NOISE_GRAPH_MAX_NODES];         /* tile buffer per node, -1 = none            */
+    int slots;
+} RE_NOISE_GRAPH;
+
+/* Per-evaluation tile storage (lives on the evaluating thread's stack) */
+typedef struct RE_NOISE_GRAPH_TILES_t {
+    RE_f32 slot[RE_NOISE_GRAPH_MAX_SLOTS][RE_NOISE_GRAPH_TILE];
+    RE_f32 px[RE_NOISE_GRAPH_TILE], py[RE_NOISE_GRAPH_TILE], pz[RE_NOISE_GRAPH_TILE];
+    RE_f32 aux[RE_NOISE_GRAPH_TILE];
+} RE_NOISE_GRAPH_TILES;
+
+/* ============================================================================================
+   BUILDING
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_GRAPH_INIT(RE_NOISE_GRAPH *g)
+{
+    memset(g, 0, sizeof(*g));
+
+    for (int i = 0; i < 3; i++)
+    {
+        g->nodes[i].op = RE_NOISE_NODE_POS_X + i;
+        g->nodes[i].in[0] = g->nodes[i].in[1] = g->nodes[i].in[2] = -1;
+    }
+    g->count  = 3;
+    g->output = -1;
+}
+
+RE_INLINE int RE_NOISE_GRAPH_ADD_NODE_(RE_NOISE_GRAPH *g, int op, int a, int b, int c,
+                                       RE_f32 p0, RE_f32 p1, RE_f32 p2, RE_f32 p3)
+{
+    const int in[3] = { a, b, c };
+    const int needs = (op == RE_NOISE_NODE_CONST) ? 0
+                    : (op == RE_NOISE_NODE_FRACTAL || op == RE_NOISE_NODE_WORLEY ||
+                       op == RE_NOISE_NODE_LERP    || op == RE_NOISE_NODE_SELECT) ? 3
+                    : (op >= RE_NOISE_NODE_ADD && op <= RE_NOISE_NODE_MAX) || op == RE_NOISE_NODE_WARP ? 2 : 1;
+
+    if (g->count >= RE_NOISE_GRAPH_MAX_NODES) return -1;
+    for (int k = 0; k < needs; k++)
+        if (in[k] < 0 || in[k] >= g->count) return -1;
+
+    RE_NOISE_GRAPH_NODE *n = &g->nodes[g->count];
+    memset(n, 0, sizeof(*n));
+    n->op = op;
+    for (int k = 0; k < 3; k++)
+        n->in[k] = (k < needs) ? in[k] : -1;
+    n->p[0] = p0;  n->p[1] = p1;  n->p[2] = p2;  n->p[3] = p3;
+
+    g->steps = 0;                               /* any edit invalidates the compiled form     */
+    return g->count++;
+}
+
+RE_INLINE int RE_NOISE_GRAPH_CONST(RE_NOISE_GRAPH *g, RE_f32 v)
+{
+    return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_CONST, -1, -1, -1, v, 0.f, 0.f, 0.f);
+}
+
+/* Fractal over any basis at (x, y, z) * frequency */
+RE_INLINE int RE_NOISE_GRAPH_FRACTAL(RE_NOISE_GRAPH *g, const RE_NOISE_FRACTAL_DESC *d, RE_f32 frequency,
+                                     int x, int y, int z)
+{
+    int n = RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_FRACTAL, x, y, z, frequency, 0.f, 0.f, 0.f);
+    if (n >= 0) g->nodes[n].fractal = *d;
+    return n;
+}
+
+/* Single octave of a basis (RE_NOISE_BASIS_*) */
+RE_INLINE int RE_NOISE_GRAPH_NOISE(RE_NOISE_GRAPH *g, int basis, RE_f32 frequency, int x, int y, int z)
+{
+    RE_NOISE_FRACTAL_DESC d = { basis, RE_NOISE_FRACTAL_FBM, 1, 2.0f, 0.5f, 0.0f, 0.0f };
+    return RE_NOISE_GRAPH_FRACTAL(g, &d, frequency, x, y, z);
+}
+
+/* Cellular distance (RE_NOISE_GRAPH_WORLEY_*) at (x, y, z) * frequency */
+RE_INLINE int RE_NOISE_GRAPH_WORLEY(RE_NOISE_GRAPH *g, int output, RE_f32 frequency, int x, int y, int z)
+{
+    return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_WORLEY, x, y, z, frequency, (RE_f32)output, 0.f, 0.f);
+}
+
+RE_INLINE int RE_NOISE_GRAPH_ADD(RE_NOISE_GRAPH *g, int a, int b) { return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_ADD, a, b, -1, 0.f, 0.f, 0.f, 0.f); }
+RE_INLINE int RE_NOISE_GRAPH_SUB(RE_NOISE_GRAPH *g, int a, int b) { return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_SUB, a, b, -1, 0.f, 0.f, 0.f, 0.f); }
+RE_INLINE int RE_NOISE_GRAPH_MUL(RE_NOISE_GRAPH *g, int a, int b) { return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_MUL, a, b, -1, 0.f, 0.f, 0.f, 0.f); }
+RE_INLINE int RE_NOISE_GRAPH_MIN(RE_NOISE_GRAPH *g, int a, int b) { return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_MIN, a, b, -1, 0.f, 0.f, 0.f, 0.f); }
+RE_INLINE int RE_NOISE_GRAPH_MAX(RE_NOISE_GRAPH *g, int a, int b) { return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_MAX, a, b, -1, 0.f, 0.f, 0.f, 0.f); }
+
+RE_INLINE int RE_NOISE_GRAPH_SCALE_BIAS(RE_NOISE_GRAPH *g, int a, RE_f32 scale, RE_f32 bias)
+{
+    return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_SCALE_BIAS, a, -1, -1, scale, bias, 0.f, 0.f);
+}
+
+/* coord + strength * offset: feed the result to a source's coordinate input */
+RE_INLINE int RE_NOISE_GRAPH_WARP(RE_NOISE_GRAPH *g, int coord, int offset, RE_f32 strength)
+{
+    return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_WARP, coord, offset, -1, strength, 0.f, 0.f, 0.f);
+}
+
+RE_INLINE int RE_NOISE_GRAPH_CLAMP(RE_NOISE_GRAPH *g, int a, RE_f32 lo, RE_f32 hi)
+{
+    return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_CLAMP, a, -1, -1, lo, hi, 0.f, 0.f);
+}
+
+RE_INLINE int RE_NOISE_GRAPH_REMAP(RE_NOISE_GRAPH *g, int a, RE_f32 in_min, RE_f32 in_max,
+                                   RE_f32 out_min, RE_f32 out_max)
+{
+    return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_REMAP, a, -1, -1, in_min, in_max, out_min, out_max);
+}
+
+/* Piecewise-linear curve through (xs[i], ys[i]), xs ascending; flat beyond the end points */
+RE_INLINE int RE_NOISE_GRAPH_CURVE(RE_NOISE_GRAPH *g, int a, const RE_f32 *xs, const RE_f32 *ys, int count)
+{
+    if (count < 1 || count > RE_NOISE_GRAPH_MAX_CURVE) return -1;
+
+    int n = RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_CURVE, a, -1, -1, 0.f, 0.f, 0.f, 0.f);
+    if (n < 0) return -1;
+
+    g->nodes[n].curve_n = count;
+    for (int i = 0; i < count; i++)
+    {
+        g->nodes[n].curve_x[i] = xs[i];
+        g->nodes[n].curve_y[i] = ys[i];
+    }
+    return n;
+}
+
+RE_INLINE int RE_NOISE_GRAPH_LERP(RE_NOISE_GRAPH *g, int a, int b, int t)
+{
+    return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_LERP, a, b, t, 0.f, 0.f, 0.f, 0.f);
+}
+
+/* a where control < threshold, b above it, smoothstep blend over threshold +- falloff */
+RE_INLINE int RE_NOISE_GRAPH_SELECT(RE_NOISE_GRAPH *g, int a, int b, int control,
+                                    RE_f32 threshold, RE_f32 falloff)
+{
+    return RE_NOISE_GRAPH_ADD_NODE_(g, RE_NOISE_NODE_SELECT, a, b, control, threshold, falloff, 0.f, 0.f);
+}
+
+/* ============================================================================================
+   COMPILING
+   Live nodes in index order; a node's tile buffer is allocated before its inputs' buffers
+   are released, so no node ever writes over a tile it reads.
+   ============================================================================================ */
+
+RE_INLINE RE_BOOL RE_NOISE_GRAPH_COMPILE(RE_NOISE_GRAPH *g, int output)
+{
+    RE_BOOL live[RE_NOISE_GRAPH_MAX_NODES];
+    int     last_use[RE_NOISE_GRAPH_MAX_NODES];
+    int     busy[RE_NOISE_GRAPH_MAX_SLOTS];
+
+    g->steps = 0;
+    if (output < 0 || output >= g->count || output >= RE_NOISE_GRAPH_MAX_NODES) return RE_FALSE;
+
+    memset(live, 0, sizeof(live));
+    live[output] = RE_TRUE;
+    for (int i = output; i >= 0; i--)
+        if (live[i])
+            for (int k = 0; k < 3; k++)
+                if (g->nodes[i].in[k] >= 0) live[g->nodes[i].in[k]] = RE_TRUE;
+
+    int steps = 0;
+    for (int i = 0; i <= output; i++)
+    {
+        last_use[i] = -1;
+        g->slot[i]  = -1;
+        if (live[i]) g->order[steps++] = i;
+    }
+
+    for (int s = 0; s < steps; s++)
+        for (int k = 0; k < 3; k++)
+            if (g->nodes[g->order[s]].in[k] >= 0) last_use[g->nodes[g->order[s]].in[k]] = s;
+
+    int used = 0;
+    for (int s = 0; s < steps; s++)
+    {
+        int i  = g->order[s];
+        int op = g->nodes[i].op;
+
+        /* Coordinates alias the caller's arrays; the output writes straight to out */
+        if (op > RE_NOISE_NODE_POS_Z && i != output)
+        {
+            int free_slot = -1;
+            for (int b = 0; b < used && free_slot < 0; b++)
+                if (busy[b] < 0) free_slot = b;
+
+            if (free_slot < 0)
+            {
+                if (used == RE_NOISE_GRAPH_MAX_SLOTS) return RE_FALSE;
+                free_slot = used++;
+            }
+            busy[free_slot] = i;
+            g->slot[i] = free_slot;
+        }
+
+        for (int k = 0; k < 3; k++)
+        {
+            int in = g->nodes[i].in[k];
+            if (in >= 0 && last_use[in] == s && g->slot[in] >= 0)
+                busy[g->slot[in]] = -1;
+        }
+    }
+
+    g->output = output;
+    g->slots  = used;
+    g->steps  = steps;
+    return RE_TRUE;
+}
+
+/* ============================================================================================
+   TILE KERNELS
+   ============================================================================================ */
+
+RE_INLINE RE_f32 RE_NOISE_GRAPH_CURVE_EVAL_f32(const RE_NOISE_GRAPH_NODE *n, RE_f32 v)
+{
+    const int last = n->curve_n - 1;
+
+    if (v <= n->curve_x[0])    return n->curve_y[0];
+    if (v >= n->curve_x[last]) return n->curve_y[last];
+
+    int k = 1;
+    while (v > n->curve_x[k]) k++;
+
+    RE_f32 t = (v - n->curve_x[k - 1]) / (n->curve_x[k] - n->curve_x[k - 1]);
+    return n->curve_y[k - 1] + (n->curve_y[k] - n->curve_y[k - 1]) * t;
+}
+
+RE_INLINE void RE_NOISE_GRAPH_RUN_TILE_(const RE_NOISE_GRAPH *g, const RE_NOISE_CONTEXT *ctx,
+                                        const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                        RE_f32 *out, int count, RE_NOISE_GRAPH_TILES *t)
+{
+    const RE_f32 *buf[RE_NOISE_GRAPH_MAX_NODES];
+
+    for (int s = 0; s < g->steps; s++)
+    {
+        const int idx = g->order[s];
+        const RE_NOISE_GRAPH_NODE *n = &g->nodes[idx];
+        const RE_f32 *a = n->in[0] >= 0 ? buf[n->in[0]] : NULL;
+        const RE_f32 *b = n->in[1] >= 0 ? buf[n->in[1]] : NULL;
+        const RE_f32 *c = n->in[2] >= 0 ? buf[n->in[2]] : NULL;
+
+        /* Coordinates are never copied unless they are the output */
+        if (n->op <= RE_NOISE_NODE_POS_Z)
+        {
+            const RE_f32 *p = (n->op == RE_NOISE_NODE_POS_X) ? x : (n->op == RE_NOISE_NODE_POS_Y) ? y : z;
+            if (idx == g->output) memcpy(out, p, (size_t)count * sizeof(RE_f32));
+            buf[idx] = p;
+            continue;
+        }
+
+        RE_f32 *dst = (idx == g->output) ? out : t->slot[g->slot[idx]];
+
+        switch (n->op)
+        {
+            case RE_NOISE_NODE_CONST:
+                for (int i = 0; i < count; i++) dst[i] = n->p[0];
+                break;
+
+            case RE_NOISE_NODE_FRACTAL:
+            case RE_NOISE_NODE_WORLEY:
+                for (int i = 0; i < count; i++)
+                {
+                    t->px[i] = a[i] * n->p[0];
+                    t->py[i] = b[i] * n->p[0];
+                    t->pz[i] = c[i] * n->p[0];
+                }
+
+                if (n->op == RE_NOISE_NODE_FRACTAL)
+                {
+                    RE_NOISE_FRACTAL3_BATCH_CTX_f32(ctx, &n->fractal, t->px, t->py, t->pz, dst, count);
+                }
+                else if ((int)n->p[1] == RE_NOISE_GRAPH_WORLEY_F1)
+                {
+                    RE_NOISE_WORLEY3_BATCH_CTX_f32(ctx, t->px, t->py, t->pz, dst, NULL, NULL, count);
+                }
+                else if ((int)n->p[1] == RE_NOISE_GRAPH_WORLEY_F2)
+                {
+                    RE_NOISE_WORLEY3_BATCH_CTX_f32(ctx, t->px, t->py, t->pz, NULL, dst, NULL, count);
+                }
+                else
+                {
+                    RE_NOISE_WORLEY3_BATCH_CTX_f32(ctx, t->px, t->py, t->pz, t->aux, dst, NULL, count);
+                    for (int i = 0; i < count; i++) dst[i] -= t->aux[i];
+                }
+                break;
+
+            case RE_NOISE_NODE_ADD: for (int i = 0; i < count; i++) dst[i] = a[i] + b[i]; break;
+            case RE_NOISE_NODE_SUB: for (int i = 0; i < count; i++) dst[i] = a[i] - b[i]; break;
+            case RE_NOISE_NODE_MUL: for (int i = 0; i < count; i++) dst[i] = a[i] * b[i]; break;
+            case RE_NOISE_NODE_MIN: for (int i = 0; i < count; i++) dst[i] = a[i] < b[i] ? a[i] : b[i]; break;
+            case RE_NOISE_NODE_MAX: for (int i = 0; i < count; i++) dst[i] = a[i] > b[i] ? a[i] : b[i]; break;
+
+            case RE_NOISE_NODE_SCALE_BIAS:
+                for (int i = 0; i < count; i++) dst[i] = a[i] * n->p[0] + n->p[1];
+                break;
+
+            case RE_NOISE_NODE_WARP:
+                for (int i = 0; i < count; i++) dst[i] = a[i] + b[i] * n->p[0];
+                break;
+
+            case RE_NOISE_NODE_CLAMP:
+                for (int i = 0; i < count; i++) dst[i] = RE_CLAMP_f32(a[i], n->p[0], n->p[1]);
+                break;
+
+            case RE_NOISE_NODE_REMAP:
+                for (int i = 0; i < count; i++) dst[i] = RE_REMAP_f32(a[i], n->p[0], n->p[1], n->p[2], n->p[3]);
+                break;
+
+            case RE_NOISE_NODE_CURVE:
+                for (int i = 0; i < count; i++) dst[i] = RE_NOISE_GRAPH_CURVE_EVAL_f32(n, a[i]);
+                break;
+
+            case RE_NOISE_NODE_LERP:
+                for (int i = 0; i < count; i++) dst[i] = a[i] + (b[i] - a[i]) * c[i];
+                break;
+
+            case RE_NOISE_NODE_SELECT:
+                for (int i = 0; i < count; i++)
+                {
+                    RE_f32 w = (n->p[1] > 0.0f)
+                             ? RE_SMOOTHSTP_f32(n->p[0] - n->p[1], n->p[0] + n->p[1], c[i])
+                             : (c[i] < n->p[0] ? 0.0f : 1.0f);
+                    dst[i] = a[i] + (b[i] - a[i]) * w;
+                }
+                break;
+
+            default:
+                for (int i = 0; i < count; i++) dst[i] = 0.0f;
+                break;
+        }
+
+        buf[idx] = dst;
+    }
+}
+
+/* ============================================================================================
+   EVALUATION
+   ============================================================================================ */
+
+/* SoA points: out[i] = graph(x[i], y[i], z[i]). No-op on an uncompiled graph. */
+RE_INLINE void RE_NOISE_GRAPH_EVAL_CTX_f32(const RE_NOISE_GRAPH *g, const RE_NOISE_CONTEXT *ctx,
+                                           const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                           RE_f32 *out, int count)
+{
+    RE_NOISE_GRAPH_TILES t;
+
+    if (g->steps == 0) return;
+
+    for (int i = 0; i < count; i += RE_NOISE_GRAPH_TILE)
+    {
+        int n = (count - i < RE_NOISE_GRAPH_TILE) ? count - i : RE_NOISE_GRAPH_TILE;
+        RE_NOISE_GRAPH_RUN_TILE_(g, ctx, x + i, y + i, z + i, out + i, n, &t);
+    }
+}
+
+RE_INLINE void RE_NOISE_GRAPH_EVAL_f32(const RE_NOISE_GRAPH *g, const RE_f32 *x, const RE_f32 *y,
+                                       const RE_f32 *z, RE_f32 *out, int count)
+{
+    RE_NOISE_GRAPH_EVAL_CTX_f32(g, &RE_NOISE_DEFAULT_CONTEXT, x, y, z, out, count);
+}
+
+/* Regular grid, out[(k * ny + j) * nx + i] = graph(ox + i*sx, oy + j*sy, oz + k*sz) */
+RE_INLINE void RE_NOISE_GRAPH_FILL_GRID_CTX_f32(const RE_NOISE_GRAPH *g, const RE_NOISE_CONTEXT *ctx,
+                                                RE_f32 *out,
+                                                RE_f32 ox, RE_f32 oy, RE_f32 oz,
+                                                RE_f32 sx, RE_f32 sy, RE_f32 sz,
+                                                int nx, int ny, int nz)
+{
+    RE_NOISE_GRAPH_TILES t;
+    RE_f32 xs[RE_NOISE_GRAPH_TILE], ys[RE_NOISE_GRAPH_TILE], zs[RE_NOISE_GRAPH_TILE];
+
+    if (g->steps == 0) return;
+
+    const size_t total = (size_t)nx * (size_t)ny * (size_t)(nz < 1 ? 1 : nz);
+    int i = 0, j = 0, k = 0;
+
+    /* Tiles run across row ends; coordinates come from the integer index */
+    for (size_t base = 0; base < total; base += RE_NOISE_GRAPH_TILE)
+    {
+        int n = (total - base < RE_NOISE_GRAPH_TILE) ? (int)(total - base) : RE_NOISE_GRAPH_TILE;
+
+        for (int s = 0; s < n; s++)
+        {
+            xs[s] = ox + (RE_f32)i * sx;
+            ys[s] = oy + (RE_f32)j * sy;
+            zs[s] = oz + (RE_f32)k * sz;
+
+            if (++i == nx)
+            {
+                i = 0;
+                if (++j == ny) { j = 0; k++; }
+            }
+        }
+
+        RE_NOISE_GRAPH_RUN_TILE_(g, ctx, xs, ys, zs, out + base, n, &t);
+    }
+}
+
+RE_INLINE void RE_NOISE_GRAPH_FILL_GRID_f32(const RE_NOISE_GRAPH *g, RE_f32 *out,
+                                            RE_f32 ox, RE_f32 oy, RE_f32 oz,
+                                            RE_f32 sx, RE_f32 sy, RE_f32 sz,
+                                            int nx, int ny, int nz)
+{
+    RE_NOISE_GRAPH_FILL_GRID_CTX_f32(g, &RE_NOISE_DEFAULT_CONTEXT, out, ox, oy, oz, sx, sy, sz, nx, ny, nz);
+}
+
+#endif /* RE_NOISE_GRAPH_H */
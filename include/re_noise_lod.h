@@ -0,0 +1,218 @@
+/**
+ * @file re_noise_lod.h
+ * @brief Level-of-detail pyramids of fractal noise (mip chains without recomputation).
+ *
+ * Level L samples the level 0 grid every 2^L samples per axis (step s * 2^L,
+ * ceil(n / 2^L) samples) and keeps only the octaves its grid can represent:
+ *
+ *   octave k is kept at level L while  freq[k] * max(s) * 2^L <= nyquist
+ *
+ * (at least one octave is always kept). Coarse levels therefore cost a
+ * fraction of the finest: fewer samples and fewer octaves.
+ *
+ * RE_NOISE_LOD_BUILD emits every level in one pass over the level 0 grid.
+ * A coarse sample sits on a fine one, and its value is the fine sample's
+ * partial sum after that level's octaves. Each row is evaluated in octave
+ * bands, coarse to fine, and the partial sums are stored on the way. The
+ * whole pyramid costs as much as level 0 alone.
+ * RE_NOISE_LOD_FILL_LEVEL evaluates a single level on its own (e.g. only the
+ * distant rings), at samples x octaves of that level.
+ *
+ * Levels are evaluated through RE_NOISE_FRACTAL3_BATCH_CTX_f32, so any basis and
+ * fractal type (FBM / turbulence / ridged, the RE_NOISE_VALUE3_FBM_f32 family and
+ * friends) works; amp_epsilon still applies. Output per level: x fastest,
+ * out[(z * ny + y) * nx + x]; 2D pyramids use nz = 1.
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_NOISE_LOD_H
+#define RE_NOISE_LOD_H
+
+#include "re_core.h"
+#include "re_noise.h"
+
+#define RE_NOISE_LOD_MAX_LEVELS   16
+#define RE_NOISE_LOD_ROW          256    /* samples per band evaluation */
+
+typedef struct RE_NOISE_LOD_DESC_t {
+    const RE_NOISE_FRACTAL_DESC *fractal;
+    const RE_NOISE_CONTEXT      *ctx;                       /* NULL = RE_NOISE_DEFAULT_CONTEXT    */
+    int    nx, ny, nz;                                      /* level 0 samples (2D: nz = 1)       */
+    RE_f32 ox, oy, oz;                                      /* coordinate of sample (0,0,0)       */
+    RE_f32 sx, sy, sz;                                      /* level 0 step                       */
+    int    levels;                                          /* 1 .. RE_NOISE_LOD_MAX_LEVELS       */
+    RE_f32 nyquist;                                         /* cycles per sample, 0 = 0.5         */
+    RE_f32 *out[RE_NOISE_LOD_MAX_LEVELS];                   /* one buffer per level               */
+} RE_NOISE_LOD_DESC;
+
+/* ============================================================================================
+   LEVEL GEOMETRY / OCTAVES
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_LOD_LEVEL_DIMS(const RE_NOISE_LOD_DESC *d, int level, int *nx, int *ny, int *nz)
+{
+    int m = (1 << level) - 1;
+    *nx = (d->nx + m) >> level;
+    *ny = (d->ny + m) >> level;
+    *nz = (d->nz > 1) ? (d->nz + m) >> level : 1;
+}
+
+/**
+ * @brief Octaves kept at `level`: the fractal's own count (after amp_epsilon), cut where the
+ *        octave frequency passes the level's Nyquist limit; at least 1.
+ */
+RE_INLINE int RE_NOISE_LOD_LEVEL_OCTAVES(const RE_NOISE_LOD_DESC *d, int level)
+{
+    RE_f32 freq[RE_NOISE_FRACTAL_MAX_OCTAVES], amp[RE_NOISE_FRACTAL_MAX_OCTAVES];
+    int K = RE_NOISE_FRACTAL_OCTAVES(d->fractal, freq, amp);
+
+    /* Largest step magnitude: a negative step is a mirrored axis, not a finer one */
+    RE_f32 ax = RE_FABS_f32(d->sx), ay = RE_FABS_f32(d->sy), az = RE_FABS_f32(d->sz);
+    RE_f32 s = (ax > ay) ? ax : ay;
+    if (d->nz > 1 && az > s) s = az;
+    s *= (RE_f32)(1 << level);
+
+    RE_f32 limit = (d->nyquist > 0.0f) ? d->nyquist : 0.5f;
+    int k = 0;
+    while (k < K && RE_FABS_f32(freq[k]) * s <= limit) k++;
+
+    return (k > 0 || K == 0) ? k : 1;
+}
+
+/* ============================================================================================
+   OCTAVE BANDS
+   ============================================================================================ */
+
+/* out[i] (+)= sum of octaves [k0, k1) at (x, y, z)[i]: the batch fractal restarted at octave k0
+   with coordinates scaled by freq[k0] and the result by amp[k0] / amp[0] */
+RE_INLINE void RE_NOISE_LOD_BAND_(const RE_NOISE_CONTEXT *ctx, const RE_NOISE_FRACTAL_DESC *f,
+                                  int k0, int k1, const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                  RE_f32 *out, int n, RE_BOOL accumulate)
+{
+    RE_f32 freq[RE_NOISE_FRACTAL_MAX_OCTAVES] = { 0 }, amp[RE_NOISE_FRACTAL_MAX_OCTAVES] = { 0 };
+    RE_f32 bx[RE_NOISE_LOD_ROW], by[RE_NOISE_LOD_ROW], bz[RE_NOISE_LOD_ROW], r[RE_NOISE_LOD_ROW];
+
+    RE_NOISE_FRACTAL_OCTAVES(f, freq, amp);
+
+    RE_NOISE_FRACTAL_DESC band = *f;
+    band.octaves     = k1 - k0;
+    band.amp_epsilon = 0.0f;
+
+    RE_f32 fs = freq[k0];
+    RE_f32 as = amp[k0] / amp[0];
+
+    if (k0 > 0)
+    {
+        for (int i = 0; i < n; i++) { bx[i] = x[i] * fs; by[i] = y[i] * fs; bz[i] = z[i] * fs; }
+        x = bx;  y = by;  z = bz;
+    }
+
+    RE_NOISE_FRACTAL3_BATCH_CTX_f32(ctx, &band, x, y, z, r, n);
+
+    if (accumulate) for (int i = 0; i < n; i++) out[i] += r[i] * as;
+    else            for (int i = 0; i < n; i++) out[i]  = r[i] * as;
+}
+
+/* ============================================================================================
+   BUILD
+   ============================================================================================ */
+
+/**
+ * @brief Fill out[0 .. levels-1] in one pass over the level 0 grid.
+ */
+RE_INLINE void RE_NOISE_LOD_BUILD(const RE_NOISE_LOD_DESC *d)
+{
+    const RE_NOISE_CONTEXT *ctx = d->ctx ? d->ctx : &RE_NOISE_DEFAULT_CONTEXT;
+    int levels = (d->levels < 1) ? 1 : (d->levels > RE_NOISE_LOD_MAX_LEVELS) ? RE_NOISE_LOD_MAX_LEVELS : d->levels;
+    int nz0    = (d->nz > 1) ? d->nz : 1;
+
+    int K[RE_NOISE_LOD_MAX_LEVELS + 1], lx[RE_NOISE_LOD_MAX_LEVELS], ly[RE_NOISE_LOD_MAX_LEVELS], lz[RE_NOISE_LOD_MAX_LEVELS];
+    for (int L = 0; L < levels; L++)
+    {
+        K[L] = RE_NOISE_LOD_LEVEL_OCTAVES(d, L);
+        RE_NOISE_LOD_LEVEL_DIMS(d, L, &lx[L], &ly[L], &lz[L]);
+    }
+    K[levels] = 0;
+
+    RE_f32 xs[RE_NOISE_LOD_ROW], ys[RE_NOISE_LOD_ROW], zs[RE_NOISE_LOD_ROW], sum[RE_NOISE_LOD_ROW];
+
+    for (int k = 0; k < nz0; k++)
+    {
+        RE_f32 pz = d->oz + d->sz * (RE_f32)k;
+
+        for (int j = 0; j < d->ny; j++)
+        {
+            RE_f32 py = d->oy + d->sy * (RE_f32)j;
+
+            /* Coarsest level this row belongs to */
+            int top = levels - 1;
+            while (top > 0 && ((j | k) & ((1 << top) - 1))) top--;
+
+            for (int x0 = 0; x0 < d->nx; x0 += RE_NOISE_LOD_ROW)
+            {
+                int n = (d->nx - x0 < RE_NOISE_LOD_ROW) ? d->nx - x0 : RE_NOISE_LOD_ROW;
+
+                for (int i = 0; i < n; i++)
+                {
+                    xs[i] = d->ox + d->sx * (RE_f32)(x0 + i);
+                    ys[i] = py;
+                    zs[i] = pz;
+                }
+
+                /* Band [K[L+1], K[L]) completes level L; rows below `top` start from octave 0 */
+                for (int L = top; L >= 0; L--)
+                {
+                    int k0 = (L == top) ? 0 : K[L + 1];
+                    if (K[L] > k0)
+                        RE_NOISE_LOD_BAND_(ctx, d->fractal, k0, K[L], xs, ys, zs, sum, n, L != top);
+                    else if (L == top)
+                        for (int i = 0; i < n; i++) sum[i] = 0.0f;
+
+                    RE_f32 *row = d->out[L] + ((size_t)(k >> L) * ly[L] + (size_t)(j >> L)) * lx[L];
+                    int step = 1 << L;
+                    for (int i = (step - x0 % step) % step; i < n; i += step)
+                        row[(x0 + i) >> L] = sum[i];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Fill out[level] only, evaluating that level's samples and octaves.
+ */
+RE_INLINE void RE_NOISE_LOD_FILL_LEVEL(const RE_NOISE_LOD_DESC *d, int level)
+{
+    const RE_NOISE_CONTEXT *ctx = d->ctx ? d->ctx : &RE_NOISE_DEFAULT_CONTEXT;
+    int nx, ny, nz;
+    RE_NOISE_LOD_LEVEL_DIMS(d, level, &nx, &ny, &nz);
+
+    RE_NOISE_FRACTAL_DESC f = *d->fractal;
+    f.octaves = RE_NOISE_LOD_LEVEL_OCTAVES(d, level);
+
+    RE_f32 scale = (RE_f32)(1 << level);
+    RE_f32 sx = d->sx * scale, sy = d->sy * scale, sz = d->sz * scale;
+    RE_f32 xs[RE_NOISE_LOD_ROW], ys[RE_NOISE_LOD_ROW], zs[RE_NOISE_LOD_ROW];
+
+    for (int k = 0; k < nz; k++)
+    for (int j = 0; j < ny; j++)
+    {
+        RE_f32 *row = d->out[level] + ((size_t)k * ny + j) * nx;
+
+        for (int x0 = 0; x0 < nx; x0 += RE_NOISE_LOD_ROW)
+        {
+            int n = (nx - x0 < RE_NOISE_LOD_ROW) ? nx - x0 : RE_NOISE_LOD_ROW;
+            for (int i = 0; i < n; i++)
+            {
+                xs[i] = d->ox + sx * (RE_f32)(x0 + i);
+                ys[i] = d->oy + sy * (RE_f32)j;
+                zs[i] = d->oz + sz * (RE_f32)k;
+            }
+            RE_NOISE_FRACTAL3_BATCH_CTX_f32(ctx, &f, xs, ys, zs, row + x0, n);
+        }
+    }
+}
+
+#endif /* RE_NOISE_LOD_H */
@@ -0,0 +1,567 @@
+/**
+ * @file re_noise_warp.h
+ * @brief Domain warping: base(p * fb + k * V(p * fw)) with a vector-valued warp V.
+ *
+ * V is a 3-channel Perlin or OpenSimplex2S field evaluated in one pass: the
+ * floor / skew, fade or attenuation terms and the corner hash are computed
+ * once per corner and shared by all channels. Each channel takes a different
+ * gradient from the same 32-bit corner hash:
+ *
+ *   channel 0   RE_HASH_TO_GRAD12(h)                (the scalar noise's gradient)
+ *   channel 1   ((h & 0xFFFF) * 12) >> 16
+ *   channel 2   RE_HASH_TO_GRAD12(h * 0x9e3779b9)
+ *
+ * so a 3-channel warp costs one hash per corner instead of three full noise
+ * evaluations. Channel 0 of the OpenSimplex2S field is RE_NOISE_OS3D_SMOOTH;
+ * the Perlin field always hashes with RE_HASH3D_PCG_SEED (channel 0 equals
+ * RE_NOISE_PERLIN3 in hash mode 3).
+ *
+ * The warped point is then sampled with any RE_NOISE_FRACTAL_DESC (one octave
+ * = plain noise). 2D warps use the same fields on the z = 0 plane and their
+ * first two channels.
+ *
+ * Entry points:
+ *   RE_NOISE_{PERLIN3,OS3D_SMOOTH}_VEC3_CTX_f32   vector field, one point
+ *   ..._VEC3_X4_CTX_f32_sse / _X8_CTX_f32_avx2    vector field, 4 / 8 points in lanes
+ *   RE_NOISE_WARP{2,3}_CTX_f32                    warped noise, one point
+ *   RE_NOISE_WARP3_COORDS_BATCH_CTX_f32           warped coordinates only (SoA)
+ *   RE_NOISE_WARP{2,3}_BATCH_CTX_f32              warped noise (SoA), tiles through the
+ *                                                 lane kernels and RE_NOISE_FRACTAL3_BATCH
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_NOISE_WARP_H
+#define RE_NOISE_WARP_H
+
+#include "re_core.h"
+#include "re_noise.h"
+
+/* Warp fields */
+#define RE_NOISE_WARP_PERLIN3        0
+#define RE_NOISE_WARP_OS3D_SMOOTH    1
+
+#define RE_NOISE_WARP_TILE           256    /* samples per batch tile */
+
+typedef struct RE_NOISE_WARP_DESC_t {
+    int    warp;                 /* RE_NOISE_WARP_*                                    */
+    RE_f32 warp_frequency;       /* fw                                                 */
+    RE_f32 strength;             /* k, in base-noise units of the unscaled coordinate  */
+    RE_f32 base_frequency;       /* fb                                                 */
+    RE_NOISE_FRACTAL_DESC base;  /* sampled at the warped point                        */
+} RE_NOISE_WARP_DESC;
+
+/* ============================================================================================
+   CHANNEL GRADIENTS
+   ============================================================================================ */
+
+RE_INLINE RE_u32 RE_NOISE_WARP_GRAD_CH1(RE_u32 h) { return ((h & 0xFFFFu) * 12u) >> 16; }
+RE_INLINE RE_u32 RE_NOISE_WARP_GRAD_CH2(RE_u32 h) { return RE_HASH_TO_GRAD12(h * 0x9e3779b9u); }
+
+/* ============================================================================================
+   VECTOR FIELDS — SCALAR
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_PERLIN3_VEC3_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                             RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out[3])
+{
+    RE_i32 X = RE_FASTFLOOR_f32(x);
+    RE_i32 Y = RE_FASTFLOOR_f32(y);
+    RE_i32 Z = RE_FASTFLOOR_f32(z);
+
+    RE_f32 xf = x - (RE_f32)X;
+    RE_f32 yf = y - (RE_f32)Y;
+    RE_f32 zf = z - (RE_f32)Z;
+
+    RE_f32 u = RE_NOISE_FADE_f32(xf);
+    RE_f32 v = RE_NOISE_FADE_f32(yf);
+    RE_f32 w = RE_NOISE_FADE_f32(zf);
+
+    /* d[channel][corner], corner = dx + 2*dy + 4*dz */
+    RE_f32 d[3][8];
+    for (int c = 0; c < 8; c++)
+    {
+        int dx = c & 1, dy = (c >> 1) & 1, dz = c >> 2;
+        RE_u32 h  = RE_HASH3D_PCG_SEED(ctx->seed, X + dx, Y + dy, Z + dz);
+        RE_f32 px = xf - (RE_f32)dx, py = yf - (RE_f32)dy, pz = zf - (RE_f32)dz;
+
+        d[0][c] = RE_NOISE_GRAD3_DOT_f32(RE_HASH_TO_GRAD12(h),       px, py, pz);
+        d[1][c] = RE_NOISE_GRAD3_DOT_f32(RE_NOISE_WARP_GRAD_CH1(h), px, py, pz);
+        d[2][c] = RE_NOISE_GRAD3_DOT_f32(RE_NOISE_WARP_GRAD_CH2(h), px, py, pz);
+    }
+
+    for (int k = 0; k < 3; k++)
+    {
+        RE_f32 y0 = RE_NOISE_LERP_f32(RE_NOISE_LERP_f32(d[k][0], d[k][1], u),
+                                      RE_NOISE_LERP_f32(d[k][2], d[k][3], u), v);
+        RE_f32 y1 = RE_NOISE_LERP_f32(RE_NOISE_LERP_f32(d[k][4], d[k][5], u),
+                                      RE_NOISE_LERP_f32(d[k][6], d[k][7], u), v);
+        out[k] = RE_NOISE_LERP_f32(y0, y1, w);
+    }
+}
+
+RE_INLINE void RE_NOISE_PERLIN3_VEC3_f32(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out[3])
+{
+    RE_NOISE_PERLIN3_VEC3_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out);
+}
+
+RE_INLINE void RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(const RE_NOISE_CONTEXT *ctx,
+                                                 RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out[3])
+{
+    RE_f32 r  = (2.0f / 3.0f) * (x + y + z);
+    RE_f32 xr = r - x;
+    RE_f32 yr = r - y;
+    RE_f32 zr = r - z;
+
+    RE_f32 v0 = 0.0f, v1 = 0.0f, v2 = 0.0f;
+
+    for (int l = 0; l < 2; l++)
+    {
+        RE_f32 ox = xr - 0.5f * l;
+        RE_f32 oy = yr - 0.5f * l;
+        RE_f32 oz = zr - 0.5f * l;
+
+        RE_i32 xb = (RE_i32)RE_FASTFLOOR_f32(ox);
+        RE_i32 yb = (RE_i32)RE_FASTFLOOR_f32(oy);
+        RE_i32 zb = (RE_i32)RE_FASTFLOOR_f32(oz);
+
+        RE_f32 fx = ox - xb;
+        RE_f32 fy = oy - yb;
+        RE_f32 fz = oz - zb;
+
+        for (int c = 0; c < 8; c++)
+        {
+            RE_i32 dx = c & 1, dy = (c >> 1) & 1, dz = c >> 2;
+
+            RE_f32 px = fx - dx;
+            RE_f32 py = fy - dy;
+            RE_f32 pz = fz - dz;
+
+            RE_f32 attn = 0.75f - (px*px + py*py + pz*pz);
+            if (attn > 0.0f)
+            {
+                RE_u32 h  = RE_OS3D_HASH_SEED(ctx->seed, 2 * (xb + dx) + l, 2 * (yb + dy) + l, 2 * (zb + dz) + l);
+                RE_f32 a2 = attn * attn;
+                RE_f32 a4 = a2 * a2;
+
+                v0 += a4 * RE_OS_DOT3_f32(RE_NOISE_GRAD3[RE_HASH_TO_GRAD12(h)],       px, py, pz);
+                v1 += a4 * RE_OS_DOT3_f32(RE_NOISE_GRAD3[RE_NOISE_WARP_GRAD_CH1(h)], px, py, pz);
+                v2 += a4 * RE_OS_DOT3_f32(RE_NOISE_GRAD3[RE_NOISE_WARP_GRAD_CH2(h)], px, py, pz);
+            }
+        }
+    }
+
+    out[0] = v0 * OS3D_SMOOTH_SCALE_F32;
+    out[1] = v1 * OS3D_SMOOTH_SCALE_F32;
+    out[2] = v2 * OS3D_SMOOTH_SCALE_F32;
+}
+
+RE_INLINE void RE_NOISE_OS3D_SMOOTH_VEC3_f32(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out[3])
+{
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, x, y, z, out);
+}
+
+/* ============================================================================================
+   VECTOR FIELDS — SSE (4 points in lanes)
+   ============================================================================================ */
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+RE_INLINE __m128i RE_NOISE_WARP_GRAD_CH1_X4_sse(__m128i h)
+{
+    __m128i t = _mm_and_si128(h, _mm_set1_epi32(0xFFFF));
+    t = _mm_add_epi32(_mm_slli_epi32(t, 3), _mm_slli_epi32(t, 2));
+    return _mm_srli_epi32(t, 16);
+}
+
+RE_INLINE __m128i RE_NOISE_WARP_GRAD_CH2_X4_sse(__m128i h)
+{
+    return RE_HASH_TO_GRAD12_X4_sse(RE_MULLO_X4_u32_sse(h, _mm_set1_epi32((int)0x9e3779b9u)));
+}
+
+RE_INLINE void RE_NOISE_PERLIN3_VEC3_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx,
+                                                    __m128 x, __m128 y, __m128 z, __m128 out[3])
+{
+    __m128  bx, by, bz;
+    __m128i X = RE_NOISE_FLOOR_X4_f32_sse(x, &bx);
+    __m128i Y = RE_NOISE_FLOOR_X4_f32_sse(y, &by);
+    __m128i Z = RE_NOISE_FLOOR_X4_f32_sse(z, &bz);
+
+    const __m128  one  = _mm_set1_ps(1.0f);
+    const __m128i ione = _mm_set1_epi32(1);
+
+    __m128 f[2][3];
+    f[0][0] = _mm_sub_ps(x, bx);  f[1][0] = _mm_sub_ps(f[0][0], one);
+    f[0][1] = _mm_sub_ps(y, by);  f[1][1] = _mm_sub_ps(f[0][1], one);
+    f[0][2] = _mm_sub_ps(z, bz);  f[1][2] = _mm_sub_ps(f[0][2], one);
+
+    __m128i c[2][3];
+    c[0][0] = X;  c[1][0] = _mm_add_epi32(X, ione);
+    c[0][1] = Y;  c[1][1] = _mm_add_epi32(Y, ione);
+    c[0][2] = Z;  c[1][2] = _mm_add_epi32(Z, ione);
+
+    __m128 u = RE_NOISE_FADE_X4_f32_sse(f[0][0]);
+    __m128 v = RE_NOISE_FADE_X4_f32_sse(f[0][1]);
+    __m128 w = RE_NOISE_FADE_X4_f32_sse(f[0][2]);
+
+    __m128 d[3][8];
+    for (int k = 0; k < 8; k++)
+    {
+        int dx = k & 1, dy = (k >> 1) & 1, dz = k >> 2;
+        __m128i h = RE_HASH3D_PCG_SEED_X4_sse(ctx->seed, c[dx][0], c[dy][1], c[dz][2]);
+
+        d[0][k] = RE_NOISE_GRAD3_DOT_X4_sse(RE_HASH_TO_GRAD12_X4_sse(h),      f[dx][0], f[dy][1], f[dz][2]);
+        d[1][k] = RE_NOISE_GRAD3_DOT_X4_sse(RE_NOISE_WARP_GRAD_CH1_X4_sse(h), f[dx][0], f[dy][1], f[dz][2]);
+        d[2][k] = RE_NOISE_GRAD3_DOT_X4_sse(RE_NOISE_WARP_GRAD_CH2_X4_sse(h), f[dx][0], f[dy][1], f[dz][2]);
+    }
+
+    for (int ch = 0; ch < 3; ch++)
+    {
+        __m128 y0 = RE_NOISE_LERP_X4_f32_sse(RE_NOISE_LERP_X4_f32_sse(d[ch][0], d[ch][1], u),
+                                             RE_NOISE_LERP_X4_f32_sse(d[ch][2], d[ch][3], u), v);
+        __m128 y1 = RE_NOISE_LERP_X4_f32_sse(RE_NOISE_LERP_X4_f32_sse(d[ch][4], d[ch][5], u),
+                                             RE_NOISE_LERP_X4_f32_sse(d[ch][6], d[ch][7], u), v);
+        out[ch] = RE_NOISE_LERP_X4_f32_sse(y0, y1, w);
+    }
+}
+
+RE_INLINE void RE_NOISE_OS3D_SMOOTH_VEC3_X4_CTX_f32_sse(const RE_NOISE_CONTEXT *ctx,
+                                                        __m128 x, __m128 y, __m128 z, __m128 out[3])
+{
+    __m128 r  = _mm_mul_ps(_mm_set1_ps(2.0f / 3.0f), _mm_add_ps(_mm_add_ps(x, y), z));
+    __m128 xr = _mm_sub_ps(r, x);
+    __m128 yr = _mm_sub_ps(r, y);
+    __m128 zr = _mm_sub_ps(r, z);
+
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 rad = _mm_set1_ps(0.75f);
+    __m128 val[3] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+
+    for (int l = 0; l < 2; l++)
+    {
+        __m128 sh = _mm_set1_ps(0.5f * l);
+        __m128 bx, by, bz;
+        __m128i xb = RE_NOISE_FLOOR_X4_f32_sse(_mm_sub_ps(xr, sh), &bx);
+        __m128i yb = RE_NOISE_FLOOR_X4_f32_sse(_mm_sub_ps(yr, sh), &by);
+        __m128i zb = RE_NOISE_FLOOR_X4_f32_sse(_mm_sub_ps(zr, sh), &bz);
+
+        __m128 f[2][3];
+        f[0][0] = _mm_sub_ps(_mm_sub_ps(xr, sh), bx);  f[1][0] = _mm_sub_ps(f[0][0], one);
+        f[0][1] = _mm_sub_ps(_mm_sub_ps(yr, sh), by);  f[1][1] = _mm_sub_ps(f[0][1], one);
+        f[0][2] = _mm_sub_ps(_mm_sub_ps(zr, sh), bz);  f[1][2] = _mm_sub_ps(f[0][2], one);
+
+        __m128i li = _mm_set1_epi32(l), two = _mm_set1_epi32(2);
+        __m128i c[2][3];
+        c[0][0] = _mm_add_epi32(_mm_slli_epi32(xb, 1), li);  c[1][0] = _mm_add_epi32(c[0][0], two);
+        c[0][1] = _mm_add_epi32(_mm_slli_epi32(yb, 1), li);  c[1][1] = _mm_add_epi32(c[0][1], two);
+        c[0][2] = _mm_add_epi32(_mm_slli_epi32(zb, 1), li);  c[1][2] = _mm_add_epi32(c[0][2], two);
+
+        for (int k = 0; k < 8; k++)
+        {
+            int dx = k & 1, dy = (k >> 1) & 1, dz = k >> 2;
+            __m128 px = f[dx][0], py = f[dy][1], pz = f[dz][2];
+
+            /* Shared per corner: attenuation and hash */
+            __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, px), _mm_mul_ps(py, py)), _mm_mul_ps(pz, pz));
+            __m128 a  = _mm_max_ps(_mm_sub_ps(rad, d2), _mm_setzero_ps());
+            a = _mm_mul_ps(a, a);
+            a = _mm_mul_ps(a, a);
+
+            __m128i h = RE_OS3D_HASH_SEED_X4_sse(ctx->seed, c[dx][0], c[dy][1], c[dz][2]);
+
+            val[0] = _mm_add_ps(val[0], _mm_mul_ps(a, RE_NOISE_GRAD3_DOT_X4_sse(RE_HASH_TO_GRAD12_X4_sse(h), px, py, pz)));
+            val[1] = _mm_add_ps(val[1], _mm_mul_ps(a, RE_NOISE_GRAD3_DOT_X4_sse(RE_NOISE_WARP_GRAD_CH1_X4_sse(h), px, py, pz)));
+            val[2] = _mm_add_ps(val[2], _mm_mul_ps(a, RE_NOISE_GRAD3_DOT_X4_sse(RE_NOISE_WARP_GRAD_CH2_X4_sse(h), px, py, pz)));
+        }
+    }
+
+    const __m128 s = _mm_set1_ps(OS3D_SMOOTH_SCALE_F32);
+    out[0] = _mm_mul_ps(val[0], s);
+    out[1] = _mm_mul_ps(val[1], s);
+    out[2] = _mm_mul_ps(val[2], s);
+}
+
+#endif
+
+/* ============================================================================================
+   VECTOR FIELDS — AVX2 (8 points in lanes)
+   ============================================================================================ */
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+
+RE_INLINE __m256i RE_NOISE_WARP_GRAD_CH1_X8_avx2(__m256i h)
+{
+    __m256i t = _mm256_and_si256(h, _mm256_set1_epi32(0xFFFF));
+    t = _mm256_add_epi32(_mm256_slli_epi32(t, 3), _mm256_slli_epi32(t, 2));
+    return _mm256_srli_epi32(t, 16);
+}
+
+RE_INLINE __m256i RE_NOISE_WARP_GRAD_CH2_X8_avx2(__m256i h)
+{
+    return RE_HASH_TO_GRAD12_X8_avx2(_mm256_mullo_epi32(h, _mm256_set1_epi32((int)0x9e3779b9u)));
+}
+
+RE_INLINE void RE_NOISE_PERLIN3_VEC3_X8_CTX_f32_avx2(const RE_NOISE_CONTEXT *ctx,
+                                                     __m256 x, __m256 y, __m256 z, __m256 out[3])
+{
+    __m256 bx = _mm256_floor_ps(x);
+    __m256 by = _mm256_floor_ps(y);
+    __m256 bz = _mm256_floor_ps(z);
+
+    const __m256  one  = _mm256_set1_ps(1.0f);
+    const __m256i ione = _mm256_set1_epi32(1);
+
+    __m256 f[2][3];
+    f[0][0] = _mm256_sub_ps(x, bx);  f[1][0] = _mm256_sub_ps(f[0][0], one);
+    f[0][1] = _mm256_sub_ps(y, by);  f[1][1] = _mm256_sub_ps(f[0][1], one);
+    f[0][2] = _mm256_sub_ps(z, bz);  f[1][2] = _mm256_sub_ps(f[0][2], one);
+
+    __m256i c[2][3];
+    c[0][0] = _mm256_cvttps_epi32(bx);  c[1][0] = _mm256_add_epi32(c[0][0], ione);
+    c[0][1] = _mm256_cvttps_epi32(by);  c[1][1] = _mm256_add_epi32(c[0][1], ione);
+    c[0][2] = _mm256_cvttps_epi32(bz);  c[1][2] = _mm256_add_epi32(c[0][2], ione);
+
+    __m256 u = RE_NOISE_FADE_X8_f32_avx(f[0][0]);
+    __m256 v = RE_NOISE_FADE_X8_f32_avx(f[0][1]);
+    __m256 w = RE_NOISE_FADE_X8_f32_avx(f[0][2]);
+
+    __m256 d[3][8];
+    for (int k = 0; k < 8; k++)
+    {
+        int dx = k & 1, dy = (k >> 1) & 1, dz = k >> 2;
+        __m256i h = RE_HASH3D_PCG_SEED_X8_avx2(ctx->seed, c[dx][0], c[dy][1], c[dz][2]);
+
+        d[0][k] = RE_NOISE_GRAD3_DOT_X8_avx2(RE_HASH_TO_GRAD12_X8_avx2(h),      f[dx][0], f[dy][1], f[dz][2]);
+        d[1][k] = RE_NOISE_GRAD3_DOT_X8_avx2(RE_NOISE_WARP_GRAD_CH1_X8_avx2(h), f[dx][0], f[dy][1], f[dz][2]);
+        d[2][k] = RE_NOISE_GRAD3_DOT_X8_avx2(RE_NOISE_WARP_GRAD_CH2_X8_avx2(h), f[dx][0], f[dy][1], f[dz][2]);
+    }
+
+    for (int ch = 0; ch < 3; ch++)
+    {
+        __m256 y0 = RE_NOISE_LERP_X8_f32_avx(RE_NOISE_LERP_X8_f32_avx(d[ch][0], d[ch][1], u),
+                                             RE_NOISE_LERP_X8_f32_avx(d[ch][2], d[ch][3], u), v);
+        __m256 y1 = RE_NOISE_LERP_X8_f32_avx(RE_NOISE_LERP_X8_f32_avx(d[ch][4], d[ch][5], u),
+                                             RE_NOISE_LERP_X8_f32_avx(d[ch][6], d[ch][7], u), v);
+        out[ch] = RE_NOISE_LERP_X8_f32_avx(y0, y1, w);
+    }
+}
+
+RE_INLINE void RE_NOISE_OS3D_SMOOTH_VEC3_X8_CTX_f32_avx2(const RE_NOISE_CONTEXT *ctx,
+                                                         __m256 x, __m256 y, __m256 z, __m256 out[3])
+{
+    __m256 r  = _mm256_mul_ps(_mm256_set1_ps(2.0f / 3.0f), _mm256_add_ps(_mm256_add_ps(x, y), z));
+    __m256 xr = _mm256_sub_ps(r, x);
+    __m256 yr = _mm256_sub_ps(r, y);
+    __m256 zr = _mm256_sub_ps(r, z);
+
+    __m256 one = _mm256_set1_ps(1.0f);
+    __m256 rad = _mm256_set1_ps(0.75f);
+    __m256 val[3] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+
+    for (int l = 0; l < 2; l++)
+    {
+        __m256 sh = _mm256_set1_ps(0.5f * l);
+        __m256 ox = _mm256_sub_ps(xr, sh);
+        __m256 oy = _mm256_sub_ps(yr, sh);
+        __m256 oz = _mm256_sub_ps(zr, sh);
+
+        __m256 bx = _mm256_floor_ps(ox);
+        __m256 by = _mm256_floor_ps(oy);
+        __m256 bz = _mm256_floor_ps(oz);
+
+        __m256 f[2][3];
+        f[0][0] = _mm256_sub_ps(ox, bx);  f[1][0] = _mm256_sub_ps(f[0][0], one);
+        f[0][1] = _mm256_sub_ps(oy, by);  f[1][1] = _mm256_sub_ps(f[0][1], one);
+        f[0][2] = _mm256_sub_ps(oz, bz);  f[1][2] = _mm256_sub_ps(f[0][2], one);
+
+        __m256i li = _mm256_set1_epi32(l), two = _mm256_set1_epi32(2);
+        __m256i c[2][3];
+        c[0][0] = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(bx), 1), li);
+        c[0][1] = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(by), 1), li);
+        c[0][2] = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvttps_epi32(bz), 1), li);
+        c[1][0] = _mm256_add_epi32(c[0][0], two);
+        c[1][1] = _mm256_add_epi32(c[0][1], two);
+        c[1][2] = _mm256_add_epi32(c[0][2], two);
+
+        for (int k = 0; k < 8; k++)
+        {
+            int dx = k & 1, dy = (k >> 1) & 1, dz = k >> 2;
+            __m256 px = f[dx][0], py = f[dy][1], pz = f[dz][2];
+
+            __m256 d2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(px, px), _mm256_mul_ps(py, py)),
+                                      _mm256_mul_ps(pz, pz));
+            __m256 a  = _mm256_max_ps(_mm256_sub_ps(rad, d2), _mm256_setzero_ps());
+            a = _mm256_mul_ps(a, a);
+            a = _mm256_mul_ps(a, a);
+
+            __m256i h = RE_OS3D_HASH_SEED_X8_avx2(ctx->seed, c[dx][0], c[dy][1], c[dz][2]);
+
+            val[0] = _mm256_add_ps(val[0], _mm256_mul_ps(a, RE_NOISE_GRAD3_DOT_X8_avx2(RE_HASH_TO_GRAD12_X8_avx2(h), px, py, pz)));
+            val[1] = _mm256_add_ps(val[1], _mm256_mul_ps(a, RE_NOISE_GRAD3_DOT_X8_avx2(RE_NOISE_WARP_GRAD_CH1_X8_avx2(h), px, py, pz)));
+            val[2] = _mm256_add_ps(val[2], _mm256_mul_ps(a, RE_NOISE_GRAD3_DOT_X8_avx2(RE_NOISE_WARP_GRAD_CH2_X8_avx2(h), px, py, pz)));
+        }
+    }
+
+    const __m256 s = _mm256_set1_ps(OS3D_SMOOTH_SCALE_F32);
+    out[0] = _mm256_mul_ps(val[0], s);
+    out[1] = _mm256_mul_ps(val[1], s);
+    out[2] = _mm256_mul_ps(val[2], s);
+}
+
+#endif
+
+/* ============================================================================================
+   WARPED NOISE — ONE POINT
+   ============================================================================================ */
+
+RE_INLINE void RE_NOISE_WARP_FIELD_CTX_f32(const RE_NOISE_CONTEXT *ctx, int warp,
+                                           RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 out[3])
+{
+    if (warp == RE_NOISE_WARP_OS3D_SMOOTH) RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x, y, z, out);
+    else                                   RE_NOISE_PERLIN3_VEC3_CTX_f32(ctx, x, y, z, out);
+}
+
+RE_INLINE RE_f32 RE_NOISE_WARP3_CTX_f32(const RE_NOISE_CONTEXT *ctx, const RE_NOISE_WARP_DESC *d,
+                                        RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_f32 v[3];
+    RE_NOISE_WARP_FIELD_CTX_f32(ctx, d->warp, x * d->warp_frequency, y * d->warp_frequency,
+                                z * d->warp_frequency, v);
+
+    return RE_NOISE_FRACTAL3_CTX_f32(ctx, &d->base, (x + d->strength * v[0]) * d->base_frequency,
+                                                    (y + d->strength * v[1]) * d->base_frequency,
+                                                    (z + d->strength * v[2]) * d->base_frequency);
+}
+
+RE_INLINE RE_f32 RE_NOISE_WARP3_f32(const RE_NOISE_WARP_DESC *d, RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    return RE_NOISE_WARP3_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, d, x, y, z);
+}
+
+RE_INLINE RE_f32 RE_NOISE_WARP2_CTX_f32(const RE_NOISE_CONTEXT *ctx, const RE_NOISE_WARP_DESC *d,
+                                        RE_f32 x, RE_f32 y)
+{
+    RE_f32 v[3];
+    RE_NOISE_WARP_FIELD_CTX_f32(ctx, d->warp, x * d->warp_frequency, y * d->warp_frequency, 0.0f, v);
+
+    return RE_NOISE_FRACTAL3_CTX_f32(ctx, &d->base, (x + d->strength * v[0]) * d->base_frequency,
+                                                    (y + d->strength * v[1]) * d->base_frequency, 0.0f);
+}
+
+RE_INLINE RE_f32 RE_NOISE_WARP2_f32(const RE_NOISE_WARP_DESC *d, RE_f32 x, RE_f32 y)
+{
+    return RE_NOISE_WARP2_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, d, x, y);
+}
+
+/* ============================================================================================
+   WARPED NOISE — BATCH
+   ============================================================================================ */
+
+/* wx[i], wy[i], wz[i] = base-space coordinates of the warped point (multiplied by fb) */
+RE_INLINE void RE_NOISE_WARP3_COORDS_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx, const RE_NOISE_WARP_DESC *d,
+                                                   const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                                   RE_f32 *wx, RE_f32 *wy, RE_f32 *wz, int count)
+{
+    const RE_f32 fw = d->warp_frequency, fb = d->base_frequency, k = d->strength;
+    int i = 0;
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+    {
+        const __m256 vfw = _mm256_set1_ps(fw), vfb = _mm256_set1_ps(fb), vk = _mm256_set1_ps(k);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 px = _mm256_loadu_ps(x + i), py = _mm256_loadu_ps(y + i), pz = _mm256_loadu_ps(z + i);
+            __m256 v[3];
+
+            if (d->warp == RE_NOISE_WARP_OS3D_SMOOTH)
+                RE_NOISE_OS3D_SMOOTH_VEC3_X8_CTX_f32_avx2(ctx, _mm256_mul_ps(px, vfw), _mm256_mul_ps(py, vfw),
+                                                          _mm256_mul_ps(pz, vfw), v);
+            else
+                RE_NOISE_PERLIN3_VEC3_X8_CTX_f32_avx2(ctx, _mm256_mul_ps(px, vfw), _mm256_mul_ps(py, vfw),
+                                                      _mm256_mul_ps(pz, vfw), v);
+
+            _mm256_storeu_ps(wx + i, _mm256_mul_ps(_mm256_add_ps(px, _mm256_mul_ps(vk, v[0])), vfb));
+            _mm256_storeu_ps(wy + i, _mm256_mul_ps(_mm256_add_ps(py, _mm256_mul_ps(vk, v[1])), vfb));
+            _mm256_storeu_ps(wz + i, _mm256_mul_ps(_mm256_add_ps(pz, _mm256_mul_ps(vk, v[2])), vfb));
+        }
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    {
+        const __m128 vfw = _mm_set1_ps(fw), vfb = _mm_set1_ps(fb), vk = _mm_set1_ps(k);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 px = _mm_loadu_ps(x + i), py = _mm_loadu_ps(y + i), pz = _mm_loadu_ps(z + i);
+            __m128 v[3];
+
+            if (d->warp == RE_NOISE_WARP_OS3D_SMOOTH)
+                RE_NOISE_OS3D_SMOOTH_VEC3_X4_CTX_f32_sse(ctx, _mm_mul_ps(px, vfw), _mm_mul_ps(py, vfw),
+                                                         _mm_mul_ps(pz, vfw), v);
+            else
+                RE_NOISE_PERLIN3_VEC3_X4_CTX_f32_sse(ctx, _mm_mul_ps(px, vfw), _mm_mul_ps(py, vfw),
+                                                     _mm_mul_ps(pz, vfw), v);
+
+            _mm_storeu_ps(wx + i, _mm_mul_ps(_mm_add_ps(px, _mm_mul_ps(vk, v[0])), vfb));
+            _mm_storeu_ps(wy + i, _mm_mul_ps(_mm_add_ps(py, _mm_mul_ps(vk, v[1])), vfb));
+            _mm_storeu_ps(wz + i, _mm_mul_ps(_mm_add_ps(pz, _mm_mul_ps(vk, v[2])), vfb));
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        RE_f32 v[3];
+        RE_NOISE_WARP_FIELD_CTX_f32(ctx, d->warp, x[i] * fw, y[i] * fw, z[i] * fw, v);
+        wx[i] = (x[i] + k * v[0]) * fb;
+        wy[i] = (y[i] + k * v[1]) * fb;
+        wz[i] = (z[i] + k * v[2]) * fb;
+    }
+}
+
+/* out[i] = RE_NOISE_WARP3_CTX_f32(ctx, d, x[i], y[i], z[i]) */
+RE_INLINE void RE_NOISE_WARP3_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx, const RE_NOISE_WARP_DESC *d,
+                                            const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                            RE_f32 *out, int count)
+{
+    RE_f32 wx[RE_NOISE_WARP_TILE], wy[RE_NOISE_WARP_TILE], wz[RE_NOISE_WARP_TILE];
+
+    for (int i = 0; i < count; i += RE_NOISE_WARP_TILE)
+    {
+        int n = (count - i < RE_NOISE_WARP_TILE) ? count - i : RE_NOISE_WARP_TILE;
+        RE_NOISE_WARP3_COORDS_BATCH_CTX_f32(ctx, d, x + i, y + i, z + i, wx, wy, wz, n);
+        RE_NOISE_FRACTAL3_BATCH_CTX_f32(ctx, &d->base, wx, wy, wz, out + i, n);
+    }
+}
+
+RE_INLINE void RE_NOISE_WARP3_BATCH_f32(const RE_NOISE_WARP_DESC *d,
+                                        const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                        RE_f32 *out, int count)
+{
+    RE_NOISE_WARP3_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, d, x, y, z, out, count);
+}
+
+/* out[i] = RE_NOISE_WARP2_CTX_f32(ctx, d, x[i], y[i]) */
+RE_INLINE void RE_NOISE_WARP2_BATCH_CTX_f32(const RE_NOISE_CONTEXT *ctx, const RE_NOISE_WARP_DESC *d,
+                                            const RE_f32 *x, const RE_f32 *y, RE_f32 *out, int count)
+{
+    RE_f32 zero[RE_NOISE_WARP_TILE];
+    RE_f32 wx[RE_NOISE_WARP_TILE], wy[RE_NOISE_WARP_TILE], wz[RE_NOISE_WARP_TILE];
+
+    for (int i = 0; i < RE_NOISE_WARP_TILE; i++) zero[i] = 0.0f;
+
+    for (int i = 0; i < count; i += RE_NOISE_WARP_TILE)
+    {
+        int n = (count - i < RE_NOISE_WARP_TILE) ? count - i : RE_NOISE_WARP_TILE;
+        RE_NOISE_WARP3_COORDS_BATCH_CTX_f32(ctx, d, x + i, y + i, zero, wx, wy, wz, n);
+        RE_NOISE_FRACTAL3_BATCH_CTX_f32(ctx, &d->base, wx, wy, zero, out + i, n);
+    }
+}
+
+RE_INLINE void RE_NOISE_WARP2_BATCH_f32(const RE_NOISE_WARP_DESC *d, const RE_f32 *x, const RE_f32 *y,
+                                        RE_f32 *out, int count)
+{
+    RE_NOISE_WARP2_BATCH_CTX_f32(&RE_NOISE_DEFAULT_CONTEXT, d, x, y, out, count);
+}
+
+#endif /* RE_NOISE_WARP_H */
@@ -0,0 +1,32 @@
+/**
+ * @file re_simd_detect.h
+ * @brief Compile-time SIMD level shared by the REMath SIMD headers.
+ *
+ * Exactly one of these is defined, from the compiler's target flags:
+ *
+ *   RE_SIMD_AVX    __AVX__ (the SSE paths are available too)
+ *   RE_SIMD_SSE    SSE2, or any MSVC build
+ *   RE_SIMD_NEON   ARM NEON
+ *   RE_SIMD_NONE   scalar fallback
+ *
+ * Finer features (__AVX2__, __SSE4_1__, AArch64) are tested where they are used. Intrinsic
+ * headers are included by the headers that need them, not here.
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_SIMD_DETECT_H
+#define RE_SIMD_DETECT_H
+
+#if defined(__AVX__)
+    #define RE_SIMD_AVX 1
+#elif defined(__SSE2__) || defined(_MSC_VER)
+    #define RE_SIMD_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define RE_SIMD_NEON 1
+#else
+    #define RE_SIMD_NONE 1
+#endif
+
+#endif /* RE_SIMD_DETECT_H */
@@ -0,0 +1,166 @@
+/**
+ * @file re_thread.h
+ * @brief Minimal threads, locks and atomics for the REMath generators.
+ *
+ * Thin wrappers over pthreads (POSIX) and the Win32 API, plus the handful of
+ * atomic operations the schedulers need (GCC/Clang __atomic builtins, MSVC
+ * Interlocked intrinsics). Everything is sequentially consistent; these are
+ * used for job bookkeeping, never inside per-sample loops.
+ *
+ * POSIX builds must link with -pthread (Threads::Threads in CMake).
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_THREAD_H
+#define RE_THREAD_H
+
+#include "re_core.h"
+
+#if defined(_WIN32)
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#  include <intrin.h>
+#else
+#  include <pthread.h>
+#  include <unistd.h>
+#endif
+
+/* ============================================================================================
+   THREADS / MUTEX / CONDITION VARIABLE
+   ============================================================================================ */
+
+typedef void (*RE_THREAD_FN)(void *arg);
+
+#if defined(_WIN32)
+
+typedef struct { HANDLE handle; RE_THREAD_FN fn; void *arg; } RE_THREAD;
+typedef SRWLOCK            RE_MUTEX;
+typedef CONDITION_VARIABLE RE_COND;
+
+RE_INLINE DWORD WINAPI RE_THREAD_ENTRY_(LPVOID p)
+{
+    RE_THREAD *t = (RE_THREAD *)p;
+    t->fn(t->arg);
+    return 0;
+}
+
+RE_INLINE RE_BOOL RE_THREAD_START(RE_THREAD *t, RE_THREAD_FN fn, void *arg)
+{
+    t->fn  = fn;
+    t->arg = arg;
+    t->handle = CreateThread(NULL, 0, RE_THREAD_ENTRY_, t, 0, NULL);
+    return t->handle != NULL;
+}
+
+RE_INLINE void RE_THREAD_JOIN(RE_THREAD *t)
+{
+    WaitForSingleObject(t->handle, INFINITE);
+    CloseHandle(t->handle);
+}
+
+RE_INLINE void RE_MUTEX_INIT(RE_MUTEX *m)    { InitializeSRWLock(m); }
+RE_INLINE void RE_MUTEX_DESTROY(RE_MUTEX *m) { (void)m; }
+RE_INLINE void RE_MUTEX_LOCK(RE_MUTEX *m)    { AcquireSRWLockExclusive(m); }
+RE_INLINE void RE_MUTEX_UNLOCK(RE_MUTEX *m)  { ReleaseSRWLockExclusive(m); }
+
+RE_INLINE void RE_COND_INIT(RE_COND *c)      { InitializeConditionVariable(c); }
+RE_INLINE void RE_COND_DESTROY(RE_COND *c)   { (void)c; }
+RE_INLINE void RE_COND_WAIT(RE_COND *c, RE_MUTEX *m) { SleepConditionVariableSRW(c, m, INFINITE, 0); }
+RE_INLINE void RE_COND_SIGNAL(RE_COND *c)    { WakeConditionVariable(c); }
+RE_INLINE void RE_COND_BROADCAST(RE_COND *c) { WakeAllConditionVariable(c); }
+
+RE_INLINE int RE_THREAD_HARDWARE_CONCURRENCY(void)
+{
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (int)si.dwNumberOfProcessors;
+}
+
+#else
+
+typedef struct { pthread_t handle; RE_THREAD_FN fn; void *arg; } RE_THREAD;
+typedef pthread_mutex_t RE_MUTEX;
+typedef pthread_cond_t  RE_COND;
+
+RE_INLINE void *RE_THREAD_ENTRY_(void *p)
+{
+    RE_THREAD *t = (RE_THREAD *)p;
+    t->fn(t->arg);
+    return NULL;
+}
+
+RE_INLINE RE_BOOL RE_THREAD_START(RE_THREAD *t, RE_THREAD_FN fn, void *arg)
+{
+    t->fn  = fn;
+    t->arg = arg;
+    return pthread_create(&t->handle, NULL, RE_THREAD_ENTRY_, t) == 0;
+}
+
+RE_INLINE void RE_THREAD_JOIN(RE_THREAD *t)  { pthread_join(t->handle, NULL); }
+
+RE_INLINE void RE_MUTEX_INIT(RE_MUTEX *m)    { pthread_mutex_init(m, NULL); }
+RE_INLINE void RE_MUTEX_DESTROY(RE_MUTEX *m) { pthread_mutex_destroy(m); }
+RE_INLINE void RE_MUTEX_LOCK(RE_MUTEX *m)    { pthread_mutex_lock(m); }
+RE_INLINE void RE_MUTEX_UNLOCK(RE_MUTEX *m)  { pthread_mutex_unlock(m); }
+
+RE_INLINE void RE_COND_INIT(RE_COND *c)      { pthread_cond_init(c, NULL); }
+RE_INLINE void RE_COND_DESTROY(RE_COND *c)   { pthread_cond_destroy(c); }
+RE_INLINE void RE_COND_WAIT(RE_COND *c, RE_MUTEX *m) { pthread_cond_wait(c, m); }
+RE_INLINE void RE_COND_SIGNAL(RE_COND *c)    { pthread_cond_signal(c); }
+RE_INLINE void RE_COND_BROADCAST(RE_COND *c) { pthread_cond_broadcast(c); }
+
+RE_INLINE int RE_THREAD_HARDWARE_CONCURRENCY(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+#endif
+
+/* ============================================================================================
+   ATOMICS (sequentially consistent)
+   ============================================================================================ */
+
+#if defined(_MSC_VER) && !defined(__clang__)
+
+RE_INLINE RE_i32 RE_ATOMIC_LOAD_i32(volatile RE_i32 *p)            { return (RE_i32)_InterlockedOr((volatile long *)p, 0); }
+RE_INLINE void   RE_ATOMIC_STORE_i32(volatile RE_i32 *p, RE_i32 v) { _InterlockedExchange((volatile long *)p, (long)v); }
+RE_INLINE RE_i32 RE_ATOMIC_ADD_i32(volatile RE_i32 *p, RE_i32 v)   { return (RE_i32)_InterlockedExchangeAdd((volatile long *)p, (long)v) + v; }
+
+RE_INLINE RE_u64 RE_ATOMIC_LOAD_U64(volatile RE_u64 *p)
+{
+    return (RE_u64)_InterlockedCompareExchange64((volatile __int64 *)p, 0, 0);
+}
+
+RE_INLINE void RE_ATOMIC_STORE_U64(volatile RE_u64 *p, RE_u64 v)
+{
+    _InterlockedExchange64((volatile __int64 *)p, (__int64)v);
+}
+
+RE_INLINE RE_BOOL RE_ATOMIC_CAS_U64(volatile RE_u64 *p, RE_u64 expected, RE_u64 desired)
+{
+    return (RE_u64)_InterlockedCompareExchange64((volatile __int64 *)p, (__int64)desired,
+                                                 (__int64)expected) == expected;
+}
+
+#else
+
+RE_INLINE RE_i32 RE_ATOMIC_LOAD_i32(volatile RE_i32 *p)            { return __atomic_load_n(p, __ATOMIC_SEQ_CST); }
+RE_INLINE void   RE_ATOMIC_STORE_i32(volatile RE_i32 *p, RE_i32 v) { __atomic_store_n(p, v, __ATOMIC_SEQ_CST); }
+RE_INLINE RE_i32 RE_ATOMIC_ADD_i32(volatile RE_i32 *p, RE_i32 v)   { return __atomic_add_fetch(p, v, __ATOMIC_SEQ_CST); }
+
+RE_INLINE RE_u64 RE_ATOMIC_LOAD_U64(volatile RE_u64 *p)            { return __atomic_load_n(p, __ATOMIC_SEQ_CST); }
+RE_INLINE void   RE_ATOMIC_STORE_U64(volatile RE_u64 *p, RE_u64 v) { __atomic_store_n(p, v, __ATOMIC_SEQ_CST); }
+
+RE_INLINE RE_BOOL RE_ATOMIC_CAS_U64(volatile RE_u64 *p, RE_u64 expected, RE_u64 desired)
+{
+    return __atomic_compare_exchange_n(p, &expected, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+#endif
+
+#endif /* RE_THREAD_H */
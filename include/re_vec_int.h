@@ -0,0 +1,429 @@
+/**
+ * @file re_vec_int.h
+ * @brief SIMD batch ops for RE_V2_i32 / RE_V3_i32 / RE_V4_i32 arrays (grid / voxel math).
+ *
+ * Every op here is component-wise, so an AoS array of packed i32 vectors is processed as one
+ * flat RE_i32 array of count * components lanes, with no transposes. Per-component operands
+ * (CLAMP bounds) are expanded into three rotated registers that repeat every 12 (SSE) or
+ * 24 (AVX2) lanes, which covers the period of 2, 3 and 4 components alike.
+ *
+ *   ADD SUB HADAMARD MIN MAX            vector (op) vector
+ *   SCALE                               vector * int
+ *   CLAMP                               per-component bounds, exact (RE_CLAMP goes through RE_f32)
+ *   SHL / SHR                           shift by s in [0, 31]; SHR is arithmetic
+ *   FLOORDIV_POW2 / FLOORMOD_POW2       floor(v / 2^s) and v - 2^s floor(v / 2^s), also for v < 0
+ *                                       (world coordinate -> chunk / cell within the chunk)
+ *   TO_f32 / FLOOR_FROM_f32             i32 -> f32, f32 -> floor as i32
+ *   LERP_Q16                            a + floor((b - a) t / 2^16), t in [0, 65536]
+ *
+ * Arithmetic wraps modulo 2^32, like the scalar functions. Paths: AVX2 8 lanes, SSE2 4 lanes
+ * (mullo / min / max / floor use SSE4.1 when available, else SSE2 sequences), scalar tail.
+ * Conversions run 8-wide on AVX as well, and the batch LERP needs SSE4.1 (pmuldq) to vectorize.
+ *
+ * RE_V*_LERP_Q16_i32 are the per-vector integer LERPs: 64-bit intermediates, no RE_f64.
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_VEC_INT_H
+#define RE_VEC_INT_H
+
+#include "re_core.h"
+#include "re_simd_detect.h"
+#include "re_vec.h"
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+#endif
+#if defined(RE_SIMD_AVX)
+#include <immintrin.h>
+#endif
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+    #define RE_VEC_INT_AVX2 1
+#endif
+
+/* ============================================================================================
+   PER-VECTOR INTEGER LERP
+   ============================================================================================ */
+
+/* a + floor((b - a) t / 2^16); t = 0 -> a, t = 65536 -> b */
+RE_INLINE RE_i32 RE_LERP_Q16_i32(RE_i32 a, RE_i32 b, RE_i32 t)
+{
+    RE_i64 d = (RE_i64)b - (RE_i64)a;
+    RE_i64 p = d * (RE_i64)t;
+    return (RE_i32)((RE_i64)a + ((p >= 0) ? (p >> 16) : ~(~p >> 16)));
+}
+
+RE_INLINE RE_V2_i32 RE_V2_LERP_Q16_i32(RE_V2_i32 a, RE_V2_i32 b, RE_i32 t)
+{
+    return RE_V2_MAKE_i32(RE_LERP_Q16_i32(a.x, b.x, t), RE_LERP_Q16_i32(a.y, b.y, t));
+}
+
+RE_INLINE RE_V3_i32 RE_V3_LERP_Q16_i32(RE_V3_i32 a, RE_V3_i32 b, RE_i32 t)
+{
+    return RE_V3_MAKE_i32(RE_LERP_Q16_i32(a.x, b.x, t), RE_LERP_Q16_i32(a.y, b.y, t),
+                          RE_LERP_Q16_i32(a.z, b.z, t));
+}
+
+RE_INLINE RE_V4_i32 RE_V4_LERP_Q16_i32(RE_V4_i32 a, RE_V4_i32 b, RE_i32 t)
+{
+    return RE_V4_MAKE_i32(RE_LERP_Q16_i32(a.x, b.x, t), RE_LERP_Q16_i32(a.y, b.y, t),
+                          RE_LERP_Q16_i32(a.z, b.z, t), RE_LERP_Q16_i32(a.w, b.w, t));
+}
+
+/* ============================================================================================
+   SCALAR LANE OPS
+   Shared by the tails and the non-SSE build. Wrapping arithmetic goes through RE_u32 to avoid
+   signed overflow; the result converts back with the wrap of re_core.h's signed integer model.
+   ============================================================================================ */
+
+RE_INLINE RE_i32 RE_VI_WRAP_(RE_u32 v) { return (RE_i32)v; }
+
+/* Arithmetic right shift, as srai (see the signed integer model in re_core.h) */
+RE_INLINE RE_i32 RE_VI_SRA_(RE_i32 v, int s) { return v >> s; }
+
+RE_INLINE RE_i32 RE_VI_FLOOR_f32_(RE_f32 x)
+{
+    RE_i32 t = (RE_i32)x;
+    return ((RE_f32)t > x) ? t - 1 : t;
+}
+
+/* ============================================================================================
+   SSE2 / SSE4.1 PRIMITIVES
+   ============================================================================================ */
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+RE_INLINE __m128i RE_VI_MULLO_X4_sse(__m128i a, __m128i b)
+{
+#if defined(__SSE4_1__)
+    return _mm_mullo_epi32(a, b);
+#else
+    __m128i p02 = _mm_mul_epu32(a, b);
+    __m128i p13 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(p02, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(p13, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+}
+
+RE_INLINE __m128i RE_VI_MIN_X4_sse(__m128i a, __m128i b)
+{
+#if defined(__SSE4_1__)
+    return _mm_min_epi32(a, b);
+#else
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+#endif
+}
+
+RE_INLINE __m128i RE_VI_MAX_X4_sse(__m128i a, __m128i b)
+{
+#if defined(__SSE4_1__)
+    return _mm_max_epi32(a, b);
+#else
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+#endif
+}
+
+RE_INLINE __m128i RE_VI_FLOOR_X4_sse(__m128 x)
+{
+#if defined(__SSE4_1__)
+    return _mm_cvttps_epi32(_mm_floor_ps(x));
+#else
+    __m128i t = _mm_cvttps_epi32(x);
+    return _mm_add_epi32(t, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(t), x)));   /* -1 where t > x */
+#endif
+}
+
+#endif
+
+/* ============================================================================================
+   FLAT ARRAY KERNELS
+   ============================================================================================ */
+
+/* Element-wise binary op over n lanes */
+#define RE_VI_BINARY_ARRAY_(NAME, OP256, OP128, SCALAR)                                              \
+    RE_INLINE void NAME(RE_i32 *out, const RE_i32 *a, const RE_i32 *b, int n)                        \
+    {                                                                                                \
+        int i = 0;                                                                                   \
+        RE_VI_BINARY_X8_(OP256)                                                                      \
+        RE_VI_BINARY_X4_(OP128)                                                                      \
+        for (; i < n; i++) out[i] = (SCALAR);                                                        \
+    }
+
+#if defined(RE_VEC_INT_AVX2)
+#define RE_VI_BINARY_X8_(OP256)                                                                      \
+    for (; i + 8 <= n; i += 8)                                                                       \
+        _mm256_storeu_si256((__m256i *)(out + i), OP256(_mm256_loadu_si256((const __m256i *)(a + i)), \
+                                                        _mm256_loadu_si256((const __m256i *)(b + i))));
+#else
+#define RE_VI_BINARY_X8_(OP256)
+#endif
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+#define RE_VI_BINARY_X4_(OP128)                                                                      \
+    for (; i + 4 <= n; i += 4)                                                                       \
+        _mm_storeu_si128((__m128i *)(out + i), OP128(_mm_loadu_si128((const __m128i *)(a + i)),       \
+                                                     _mm_loadu_si128((const __m128i *)(b + i))));
+#else
+#define RE_VI_BINARY_X4_(OP128)
+#endif
+
+RE_VI_BINARY_ARRAY_(RE_VI_ADD_ARRAY_i32, _mm256_add_epi32,   _mm_add_epi32,      RE_VI_WRAP_((RE_u32)a[i] + (RE_u32)b[i]))
+RE_VI_BINARY_ARRAY_(RE_VI_SUB_ARRAY_i32, _mm256_sub_epi32,   _mm_sub_epi32,      RE_VI_WRAP_((RE_u32)a[i] - (RE_u32)b[i]))
+RE_VI_BINARY_ARRAY_(RE_VI_MUL_ARRAY_i32, _mm256_mullo_epi32, RE_VI_MULLO_X4_sse, RE_VI_WRAP_((RE_u32)a[i] * (RE_u32)b[i]))
+RE_VI_BINARY_ARRAY_(RE_VI_MIN_ARRAY_i32, _mm256_min_epi32,   RE_VI_MIN_X4_sse,   (a[i] < b[i]) ? a[i] : b[i])
+RE_VI_BINARY_ARRAY_(RE_VI_MAX_ARRAY_i32, _mm256_max_epi32,   RE_VI_MAX_X4_sse,   (a[i] > b[i]) ? a[i] : b[i])
+
+#undef RE_VI_BINARY_ARRAY_
+#undef RE_VI_BINARY_X8_
+#undef RE_VI_BINARY_X4_
+
+/* out[i] = v[i] * s */
+RE_INLINE void RE_VI_SCALE_ARRAY_i32(RE_i32 *out, const RE_i32 *v, RE_i32 s, int n)
+{
+    int i = 0;
+#if defined(RE_VEC_INT_AVX2)
+    __m256i s8 = _mm256_set1_epi32(s);
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_si256((__m256i *)(out + i), _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i *)(v + i)), s8));
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    __m128i s4 = _mm_set1_epi32(s);
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_si128((__m128i *)(out + i), RE_VI_MULLO_X4_sse(_mm_loadu_si128((const __m128i *)(v + i)), s4));
+#endif
+    for (; i < n; i++) out[i] = RE_VI_WRAP_((RE_u32)v[i] * (RE_u32)s);
+}
+
+#define RE_VI_SHIFT_SHL   0
+#define RE_VI_SHIFT_SRA   1
+#define RE_VI_SHIFT_MASK  2     /* v & (2^s - 1) */
+
+/* Uniform shift / mask by s in [0, 31] */
+RE_INLINE void RE_VI_SHIFT_ARRAY_i32(RE_i32 *out, const RE_i32 *v, int s, int op, int n)
+{
+    RE_i32 mask = (RE_i32)((1u << s) - 1u);
+    int i = 0;
+#if defined(RE_VEC_INT_AVX2)
+    __m128i c8 = _mm_cvtsi32_si128(s);
+    __m256i m8 = _mm256_set1_epi32(mask);
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(v + i));
+        x = (op == RE_VI_SHIFT_SHL) ? _mm256_sll_epi32(x, c8)
+          : (op == RE_VI_SHIFT_SRA) ? _mm256_sra_epi32(x, c8) : _mm256_and_si256(x, m8);
+        _mm256_storeu_si256((__m256i *)(out + i), x);
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    __m128i c4 = _mm_cvtsi32_si128(s);
+    __m128i m4 = _mm_set1_epi32(mask);
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)(v + i));
+        x = (op == RE_VI_SHIFT_SHL) ? _mm_sll_epi32(x, c4)
+          : (op == RE_VI_SHIFT_SRA) ? _mm_sra_epi32(x, c4) : _mm_and_si128(x, m4);
+        _mm_storeu_si128((__m128i *)(out + i), x);
+    }
+#endif
+    for (; i < n; i++)
+        out[i] = (op == RE_VI_SHIFT_SHL) ? RE_VI_WRAP_((RE_u32)v[i] << s)
+               : (op == RE_VI_SHIFT_SRA) ? RE_VI_SRA_(v[i], s) : (v[i] & mask);
+}
+
+/* min(max(v, mn), mx) with per-component bounds: lane j uses component j % k (k = 2, 3, 4) */
+RE_INLINE void RE_VI_CLAMP_ARRAY_i32(RE_i32 *out, const RE_i32 *v, const RE_i32 *mn, const RE_i32 *mx,
+                                     int k, int n)
+{
+    RE_ALIGN(32) RE_i32 lo[24], hi[24];
+    for (int j = 0; j < 24; j++) { lo[j] = mn[j % k];  hi[j] = mx[j % k]; }
+
+    int i = 0;
+#if defined(RE_VEC_INT_AVX2)
+    __m256i l8[3], h8[3];
+    for (int r = 0; r < 3; r++)
+    {
+        l8[r] = _mm256_load_si256((const __m256i *)(lo + 8 * r));
+        h8[r] = _mm256_load_si256((const __m256i *)(hi + 8 * r));
+    }
+    for (; i + 24 <= n; i += 24)
+        for (int r = 0; r < 3; r++)
+        {
+            __m256i x = _mm256_loadu_si256((const __m256i *)(v + i + 8 * r));
+            _mm256_storeu_si256((__m256i *)(out + i + 8 * r), _mm256_min_epi32(_mm256_max_epi32(x, l8[r]), h8[r]));
+        }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    __m128i l4[3], h4[3];
+    for (int r = 0; r < 3; r++)
+    {
+        l4[r] = _mm_load_si128((const __m128i *)(lo + 4 * r));
+        h4[r] = _mm_load_si128((const __m128i *)(hi + 4 * r));
+    }
+    for (; i + 12 <= n; i += 12)
+        for (int r = 0; r < 3; r++)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)(v + i + 4 * r));
+            _mm_storeu_si128((__m128i *)(out + i + 4 * r), RE_VI_MIN_X4_sse(RE_VI_MAX_X4_sse(x, l4[r]), h4[r]));
+        }
+#endif
+    for (; i < n; i++)
+    {
+        RE_i32 x = (v[i] > lo[i % k]) ? v[i] : lo[i % k];
+        out[i] = (x < hi[i % k]) ? x : hi[i % k];
+    }
+}
+
+/* a + floor((b - a) t / 2^16), b - a taken modulo 2^32 */
+RE_INLINE void RE_VI_LERP_Q16_ARRAY_i32(RE_i32 *out, const RE_i32 *a, const RE_i32 *b, RE_i32 t, int n)
+{
+    int i = 0;
+#if defined(RE_VEC_INT_AVX2)
+    __m256i t8 = _mm256_set1_epi32(t);
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i d  = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *)(b + i)), va);
+        __m256i pe = _mm256_srli_epi64(_mm256_mul_epi32(d, t8), 16);                        /* lanes 0 2 4 6 */
+        __m256i po = _mm256_srli_epi64(_mm256_mul_epi32(_mm256_srli_epi64(d, 32), t8), 16); /* lanes 1 3 5 7 */
+        __m256i r  = _mm256_blend_epi32(pe, _mm256_slli_epi64(po, 32), 0xAA);
+        _mm256_storeu_si256((__m256i *)(out + i), _mm256_add_epi32(va, r));
+    }
+#endif
+#if defined(__SSE4_1__)
+    __m128i t4 = _mm_set1_epi32(t);
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i d  = _mm_sub_epi32(_mm_loadu_si128((const __m128i *)(b + i)), va);
+        __m128i pe = _mm_srli_epi64(_mm_mul_epi32(d, t4), 16);
+        __m128i po = _mm_srli_epi64(_mm_mul_epi32(_mm_srli_epi64(d, 32), t4), 16);
+        __m128i r  = _mm_blend_epi16(pe, _mm_slli_epi64(po, 32), 0xCC);
+        _mm_storeu_si128((__m128i *)(out + i), _mm_add_epi32(va, r));
+    }
+#endif
+    for (; i < n; i++)
+    {
+        RE_i64 p = (RE_i64)RE_VI_WRAP_((RE_u32)b[i] - (RE_u32)a[i]) * (RE_i64)t;
+        out[i] = RE_VI_WRAP_((RE_u32)a[i] + (RE_u32)((p >= 0) ? (p >> 16) : ~(~p >> 16)));
+    }
+}
+
+RE_INLINE void RE_VI_TO_f32_ARRAY_i32(RE_f32 *out, const RE_i32 *v, int n)
+{
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)(v + i))));
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(out + i, _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(v + i))));
+#endif
+    for (; i < n; i++) out[i] = (RE_f32)v[i];
+}
+
+/* floor(v) as i32; v must lie within the i32 range */
+RE_INLINE void RE_VI_FLOOR_FROM_f32_ARRAY_i32(RE_i32 *out, const RE_f32 *v, int n)
+{
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_si256((__m256i *)(out + i), _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_loadu_ps(v + i))));
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_si128((__m128i *)(out + i), RE_VI_FLOOR_X4_sse(_mm_loadu_ps(v + i)));
+#endif
+    for (; i < n; i++) out[i] = RE_VI_FLOOR_f32_(v[i]);
+}
+
+/* ============================================================================================
+   TYPED BATCH OPS
+   ============================================================================================ */
+
+#define RE_GEN_VI_BATCH_FUNCS(V, K)                                                                  \
+                                                                                                     \
+    RE_INLINE void RE_##V##_ADD_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *a,                  \
+                                          const RE_##V##_i32 *b, int n) {                            \
+        RE_VI_ADD_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)a, (const RE_i32 *)b, (K) * n);           \
+    }                                                                                                \
+                                                                                                     \
+    RE_INLINE void RE_##V##_SUB_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *a,                  \
+                                          const RE_##V##_i32 *b, int n) {                            \
+        RE_VI_SUB_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)a, (const RE_i32 *)b, (K) * n);           \
+    }                                                                                                \
+                                                                                                     \
+    RE_INLINE void RE_##V##_HADAMARD_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *a,             \
+                                               const RE_##V##_i32 *b, int n) {                       \
+        RE_VI_MUL_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)a, (const RE_i32 *)b, (K) * n);           \
+    }                                                                                                \
+                                                                                                     \
+    RE_INLINE void RE_##V##_MIN_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *a,                  \
+                                          const RE_##V##_i32 *b, int n) {                            \
+        RE_VI_MIN_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)a, (const RE_i32 *)b, (K) * n);           \
+    }                                                                                                \
+                                                                                                     \
+    RE_INLINE void RE_##V##_MAX_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *a,                  \
+                                          const RE_##V##_i32 *b, int n) {                            \
+        RE_VI_MAX_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)a, (const RE_i32 *)b, (K) * n);           \
+    }                                                                                                \
+                                                                                                     \
+    RE_INLINE void RE_##V##_SCALE_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *v,                \
+                                            RE_i32 s, int n) {                                       \
+        RE_VI_SCALE_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)v, s, (K) * n);                         \
+    }                                                                                                \
+                                                                                                     \
+    RE_INLINE void RE_##V##_CLAMP_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *v,                \
+                                            RE_##V##_i32 mn, RE_##V##_i32 mx, int n) {               \
+        RE_VI_CLAMP_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)v, &mn.x, &mx.x, (K), (K) * n);         \
+    }                                                                                                \
+                                                                                                     \
+    RE_INLINE void RE_##V##_SHL_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *v, int s, int n) {  \
+        RE_VI_SHIFT_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)v, s, RE_VI_SHIFT_SHL, (K) * n);        \
+    }                                                                                                \
+                                                                                                     \
+    RE_INLINE void RE_##V##_SHR_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *v, int s, int n) {  \
+        RE_VI_SHIFT_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)v, s, RE_VI_SHIFT_SRA, (K) * n);        \
+    }                                                                                                \
+                                                                                                     \
+    /* floor(v / 2^s): the arithmetic shift rounds toward -inf, unlike v / 2^s in C */               \
+    RE_INLINE void RE_##V##_FLOORDIV_POW2_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *v,        \
+                                                    int s, int n) {                                  \
+        RE_VI_SHIFT_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)v, s, RE_VI_SHIFT_SRA, (K) * n);        \
+    }                                                                                                \
+                                                                                                     \
+    /* v - 2^s floor(v / 2^s), in [0, 2^s) */                                                        \
+    RE_INLINE void RE_##V##_FLOORMOD_POW2_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *v,        \
+                                                    int s, int n) {                                  \
+        RE_VI_SHIFT_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)v, s, RE_VI_SHIFT_MASK, (K) * n);       \
+    }                                                                                                \
+                                                                                                     \
+    /* t in [0, 65536]; |b - a| must fit in RE_i32 (the per-vector LERP_Q16 has no limit) */        \
+    RE_INLINE void RE_##V##_LERP_Q16_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_i32 *a,             \
+                                               const RE_##V##_i32 *b, RE_i32 t, int n) {             \
+        RE_VI_LERP_Q16_ARRAY_i32((RE_i32 *)out, (const RE_i32 *)a, (const RE_i32 *)b, t, (K) * n);   \
+    }                                                                                                \
+                                                                                                     \
+    RE_INLINE void RE_##V##_TO_f32_BATCH_i32(RE_##V##_f32 *out, const RE_##V##_i32 *v, int n) {      \
+        RE_VI_TO_f32_ARRAY_i32((RE_f32 *)out, (const RE_i32 *)v, (K) * n);                           \
+    }                                                                                                \
+                                                                                                     \
+    RE_INLINE void RE_##V##_FLOOR_FROM_f32_BATCH_i32(RE_##V##_i32 *out, const RE_##V##_f32 *v,       \
+                                                     int n) {                                        \
+        RE_VI_FLOOR_FROM_f32_ARRAY_i32((RE_i32 *)out, (const RE_f32 *)v, (K) * n);                   \
+    }
+
+RE_GEN_VI_BATCH_FUNCS(V2, 2)
+RE_GEN_VI_BATCH_FUNCS(V3, 3)
+RE_GEN_VI_BATCH_FUNCS(V4, 4)
+
+#endif /* RE_VEC_INT_H */
@@ -0,0 +1,395 @@
+/**
+ * @file re_vec_simd.h
+ * @brief Register-backed RE_V4A_f32 / RE_V3A_f32 (16-byte aligned, one SIMD register each).
+ *
+ * RE_V4_f32 is a plain {x, y, z, w} struct: every op works lane by lane and the result goes
+ * back through memory. The "A" types hold a single __m128 (SSE) / float32x4_t (AArch64 NEON),
+ * so a chain of ops stays in registers and only LOAD / STORE touch memory.
+ *
+ *   RE_V4A_f32   x y z w
+ *   RE_V3A_f32   x y z 0    w is padding and stays 0 through every V3A op (SCALE / DIV /
+ *                           LERP mask it, so an infinite or NaN scalar cannot reach it),
+ *                           so 4-lane DOT / LENGTH / NORMALIZE give the 3D results
+ *
+ * Operation set mirrors RE_GEN_V4_TYPE_AND_FUNCS plus the float extras of re_vec.h:
+ *
+ *   MAKE ZERO BROADCAST ADD SUB SCALE DIV DOT HADAMARD CLAMP LERP
+ *   LENGTH NORMALIZE DISTANCE REFLECT ANGLE PROJECT      (V3A also CROSS, REFRACT)
+ *
+ * Differences from the RE_V4_f32 functions: LERP is computed in f32 (not via f64), and
+ * LENGTH / NORMALIZE use the IEEE square root (not the RE_INVSQRT estimate). DOT_SPLAT
+ * returns the dot product in all four lanes for further register-only math.
+ *
+ * Conversions: FROM_V4 / TO_V4 (by value), LOAD / STORE (16-byte aligned RE_f32 *),
+ * LOADU / STOREU (any alignment).
+ *
+ * Without SSE or AArch64 NEON the same API runs on a 16-byte aligned RE_f32[4].
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_VEC_SIMD_H
+#define RE_VEC_SIMD_H
+
+#include "re_core.h"
+#include "re_simd_detect.h"
+#include "re_math.h"
+#include "re_vec.h"
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    #include <xmmintrin.h>
+    #include <emmintrin.h>
+    #define RE_VEC_SIMD_SSE 1
+#elif defined(RE_SIMD_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define RE_VEC_SIMD_NEON 1                /* vdivq / vsqrtq / vaddvq are AArch64-only */
+#else
+    #define RE_VEC_SIMD_SCALAR 1
+#endif
+
+/* ============================================================================================
+   TYPES
+   ============================================================================================ */
+
+#if defined(RE_VEC_SIMD_SSE)
+typedef __m128 RE_V4A_REG;
+#elif defined(RE_VEC_SIMD_NEON)
+typedef float32x4_t RE_V4A_REG;
+#else
+typedef struct { RE_ALIGN(16) RE_f32 f[4]; } RE_V4A_REG;
+#endif
+
+typedef struct { RE_V4A_REG v; } RE_V4A_f32;
+typedef struct { RE_V4A_REG v; } RE_V3A_f32;
+
+/* ============================================================================================
+   REGISTER PRIMITIVES
+   Everything below is written in terms of these.
+   ============================================================================================ */
+
+#if defined(RE_VEC_SIMD_SSE)
+
+RE_INLINE RE_V4A_REG RE_V4A_SETR_(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 w) { return _mm_setr_ps(x, y, z, w); }
+RE_INLINE RE_V4A_REG RE_V4A_SET1_(RE_f32 a)                    { return _mm_set1_ps(a); }
+RE_INLINE RE_V4A_REG RE_V4A_ADD_(RE_V4A_REG a, RE_V4A_REG b)   { return _mm_add_ps(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_SUB_(RE_V4A_REG a, RE_V4A_REG b)   { return _mm_sub_ps(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_MUL_(RE_V4A_REG a, RE_V4A_REG b)   { return _mm_mul_ps(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_DIV_(RE_V4A_REG a, RE_V4A_REG b)   { return _mm_div_ps(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_MIN_(RE_V4A_REG a, RE_V4A_REG b)   { return _mm_min_ps(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_MAX_(RE_V4A_REG a, RE_V4A_REG b)   { return _mm_max_ps(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_SQRT_(RE_V4A_REG a)                { return _mm_sqrt_ps(a); }
+RE_INLINE RE_f32     RE_V4A_LANE0_(RE_V4A_REG a)               { return _mm_cvtss_f32(a); }
+
+/* Sum of the four lanes, in every lane */
+RE_INLINE RE_V4A_REG RE_V4A_HSUM_(RE_V4A_REG a)
+{
+    RE_V4A_REG s = _mm_add_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_add_ps(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+/* (y, z, x, w) */
+RE_INLINE RE_V4A_REG RE_V4A_YZX_(RE_V4A_REG a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1)); }
+
+/* v where d > 0, else 0 */
+RE_INLINE RE_V4A_REG RE_V4A_IF_POS_(RE_V4A_REG v, RE_V4A_REG d)
+{
+    return _mm_and_ps(v, _mm_cmpgt_ps(d, _mm_setzero_ps()));
+}
+
+RE_INLINE RE_V4A_REG RE_V4A_LOAD_(const RE_f32 *p)           { return _mm_load_ps(p); }
+RE_INLINE RE_V4A_REG RE_V4A_LOADU_(const RE_f32 *p)          { return _mm_loadu_ps(p); }
+RE_INLINE void       RE_V4A_STORE_(RE_f32 *p, RE_V4A_REG a)  { _mm_store_ps(p, a); }
+RE_INLINE void       RE_V4A_STOREU_(RE_f32 *p, RE_V4A_REG a) { _mm_storeu_ps(p, a); }
+
+#elif defined(RE_VEC_SIMD_NEON)
+
+RE_INLINE RE_V4A_REG RE_V4A_SETR_(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 w)
+{
+    const RE_f32 f[4] = { x, y, z, w };
+    return vld1q_f32(f);
+}
+RE_INLINE RE_V4A_REG RE_V4A_SET1_(RE_f32 a)                    { return vdupq_n_f32(a); }
+RE_INLINE RE_V4A_REG RE_V4A_ADD_(RE_V4A_REG a, RE_V4A_REG b)   { return vaddq_f32(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_SUB_(RE_V4A_REG a, RE_V4A_REG b)   { return vsubq_f32(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_MUL_(RE_V4A_REG a, RE_V4A_REG b)   { return vmulq_f32(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_DIV_(RE_V4A_REG a, RE_V4A_REG b)   { return vdivq_f32(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_MIN_(RE_V4A_REG a, RE_V4A_REG b)   { return vminq_f32(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_MAX_(RE_V4A_REG a, RE_V4A_REG b)   { return vmaxq_f32(a, b); }
+RE_INLINE RE_V4A_REG RE_V4A_SQRT_(RE_V4A_REG a)                { return vsqrtq_f32(a); }
+RE_INLINE RE_f32     RE_V4A_LANE0_(RE_V4A_REG a)               { return vgetq_lane_f32(a, 0); }
+RE_INLINE RE_V4A_REG RE_V4A_HSUM_(RE_V4A_REG a)                { return vdupq_n_f32(vaddvq_f32(a)); }
+
+RE_INLINE RE_V4A_REG RE_V4A_YZX_(RE_V4A_REG a)
+{
+    RE_V4A_REG r = vextq_f32(a, a, 1);                         /* y z w x */
+    r = vsetq_lane_f32(vgetq_lane_f32(a, 0), r, 2);
+    return vsetq_lane_f32(vgetq_lane_f32(a, 3), r, 3);
+}
+
+RE_INLINE RE_V4A_REG RE_V4A_IF_POS_(RE_V4A_REG v, RE_V4A_REG d)
+{
+    uint32x4_t m = vcgtq_f32(d, vdupq_n_f32(0.0f));
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(v), m));
+}
+
+RE_INLINE RE_V4A_REG RE_V4A_LOAD_(const RE_f32 *p)           { return vld1q_f32(p); }
+RE_INLINE RE_V4A_REG RE_V4A_LOADU_(const RE_f32 *p)          { return vld1q_f32(p); }
+RE_INLINE void       RE_V4A_STORE_(RE_f32 *p, RE_V4A_REG a)  { vst1q_f32(p, a); }
+RE_INLINE void       RE_V4A_STOREU_(RE_f32 *p, RE_V4A_REG a) { vst1q_f32(p, a); }
+
+#else
+
+RE_INLINE RE_V4A_REG RE_V4A_SETR_(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 w)
+{
+    RE_V4A_REG r;
+    r.f[0] = x;  r.f[1] = y;  r.f[2] = z;  r.f[3] = w;
+    return r;
+}
+RE_INLINE RE_V4A_REG RE_V4A_SET1_(RE_f32 a) { return RE_V4A_SETR_(a, a, a, a); }
+
+#define RE_V4A_LANEWISE_(NAME, EXPR)                                                             \
+    RE_INLINE RE_V4A_REG NAME(RE_V4A_REG a, RE_V4A_REG b)                                        \
+    {                                                                                            \
+        RE_V4A_REG r;                                                                            \
+        for (int i = 0; i < 4; i++) r.f[i] = (EXPR);                                             \
+        return r;                                                                                \
+    }
+
+RE_V4A_LANEWISE_(RE_V4A_ADD_, a.f[i] + b.f[i])
+RE_V4A_LANEWISE_(RE_V4A_SUB_, a.f[i] - b.f[i])
+RE_V4A_LANEWISE_(RE_V4A_MUL_, a.f[i] * b.f[i])
+RE_V4A_LANEWISE_(RE_V4A_DIV_, a.f[i] / b.f[i])
+RE_V4A_LANEWISE_(RE_V4A_MIN_, (a.f[i] < b.f[i]) ? a.f[i] : b.f[i])
+RE_V4A_LANEWISE_(RE_V4A_MAX_, (a.f[i] > b.f[i]) ? a.f[i] : b.f[i])
+RE_V4A_LANEWISE_(RE_V4A_IF_POS_, (b.f[i] > 0.0f) ? a.f[i] : 0.0f)
+
+#undef RE_V4A_LANEWISE_
+
+RE_INLINE RE_V4A_REG RE_V4A_SQRT_(RE_V4A_REG a)
+{
+    for (int i = 0; i < 4; i++) a.f[i] = (a.f[i] > 0.0f) ? RE_SQRT(a.f[i]) : 0.0f;
+    return a;
+}
+
+RE_INLINE RE_f32     RE_V4A_LANE0_(RE_V4A_REG a) { return a.f[0]; }
+RE_INLINE RE_V4A_REG RE_V4A_HSUM_(RE_V4A_REG a)  { return RE_V4A_SET1_((a.f[0] + a.f[1]) + (a.f[2] + a.f[3])); }
+RE_INLINE RE_V4A_REG RE_V4A_YZX_(RE_V4A_REG a)   { return RE_V4A_SETR_(a.f[1], a.f[2], a.f[0], a.f[3]); }
+
+RE_INLINE RE_V4A_REG RE_V4A_LOAD_(const RE_f32 *p)           { return RE_V4A_SETR_(p[0], p[1], p[2], p[3]); }
+RE_INLINE RE_V4A_REG RE_V4A_LOADU_(const RE_f32 *p)          { return RE_V4A_SETR_(p[0], p[1], p[2], p[3]); }
+RE_INLINE void       RE_V4A_STORE_(RE_f32 *p, RE_V4A_REG a)  { for (int i = 0; i < 4; i++) p[i] = a.f[i]; }
+RE_INLINE void       RE_V4A_STOREU_(RE_f32 *p, RE_V4A_REG a) { for (int i = 0; i < 4; i++) p[i] = a.f[i]; }
+
+#endif
+
+/* ============================================================================================
+   SHARED OPS
+   The V4A and V3A functions differ only in type and in how they are built, so both come from
+   one generator; the geometric extras that depend on the dimension follow separately.
+   ============================================================================================ */
+
+/* Result fixup for the ops taking a scalar: an infinite or NaN scalar would turn the V3A
+   padding lane into NaN, so it is masked back to 0 */
+#define RE_V4A_PAD_(r) (r)
+#define RE_V3A_PAD_(r) RE_V4A_IF_POS_((r), RE_V4A_SETR_(1.0f, 1.0f, 1.0f, 0.0f))
+
+#define RE_GEN_VA_FUNCS(VA)                                                                         \
+                                                                                                    \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_ZERO_f32(void) {                                              \
+        RE_##VA##_f32 r = { RE_V4A_SET1_(0.0f) };  return r;                                        \
+    }                                                                                               \
+                                                                                                    \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_ADD_f32(RE_##VA##_f32 a, RE_##VA##_f32 b) {                   \
+        RE_##VA##_f32 r = { RE_V4A_ADD_(a.v, b.v) };  return r;                                     \
+    }                                                                                               \
+                                                                                                    \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_SUB_f32(RE_##VA##_f32 a, RE_##VA##_f32 b) {                   \
+        RE_##VA##_f32 r = { RE_V4A_SUB_(a.v, b.v) };  return r;                                     \
+    }                                                                                               \
+                                                                                                    \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_SCALE_f32(RE_##VA##_f32 v, RE_f32 s) {                        \
+        RE_##VA##_f32 r = { RE_##VA##_PAD_(RE_V4A_MUL_(v.v, RE_V4A_SET1_(s))) };  return r;         \
+    }                                                                                               \
+                                                                                                    \
+    /* Zero vector when s == 0, as RE_V4_DIV_f32 */                                                 \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_DIV_f32(RE_##VA##_f32 v, RE_f32 s) {                          \
+        if (s == 0.0f) return RE_##VA##_ZERO_f32();                                                 \
+        RE_##VA##_f32 r = { RE_##VA##_PAD_(RE_V4A_DIV_(v.v, RE_V4A_SET1_(s))) };  return r;         \
+    }                                                                                               \
+                                                                                                    \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_HADAMARD_f32(RE_##VA##_f32 a, RE_##VA##_f32 b) {              \
+        RE_##VA##_f32 r = { RE_V4A_MUL_(a.v, b.v) };  return r;                                     \
+    }                                                                                               \
+                                                                                                    \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_CLAMP_f32(RE_##VA##_f32 v, RE_##VA##_f32 mn,                  \
+                                                RE_##VA##_f32 mx) {                                 \
+        RE_##VA##_f32 r = { RE_V4A_MIN_(RE_V4A_MAX_(v.v, mn.v), mx.v) };  return r;                 \
+    }                                                                                               \
+                                                                                                    \
+    /* a + (b - a) * t */                                                                           \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_LERP_f32(RE_##VA##_f32 a, RE_##VA##_f32 b, RE_f32 t) {        \
+        RE_V4A_REG d = RE_V4A_MUL_(RE_V4A_SUB_(b.v, a.v), RE_V4A_SET1_(t));                         \
+        RE_##VA##_f32 r = { RE_##VA##_PAD_(RE_V4A_ADD_(a.v, d)) };  return r;                       \
+    }                                                                                               \
+                                                                                                    \
+    /* Dot product in all four lanes */                                                             \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_DOT_SPLAT_f32(RE_##VA##_f32 a, RE_##VA##_f32 b) {             \
+        RE_##VA##_f32 r = { RE_V4A_HSUM_(RE_V4A_MUL_(a.v, b.v)) };  return r;                       \
+    }                                                                                               \
+                                                                                                    \
+    RE_INLINE RE_f32 RE_##VA##_DOT_f32(RE_##VA##_f32 a, RE_##VA##_f32 b) {                          \
+        return RE_V4A_LANE0_(RE_V4A_HSUM_(RE_V4A_MUL_(a.v, b.v)));                                  \
+    }                                                                                               \
+                                                                                                    \
+    RE_INLINE RE_f32 RE_##VA##_LENGTH_f32(RE_##VA##_f32 v) {                                        \
+        return RE_V4A_LANE0_(RE_V4A_SQRT_(RE_V4A_HSUM_(RE_V4A_MUL_(v.v, v.v))));                    \
+    }                                                                                               \
+                                                                                                    \
+    /* Zero vector when |v| = 0, as RE_V4_NORMALIZE_f32 */                                          \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_NORMALIZE_f32(RE_##VA##_f32 v) {                              \
+        RE_V4A_REG d = RE_V4A_HSUM_(RE_V4A_MUL_(v.v, v.v));                                         \
+        RE_##VA##_f32 r = { RE_V4A_IF_POS_(RE_V4A_DIV_(v.v, RE_V4A_SQRT_(d)), d) };                 \
+        return r;                                                                                   \
+    }                                                                                               \
+                                                                                                    \
+    RE_INLINE RE_f32 RE_##VA##_DISTANCE_f32(RE_##VA##_f32 a, RE_##VA##_f32 b) {                     \
+        return RE_##VA##_LENGTH_f32(RE_##VA##_SUB_f32(a, b));                                       \
+    }                                                                                               \
+                                                                                                    \
+    /* I - 2 (I.N) N */                                                                             \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_REFLECT_f32(RE_##VA##_f32 I, RE_##VA##_f32 N) {               \
+        RE_V4A_REG d2 = RE_V4A_HSUM_(RE_V4A_MUL_(I.v, N.v));                                        \
+        d2 = RE_V4A_ADD_(d2, d2);                                                                   \
+        RE_##VA##_f32 r = { RE_V4A_SUB_(I.v, RE_V4A_MUL_(d2, N.v)) };  return r;                    \
+    }                                                                                               \
+                                                                                                    \
+    RE_INLINE RE_f32 RE_##VA##_ANGLE_f32(RE_##VA##_f32 A, RE_##VA##_f32 B) {                        \
+        RE_f32 d = RE_##VA##_LENGTH_f32(A) * RE_##VA##_LENGTH_f32(B);                               \
+        if (d <= 0.0f) return 0.0f;                                                                 \
+        RE_f32 c = RE_##VA##_DOT_f32(A, B) / d;                                                     \
+        return RE_ACOS(RE_CLAMP(c, -1.0f, 1.0f));                                                   \
+    }                                                                                               \
+                                                                                                    \
+    /* B (A.B) / (B.B); zero vector when B = 0 */                                                   \
+    RE_INLINE RE_##VA##_f32 RE_##VA##_PROJECT_f32(RE_##VA##_f32 A, RE_##VA##_f32 B) {               \
+        RE_V4A_REG bb = RE_V4A_HSUM_(RE_V4A_MUL_(B.v, B.v));                                        \
+        RE_V4A_REG ab = RE_V4A_HSUM_(RE_V4A_MUL_(A.v, B.v));                                        \
+        RE_##VA##_f32 r = { RE_V4A_IF_POS_(RE_V4A_MUL_(B.v, RE_V4A_DIV_(ab, bb)), bb) };            \
+        return r;                                                                                   \
+    }
+
+RE_GEN_VA_FUNCS(V4A)
+RE_GEN_VA_FUNCS(V3A)
+
+#undef RE_GEN_VA_FUNCS
+#undef RE_V3A_PAD_
+#undef RE_V4A_PAD_
+
+/* ============================================================================================
+   V4A: CONSTRUCTION / CONVERSION
+   ============================================================================================ */
+
+RE_INLINE RE_V4A_f32 RE_V4A_MAKE_f32(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 w)
+{
+    RE_V4A_f32 r = { RE_V4A_SETR_(x, y, z, w) };  return r;
+}
+
+RE_INLINE RE_V4A_f32 RE_V4A_BROADCAST_f32(RE_f32 a)
+{
+    RE_V4A_f32 r = { RE_V4A_SET1_(a) };  return r;
+}
+
+/* p must be 16-byte aligned */
+RE_INLINE RE_V4A_f32 RE_V4A_LOAD_f32(const RE_f32 *p)    { RE_V4A_f32 r = { RE_V4A_LOAD_(p) };  return r; }
+RE_INLINE RE_V4A_f32 RE_V4A_LOADU_f32(const RE_f32 *p)   { RE_V4A_f32 r = { RE_V4A_LOADU_(p) }; return r; }
+RE_INLINE void RE_V4A_STORE_f32(RE_f32 *p, RE_V4A_f32 v)  { RE_V4A_STORE_(p, v.v); }
+RE_INLINE void RE_V4A_STOREU_f32(RE_f32 *p, RE_V4A_f32 v) { RE_V4A_STOREU_(p, v.v); }
+
+RE_INLINE RE_V4A_f32 RE_V4A_FROM_V4_f32(RE_V4_f32 v)
+{
+    return RE_V4A_LOADU_f32(&v.x);
+}
+
+RE_INLINE RE_V4_f32 RE_V4A_TO_V4_f32(RE_V4A_f32 v)
+{
+    RE_ALIGN(16) RE_f32 f[4];
+    RE_V4A_STORE_(f, v.v);
+    return RE_V4_MAKE_f32(f[0], f[1], f[2], f[3]);
+}
+
+/* ============================================================================================
+   V3A: CONSTRUCTION / CONVERSION
+   ============================================================================================ */
+
+RE_INLINE RE_V3A_f32 RE_V3A_MAKE_f32(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_V3A_f32 r = { RE_V4A_SETR_(x, y, z, 0.0f) };  return r;
+}
+
+RE_INLINE RE_V3A_f32 RE_V3A_BROADCAST_f32(RE_f32 a)
+{
+    RE_V3A_f32 r = { RE_V4A_SETR_(a, a, a, 0.0f) };  return r;
+}
+
+/* p: x y z, any alignment; reads exactly three floats */
+RE_INLINE RE_V3A_f32 RE_V3A_LOADU_f32(const RE_f32 *p)
+{
+    return RE_V3A_MAKE_f32(p[0], p[1], p[2]);
+}
+
+/* Writes exactly three floats */
+RE_INLINE void RE_V3A_STOREU_f32(RE_f32 *p, RE_V3A_f32 v)
+{
+    RE_ALIGN(16) RE_f32 f[4];
+    RE_V4A_STORE_(f, v.v);
+    p[0] = f[0];  p[1] = f[1];  p[2] = f[2];
+}
+
+RE_INLINE RE_V3A_f32 RE_V3A_FROM_V3_f32(RE_V3_f32 v)  { return RE_V3A_MAKE_f32(v.x, v.y, v.z); }
+
+RE_INLINE RE_V3_f32 RE_V3A_TO_V3_f32(RE_V3A_f32 v)
+{
+    RE_ALIGN(16) RE_f32 f[4];
+    RE_V4A_STORE_(f, v.v);
+    return RE_V3_MAKE_f32(f[0], f[1], f[2]);
+}
+
+/* w is dropped / set to 0 */
+RE_INLINE RE_V3A_f32 RE_V3A_FROM_V4A_f32(RE_V4A_f32 v)
+{
+    RE_V3A_f32 r = { RE_V4A_IF_POS_(v.v, RE_V4A_SETR_(1.0f, 1.0f, 1.0f, 0.0f)) };  return r;
+}
+
+RE_INLINE RE_V4A_f32 RE_V3A_TO_V4A_f32(RE_V3A_f32 v, RE_f32 w)
+{
+    RE_V4A_f32 r = { RE_V4A_ADD_(v.v, RE_V4A_SETR_(0.0f, 0.0f, 0.0f, w)) };  return r;
+}
+
+/* ============================================================================================
+   V3A: GEOMETRY
+   ============================================================================================ */
+
+/* a x b = (a * b.yzx - a.yzx * b).yzx; w = 0 */
+RE_INLINE RE_V3A_f32 RE_V3A_CROSS_f32(RE_V3A_f32 a, RE_V3A_f32 b)
+{
+    RE_V4A_REG c = RE_V4A_SUB_(RE_V4A_MUL_(a.v, RE_V4A_YZX_(b.v)), RE_V4A_MUL_(RE_V4A_YZX_(a.v), b.v));
+    RE_V3A_f32 r = { RE_V4A_YZX_(c) };  return r;
+}
+
+/* eta I - (eta (I.N) + sqrt(k)) N, k = 1 - eta^2 (1 - (I.N)^2); zero vector when k < 0 */
+RE_INLINE RE_V3A_f32 RE_V3A_REFRACT_f32(RE_V3A_f32 I, RE_V3A_f32 N, RE_f32 eta)
+{
+    RE_V4A_REG e = RE_V4A_SET1_(eta);
+    RE_V4A_REG d = RE_V4A_HSUM_(RE_V4A_MUL_(I.v, N.v));
+    RE_V4A_REG one = RE_V4A_SET1_(1.0f);
+    RE_V4A_REG k = RE_V4A_SUB_(one, RE_V4A_MUL_(RE_V4A_MUL_(e, e), RE_V4A_SUB_(one, RE_V4A_MUL_(d, d))));
+
+    if (RE_V4A_LANE0_(k) < 0.0f) return RE_V3A_ZERO_f32();
+
+    RE_V4A_REG t = RE_V4A_ADD_(RE_V4A_MUL_(e, d), RE_V4A_SQRT_(k));
+    RE_V3A_f32 r = { RE_V4A_SUB_(RE_V4A_MUL_(e, I.v), RE_V4A_MUL_(t, N.v)) };
+    return r;
+}
+
+#endif /* RE_VEC_SIMD_H */
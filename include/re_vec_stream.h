@@ -0,0 +1,1195 @@
+/**
+ * @file re_vec_stream.h
+ * @brief SoA vector streams and batch kernels for RE_V3_f32 / RE_V4_f32.
+ *
+ * A stream keeps one array per component (x[], y[], z[] (, w[])), so a SIMD
+ * register holds the same component of 4 (SSE) or 8 (AVX) vectors and every
+ * op is plain vertical arithmetic, with no shuffles or horizontal adds.
+ *
+ * Storage is caller-owned (no allocation here):
+ *
+ *   size_t bytes = RE_V3_STREAM_BYTES_f32(100000);
+ *   RE_V3_STREAM_f32 s;
+ *   RE_V3_STREAM_INIT_f32(&s, memory, bytes);      // component arrays 64-byte aligned
+ *   RE_V3_STREAM_WRAP_f32(&s, xs, ys, zs, n);      // or existing arrays, any alignment
+ *
+ * Kernels process `count` vectors of their first input and set out->count.
+ * out may alias any input. Each one runs an AVX 8-wide loop, then an SSE
+ * 4-wide loop, then a scalar tail; the tail uses the same operations, so
+ * a result does not depend on its position in the stream (barring FMA
+ * contraction of the scalar tail by the compiler).
+ *
+ *   ADD / SUB / HADAMARD / SCALE / LERP / CLAMP / CROSS (V3)    stream -> stream
+ *   DOT / LENGTH                                               stream -> RE_f32[]
+ *   NORMALIZE                                                  stream -> stream, |v| = 0 -> 0
+ *
+ * Existing AoS arrays (RE_V3_f32[], RE_V4_f32[]) convert with RE_V3_AOS_TO_SOA_f32 /
+ * RE_V3_SOA_TO_AOS_f32 (shuffle transposes, 8x3 on AVX, 4x3 / 4x4 on SSE), or use the
+ * RE_V3_*_BATCH_f32 wrappers directly: AoS in, AoS out, transposed per block internally.
+ *
+ * LENGTH and NORMALIZE use the IEEE square root (sqrtps), not the RE_INVSQRT
+ * estimate of the per-vector functions. The *_NORMALIZE_FAST_* variants (V2 / V3 / V4
+ * arrays and streams) trade that for rsqrtps: ~12-bit APPROX or ~22-bit REFINED.
+ *
+ * @author
+ * Jayansh Devgan
+ */
+
+#ifndef RE_VEC_STREAM_H
+#define RE_VEC_STREAM_H
+
+#include "re_core.h"
+#include "re_simd_detect.h"
+#include "re_math.h"
+#include "re_vec.h"
+
+#include <stddef.h>
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#endif
+#if defined(RE_SIMD_AVX)
+#include <immintrin.h>
+#endif
+
+#define RE_VEC_STREAM_ALIGN   64     /* cache line; covers 32-byte AVX loads */
+
+/* ============================================================================================
+   STREAM TYPES
+   ============================================================================================ */
+
+typedef struct RE_V3_STREAM_f32_t {
+    RE_f32 *x, *y, *z;
+    int     count;                   /* vectors in use                       */
+    int     capacity;                /* vectors each array can hold          */
+} RE_V3_STREAM_f32;
+
+typedef struct RE_V4_STREAM_f32_t {
+    RE_f32 *x, *y, *z, *w;
+    int     count;
+    int     capacity;
+} RE_V4_STREAM_f32;
+
+/* Component array length in floats: capacity rounded up to a whole cache line */
+RE_INLINE size_t RE_VEC_STREAM_STRIDE(int capacity)
+{
+    const size_t per_line = RE_VEC_STREAM_ALIGN / sizeof(RE_f32);
+    return ((size_t)(capacity > 0 ? capacity : 0) + per_line - 1) / per_line * per_line;
+}
+
+/* Carve `components` aligned arrays out of `memory`; returns the capacity that fits */
+RE_INLINE int RE_VEC_STREAM_CARVE_(void *memory, size_t bytes, int components, RE_f32 **arrays)
+{
+    size_t base = ((size_t)(uintptr_t)memory + RE_VEC_STREAM_ALIGN - 1) & ~(size_t)(RE_VEC_STREAM_ALIGN - 1);
+    size_t skip = base - (size_t)(uintptr_t)memory;
+    size_t line = RE_VEC_STREAM_ALIGN / sizeof(RE_f32);
+
+    size_t lines  = (bytes > skip) ? (bytes - skip) / RE_VEC_STREAM_ALIGN / (size_t)components : 0;
+    size_t stride = lines * line;
+    if (stride > (size_t)INT_MAX) stride = (size_t)INT_MAX / line * line;
+
+    for (int c = 0; c < components; c++)
+        arrays[c] = (stride > 0) ? (RE_f32 *)base + (size_t)c * stride : NULL;
+
+    return (int)stride;
+}
+
+/**
+ * @brief Bytes of caller memory for a V3 stream of `capacity` vectors, including the slack
+ *        needed to align an arbitrary pointer.
+ */
+RE_INLINE size_t RE_V3_STREAM_BYTES_f32(int capacity)
+{
+    return 3 * RE_VEC_STREAM_STRIDE(capacity) * sizeof(RE_f32) + RE_VEC_STREAM_ALIGN - 1;
+}
+
+RE_INLINE size_t RE_V4_STREAM_BYTES_f32(int capacity)
+{
+    return 4 * RE_VEC_STREAM_STRIDE(capacity) * sizeof(RE_f32) + RE_VEC_STREAM_ALIGN - 1;
+}
+
+/**
+ * @brief Lay a stream over `memory` (count = 0). Every component array starts on a
+ *        RE_VEC_STREAM_ALIGN boundary. Returns the capacity.
+ */
+RE_INLINE int RE_V3_STREAM_INIT_f32(RE_V3_STREAM_f32 *s, void *memory, size_t bytes)
+{
+    RE_f32 *a[3];
+    s->capacity = RE_VEC_STREAM_CARVE_(memory, bytes, 3, a);
+    s->x = a[0];  s->y = a[1];  s->z = a[2];
+    s->count = 0;
+    return s->capacity;
+}
+
+RE_INLINE int RE_V4_STREAM_INIT_f32(RE_V4_STREAM_f32 *s, void *memory, size_t bytes)
+{
+    RE_f32 *a[4];
+    s->capacity = RE_VEC_STREAM_CARVE_(memory, bytes, 4, a);
+    s->x = a[0];  s->y = a[1];  s->z = a[2];  s->w = a[3];
+    s->count = 0;
+    return s->capacity;
+}
+
+/* Use existing component arrays as a stream (count = capacity = n) */
+RE_INLINE void RE_V3_STREAM_WRAP_f32(RE_V3_STREAM_f32 *s, RE_f32 *x, RE_f32 *y, RE_f32 *z, int n)
+{
+    s->x = x;  s->y = y;  s->z = z;
+    s->count = s->capacity = n;
+}
+
+RE_INLINE void RE_V4_STREAM_WRAP_f32(RE_V4_STREAM_f32 *s, RE_f32 *x, RE_f32 *y, RE_f32 *z, RE_f32 *w, int n)
+{
+    s->x = x;  s->y = y;  s->z = z;  s->w = w;
+    s->count = s->capacity = n;
+}
+
+RE_INLINE RE_V3_f32 RE_V3_STREAM_GET_f32(const RE_V3_STREAM_f32 *s, int i)
+{
+    return RE_V3_MAKE_f32(s->x[i], s->y[i], s->z[i]);
+}
+
+RE_INLINE void RE_V3_STREAM_SET_f32(RE_V3_STREAM_f32 *s, int i, RE_V3_f32 v)
+{
+    s->x[i] = v.x;  s->y[i] = v.y;  s->z[i] = v.z;
+}
+
+RE_INLINE RE_V4_f32 RE_V4_STREAM_GET_f32(const RE_V4_STREAM_f32 *s, int i)
+{
+    return RE_V4_MAKE_f32(s->x[i], s->y[i], s->z[i], s->w[i]);
+}
+
+RE_INLINE void RE_V4_STREAM_SET_f32(RE_V4_STREAM_f32 *s, int i, RE_V4_f32 v)
+{
+    s->x[i] = v.x;  s->y[i] = v.y;  s->z[i] = v.z;  s->w[i] = v.w;
+}
+
+/* ============================================================================================
+   COMPONENT KERNELS
+   One component array at a time; the stream ops below run them per component. k-component
+   kernels (DOT, LENGTH, NORMALIZE) take arrays of component pointers.
+   ============================================================================================ */
+
+/* Scalar square root matching the vector paths (sqrtss), RE_SQRT without SSE */
+RE_INLINE RE_f32 RE_VEC_STREAM_SQRT_f32(RE_f32 v)
+{
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(v)));
+#else
+    return (v > 0.0f) ? RE_SQRT(v) : 0.0f;
+#endif
+}
+
+/* Element-wise binary op: out[i] = a[i] OP b[i] */
+#if defined(RE_SIMD_AVX)
+#define RE_VEC_STREAM_BINARY_X8_(OP256)                                                              \
+    for (; i + 8 <= n; i += 8)                                                                       \
+        _mm256_storeu_ps(out + i, OP256(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+#else
+#define RE_VEC_STREAM_BINARY_X8_(OP256)
+#endif
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+#define RE_VEC_STREAM_BINARY_X4_(OP128)                                                              \
+    for (; i + 4 <= n; i += 4)                                                                       \
+        _mm_storeu_ps(out + i, OP128(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+#else
+#define RE_VEC_STREAM_BINARY_X4_(OP128)
+#endif
+
+RE_INLINE void RE_VEC_STREAM_ADD_ARRAY_f32(RE_f32 *out, const RE_f32 *a, const RE_f32 *b, int n)
+{
+    int i = 0;
+    RE_VEC_STREAM_BINARY_X8_(_mm256_add_ps)
+    RE_VEC_STREAM_BINARY_X4_(_mm_add_ps)
+    for (; i < n; i++) out[i] = a[i] + b[i];
+}
+
+RE_INLINE void RE_VEC_STREAM_SUB_ARRAY_f32(RE_f32 *out, const RE_f32 *a, const RE_f32 *b, int n)
+{
+    int i = 0;
+    RE_VEC_STREAM_BINARY_X8_(_mm256_sub_ps)
+    RE_VEC_STREAM_BINARY_X4_(_mm_sub_ps)
+    for (; i < n; i++) out[i] = a[i] - b[i];
+}
+
+RE_INLINE void RE_VEC_STREAM_MUL_ARRAY_f32(RE_f32 *out, const RE_f32 *a, const RE_f32 *b, int n)
+{
+    int i = 0;
+    RE_VEC_STREAM_BINARY_X8_(_mm256_mul_ps)
+    RE_VEC_STREAM_BINARY_X4_(_mm_mul_ps)
+    for (; i < n; i++) out[i] = a[i] * b[i];
+}
+
+#undef RE_VEC_STREAM_BINARY_X8_
+#undef RE_VEC_STREAM_BINARY_X4_
+
+/* out[i] = a[i] * s */
+RE_INLINE void RE_VEC_STREAM_SCALE_ARRAY_f32(RE_f32 *out, const RE_f32 *a, RE_f32 s, int n)
+{
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    __m256 s8 = _mm256_set1_ps(s);
+    for (; i + 8 <= n; i += 8) _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), s8));
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    __m128 s4 = _mm_set1_ps(s);
+    for (; i + 4 <= n; i += 4) _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(a + i), s4));
+#endif
+    for (; i < n; i++) out[i] = a[i] * s;
+}
+
+/* out[i] = a[i] + (b[i] - a[i]) * t */
+RE_INLINE void RE_VEC_STREAM_LERP_ARRAY_f32(RE_f32 *out, const RE_f32 *a, const RE_f32 *b, RE_f32 t, int n)
+{
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    __m256 t8 = _mm256_set1_ps(t);
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 va = _mm256_loadu_ps(a + i);
+        _mm256_storeu_ps(out + i, _mm256_add_ps(va, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(b + i), va), t8)));
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    __m128 t4 = _mm_set1_ps(t);
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 va = _mm_loadu_ps(a + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b + i), va), t4)));
+    }
+#endif
+    for (; i < n; i++) out[i] = a[i] + (b[i] - a[i]) * t;
+}
+
+/* out[i] = min(max(a[i], lo), hi), as RE_CLAMP */
+RE_INLINE void RE_VEC_STREAM_CLAMP_ARRAY_f32(RE_f32 *out, const RE_f32 *a, RE_f32 lo, RE_f32 hi, int n)
+{
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    __m256 lo8 = _mm256_set1_ps(lo), hi8 = _mm256_set1_ps(hi);
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(a + i), lo8), hi8));
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    __m128 lo4 = _mm_set1_ps(lo), hi4 = _mm_set1_ps(hi);
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(out + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(a + i), lo4), hi4));
+#endif
+    for (; i < n; i++)
+    {
+        RE_f32 v = (a[i] > lo) ? a[i] : lo;
+        out[i] = (v < hi) ? v : hi;
+    }
+}
+
+/* out[i] = sum_c a[c][i] * b[c][i] over k components */
+RE_INLINE void RE_VEC_STREAM_DOT_ARRAYS_f32(RE_f32 *out, const RE_f32 *const *a, const RE_f32 *const *b,
+                                            int k, int n)
+{
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 acc = _mm256_mul_ps(_mm256_loadu_ps(a[0] + i), _mm256_loadu_ps(b[0] + i));
+        for (int c = 1; c < k; c++)
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(a[c] + i), _mm256_loadu_ps(b[c] + i)));
+        _mm256_storeu_ps(out + i, acc);
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 acc = _mm_mul_ps(_mm_loadu_ps(a[0] + i), _mm_loadu_ps(b[0] + i));
+        for (int c = 1; c < k; c++)
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a[c] + i), _mm_loadu_ps(b[c] + i)));
+        _mm_storeu_ps(out + i, acc);
+    }
+#endif
+    for (; i < n; i++)
+    {
+        RE_f32 acc = a[0][i] * b[0][i];
+        for (int c = 1; c < k; c++) acc += a[c][i] * b[c][i];
+        out[i] = acc;
+    }
+}
+
+/* out[i] = sqrt(sum_c a[c][i]^2) */
+RE_INLINE void RE_VEC_STREAM_LENGTH_ARRAYS_f32(RE_f32 *out, const RE_f32 *const *a, int k, int n)
+{
+    RE_VEC_STREAM_DOT_ARRAYS_f32(out, a, a, k, n);
+
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= n; i += 8) _mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_loadu_ps(out + i)));
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4) _mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_loadu_ps(out + i)));
+#endif
+    for (; i < n; i++) out[i] = RE_VEC_STREAM_SQRT_f32(out[i]);
+}
+
+/* out[c][i] = a[c][i] / |a[i]|, 0 where |a[i]| = 0 */
+RE_INLINE void RE_VEC_STREAM_NORMALIZE_ARRAYS_f32(RE_f32 *const *out, const RE_f32 *const *a, int k, int n)
+{
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 v[4], d = _mm256_setzero_ps();
+        for (int c = 0; c < k; c++) { v[c] = _mm256_loadu_ps(a[c] + i);  d = _mm256_add_ps(d, _mm256_mul_ps(v[c], v[c])); }
+
+        __m256 live = _mm256_cmp_ps(d, _mm256_setzero_ps(), _CMP_GT_OQ);
+        __m256 inv  = _mm256_and_ps(_mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(d)), live);
+        for (int c = 0; c < k; c++) _mm256_storeu_ps(out[c] + i, _mm256_mul_ps(v[c], inv));
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 v[4], d = _mm_setzero_ps();
+        for (int c = 0; c < k; c++) { v[c] = _mm_loadu_ps(a[c] + i);  d = _mm_add_ps(d, _mm_mul_ps(v[c], v[c])); }
+
+        __m128 live = _mm_cmpgt_ps(d, _mm_setzero_ps());
+        __m128 inv  = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(d)), live);
+        for (int c = 0; c < k; c++) _mm_storeu_ps(out[c] + i, _mm_mul_ps(v[c], inv));
+    }
+#endif
+    for (; i < n; i++)
+    {
+        RE_f32 v[4], d = 0.0f;
+        for (int c = 0; c < k; c++) { v[c] = a[c][i];  d += v[c] * v[c]; }
+
+        RE_f32 inv = (d > 0.0f) ? 1.0f / RE_VEC_STREAM_SQRT_f32(d) : 0.0f;
+        for (int c = 0; c < k; c++) out[c][i] = v[c] * inv;
+    }
+}
+
+/* ============================================================================================
+   V3 STREAM OPS
+   ============================================================================================ */
+
+RE_INLINE void RE_V3_STREAM_ADD_f32(RE_V3_STREAM_f32 *out, const RE_V3_STREAM_f32 *a, const RE_V3_STREAM_f32 *b)
+{
+    int n = a->count;
+    RE_VEC_STREAM_ADD_ARRAY_f32(out->x, a->x, b->x, n);
+    RE_VEC_STREAM_ADD_ARRAY_f32(out->y, a->y, b->y, n);
+    RE_VEC_STREAM_ADD_ARRAY_f32(out->z, a->z, b->z, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V3_STREAM_SUB_f32(RE_V3_STREAM_f32 *out, const RE_V3_STREAM_f32 *a, const RE_V3_STREAM_f32 *b)
+{
+    int n = a->count;
+    RE_VEC_STREAM_SUB_ARRAY_f32(out->x, a->x, b->x, n);
+    RE_VEC_STREAM_SUB_ARRAY_f32(out->y, a->y, b->y, n);
+    RE_VEC_STREAM_SUB_ARRAY_f32(out->z, a->z, b->z, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V3_STREAM_HADAMARD_f32(RE_V3_STREAM_f32 *out, const RE_V3_STREAM_f32 *a, const RE_V3_STREAM_f32 *b)
+{
+    int n = a->count;
+    RE_VEC_STREAM_MUL_ARRAY_f32(out->x, a->x, b->x, n);
+    RE_VEC_STREAM_MUL_ARRAY_f32(out->y, a->y, b->y, n);
+    RE_VEC_STREAM_MUL_ARRAY_f32(out->z, a->z, b->z, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V3_STREAM_SCALE_f32(RE_V3_STREAM_f32 *out, const RE_V3_STREAM_f32 *v, RE_f32 s)
+{
+    int n = v->count;
+    RE_VEC_STREAM_SCALE_ARRAY_f32(out->x, v->x, s, n);
+    RE_VEC_STREAM_SCALE_ARRAY_f32(out->y, v->y, s, n);
+    RE_VEC_STREAM_SCALE_ARRAY_f32(out->z, v->z, s, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V3_STREAM_LERP_f32(RE_V3_STREAM_f32 *out, const RE_V3_STREAM_f32 *a, const RE_V3_STREAM_f32 *b, RE_f32 t)
+{
+    int n = a->count;
+    RE_VEC_STREAM_LERP_ARRAY_f32(out->x, a->x, b->x, t, n);
+    RE_VEC_STREAM_LERP_ARRAY_f32(out->y, a->y, b->y, t, n);
+    RE_VEC_STREAM_LERP_ARRAY_f32(out->z, a->z, b->z, t, n);
+    out->count = n;
+}
+
+/* Per-component bounds, as RE_V3_CLAMP_f32 */
+RE_INLINE void RE_V3_STREAM_CLAMP_f32(RE_V3_STREAM_f32 *out, const RE_V3_STREAM_f32 *v, RE_V3_f32 mn, RE_V3_f32 mx)
+{
+    int n = v->count;
+    RE_VEC_STREAM_CLAMP_ARRAY_f32(out->x, v->x, mn.x, mx.x, n);
+    RE_VEC_STREAM_CLAMP_ARRAY_f32(out->y, v->y, mn.y, mx.y, n);
+    RE_VEC_STREAM_CLAMP_ARRAY_f32(out->z, v->z, mn.z, mx.z, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V3_STREAM_DOT_f32(RE_f32 *out, const RE_V3_STREAM_f32 *a, const RE_V3_STREAM_f32 *b)
+{
+    const RE_f32 *ac[3] = { a->x, a->y, a->z }, *bc[3] = { b->x, b->y, b->z };
+    RE_VEC_STREAM_DOT_ARRAYS_f32(out, ac, bc, 3, a->count);
+}
+
+RE_INLINE void RE_V3_STREAM_LENGTH_f32(RE_f32 *out, const RE_V3_STREAM_f32 *v)
+{
+    const RE_f32 *vc[3] = { v->x, v->y, v->z };
+    RE_VEC_STREAM_LENGTH_ARRAYS_f32(out, vc, 3, v->count);
+}
+
+RE_INLINE void RE_V3_STREAM_NORMALIZE_f32(RE_V3_STREAM_f32 *out, const RE_V3_STREAM_f32 *v)
+{
+    const RE_f32 *vc[3] = { v->x, v->y, v->z };
+    RE_f32 *oc[3] = { out->x, out->y, out->z };
+    RE_VEC_STREAM_NORMALIZE_ARRAYS_f32(oc, vc, 3, v->count);
+    out->count = v->count;
+}
+
+/* out = a x b; all components of a vector are read before any is written, so out may alias */
+RE_INLINE void RE_V3_STREAM_CROSS_f32(RE_V3_STREAM_f32 *out, const RE_V3_STREAM_f32 *a, const RE_V3_STREAM_f32 *b)
+{
+    int i = 0, n = a->count;
+
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 ax = _mm256_loadu_ps(a->x + i), ay = _mm256_loadu_ps(a->y + i), az = _mm256_loadu_ps(a->z + i);
+        __m256 bx = _mm256_loadu_ps(b->x + i), by = _mm256_loadu_ps(b->y + i), bz = _mm256_loadu_ps(b->z + i);
+        _mm256_storeu_ps(out->x + i, _mm256_sub_ps(_mm256_mul_ps(ay, bz), _mm256_mul_ps(az, by)));
+        _mm256_storeu_ps(out->y + i, _mm256_sub_ps(_mm256_mul_ps(az, bx), _mm256_mul_ps(ax, bz)));
+        _mm256_storeu_ps(out->z + i, _mm256_sub_ps(_mm256_mul_ps(ax, by), _mm256_mul_ps(ay, bx)));
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 ax = _mm_loadu_ps(a->x + i), ay = _mm_loadu_ps(a->y + i), az = _mm_loadu_ps(a->z + i);
+        __m128 bx = _mm_loadu_ps(b->x + i), by = _mm_loadu_ps(b->y + i), bz = _mm_loadu_ps(b->z + i);
+        _mm_storeu_ps(out->x + i, _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+        _mm_storeu_ps(out->y + i, _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)));
+        _mm_storeu_ps(out->z + i, _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+    }
+#endif
+    for (; i < n; i++)
+    {
+        RE_f32 ax = a->x[i], ay = a->y[i], az = a->z[i];
+        RE_f32 bx = b->x[i], by = b->y[i], bz = b->z[i];
+        out->x[i] = ay * bz - az * by;
+        out->y[i] = az * bx - ax * bz;
+        out->z[i] = ax * by - ay * bx;
+    }
+    out->count = n;
+}
+
+/* ============================================================================================
+   V4 STREAM OPS
+   ============================================================================================ */
+
+RE_INLINE void RE_V4_STREAM_ADD_f32(RE_V4_STREAM_f32 *out, const RE_V4_STREAM_f32 *a, const RE_V4_STREAM_f32 *b)
+{
+    int n = a->count;
+    RE_VEC_STREAM_ADD_ARRAY_f32(out->x, a->x, b->x, n);
+    RE_VEC_STREAM_ADD_ARRAY_f32(out->y, a->y, b->y, n);
+    RE_VEC_STREAM_ADD_ARRAY_f32(out->z, a->z, b->z, n);
+    RE_VEC_STREAM_ADD_ARRAY_f32(out->w, a->w, b->w, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V4_STREAM_SUB_f32(RE_V4_STREAM_f32 *out, const RE_V4_STREAM_f32 *a, const RE_V4_STREAM_f32 *b)
+{
+    int n = a->count;
+    RE_VEC_STREAM_SUB_ARRAY_f32(out->x, a->x, b->x, n);
+    RE_VEC_STREAM_SUB_ARRAY_f32(out->y, a->y, b->y, n);
+    RE_VEC_STREAM_SUB_ARRAY_f32(out->z, a->z, b->z, n);
+    RE_VEC_STREAM_SUB_ARRAY_f32(out->w, a->w, b->w, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V4_STREAM_HADAMARD_f32(RE_V4_STREAM_f32 *out, const RE_V4_STREAM_f32 *a, const RE_V4_STREAM_f32 *b)
+{
+    int n = a->count;
+    RE_VEC_STREAM_MUL_ARRAY_f32(out->x, a->x, b->x, n);
+    RE_VEC_STREAM_MUL_ARRAY_f32(out->y, a->y, b->y, n);
+    RE_VEC_STREAM_MUL_ARRAY_f32(out->z, a->z, b->z, n);
+    RE_VEC_STREAM_MUL_ARRAY_f32(out->w, a->w, b->w, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V4_STREAM_SCALE_f32(RE_V4_STREAM_f32 *out, const RE_V4_STREAM_f32 *v, RE_f32 s)
+{
+    int n = v->count;
+    RE_VEC_STREAM_SCALE_ARRAY_f32(out->x, v->x, s, n);
+    RE_VEC_STREAM_SCALE_ARRAY_f32(out->y, v->y, s, n);
+    RE_VEC_STREAM_SCALE_ARRAY_f32(out->z, v->z, s, n);
+    RE_VEC_STREAM_SCALE_ARRAY_f32(out->w, v->w, s, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V4_STREAM_LERP_f32(RE_V4_STREAM_f32 *out, const RE_V4_STREAM_f32 *a, const RE_V4_STREAM_f32 *b, RE_f32 t)
+{
+    int n = a->count;
+    RE_VEC_STREAM_LERP_ARRAY_f32(out->x, a->x, b->x, t, n);
+    RE_VEC_STREAM_LERP_ARRAY_f32(out->y, a->y, b->y, t, n);
+    RE_VEC_STREAM_LERP_ARRAY_f32(out->z, a->z, b->z, t, n);
+    RE_VEC_STREAM_LERP_ARRAY_f32(out->w, a->w, b->w, t, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V4_STREAM_CLAMP_f32(RE_V4_STREAM_f32 *out, const RE_V4_STREAM_f32 *v, RE_V4_f32 mn, RE_V4_f32 mx)
+{
+    int n = v->count;
+    RE_VEC_STREAM_CLAMP_ARRAY_f32(out->x, v->x, mn.x, mx.x, n);
+    RE_VEC_STREAM_CLAMP_ARRAY_f32(out->y, v->y, mn.y, mx.y, n);
+    RE_VEC_STREAM_CLAMP_ARRAY_f32(out->z, v->z, mn.z, mx.z, n);
+    RE_VEC_STREAM_CLAMP_ARRAY_f32(out->w, v->w, mn.w, mx.w, n);
+    out->count = n;
+}
+
+RE_INLINE void RE_V4_STREAM_DOT_f32(RE_f32 *out, const RE_V4_STREAM_f32 *a, const RE_V4_STREAM_f32 *b)
+{
+    const RE_f32 *ac[4] = { a->x, a->y, a->z, a->w }, *bc[4] = { b->x, b->y, b->z, b->w };
+    RE_VEC_STREAM_DOT_ARRAYS_f32(out, ac, bc, 4, a->count);
+}
+
+RE_INLINE void RE_V4_STREAM_LENGTH_f32(RE_f32 *out, const RE_V4_STREAM_f32 *v)
+{
+    const RE_f32 *vc[4] = { v->x, v->y, v->z, v->w };
+    RE_VEC_STREAM_LENGTH_ARRAYS_f32(out, vc, 4, v->count);
+}
+
+RE_INLINE void RE_V4_STREAM_NORMALIZE_f32(RE_V4_STREAM_f32 *out, const RE_V4_STREAM_f32 *v)
+{
+    const RE_f32 *vc[4] = { v->x, v->y, v->z, v->w };
+    RE_f32 *oc[4] = { out->x, out->y, out->z, out->w };
+    RE_VEC_STREAM_NORMALIZE_ARRAYS_f32(oc, vc, 4, v->count);
+    out->count = v->count;
+}
+
+/* ============================================================================================
+   IN-REGISTER TRANSPOSES
+   RE_V3_f32 / RE_V4_f32 are packed floats (12 / 16-byte stride), so an AoS array is read as a
+   flat float array: 4 V3 = 3 __m128, 8 V3 = 3 __m256, 4 V4 = 4 __m128.
+   ============================================================================================ */
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+/* Rows r0..r3 become columns (x, y, z, w of four V4s -> four component registers and back) */
+RE_INLINE void RE_VEC_TRANSPOSE_4x4_sse(__m128 *r0, __m128 *r1, __m128 *r2, __m128 *r3)
+{
+    __m128 t0 = _mm_unpacklo_ps(*r0, *r1);       /* 00 10 01 11 */
+    __m128 t1 = _mm_unpacklo_ps(*r2, *r3);       /* 20 30 21 31 */
+    __m128 t2 = _mm_unpackhi_ps(*r0, *r1);       /* 02 12 03 13 */
+    __m128 t3 = _mm_unpackhi_ps(*r2, *r3);       /* 22 32 23 33 */
+    *r0 = _mm_movelh_ps(t0, t1);
+    *r1 = _mm_movehl_ps(t1, t0);
+    *r2 = _mm_movelh_ps(t2, t3);
+    *r3 = _mm_movehl_ps(t3, t2);
+}
+
+/* (x0 y0 z0 x1)(y1 z1 x2 y2)(z2 x3 y3 z3) -> (x0..x3)(y0..y3)(z0..z3) */
+RE_INLINE void RE_VEC_AOS3_TO_SOA_X4_sse(__m128 a, __m128 b, __m128 c, __m128 *x, __m128 *y, __m128 *z)
+{
+    __m128 t0 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));   /* x2 y2 x3 y3 */
+    __m128 t1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));   /* y0 z0 y1 z1 */
+    *x = _mm_shuffle_ps(a,  t0, _MM_SHUFFLE(2, 0, 3, 0));
+    *y = _mm_shuffle_ps(t1, t0, _MM_SHUFFLE(3, 1, 2, 0));
+    *z = _mm_shuffle_ps(t1, c,  _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+/* Inverse of RE_VEC_AOS3_TO_SOA_X4_sse */
+RE_INLINE void RE_VEC_SOA_TO_AOS3_X4_sse(__m128 x, __m128 y, __m128 z, __m128 *a, __m128 *b, __m128 *c)
+{
+    __m128 u = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));    /* x0 x2 y0 y2 */
+    __m128 v = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));    /* z0 z2 x1 x3 */
+    __m128 w = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));    /* y1 y3 z1 z3 */
+    *a = _mm_shuffle_ps(u, v, _MM_SHUFFLE(2, 0, 2, 0));
+    *b = _mm_shuffle_ps(w, u, _MM_SHUFFLE(3, 1, 2, 0));
+    *c = _mm_shuffle_ps(v, w, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+#endif
+
+#if defined(RE_SIMD_AVX)
+
+/* 8 V3 in three registers -> x, y, z. The 128-bit halves are regrouped so that the low lane
+   holds vectors 0..3 and the high lane 4..7, then each lane runs the 4x3 shuffles. */
+RE_INLINE void RE_VEC_AOS3_TO_SOA_X8_avx(__m256 r0, __m256 r1, __m256 r2, __m256 *x, __m256 *y, __m256 *z)
+{
+    __m256 a = _mm256_permute2f128_ps(r0, r1, 0x30);            /* f0..3   | f12..15 */
+    __m256 b = _mm256_permute2f128_ps(r0, r2, 0x21);            /* f4..7   | f16..19 */
+    __m256 c = _mm256_permute2f128_ps(r1, r2, 0x30);            /* f8..11  | f20..23 */
+
+    __m256 t0 = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+    __m256 t1 = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+    *x = _mm256_shuffle_ps(a,  t0, _MM_SHUFFLE(2, 0, 3, 0));
+    *y = _mm256_shuffle_ps(t1, t0, _MM_SHUFFLE(3, 1, 2, 0));
+    *z = _mm256_shuffle_ps(t1, c,  _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+/* Inverse of RE_VEC_AOS3_TO_SOA_X8_avx */
+RE_INLINE void RE_VEC_SOA_TO_AOS3_X8_avx(__m256 x, __m256 y, __m256 z, __m256 *r0, __m256 *r1, __m256 *r2)
+{
+    __m256 u = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 v = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+    __m256 w = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+    __m256 a = _mm256_shuffle_ps(u, v, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 b = _mm256_shuffle_ps(w, u, _MM_SHUFFLE(3, 1, 2, 0));
+    __m256 c = _mm256_shuffle_ps(v, w, _MM_SHUFFLE(3, 1, 3, 1));
+
+    *r0 = _mm256_permute2f128_ps(a, b, 0x20);
+    *r1 = _mm256_permute2f128_ps(c, a, 0x30);
+    *r2 = _mm256_permute2f128_ps(b, c, 0x31);
+}
+
+#endif
+
+/* ============================================================================================
+   AoS <-> SoA
+   ============================================================================================ */
+
+RE_INLINE void RE_V3_AOS_TO_SOA_f32(RE_f32 *x, RE_f32 *y, RE_f32 *z, const RE_V3_f32 *in, int n)
+{
+    const RE_f32 *f = (const RE_f32 *)in;
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 vx, vy, vz;
+        RE_VEC_AOS3_TO_SOA_X8_avx(_mm256_loadu_ps(f + 3 * i), _mm256_loadu_ps(f + 3 * i + 8),
+                                  _mm256_loadu_ps(f + 3 * i + 16), &vx, &vy, &vz);
+        _mm256_storeu_ps(x + i, vx);  _mm256_storeu_ps(y + i, vy);  _mm256_storeu_ps(z + i, vz);
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 vx, vy, vz;
+        RE_VEC_AOS3_TO_SOA_X4_sse(_mm_loadu_ps(f + 3 * i), _mm_loadu_ps(f + 3 * i + 4),
+                                  _mm_loadu_ps(f + 3 * i + 8), &vx, &vy, &vz);
+        _mm_storeu_ps(x + i, vx);  _mm_storeu_ps(y + i, vy);  _mm_storeu_ps(z + i, vz);
+    }
+#endif
+    for (; i < n; i++) { x[i] = f[3 * i];  y[i] = f[3 * i + 1];  z[i] = f[3 * i + 2]; }
+}
+
+RE_INLINE void RE_V3_SOA_TO_AOS_f32(RE_V3_f32 *out, const RE_f32 *x, const RE_f32 *y, const RE_f32 *z, int n)
+{
+    RE_f32 *f = (RE_f32 *)out;
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 r0, r1, r2;
+        RE_VEC_SOA_TO_AOS3_X8_avx(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), _mm256_loadu_ps(z + i), &r0, &r1, &r2);
+        _mm256_storeu_ps(f + 3 * i, r0);  _mm256_storeu_ps(f + 3 * i + 8, r1);  _mm256_storeu_ps(f + 3 * i + 16, r2);
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 a, b, c;
+        RE_VEC_SOA_TO_AOS3_X4_sse(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i), _mm_loadu_ps(z + i), &a, &b, &c);
+        _mm_storeu_ps(f + 3 * i, a);  _mm_storeu_ps(f + 3 * i + 4, b);  _mm_storeu_ps(f + 3 * i + 8, c);
+    }
+#endif
+    for (; i < n; i++) { f[3 * i] = x[i];  f[3 * i + 1] = y[i];  f[3 * i + 2] = z[i]; }
+}
+
+RE_INLINE void RE_V4_AOS_TO_SOA_f32(RE_f32 *x, RE_f32 *y, RE_f32 *z, RE_f32 *w, const RE_V4_f32 *in, int n)
+{
+    const RE_f32 *f = (const RE_f32 *)in;
+    int i = 0;
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 r0 = _mm_loadu_ps(f + 4 * i),     r1 = _mm_loadu_ps(f + 4 * i + 4);
+        __m128 r2 = _mm_loadu_ps(f + 4 * i + 8), r3 = _mm_loadu_ps(f + 4 * i + 12);
+        RE_VEC_TRANSPOSE_4x4_sse(&r0, &r1, &r2, &r3);
+        _mm_storeu_ps(x + i, r0);  _mm_storeu_ps(y + i, r1);  _mm_storeu_ps(z + i, r2);  _mm_storeu_ps(w + i, r3);
+    }
+#endif
+    for (; i < n; i++) { x[i] = f[4 * i];  y[i] = f[4 * i + 1];  z[i] = f[4 * i + 2];  w[i] = f[4 * i + 3]; }
+}
+
+RE_INLINE void RE_V4_SOA_TO_AOS_f32(RE_V4_f32 *out, const RE_f32 *x, const RE_f32 *y, const RE_f32 *z,
+                                    const RE_f32 *w, int n)
+{
+    RE_f32 *f = (RE_f32 *)out;
+    int i = 0;
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 r0 = _mm_loadu_ps(x + i), r1 = _mm_loadu_ps(y + i), r2 = _mm_loadu_ps(z + i), r3 = _mm_loadu_ps(w + i);
+        RE_VEC_TRANSPOSE_4x4_sse(&r0, &r1, &r2, &r3);
+        _mm_storeu_ps(f + 4 * i, r0);  _mm_storeu_ps(f + 4 * i + 4, r1);
+        _mm_storeu_ps(f + 4 * i + 8, r2);  _mm_storeu_ps(f + 4 * i + 12, r3);
+    }
+#endif
+    for (; i < n; i++) { f[4 * i] = x[i];  f[4 * i + 1] = y[i];  f[4 * i + 2] = z[i];  f[4 * i + 3] = w[i]; }
+}
+
+/* Fill a stream from an AoS array; copies min(n, capacity) vectors and returns that count */
+RE_INLINE int RE_V3_STREAM_FROM_AOS_f32(RE_V3_STREAM_f32 *s, const RE_V3_f32 *in, int n)
+{
+    s->count = (n < s->capacity) ? n : s->capacity;
+    RE_V3_AOS_TO_SOA_f32(s->x, s->y, s->z, in, s->count);
+    return s->count;
+}
+
+RE_INLINE void RE_V3_STREAM_TO_AOS_f32(RE_V3_f32 *out, const RE_V3_STREAM_f32 *s)
+{
+    RE_V3_SOA_TO_AOS_f32(out, s->x, s->y, s->z, s->count);
+}
+
+RE_INLINE int RE_V4_STREAM_FROM_AOS_f32(RE_V4_STREAM_f32 *s, const RE_V4_f32 *in, int n)
+{
+    s->count = (n < s->capacity) ? n : s->capacity;
+    RE_V4_AOS_TO_SOA_f32(s->x, s->y, s->z, s->w, in, s->count);
+    return s->count;
+}
+
+RE_INLINE void RE_V4_STREAM_TO_AOS_f32(RE_V4_f32 *out, const RE_V4_STREAM_f32 *s)
+{
+    RE_V4_SOA_TO_AOS_f32(out, s->x, s->y, s->z, s->w, s->count);
+}
+
+/* ============================================================================================
+   AoS BATCH OPS
+   Same results as the stream ops on plain RE_V3_f32[] / RE_V4_f32[] arrays. Component-wise
+   ops with a uniform operand (ADD, SUB, HADAMARD, SCALE, LERP) run over the flat floats with no
+   transpose. The rest transpose RE_VEC_STREAM_BLOCK vectors at a time into stack SoA blocks,
+   run the stream kernel and transpose back. out may alias an input.
+   ============================================================================================ */
+
+#define RE_VEC_STREAM_BLOCK   256    /* vectors per transposed block (3-4 KB per operand) */
+
+RE_INLINE void RE_V3_ADD_BATCH_f32(RE_V3_f32 *out, const RE_V3_f32 *a, const RE_V3_f32 *b, int n)
+{
+    RE_VEC_STREAM_ADD_ARRAY_f32((RE_f32 *)out, (const RE_f32 *)a, (const RE_f32 *)b, 3 * n);
+}
+
+RE_INLINE void RE_V3_SUB_BATCH_f32(RE_V3_f32 *out, const RE_V3_f32 *a, const RE_V3_f32 *b, int n)
+{
+    RE_VEC_STREAM_SUB_ARRAY_f32((RE_f32 *)out, (const RE_f32 *)a, (const RE_f32 *)b, 3 * n);
+}
+
+RE_INLINE void RE_V3_HADAMARD_BATCH_f32(RE_V3_f32 *out, const RE_V3_f32 *a, const RE_V3_f32 *b, int n)
+{
+    RE_VEC_STREAM_MUL_ARRAY_f32((RE_f32 *)out, (const RE_f32 *)a, (const RE_f32 *)b, 3 * n);
+}
+
+RE_INLINE void RE_V3_SCALE_BATCH_f32(RE_V3_f32 *out, const RE_V3_f32 *v, RE_f32 s, int n)
+{
+    RE_VEC_STREAM_SCALE_ARRAY_f32((RE_f32 *)out, (const RE_f32 *)v, s, 3 * n);
+}
+
+RE_INLINE void RE_V3_LERP_BATCH_f32(RE_V3_f32 *out, const RE_V3_f32 *a, const RE_V3_f32 *b, RE_f32 t, int n)
+{
+    RE_VEC_STREAM_LERP_ARRAY_f32((RE_f32 *)out, (const RE_f32 *)a, (const RE_f32 *)b, t, 3 * n);
+}
+
+/* Two stack SoA blocks, sa and sb */
+#define RE_V3_BLOCKS_                                                                                \
+    RE_ALIGN(64) RE_f32 ba_[3][RE_VEC_STREAM_BLOCK];                                                 \
+    RE_ALIGN(64) RE_f32 bb_[3][RE_VEC_STREAM_BLOCK];                                                 \
+    RE_V3_STREAM_f32 sa, sb;                                                                         \
+    RE_V3_STREAM_WRAP_f32(&sa, ba_[0], ba_[1], ba_[2], RE_VEC_STREAM_BLOCK);                         \
+    RE_V3_STREAM_WRAP_f32(&sb, bb_[0], bb_[1], bb_[2], RE_VEC_STREAM_BLOCK);                         \
+    (void)sb;
+
+#define RE_V4_BLOCKS_                                                                                \
+    RE_ALIGN(64) RE_f32 ba_[4][RE_VEC_STREAM_BLOCK];                                                 \
+    RE_ALIGN(64) RE_f32 bb_[4][RE_VEC_STREAM_BLOCK];                                                 \
+    RE_V4_STREAM_f32 sa, sb;                                                                         \
+    RE_V4_STREAM_WRAP_f32(&sa, ba_[0], ba_[1], ba_[2], ba_[3], RE_VEC_STREAM_BLOCK);                 \
+    RE_V4_STREAM_WRAP_f32(&sb, bb_[0], bb_[1], bb_[2], bb_[3], RE_VEC_STREAM_BLOCK);                 \
+    (void)sb;
+
+RE_INLINE void RE_V3_CLAMP_BATCH_f32(RE_V3_f32 *out, const RE_V3_f32 *v, RE_V3_f32 mn, RE_V3_f32 mx, int n)
+{
+    RE_V3_BLOCKS_
+    for (int i0 = 0; i0 < n; i0 += RE_VEC_STREAM_BLOCK)
+    {
+        int m = (n - i0 < RE_VEC_STREAM_BLOCK) ? n - i0 : RE_VEC_STREAM_BLOCK;
+        RE_V3_STREAM_FROM_AOS_f32(&sa, v + i0, m);
+        RE_V3_STREAM_CLAMP_f32(&sa, &sa, mn, mx);
+        RE_V3_STREAM_TO_AOS_f32(out + i0, &sa);
+    }
+}
+
+RE_INLINE void RE_V3_CROSS_BATCH_f32(RE_V3_f32 *out, const RE_V3_f32 *a, const RE_V3_f32 *b, int n)
+{
+    RE_V3_BLOCKS_
+    for (int i0 = 0; i0 < n; i0 += RE_VEC_STREAM_BLOCK)
+    {
+        int m = (n - i0 < RE_VEC_STREAM_BLOCK) ? n - i0 : RE_VEC_STREAM_BLOCK;
+        RE_V3_STREAM_FROM_AOS_f32(&sa, a + i0, m);
+        RE_V3_STREAM_FROM_AOS_f32(&sb, b + i0, m);
+        RE_V3_STREAM_CROSS_f32(&sa, &sa, &sb);
+        RE_V3_STREAM_TO_AOS_f32(out + i0, &sa);
+    }
+}
+
+RE_INLINE void RE_V3_DOT_BATCH_f32(RE_f32 *out, const RE_V3_f32 *a, const RE_V3_f32 *b, int n)
+{
+    RE_V3_BLOCKS_
+    for (int i0 = 0; i0 < n; i0 += RE_VEC_STREAM_BLOCK)
+    {
+        int m = (n - i0 < RE_VEC_STREAM_BLOCK) ? n - i0 : RE_VEC_STREAM_BLOCK;
+        RE_V3_STREAM_FROM_AOS_f32(&sa, a + i0, m);
+        RE_V3_STREAM_FROM_AOS_f32(&sb, b + i0, m);
+        RE_V3_STREAM_DOT_f32(out + i0, &sa, &sb);
+    }
+}
+
+RE_INLINE void RE_V3_LENGTH_BATCH_f32(RE_f32 *out, const RE_V3_f32 *v, int n)
+{
+    RE_V3_BLOCKS_
+    for (int i0 = 0; i0 < n; i0 += RE_VEC_STREAM_BLOCK)
+    {
+        int m = (n - i0 < RE_VEC_STREAM_BLOCK) ? n - i0 : RE_VEC_STREAM_BLOCK;
+        RE_V3_STREAM_FROM_AOS_f32(&sa, v + i0, m);
+        RE_V3_STREAM_LENGTH_f32(out + i0, &sa);
+    }
+}
+
+RE_INLINE void RE_V3_NORMALIZE_BATCH_f32(RE_V3_f32 *out, const RE_V3_f32 *v, int n)
+{
+    RE_V3_BLOCKS_
+    for (int i0 = 0; i0 < n; i0 += RE_VEC_STREAM_BLOCK)
+    {
+        int m = (n - i0 < RE_VEC_STREAM_BLOCK) ? n - i0 : RE_VEC_STREAM_BLOCK;
+        RE_V3_STREAM_FROM_AOS_f32(&sa, v + i0, m);
+        RE_V3_STREAM_NORMALIZE_f32(&sa, &sa);
+        RE_V3_STREAM_TO_AOS_f32(out + i0, &sa);
+    }
+}
+
+RE_INLINE void RE_V4_ADD_BATCH_f32(RE_V4_f32 *out, const RE_V4_f32 *a, const RE_V4_f32 *b, int n)
+{
+    RE_VEC_STREAM_ADD_ARRAY_f32((RE_f32 *)out, (const RE_f32 *)a, (const RE_f32 *)b, 4 * n);
+}
+
+RE_INLINE void RE_V4_SUB_BATCH_f32(RE_V4_f32 *out, const RE_V4_f32 *a, const RE_V4_f32 *b, int n)
+{
+    RE_VEC_STREAM_SUB_ARRAY_f32((RE_f32 *)out, (const RE_f32 *)a, (const RE_f32 *)b, 4 * n);
+}
+
+RE_INLINE void RE_V4_HADAMARD_BATCH_f32(RE_V4_f32 *out, const RE_V4_f32 *a, const RE_V4_f32 *b, int n)
+{
+    RE_VEC_STREAM_MUL_ARRAY_f32((RE_f32 *)out, (const RE_f32 *)a, (const RE_f32 *)b, 4 * n);
+}
+
+RE_INLINE void RE_V4_SCALE_BATCH_f32(RE_V4_f32 *out, const RE_V4_f32 *v, RE_f32 s, int n)
+{
+    RE_VEC_STREAM_SCALE_ARRAY_f32((RE_f32 *)out, (const RE_f32 *)v, s, 4 * n);
+}
+
+RE_INLINE void RE_V4_LERP_BATCH_f32(RE_V4_f32 *out, const RE_V4_f32 *a, const RE_V4_f32 *b, RE_f32 t, int n)
+{
+    RE_VEC_STREAM_LERP_ARRAY_f32((RE_f32 *)out, (const RE_f32 *)a, (const RE_f32 *)b, t, 4 * n);
+}
+
+RE_INLINE void RE_V4_CLAMP_BATCH_f32(RE_V4_f32 *out, const RE_V4_f32 *v, RE_V4_f32 mn, RE_V4_f32 mx, int n)
+{
+    RE_V4_BLOCKS_
+    for (int i0 = 0; i0 < n; i0 += RE_VEC_STREAM_BLOCK)
+    {
+        int m = (n - i0 < RE_VEC_STREAM_BLOCK) ? n - i0 : RE_VEC_STREAM_BLOCK;
+        RE_V4_STREAM_FROM_AOS_f32(&sa, v + i0, m);
+        RE_V4_STREAM_CLAMP_f32(&sa, &sa, mn, mx);
+        RE_V4_STREAM_TO_AOS_f32(out + i0, &sa);
+    }
+}
+
+RE_INLINE void RE_V4_DOT_BATCH_f32(RE_f32 *out, const RE_V4_f32 *a, const RE_V4_f32 *b, int n)
+{
+    RE_V4_BLOCKS_
+    for (int i0 = 0; i0 < n; i0 += RE_VEC_STREAM_BLOCK)
+    {
+        int m = (n - i0 < RE_VEC_STREAM_BLOCK) ? n - i0 : RE_VEC_STREAM_BLOCK;
+        RE_V4_STREAM_FROM_AOS_f32(&sa, a + i0, m);
+        RE_V4_STREAM_FROM_AOS_f32(&sb, b + i0, m);
+        RE_V4_STREAM_DOT_f32(out + i0, &sa, &sb);
+    }
+}
+
+RE_INLINE void RE_V4_LENGTH_BATCH_f32(RE_f32 *out, const RE_V4_f32 *v, int n)
+{
+    RE_V4_BLOCKS_
+    for (int i0 = 0; i0 < n; i0 += RE_VEC_STREAM_BLOCK)
+    {
+        int m = (n - i0 < RE_VEC_STREAM_BLOCK) ? n - i0 : RE_VEC_STREAM_BLOCK;
+        RE_V4_STREAM_FROM_AOS_f32(&sa, v + i0, m);
+        RE_V4_STREAM_LENGTH_f32(out + i0, &sa);
+    }
+}
+
+RE_INLINE void RE_V4_NORMALIZE_BATCH_f32(RE_V4_f32 *out, const RE_V4_f32 *v, int n)
+{
+    RE_V4_BLOCKS_
+    for (int i0 = 0; i0 < n; i0 += RE_VEC_STREAM_BLOCK)
+    {
+        int m = (n - i0 < RE_VEC_STREAM_BLOCK) ? n - i0 : RE_VEC_STREAM_BLOCK;
+        RE_V4_STREAM_FROM_AOS_f32(&sa, v + i0, m);
+        RE_V4_STREAM_NORMALIZE_f32(&sa, &sa);
+        RE_V4_STREAM_TO_AOS_f32(out + i0, &sa);
+    }
+}
+
+#undef RE_V3_BLOCKS_
+#undef RE_V4_BLOCKS_
+
+/* ============================================================================================
+   FAST NORMALIZE
+   rsqrtps estimate, optionally refined by one Newton step r' = r (1.5 - 0.5 d r^2):
+
+     RE_VEC_NORMALIZE_APPROX    ~12 bits (relative error <= 1.5 * 2^-12)
+     RE_VEC_NORMALIZE_REFINED   ~22 bits
+
+   Vectors with |v|^2 below FLT_MIN (including zero) normalize to the zero vector. The last
+   partial SIMD group is padded with zeros and run through the same kernel, so every vector
+   gets the same result wherever it sits in the array (unless the compiler contracts the
+   8-wide and 4-wide paths to FMA differently). The rsqrtps estimate itself differs between
+   CPU vendors, so results are not bit-reproducible across machines. Without SSE the scalar path uses
+   RE_INVSQRT (about 17 bits), plus a Newton step for REFINED.
+   ============================================================================================ */
+
+#define RE_VEC_NORMALIZE_APPROX    0
+#define RE_VEC_NORMALIZE_REFINED   1
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+/* 1 / sqrt(d), 0 where d < FLT_MIN */
+RE_INLINE __m128 RE_VEC_RSQRT_X4_sse(__m128 d, int precision)
+{
+    __m128 r = _mm_rsqrt_ps(d);
+    if (precision == RE_VEC_NORMALIZE_REFINED)
+    {
+        __m128 hd = _mm_mul_ps(d, _mm_set1_ps(0.5f));
+        r = _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(hd, _mm_mul_ps(r, r))));
+    }
+    return _mm_and_ps(r, _mm_cmpge_ps(d, _mm_set1_ps(FLT_MIN)));
+}
+
+#endif
+
+#if defined(RE_SIMD_AVX)
+
+RE_INLINE __m256 RE_VEC_RSQRT_X8_avx(__m256 d, int precision)
+{
+    __m256 r = _mm256_rsqrt_ps(d);
+    if (precision == RE_VEC_NORMALIZE_REFINED)
+    {
+        __m256 hd = _mm256_mul_ps(d, _mm256_set1_ps(0.5f));
+        r = _mm256_mul_ps(r, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(hd, _mm256_mul_ps(r, r))));
+    }
+    return _mm256_and_ps(r, _mm256_cmp_ps(d, _mm256_set1_ps(FLT_MIN), _CMP_GE_OQ));
+}
+
+#endif
+
+/* Scalar path for targets without SSE */
+RE_INLINE RE_f32 RE_VEC_RSQRT_f32(RE_f32 d, int precision)
+{
+    if (!(d >= FLT_MIN)) return 0.0f;
+    RE_f32 r = RE_INVSQRT(d);
+    if (precision == RE_VEC_NORMALIZE_REFINED) r = r * (1.5f - 0.5f * d * r * r);
+    return r;
+}
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+/* k component registers -> normalized in place */
+RE_INLINE void RE_VEC_NORMALIZE_FAST_X4_sse(__m128 *v, int k, int precision)
+{
+    __m128 d = _mm_mul_ps(v[0], v[0]);
+    for (int c = 1; c < k; c++) d = _mm_add_ps(d, _mm_mul_ps(v[c], v[c]));
+    __m128 r = RE_VEC_RSQRT_X4_sse(d, precision);
+    for (int c = 0; c < k; c++) v[c] = _mm_mul_ps(v[c], r);
+}
+
+#endif
+
+/* Component arrays: out[c][i] = a[c][i] / |a[i]| */
+RE_INLINE void RE_VEC_STREAM_NORMALIZE_FAST_ARRAYS_f32(RE_f32 *const *out, const RE_f32 *const *a,
+                                                       int k, int n, int precision)
+{
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 v[4], d = _mm256_setzero_ps();
+        for (int c = 0; c < k; c++) { v[c] = _mm256_loadu_ps(a[c] + i);  d = _mm256_add_ps(d, _mm256_mul_ps(v[c], v[c])); }
+        __m256 r = RE_VEC_RSQRT_X8_avx(d, precision);
+        for (int c = 0; c < k; c++) _mm256_storeu_ps(out[c] + i, _mm256_mul_ps(v[c], r));
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    __m128 v[4];
+    for (; i + 4 <= n; i += 4)
+    {
+        for (int c = 0; c < k; c++) v[c] = _mm_loadu_ps(a[c] + i);
+        RE_VEC_NORMALIZE_FAST_X4_sse(v, k, precision);
+        for (int c = 0; c < k; c++) _mm_storeu_ps(out[c] + i, v[c]);
+    }
+    if (i < n)
+    {
+        RE_ALIGN(16) RE_f32 pad[4][4] = { { 0 } };
+        for (int c = 0; c < k; c++) { for (int j = i; j < n; j++) pad[c][j - i] = a[c][j];  v[c] = _mm_load_ps(pad[c]); }
+        RE_VEC_NORMALIZE_FAST_X4_sse(v, k, precision);
+        for (int c = 0; c < k; c++) { _mm_store_ps(pad[c], v[c]);  for (int j = i; j < n; j++) out[c][j] = pad[c][j - i]; }
+    }
+#else
+    for (; i < n; i++)
+    {
+        RE_f32 v[4], d = 0.0f;
+        for (int c = 0; c < k; c++) { v[c] = a[c][i];  d += v[c] * v[c]; }
+        RE_f32 r = RE_VEC_RSQRT_f32(d, precision);
+        for (int c = 0; c < k; c++) out[c][i] = v[c] * r;
+    }
+#endif
+}
+
+RE_INLINE void RE_V3_STREAM_NORMALIZE_FAST_f32(RE_V3_STREAM_f32 *out, const RE_V3_STREAM_f32 *v, int precision)
+{
+    const RE_f32 *vc[3] = { v->x, v->y, v->z };
+    RE_f32 *oc[3] = { out->x, out->y, out->z };
+    RE_VEC_STREAM_NORMALIZE_FAST_ARRAYS_f32(oc, vc, 3, v->count, precision);
+    out->count = v->count;
+}
+
+RE_INLINE void RE_V4_STREAM_NORMALIZE_FAST_f32(RE_V4_STREAM_f32 *out, const RE_V4_STREAM_f32 *v, int precision)
+{
+    const RE_f32 *vc[4] = { v->x, v->y, v->z, v->w };
+    RE_f32 *oc[4] = { out->x, out->y, out->z, out->w };
+    RE_VEC_STREAM_NORMALIZE_FAST_ARRAYS_f32(oc, vc, 4, v->count, precision);
+    out->count = v->count;
+}
+
+/* --------------------------------------------------------------------------------------------
+   AoS arrays. V2 and V4 keep whole vectors in a register and sum their squares with in-lane
+   shuffles (2 V2 or 1 V4 per 128-bit lane); V3 goes through the 4x3 / 8x3 transposes.
+   -------------------------------------------------------------------------------------------- */
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+
+/* 2 V2 (4 floats) */
+RE_INLINE void RE_VEC_NORMALIZE2_FAST_X2_sse(RE_f32 *dst, const RE_f32 *src, int precision)
+{
+    __m128 v = _mm_loadu_ps(src), m = _mm_mul_ps(v, v);
+    __m128 d = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+    _mm_storeu_ps(dst, _mm_mul_ps(v, RE_VEC_RSQRT_X4_sse(d, precision)));
+}
+
+/* 4 V3 (12 floats), through the 4x3 transpose */
+RE_INLINE void RE_VEC_NORMALIZE3_FAST_X4_sse(RE_f32 *dst, const RE_f32 *src, int precision)
+{
+    __m128 v[3], a, b, c;
+    RE_VEC_AOS3_TO_SOA_X4_sse(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), &v[0], &v[1], &v[2]);
+    RE_VEC_NORMALIZE_FAST_X4_sse(v, 3, precision);
+    RE_VEC_SOA_TO_AOS3_X4_sse(v[0], v[1], v[2], &a, &b, &c);
+    _mm_storeu_ps(dst, a);  _mm_storeu_ps(dst + 4, b);  _mm_storeu_ps(dst + 8, c);
+}
+
+#endif
+
+RE_INLINE void RE_V2_NORMALIZE_FAST_BATCH_f32(RE_V2_f32 *out, const RE_V2_f32 *in, int n, int precision)
+{
+    const RE_f32 *f = (const RE_f32 *)in;
+    RE_f32 *o = (RE_f32 *)out;
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256 v = _mm256_loadu_ps(f + 2 * i), m = _mm256_mul_ps(v, v);
+        __m256 d = _mm256_add_ps(m, _mm256_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+        _mm256_storeu_ps(o + 2 * i, _mm256_mul_ps(v, RE_VEC_RSQRT_X8_avx(d, precision)));
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 2 <= n; i += 2) RE_VEC_NORMALIZE2_FAST_X2_sse(o + 2 * i, f + 2 * i, precision);
+    if (i < n)
+    {
+        RE_f32 pad[4] = { f[2 * i], f[2 * i + 1], 0.0f, 0.0f };
+        RE_VEC_NORMALIZE2_FAST_X2_sse(pad, pad, precision);
+        o[2 * i] = pad[0];  o[2 * i + 1] = pad[1];
+    }
+#else
+    for (; i < n; i++)
+    {
+        RE_f32 x = f[2 * i], y = f[2 * i + 1];
+        RE_f32 r = RE_VEC_RSQRT_f32(x * x + y * y, precision);
+        o[2 * i] = x * r;  o[2 * i + 1] = y * r;
+    }
+#endif
+}
+
+RE_INLINE void RE_V3_NORMALIZE_FAST_BATCH_f32(RE_V3_f32 *out, const RE_V3_f32 *in, int n, int precision)
+{
+    const RE_f32 *f = (const RE_f32 *)in;
+    RE_f32 *o = (RE_f32 *)out;
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 x, y, z, r0, r1, r2;
+        RE_VEC_AOS3_TO_SOA_X8_avx(_mm256_loadu_ps(f + 3 * i), _mm256_loadu_ps(f + 3 * i + 8),
+                                  _mm256_loadu_ps(f + 3 * i + 16), &x, &y, &z);
+        __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z));
+        __m256 r = RE_VEC_RSQRT_X8_avx(d, precision);
+        RE_VEC_SOA_TO_AOS3_X8_avx(_mm256_mul_ps(x, r), _mm256_mul_ps(y, r), _mm256_mul_ps(z, r), &r0, &r1, &r2);
+        _mm256_storeu_ps(o + 3 * i, r0);  _mm256_storeu_ps(o + 3 * i + 8, r1);  _mm256_storeu_ps(o + 3 * i + 16, r2);
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i + 4 <= n; i += 4) RE_VEC_NORMALIZE3_FAST_X4_sse(o + 3 * i, f + 3 * i, precision);
+    if (i < n)
+    {
+        RE_f32 pad[12] = { 0 };
+        for (int j = 0; j < 3 * (n - i); j++) pad[j] = f[3 * i + j];
+        RE_VEC_NORMALIZE3_FAST_X4_sse(pad, pad, precision);
+        for (int j = 0; j < 3 * (n - i); j++) o[3 * i + j] = pad[j];
+    }
+#else
+    for (; i < n; i++)
+    {
+        RE_f32 x = f[3 * i], y = f[3 * i + 1], z = f[3 * i + 2];
+        RE_f32 r = RE_VEC_RSQRT_f32(x * x + y * y + z * z, precision);
+        o[3 * i] = x * r;  o[3 * i + 1] = y * r;  o[3 * i + 2] = z * r;
+    }
+#endif
+}
+
+RE_INLINE void RE_V4_NORMALIZE_FAST_BATCH_f32(RE_V4_f32 *out, const RE_V4_f32 *in, int n, int precision)
+{
+    const RE_f32 *f = (const RE_f32 *)in;
+    RE_f32 *o = (RE_f32 *)out;
+    int i = 0;
+#if defined(RE_SIMD_AVX)
+    for (; i + 2 <= n; i += 2)
+    {
+        __m256 v = _mm256_loadu_ps(f + 4 * i), m = _mm256_mul_ps(v, v);
+        __m256 d = _mm256_add_ps(m, _mm256_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+        d = _mm256_add_ps(d, _mm256_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm256_storeu_ps(o + 4 * i, _mm256_mul_ps(v, RE_VEC_RSQRT_X8_avx(d, precision)));
+    }
+#endif
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+    for (; i < n; i++)
+    {
+        __m128 v = _mm_loadu_ps(f + 4 * i), m = _mm_mul_ps(v, v);
+        __m128 d = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+        d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm_storeu_ps(o + 4 * i, _mm_mul_ps(v, RE_VEC_RSQRT_X4_sse(d, precision)));
+    }
+#else
+    for (; i < n; i++)
+    {
+        RE_f32 x = f[4 * i], y = f[4 * i + 1], z = f[4 * i + 2], w = f[4 * i + 3];
+        RE_f32 r = RE_VEC_RSQRT_f32(x * x + y * y + z * z + w * w, precision);
+        o[4 * i] = x * r;  o[4 * i + 1] = y * r;  o[4 * i + 2] = z * r;  o[4 * i + 3] = w * r;
+    }
+#endif
+}
+
+#endif /* RE_VEC_STREAM_H */
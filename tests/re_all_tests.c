@@ -16,6 +16,17 @@ void run_mat_tests(void);
 void run_quat_tests(void);
 void run_random_tests(void);
 void run_noise_tests(void);
+void run_noise_gen_tests(void);
+void run_noise_cellular_tests(void);
+void run_noise_graph_tests(void);
+void run_noise_warp_tests(void);
+void run_noise_curl_tests(void);
+void run_noise_cache_tests(void);
+void run_noise_lod_tests(void);
+void run_noise_fixed_tests(void);
+void run_vec_stream_tests(void);
+void run_vec_simd_tests(void);
+void run_vec_int_tests(void);
 void test_color_all(void);
 
 int main(void)
@@ -30,6 +41,17 @@ int main(void)
     run_quat_tests();
     run_random_tests();
     run_noise_tests();
+    run_noise_gen_tests();
+    run_noise_cellular_tests();
+    run_noise_graph_tests();
+    run_noise_warp_tests();
+    run_noise_curl_tests();
+    run_noise_cache_tests();
+    run_noise_lod_tests();
+    run_noise_fixed_tests();
+    run_vec_stream_tests();
+    run_vec_simd_tests();
+    run_vec_int_tests();
     test_color_all();
 
     printf("=== REMath combined test suite finished ===\n");
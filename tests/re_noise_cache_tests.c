@@ -0,0 +1,260 @@
+/**
+ * @file re_noise_cache_tests.c
+ * @brief Unit tests for the noise tile cache.
+ *
+ *  - LRU order and the hit / miss / evict counters
+ *  - generator-backed tiles: chunk placement, LOD, bitwise recomputation after eviction
+ *  - concurrent access across stripes with pinned tiles
+ */
+
+#include "../include/re_noise_cache.h"
+#include "../include/re_test_core.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* ============================================================================================
+   Helpers
+   ============================================================================================ */
+
+/* Tile content derived from the key only, so any reader can check what it got */
+static RE_f32 key_value(const RE_NOISE_CACHE_KEY *k, int i)
+{
+    return (RE_f32)(k->cx * 1000 + k->cy * 100 + k->cz * 10 + (RE_i32)k->function + k->lod) + (RE_f32)i * 0.5f;
+}
+
+static volatile RE_i32 g_fills;
+
+static void fill_key(void *user, const RE_NOISE_CACHE_KEY *key, RE_f32 *out, int samples)
+{
+    (void)user;
+    RE_ATOMIC_ADD_i32(&g_fills, 1);
+    for (int i = 0; i < samples; i++) out[i] = key_value(key, i);
+}
+
+static RE_NOISE_CACHE_KEY make_key(int function, int cx, int cy, int cz, int lod)
+{
+    RE_NOISE_CACHE_KEY k;
+    memset(&k, 0, sizeof(k));
+    k.function = (RE_u64)function;
+    k.seed = 7u;
+    k.cx = cx;  k.cy = cy;  k.cz = cz;
+    k.lod = lod;
+    return k;
+}
+
+static RE_BOOL tile_is(const RE_f32 *t, const RE_NOISE_CACHE_KEY *k, int samples)
+{
+    RE_BOOL ok = t != NULL;
+    for (int i = 0; ok && i < samples; i++) ok &= t[i] == key_value(k, i);
+    return ok;
+}
+
+/* ============================================================================================
+   1. LRU / COUNTERS
+   ============================================================================================ */
+
+static void test_cache_lru_counters(void)
+{
+    enum { TILE = 100 };
+    static RE_u8 memory[4 * (TILE * 4 + 64 + 64) + 128];
+    RE_NOISE_CACHE c;
+
+    /* One stripe, budget for exactly 4 tiles */
+    int cap = RE_NOISE_CACHE_INIT(&c, memory, sizeof(memory), TILE, 1);
+    RE_BOOL ok = cap == 4;
+
+    RE_NOISE_CACHE_KEY k[6];
+    for (int i = 0; i < 6; i++) k[i] = make_key(1, i, -i, 0, 0);
+
+    RE_f32 out[TILE];
+    g_fills = 0;
+
+    for (int i = 0; i < 4; i++) RE_NOISE_CACHE_READ(&c, &k[i], fill_key, NULL, out);    /* 4 misses */
+    RE_NOISE_CACHE_READ(&c, &k[0], fill_key, NULL, out);                                 /* hit: 0 is MRU */
+    RE_NOISE_CACHE_READ(&c, &k[4], fill_key, NULL, out);                                 /* evicts 1 */
+    ok &= tile_is(out, &k[4], TILE);
+
+    RE_NOISE_CACHE_READ(&c, &k[0], fill_key, NULL, out);                                 /* hit */
+    RE_NOISE_CACHE_READ(&c, &k[2], fill_key, NULL, out);                                 /* hit */
+    RE_NOISE_CACHE_READ(&c, &k[1], fill_key, NULL, out);                                 /* miss, evicts 3 */
+    ok &= tile_is(out, &k[1], TILE);
+
+    RE_NOISE_CACHE_STATS s = RE_NOISE_CACHE_GET_STATS(&c);
+    ok &= s.hits == 3 && s.misses == 6 && s.evictions == 2 && s.resident == 4 && s.capacity == 4;
+    ok &= g_fills == 6;
+
+    /* A pinned tile survives pressure; with every tile pinned ACQUIRE reports NULL */
+    const RE_f32 *pin[4];
+    for (int i = 0; i < 4; i++) pin[i] = RE_NOISE_CACHE_ACQUIRE(&c, &k[i], fill_key, NULL);
+    RE_BOOL pin_ok = RE_NOISE_CACHE_ACQUIRE(&c, &k[5], fill_key, NULL) == NULL;
+    RE_NOISE_CACHE_READ(&c, &k[5], fill_key, NULL, out);
+    pin_ok &= tile_is(out, &k[5], TILE);
+    for (int i = 0; i < 4; i++) pin_ok &= tile_is(pin[i], &k[i], TILE);
+    for (int i = 0; i < 4; i++) RE_NOISE_CACHE_RELEASE(&c, pin[i]);
+
+    /* Clear drops everything; counters survive until reset */
+    RE_NOISE_CACHE_CLEAR(&c);
+    s = RE_NOISE_CACHE_GET_STATS(&c);
+    pin_ok &= s.resident == 0 && s.hits > 0;
+    RE_NOISE_CACHE_RESET_STATS(&c);
+    s = RE_NOISE_CACHE_GET_STATS(&c);
+    pin_ok &= s.hits == 0 && s.misses == 0 && s.evictions == 0;
+
+    RE_NOISE_CACHE_READ(&c, &k[3], fill_key, NULL, out);
+    pin_ok &= tile_is(out, &k[3], TILE) && RE_NOISE_CACHE_GET_STATS(&c).misses == 1;
+
+    RE_NOISE_CACHE_DESTROY(&c);
+
+    test_result("CACHE LRU eviction and hit/miss/evict counters", ok);
+    test_result("CACHE pinned tiles are not evicted, clear / reset", pin_ok);
+}
+
+/* ============================================================================================
+   2. GENERATOR SOURCE
+   ============================================================================================ */
+
+static void test_cache_gen_source(void)
+{
+    enum { W = 16, H = 8, D = 4, TILE = W * H * D };
+    static RE_u8 memory[3 * (TILE * 4 + 128) + 256];
+    static const RE_NOISE_FRACTAL_DESC fbm = {
+        RE_NOISE_BASIS_PERLIN3, RE_NOISE_FRACTAL_FBM, 3, 2.0f, 0.5f, 1.0f, 0.0f
+    };
+
+    RE_NOISE_CACHE c;
+    RE_BOOL ok = RE_NOISE_CACHE_INIT(&c, memory, sizeof(memory), TILE, 1) == 3;
+
+    RE_NOISE_GEN_DESC sd;
+    memset(&sd, 0, sizeof(sd));
+    sd.ox = -3.0f;  sd.oy = 1.0f;  sd.oz = 0.5f;
+    sd.sx = sd.sy = sd.sz = 0.125f;
+    sd.fractal = &fbm;
+
+    /* Chunks that do not fit the tile are rejected at setup */
+    RE_NOISE_CACHE_GEN_SOURCE src;
+    RE_BOOL reject_ok = RE_TRUE;
+    sd.chunk_x = W;  sd.chunk_y = H;  sd.chunk_z = D + 1;
+    reject_ok &= !RE_NOISE_CACHE_GEN_SOURCE_INIT(&src, &sd, &c) && src.samples == 0;
+    sd.chunk_z = 0;
+    reject_ok &= !RE_NOISE_CACHE_GEN_SOURCE_INIT(&src, &sd, &c);
+    sd.chunk_x = -W;  sd.chunk_y = -H;  sd.chunk_z = D;
+    reject_ok &= !RE_NOISE_CACHE_GEN_SOURCE_INIT(&src, &sd, &c);
+
+    sd.chunk_x = W;  sd.chunk_y = H;  sd.chunk_z = D;
+    ok &= RE_NOISE_CACHE_GEN_SOURCE_INIT(&src, &sd, &c) && src.samples == TILE;
+
+    /* Chunk (2, -1, 1) at LOD 1 == the same region generated directly */
+    RE_NOISE_CACHE_KEY key = make_key(0, 2, -1, 1, 1);
+    key.seed = 99u;
+
+    static RE_f32 ref[TILE], first[TILE], again[TILE];
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 99u);
+
+    RE_NOISE_GEN_DESC d;
+    memset(&d, 0, sizeof(d));
+    d.nx = W;  d.ny = H;  d.nz = D;
+    d.sx = d.sy = d.sz = 0.25f;
+    d.ox = -3.0f + 0.25f * (RE_f32)(2 * W);
+    d.oy =  1.0f + 0.25f * (RE_f32)(-1 * H);
+    d.oz =  0.5f + 0.25f * (RE_f32)(1 * D);
+    d.chunk_x = W;  d.chunk_y = H;  d.chunk_z = D;
+    d.fractal = &fbm;
+    d.ctx = &ctx;
+    d.out = ref;
+    RE_NOISE_GEN_RUN(NULL, &d);
+
+    RE_NOISE_CACHE_READ(&c, &key, RE_NOISE_CACHE_FILL_GEN, &src, first);
+    ok &= memcmp(first, ref, sizeof(ref)) == 0;
+
+    /* Push it out with three other tiles, then recompute: bit-identical */
+    for (int i = 0; i < 3; i++)
+    {
+        RE_NOISE_CACHE_KEY other = make_key(0, i, 0, 0, 0);
+        RE_NOISE_CACHE_READ(&c, &other, RE_NOISE_CACHE_FILL_GEN, &src, again);
+    }
+    RE_NOISE_CACHE_STATS s = RE_NOISE_CACHE_GET_STATS(&c);
+    RE_NOISE_CACHE_READ(&c, &key, RE_NOISE_CACHE_FILL_GEN, &src, again);
+
+    RE_BOOL recompute_ok = s.evictions == 1 && RE_NOISE_CACHE_GET_STATS(&c).misses == 5;
+    recompute_ok &= memcmp(first, again, sizeof(again)) == 0;
+
+    RE_NOISE_CACHE_DESTROY(&c);
+
+    test_result("CACHE generator source rejects chunks that do not fit the tile", reject_ok);
+    test_result("CACHE generator tile == direct chunk generation (LOD, seed)", ok);
+    test_result("CACHE evicted tile recomputes bit-identically", recompute_ok);
+}
+
+/* ============================================================================================
+   3. CONCURRENCY
+   ============================================================================================ */
+
+enum { CACHE_MT_TILE = 64, CACHE_MT_THREADS = 4, CACHE_MT_ITERS = 4000 };
+
+typedef struct {
+    RE_NOISE_CACHE *cache;
+    int             index;
+    RE_BOOL         ok;
+} CACHE_MT_ARG;
+
+static void cache_mt_worker(void *p)
+{
+    CACHE_MT_ARG *a = (CACHE_MT_ARG *)p;
+    RE_u32 s = 0x1234u + (RE_u32)a->index * 7919u;
+
+    for (int n = 0; n < CACHE_MT_ITERS; n++)
+    {
+        s = RE_PCG_MIX32(s + 0x9e3779b9u);
+        RE_NOISE_CACHE_KEY k = make_key((int)(s & 3u), (int)((s >> 2) % 24u), (int)((s >> 8) % 3u), 0, 0);
+
+        const RE_f32 *t = RE_NOISE_CACHE_ACQUIRE(a->cache, &k, fill_key, NULL);
+        a->ok &= tile_is(t, &k, CACHE_MT_TILE);
+        if (t) RE_NOISE_CACHE_RELEASE(a->cache, t);
+    }
+}
+
+static void test_cache_concurrent(void)
+{
+    static RE_u8 memory[96 * (CACHE_MT_TILE * 4 + 64) + 4096];
+    RE_NOISE_CACHE c;
+    int cap = RE_NOISE_CACHE_INIT(&c, memory, sizeof(memory), CACHE_MT_TILE, 8);
+
+    CACHE_MT_ARG  args[CACHE_MT_THREADS];
+    RE_THREAD     threads[CACHE_MT_THREADS];
+    RE_BOOL ok = cap >= 64 && cap % 8 == 0;
+
+    for (int t = 0; t < CACHE_MT_THREADS; t++)
+    {
+        args[t].cache = &c;
+        args[t].index = t;
+        args[t].ok    = RE_TRUE;
+        ok &= RE_THREAD_START(&threads[t], cache_mt_worker, &args[t]);
+    }
+    for (int t = 0; t < CACHE_MT_THREADS; t++)
+    {
+        RE_THREAD_JOIN(&threads[t]);
+        ok &= args[t].ok;
+    }
+
+    /* 288 keys over the capacity: every access is counted once, evictions follow misses */
+    RE_NOISE_CACHE_STATS s = RE_NOISE_CACHE_GET_STATS(&c);
+    ok &= s.hits + s.misses == (RE_u64)(CACHE_MT_THREADS * CACHE_MT_ITERS);
+    ok &= s.misses == s.evictions + (RE_u64)s.resident && s.hits > 0 && s.evictions > 0;
+
+    RE_NOISE_CACHE_DESTROY(&c);
+
+    test_result("CACHE concurrent striped access: correct tiles, consistent counters", ok);
+}
+
+void run_noise_cache_tests(void)
+{
+    printf("=== re_noise_cache tests start ===\n");
+
+    test_cache_lru_counters();
+    test_cache_gen_source();
+    test_cache_concurrent();
+
+    printf("=== re_noise_cache tests finished ===\n");
+}
@@ -0,0 +1,241 @@
+/**
+ * @file re_noise_cellular_tests.c
+ * @brief Unit tests for cellular (Worley) noise.
+ *
+ *  - F1 / F2 / cell ID against a brute-force 5^n search, including a dense random sweep
+ *  - SIMD batch and grid fill against the single-point functions
+ *  - seeded contexts
+ */
+
+#include "../include/re_noise_cellular.h"
+#include "../include/re_test_core.h"
+
+#include <stdio.h>
+#include <math.h>
+
+/* ============================================================================================
+   Helpers
+   ============================================================================================ */
+
+/* Nearest / second-nearest over the 5x5x5 neighbourhood, straight from the definition */
+static void worley3_brute(RE_u32 seed, RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 *f1, RE_f32 *f2, RE_u32 *id)
+{
+    RE_i32 X = (RE_i32)floorf(x), Y = (RE_i32)floorf(y), Z = (RE_i32)floorf(z);
+    RE_f32 d1 = 1e9f, d2 = 1e9f;
+
+    for (int k = -2; k <= 2; k++)
+    for (int j = -2; j <= 2; j++)
+    for (int i = -2; i <= 2; i++)
+    {
+        RE_u32 h  = RE_HASH3D_PCG_SEED(seed, X + i, Y + j, Z + k);
+        RE_f32 dx = (RE_f32)(X + i) + 0.25f + (RE_f32)( h        & 0x3FFu) / 2048.0f - x;
+        RE_f32 dy = (RE_f32)(Y + j) + 0.25f + (RE_f32)((h >> 10) & 0x3FFu) / 2048.0f - y;
+        RE_f32 dz = (RE_f32)(Z + k) + 0.25f + (RE_f32)((h >> 20) & 0x3FFu) / 2048.0f - z;
+        RE_f32 d  = sqrtf(dx*dx + dy*dy + dz*dz);
+
+        if (d < d1)      { d2 = d1; d1 = d; *id = h; }
+        else if (d < d2) { d2 = d; }
+    }
+
+    *f1 = d1;
+    *f2 = d2;
+}
+
+static void worley2_brute(RE_u32 seed, RE_f32 x, RE_f32 y, RE_f32 *f1, RE_f32 *f2, RE_u32 *id)
+{
+    RE_i32 X = (RE_i32)floorf(x), Y = (RE_i32)floorf(y);
+    RE_f32 d1 = 1e9f, d2 = 1e9f;
+
+    for (int j = -2; j <= 2; j++)
+    for (int i = -2; i <= 2; i++)
+    {
+        RE_u32 h  = RE_HASH3D_PCG_SEED(seed, X + i, Y + j, 0);
+        RE_f32 dx = (RE_f32)(X + i) + 0.25f + (RE_f32)(h & 0xFFFFu) / 131072.0f - x;
+        RE_f32 dy = (RE_f32)(Y + j) + 0.25f + (RE_f32)(h >> 16)     / 131072.0f - y;
+        RE_f32 d  = sqrtf(dx*dx + dy*dy);
+
+        if (d < d1)      { d2 = d1; d1 = d; *id = h; }
+        else if (d < d2) { d2 = d; }
+    }
+
+    *f1 = d1;
+    *f2 = d2;
+}
+
+/* ============================================================================================
+   1. DEFINITION
+   ============================================================================================ */
+
+static void test_worley_matches_brute_force(void)
+{
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 9u);
+
+    RE_BOOL f1_ok = RE_TRUE, f2_ok = RE_TRUE, id_ok = RE_TRUE, order_ok = RE_TRUE;
+    const int N = 4000;
+
+    for (int n = 0; n < N; n++)
+    {
+        RE_f32 x = (RE_f32)(n % 40) * 0.377f - 6.1f;
+        RE_f32 y = (RE_f32)((n / 40) % 10) * 0.613f - 2.3f;
+        RE_f32 z = (RE_f32)(n / 400) * 0.291f + 0.05f;
+
+        RE_f32 b1, b2; RE_u32 bid = 0;
+        worley3_brute(ctx.seed, x, y, z, &b1, &b2, &bid);
+        RE_NOISE_WORLEY_RESULT r = RE_NOISE_WORLEY3_CTX_f32(&ctx, x, y, z);
+
+        f1_ok    &= fabsf(r.f1 - b1) < 1e-4f;
+        f2_ok    &= fabsf(r.f2 - b2) < 1e-4f;
+        id_ok    &= r.id == bid;
+        order_ok &= r.f1 <= r.f2;
+
+        worley2_brute(ctx.seed, x, y, &b1, &b2, &bid);
+        r = RE_NOISE_WORLEY2_CTX_f32(&ctx, x, y);
+
+        f1_ok    &= fabsf(r.f1 - b1) < 1e-4f;
+        f2_ok    &= fabsf(r.f2 - b2) < 1e-4f;
+        id_ok    &= r.id == bid;
+        order_ok &= r.f1 <= r.f2;
+    }
+
+    test_result("WORLEY F1 == brute force", f1_ok);
+    test_result("WORLEY F2 == brute force", f2_ok);
+    test_result("WORLEY cell ID == nearest cell hash", id_ok);
+    test_result("WORLEY F1 <= F2", order_ok);
+}
+
+/* The 3^n search must be exact, not just usually right: 400k random 2D and 100k random 3D
+   samples over many cells, every one against the 5^n brute force */
+static void test_worley_dense_brute_force(void)
+{
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 31u);
+
+    int bad2 = 0, bad3 = 0;
+    RE_u32 s = 12345u;
+
+    for (int n = 0; n < 400000; n++)
+    {
+        s = s * 1664525u + 1013904223u;  RE_f32 x = (RE_f32)(s >> 8) * (200.0f / 16777216.0f) - 100.0f;
+        s = s * 1664525u + 1013904223u;  RE_f32 y = (RE_f32)(s >> 8) * (200.0f / 16777216.0f) - 100.0f;
+
+        RE_f32 b1, b2; RE_u32 bid = 0;
+        worley2_brute(ctx.seed, x, y, &b1, &b2, &bid);
+        RE_NOISE_WORLEY_RESULT r = RE_NOISE_WORLEY2_CTX_f32(&ctx, x, y);
+        bad2 += fabsf(r.f1 - b1) >= 1e-4f || fabsf(r.f2 - b2) >= 1e-4f || r.id != bid;
+    }
+
+    for (int n = 0; n < 100000; n++)
+    {
+        s = s * 1664525u + 1013904223u;  RE_f32 x = (RE_f32)(s >> 8) * (64.0f / 16777216.0f) - 32.0f;
+        s = s * 1664525u + 1013904223u;  RE_f32 y = (RE_f32)(s >> 8) * (64.0f / 16777216.0f) - 32.0f;
+        s = s * 1664525u + 1013904223u;  RE_f32 z = (RE_f32)(s >> 8) * (64.0f / 16777216.0f) - 32.0f;
+
+        RE_f32 b1, b2; RE_u32 bid = 0;
+        worley3_brute(ctx.seed, x, y, z, &b1, &b2, &bid);
+        RE_NOISE_WORLEY_RESULT r = RE_NOISE_WORLEY3_CTX_f32(&ctx, x, y, z);
+        bad3 += fabsf(r.f1 - b1) >= 1e-4f || fabsf(r.f2 - b2) >= 1e-4f || r.id != bid;
+    }
+
+    test_result("WORLEY2 F1 / F2 / ID == brute force, 400k dense samples", bad2 == 0);
+    test_result("WORLEY3 F1 / F2 / ID == brute force, 100k dense samples", bad3 == 0);
+}
+
+/* ============================================================================================
+   2. BATCH / GRID
+   ============================================================================================ */
+
+static void test_worley_batch_and_grid(void)
+{
+    enum { N = 203, NX = 37, NY = 6, NZ = 3 };
+    RE_f32 xs[N], ys[N], zs[N], f1[N], f2[N];
+    RE_u32 id[N];
+
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 1234u);
+
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] = (RE_f32)i * 0.173f - 17.0f;
+        ys[i] = (RE_f32)(i % 13) * 0.41f - 2.0f;
+        zs[i] = (RE_f32)(i % 7) * 0.77f;
+    }
+
+    RE_BOOL batch_ok = RE_TRUE;
+
+    RE_NOISE_WORLEY3_BATCH_CTX_f32(&ctx, xs, ys, zs, f1, f2, id, N);
+    for (int i = 0; i < N; i++)
+    {
+        RE_NOISE_WORLEY_RESULT r = RE_NOISE_WORLEY3_CTX_f32(&ctx, xs[i], ys[i], zs[i]);
+        batch_ok &= fabsf(f1[i] - r.f1) < 1e-4f && fabsf(f2[i] - r.f2) < 1e-4f && id[i] == r.id;
+    }
+
+    RE_NOISE_WORLEY2_BATCH_CTX_f32(&ctx, xs, ys, f1, NULL, id, N);
+    for (int i = 0; i < N; i++)
+    {
+        RE_NOISE_WORLEY_RESULT r = RE_NOISE_WORLEY2_CTX_f32(&ctx, xs[i], ys[i]);
+        batch_ok &= fabsf(f1[i] - r.f1) < 1e-4f && id[i] == r.id;
+    }
+
+    RE_BOOL grid_ok = RE_TRUE;
+    static RE_f32 g1[NX * NY * NZ], g2[NX * NY * NZ];
+    static RE_u32 gid[NX * NY * NZ];
+    const RE_f32 ox = -1.3f, oy = 4.2f, oz = 0.6f, sx = 0.21f, sy = 0.37f, sz = 0.5f;
+
+    RE_NOISE_WORLEY3_FILL_GRID_f32(g1, g2, gid, ox, oy, oz, sx, sy, sz, NX, NY, NZ);
+    for (int k = 0; k < NZ; k++)
+    for (int j = 0; j < NY; j++)
+    for (int i = 0; i < NX; i++)
+    {
+        int o = (k * NY + j) * NX + i;
+        RE_NOISE_WORLEY_RESULT r = RE_NOISE_WORLEY3_f32(ox + i * sx, oy + j * sy, oz + k * sz);
+        grid_ok &= fabsf(g1[o] - r.f1) < 1e-4f && fabsf(g2[o] - r.f2) < 1e-4f && gid[o] == r.id;
+    }
+
+    RE_NOISE_WORLEY2_FILL_GRID_f32(NULL, g2, NULL, ox, oy, sx, sy, NX, NY);
+    for (int j = 0; j < NY; j++)
+    for (int i = 0; i < NX; i++)
+        grid_ok &= fabsf(g2[j * NX + i] - RE_NOISE_WORLEY2_f32(ox + i * sx, oy + j * sy).f2) < 1e-4f;
+
+    test_result("WORLEY batch == per-point", batch_ok);
+    test_result("WORLEY fill grid == per-point", grid_ok);
+}
+
+/* ============================================================================================
+   3. SEEDS
+   ============================================================================================ */
+
+static void test_worley_seeds(void)
+{
+    RE_NOISE_CONTEXT a, b;
+    RE_NOISE_CONTEXT_INIT(&a, 0u);
+    RE_NOISE_CONTEXT_INIT(&b, 5u);
+
+    RE_BOOL same0 = RE_TRUE;
+    int differ = 0;
+
+    for (int n = 0; n < 64; n++)
+    {
+        RE_f32 x = (RE_f32)n * 0.71f, y = (RE_f32)n * -0.33f, z = 1.5f;
+        RE_NOISE_WORLEY_RESULT ra = RE_NOISE_WORLEY3_CTX_f32(&a, x, y, z);
+        RE_NOISE_WORLEY_RESULT rd = RE_NOISE_WORLEY3_f32(x, y, z);
+
+        same0  &= ra.f1 == rd.f1 && ra.f2 == rd.f2 && ra.id == rd.id;
+        differ += ra.id != RE_NOISE_WORLEY3_CTX_f32(&b, x, y, z).id;
+    }
+
+    test_result("WORLEY seed 0 == default context", same0);
+    test_result("WORLEY seeds give different cells", differ > 48);
+}
+
+void run_noise_cellular_tests(void)
+{
+    printf("=== re_noise_cellular tests start ===\n");
+
+    test_worley_matches_brute_force();
+    test_worley_dense_brute_force();
+    test_worley_batch_and_grid();
+    test_worley_seeds();
+
+    printf("=== re_noise_cellular tests finished ===\n");
+}
@@ -0,0 +1,124 @@
+/**
+ * @file re_noise_curl_tests.c
+ * @brief Unit tests for curl noise.
+ *
+ *  - analytic curl against central differences of the vector potential
+ *  - divergence of the curl field
+ *  - particle batch against the single-point curl, accumulation into vel
+ */
+
+#include "../include/re_noise_curl.h"
+#include "../include/re_test_core.h"
+
+#include <stdio.h>
+#include <math.h>
+
+/* curl of RE_NOISE_OS3D_SMOOTH_VEC3 by central differences (18 channel samples) */
+static RE_V3_f32 curl_by_differences(const RE_NOISE_CONTEXT *ctx, RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 h)
+{
+    RE_f32 px[3], mx[3], py[3], my[3], pz[3], mz[3];
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x + h, y, z, px);
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x - h, y, z, mx);
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x, y + h, z, py);
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x, y - h, z, my);
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x, y, z + h, pz);
+    RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(ctx, x, y, z - h, mz);
+
+    RE_f32 s = 0.5f / h;
+    RE_V3_f32 c;
+    c.x = ((py[2] - my[2]) - (pz[1] - mz[1])) * s;
+    c.y = ((pz[0] - mz[0]) - (px[2] - mx[2])) * s;
+    c.z = ((px[1] - mx[1]) - (py[0] - my[0])) * s;
+    return c;
+}
+
+/* ============================================================================================
+   1. DEFINITION
+   ============================================================================================ */
+
+static void test_curl_matches_differences(void)
+{
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 17u);
+
+    RE_BOOL ok = RE_TRUE;
+    RE_f32 div_max = 0.0f, mag_max = 0.0f;
+
+    for (int n = 0; n < 400; n++)
+    {
+        RE_f32 x = (RE_f32)n * 0.0931f - 13.0f;
+        RE_f32 y = (RE_f32)(n % 19) * 0.217f - 1.5f;
+        RE_f32 z = (RE_f32)(n % 11) * -0.173f + 0.4f;
+
+        RE_V3_f32 a = RE_NOISE_CURL3_CTX_f32(&ctx, x, y, z);
+        RE_V3_f32 d = curl_by_differences(&ctx, x, y, z, 1e-3f);
+
+        ok &= fabsf(a.x - d.x) < 2e-2f && fabsf(a.y - d.y) < 2e-2f && fabsf(a.z - d.z) < 2e-2f;
+
+        /* div(curl) from differences of the analytic field */
+        const RE_f32 h = 1e-3f;
+        RE_f32 div = (RE_NOISE_CURL3_CTX_f32(&ctx, x + h, y, z).x - RE_NOISE_CURL3_CTX_f32(&ctx, x - h, y, z).x
+                    + RE_NOISE_CURL3_CTX_f32(&ctx, x, y + h, z).y - RE_NOISE_CURL3_CTX_f32(&ctx, x, y - h, z).y
+                    + RE_NOISE_CURL3_CTX_f32(&ctx, x, y, z + h).z - RE_NOISE_CURL3_CTX_f32(&ctx, x, y, z - h).z)
+                   * (0.5f / h);
+
+        div_max = fmaxf(div_max, fabsf(div));
+        mag_max = fmaxf(mag_max, fabsf(a.x) + fabsf(a.y) + fabsf(a.z));
+    }
+
+    test_result("CURL analytic == central differences", ok);
+    test_result("CURL field is divergence-free", div_max < 0.02f * mag_max && mag_max > 0.5f);
+}
+
+/* ============================================================================================
+   2. PARTICLES
+   ============================================================================================ */
+
+static void test_curl_particles(void)
+{
+    enum { N = 203 };
+    RE_f32 xs[N], ys[N], zs[N];
+    RE_V3_f32 vel[N];
+
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 5u);
+
+    const RE_f32 freq = 0.35f, k = 2.5f;
+
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] = (RE_f32)i * 0.173f - 17.0f;
+        ys[i] = (RE_f32)(i % 13) * 0.41f - 2.0f;
+        zs[i] = (RE_f32)(i % 7) * 0.77f;
+        vel[i].x = (RE_f32)i;  vel[i].y = -1.0f;  vel[i].z = 0.5f;
+    }
+
+    RE_NOISE_CURL3_BATCH_CTX_f32(&ctx, xs, ys, zs, freq, k, vel, N);
+
+    RE_BOOL ok = RE_TRUE;
+    for (int i = 0; i < N; i++)
+    {
+        RE_V3_f32 c = RE_NOISE_CURL3_CTX_f32(&ctx, xs[i] * freq, ys[i] * freq, zs[i] * freq);
+        ok &= fabsf(vel[i].x - ((RE_f32)i + k * c.x)) < 1e-3f
+           && fabsf(vel[i].y - (-1.0f    + k * c.y)) < 1e-4f
+           && fabsf(vel[i].z - (0.5f     + k * c.z)) < 1e-4f;
+    }
+
+    /* Default context == seed 0 */
+    RE_NOISE_CONTEXT_INIT(&ctx, 0u);
+    RE_V3_f32 a = RE_NOISE_CURL3_f32(1.3f, -0.7f, 2.2f);
+    RE_V3_f32 b = RE_NOISE_CURL3_CTX_f32(&ctx, 1.3f, -0.7f, 2.2f);
+
+    test_result("CURL particle batch == per-point, adds to vel", ok);
+    test_result("CURL seed 0 == default context", a.x == b.x && a.y == b.y && a.z == b.z);
+}
+
+void run_noise_curl_tests(void)
+{
+    printf("=== re_noise_curl tests start ===\n");
+
+    test_curl_matches_differences();
+    test_curl_particles();
+
+    printf("=== re_noise_curl tests finished ===\n");
+}
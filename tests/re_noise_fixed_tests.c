@@ -0,0 +1,150 @@
+/**
+ * @file re_noise_fixed_tests.c
+ * @brief Unit tests for the Q16.16 fixed-point noise.
+ *
+ *  - each function against its float counterpart, default and seeded contexts
+ *  - batch (SIMD) output bit-identical to the scalar functions, odd counts
+ *  - golden checksums: the same bits on every compiler / ISA
+ */
+
+#include "../include/re_noise_fixed.h"
+#include "../include/re_test_core.h"
+
+#include <stdio.h>
+
+enum { FIXED_N = 1031 };
+
+static RE_q16 g_x[FIXED_N], g_y[FIXED_N], g_z[FIXED_N];
+
+/* Points in [-64, 64)^3 from an LCG (not the noise hashes) */
+static void fixed_points(void)
+{
+    RE_u32 s = 0x2545F491u;
+    for (int i = 0; i < FIXED_N; i++)
+    {
+        s = s * 1664525u + 1013904223u;  g_x[i] = (RE_i32)(s >> 9) - (1 << 22);
+        s = s * 1664525u + 1013904223u;  g_y[i] = (RE_i32)(s >> 9) - (1 << 22);
+        s = s * 1664525u + 1013904223u;  g_z[i] = (RE_i32)(s >> 9) - (1 << 22);
+    }
+}
+
+static RE_f32 fabs_f32(RE_f32 v) { return v < 0.0f ? -v : v; }
+
+/* ============================================================================================
+   1. AGAINST FLOAT
+   ============================================================================================ */
+
+static void test_fixed_matches_float(void)
+{
+    RE_NOISE_CONTEXT seeded;
+    RE_NOISE_CONTEXT_INIT(&seeded, 4242u);
+    const RE_NOISE_CONTEXT *ctxs[2] = { &RE_NOISE_DEFAULT_CONTEXT, &seeded };
+
+    RE_f32 err[6] = { 0 };
+
+    for (int c = 0; c < 2; c++)
+    for (int i = 0; i < FIXED_N; i++)
+    {
+        const RE_NOISE_CONTEXT *ctx = ctxs[c];
+        RE_f32 x = RE_Q16_TO_f32(g_x[i]), y = RE_Q16_TO_f32(g_y[i]), z = RE_Q16_TO_f32(g_z[i]);
+        RE_f32 d[6];
+
+        d[0] = RE_Q16_TO_f32(RE_NOISE_VALUE2_CTX_q16(ctx, g_x[i], g_y[i]))             - RE_NOISE_VALUE2_CTX_f32(ctx, x, y);
+        d[1] = RE_Q16_TO_f32(RE_NOISE_VALUE3_CTX_q16(ctx, g_x[i], g_y[i], g_z[i]))     - RE_NOISE_VALUE3_CTX_f32(ctx, x, y, z);
+        d[2] = RE_Q16_TO_f32(RE_NOISE_PERLIN2_CTX_q16(ctx, g_x[i], g_y[i]))            - RE_NOISE_PERLIN2_CTX_f32(ctx, x, y);
+        d[3] = RE_Q16_TO_f32(RE_NOISE_PERLIN3_CTX_q16(ctx, g_x[i], g_y[i], g_z[i]))    - RE_NOISE_PERLIN3_CTX_f32(ctx, x, y, z);
+        d[4] = RE_Q16_TO_f32(RE_NOISE_OS2D_SMOOTH_CTX_q16(ctx, g_x[i], g_y[i]))        - RE_NOISE_OS2D_SMOOTH_CTX_f32(ctx, x, y);
+        d[5] = RE_Q16_TO_f32(RE_NOISE_OS3D_FAST_CTX_q16(ctx, g_x[i], g_y[i], g_z[i]))  - RE_NOISE_OS3D_FAST_CTX_f32(ctx, x, y, z);
+
+        for (int k = 0; k < 6; k++) if (fabs_f32(d[k]) > err[k]) err[k] = fabs_f32(d[k]);
+    }
+
+    test_result("FIXED Value 2D/3D == float (1e-3)",  err[0] < 1e-3f && err[1] < 1e-3f);
+    test_result("FIXED Perlin 2D/3D == float (1e-3)", err[2] < 1e-3f && err[3] < 1e-3f);
+    test_result("FIXED OS2D smooth / OS3D fast == float (3e-3)", err[4] < 3e-3f && err[5] < 3e-3f);
+}
+
+/* ============================================================================================
+   2. BATCH / DETERMINISM
+   ============================================================================================ */
+
+static RE_u32 fnv(RE_u32 h, const RE_q16 *v, int n)
+{
+    for (int i = 0; i < n; i++)
+    {
+        RE_u32 u = (RE_u32)v[i];
+        for (int b = 0; b < 4; b++) { h ^= (u >> (b * 8)) & 255u;  h *= 16777619u; }
+    }
+    return h;
+}
+
+static void test_fixed_batch_and_golden(void)
+{
+    static RE_q16 out[FIXED_N];
+    RE_NOISE_CONTEXT seeded;
+    RE_NOISE_CONTEXT_INIT(&seeded, 4242u);
+
+    RE_BOOL batch_ok = RE_TRUE;
+    RE_u32  h = 2166136261u;
+
+    #define CHECK2(NAME)                                                                       \
+        RE_NOISE_##NAME##_BATCH_CTX_q16(&seeded, g_x, g_y, out, FIXED_N);                      \
+        for (int i = 0; i < FIXED_N; i++)                                                      \
+            batch_ok &= out[i] == RE_NOISE_##NAME##_CTX_q16(&seeded, g_x[i], g_y[i]);          \
+        h = fnv(h, out, FIXED_N);                                                              \
+        RE_NOISE_##NAME##_BATCH_q16(g_x, g_y, out, 13);                                        \
+        for (int i = 0; i < 13; i++) batch_ok &= out[i] == RE_NOISE_##NAME##_q16(g_x[i], g_y[i]);
+
+    #define CHECK3(NAME)                                                                       \
+        RE_NOISE_##NAME##_BATCH_CTX_q16(&seeded, g_x, g_y, g_z, out, FIXED_N);                 \
+        for (int i = 0; i < FIXED_N; i++)                                                      \
+            batch_ok &= out[i] == RE_NOISE_##NAME##_CTX_q16(&seeded, g_x[i], g_y[i], g_z[i]);  \
+        h = fnv(h, out, FIXED_N);                                                              \
+        RE_NOISE_##NAME##_BATCH_q16(g_x, g_y, g_z, out, 13);                                   \
+        for (int i = 0; i < 13; i++) batch_ok &= out[i] == RE_NOISE_##NAME##_q16(g_x[i], g_y[i], g_z[i]);
+
+    CHECK2(VALUE2)
+    CHECK3(VALUE3)
+    CHECK2(PERLIN2)
+    CHECK3(PERLIN3)
+    CHECK2(OS2D_SMOOTH)
+    CHECK3(OS3D_FAST)
+
+    #undef CHECK2
+    #undef CHECK3
+
+    /* Domain edges: Value / Perlin anywhere, OpenSimplex2 at its documented limits */
+    const RE_q16 edge[4] = { (RE_q16)0x7FFFFFFF, (RE_q16)0x80000000, RE_Q16_FROM_i32(16383), -RE_Q16_FROM_i32(8191) };
+    RE_q16 e[8];
+    e[0] = RE_NOISE_VALUE3_q16(edge[0], edge[1], edge[2]);
+    e[1] = RE_NOISE_PERLIN3_q16(edge[1], edge[0], edge[3]);
+    e[2] = RE_NOISE_OS2D_SMOOTH_q16(edge[2] + 65535, -edge[2] - 65535);
+    e[3] = RE_NOISE_OS3D_FAST_q16(edge[3], -edge[3] + 65535, edge[3]);
+    e[4] = RE_NOISE_VALUE2_q16(edge[1], edge[1]);
+    e[5] = RE_NOISE_PERLIN2_q16(edge[0], edge[0]);
+    e[6] = RE_NOISE_OS2D_SMOOTH_q16(RE_Q16_ONE / 3, -RE_Q16_ONE / 7);
+    e[7] = RE_NOISE_OS3D_FAST_q16(0, 0, 0);
+    for (int i = 0; i < 8; i++) batch_ok &= e[i] >= -RE_Q16_ONE && e[i] <= RE_Q16_ONE;
+    h = fnv(h, e, 8);
+
+    /* Modes 1 and 2 both hash through the context permutation table */
+#if RE_NOISE_HASH_MODE == 3
+    const RE_u32 golden = 0x7111ad78u;
+#else
+    const RE_u32 golden = 0x274ff21au;
+#endif
+
+    test_result("FIXED batch (SSE/AVX2) bit-identical to scalar, tails", batch_ok);
+    test_result("FIXED golden checksum (hash mode)", h == golden);
+}
+
+void run_noise_fixed_tests(void)
+{
+    printf("=== re_noise_fixed tests start ===\n");
+
+    fixed_points();
+    test_fixed_matches_float();
+    test_fixed_batch_and_golden();
+
+    printf("=== re_noise_fixed tests finished ===\n");
+}
@@ -0,0 +1,204 @@
+/**
+ * @file re_noise_gen_tests.c
+ * @brief Unit tests for the threaded chunked noise generator.
+ *
+ *  - thread-count independence (bitwise)
+ *  - agreement with the single-point fractal / noise functions
+ *  - chunked output layout
+ *  - progress and cancellation
+ */
+
+#include "../include/re_noise_gen.h"
+#include "../include/re_test_core.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* ============================================================================================
+   Helpers
+   ============================================================================================ */
+
+static RE_f32 gen_os2d_point(const RE_NOISE_CONTEXT *ctx, void *user, RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    (void)user; (void)z;
+    return RE_NOISE_OS2D_SMOOTH_CTX_f32(ctx, x, y);
+}
+
+/* Cancels its own job from inside the first chunk that runs */
+static RE_f32 gen_cancel_point(const RE_NOISE_CONTEXT *ctx, void *user, RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_NOISE_GEN_CANCEL((RE_NOISE_GEN_JOB *)user);
+    return RE_NOISE_PERLIN3_CTX_f32(ctx, x, y, z);
+}
+
+/* ============================================================================================
+   1. DETERMINISM
+   ============================================================================================ */
+
+static void test_gen_thread_independent(void)
+{
+    enum { NX = 70, NY = 45, NZ = 19, N = NX * NY * NZ };
+    RE_f32 *ref = (RE_f32 *)malloc(N * sizeof(RE_f32));
+    RE_f32 *out = (RE_f32 *)malloc(N * sizeof(RE_f32));
+
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 77u);
+
+    RE_NOISE_FRACTAL_DESC f = { RE_NOISE_BASIS_PERLIN3, RE_NOISE_FRACTAL_FBM, 4, 2.0f, 0.5f, 1.0f, 0.0f };
+    RE_NOISE_GEN_DESC d;
+    memset(&d, 0, sizeof(d));
+    d.nx = NX;  d.ny = NY;  d.nz = NZ;
+    d.ox = -3.1f; d.oy = 0.7f; d.oz = 11.0f;
+    d.sx = 0.043f; d.sy = 0.051f; d.sz = 0.09f;
+    d.chunk_x = 16; d.chunk_y = 8; d.chunk_z = 4;
+    d.ctx = &ctx;
+    d.fractal = &f;
+
+    d.out = ref;
+    RE_BOOL ok = RE_NOISE_GEN_RUN(NULL, &d);
+
+    /* Matches the single-point fractal */
+    RE_BOOL point_ok = RE_TRUE;
+    for (int i = 0; i < N; i += 37)
+    {
+        int x = i % NX, y = (i / NX) % NY, z = i / (NX * NY);
+        RE_f32 e = RE_NOISE_FRACTAL3_CTX_f32(&ctx, &f, d.ox + (RE_f32)x * d.sx,
+                                             d.oy + (RE_f32)y * d.sy, d.oz + (RE_f32)z * d.sz);
+        point_ok &= fabsf(ref[i] - e) < 1e-5f;
+    }
+
+    /* Any thread count gives the same bits */
+    RE_BOOL same = RE_TRUE;
+    const int counts[3] = { 1, 3, 8 };
+    for (int t = 0; t < 3; t++)
+    {
+        RE_NOISE_POOL pool;
+        ok &= RE_NOISE_POOL_CREATE(&pool, counts[t]);
+
+        memset(out, 0, N * sizeof(RE_f32));
+        d.out = out;
+        ok &= RE_NOISE_GEN_RUN(&pool, &d);
+        same &= memcmp(ref, out, N * sizeof(RE_f32)) == 0;
+
+        RE_NOISE_POOL_DESTROY(&pool);
+    }
+
+    /* Default chunking: same values up to SIMD/scalar rounding */
+    RE_BOOL chunk_ok = RE_TRUE;
+    d.chunk_x = d.chunk_y = d.chunk_z = 0;
+    ok &= RE_NOISE_GEN_RUN(NULL, &d);
+    for (int i = 0; i < N; i++)
+        chunk_ok &= fabsf(ref[i] - out[i]) < 1e-5f;
+
+    test_result("GEN run completes", ok);
+    test_result("GEN == FRACTAL3 per point", point_ok);
+    test_result("GEN bitwise equal for 1/3/8 threads", same);
+    test_result("GEN chunk size independent", chunk_ok);
+
+    free(ref);
+    free(out);
+}
+
+/* ============================================================================================
+   2. POINT SOURCE + CHUNKED LAYOUT
+   ============================================================================================ */
+
+static void test_gen_chunked_layout(void)
+{
+    enum { NX = 100, NY = 37, CW = 32, CH = 16 };
+    enum { CX = (NX + CW - 1) / CW, CY = (NY + CH - 1) / CH };
+    static RE_f32 out[CX * CY * CW * CH];
+
+    RE_NOISE_GEN_DESC d;
+    memset(&d, 0, sizeof(d));
+    d.nx = NX;  d.ny = NY;  d.nz = 1;
+    d.ox = 5.0f; d.oy = -2.0f;
+    d.sx = 0.11f; d.sy = 0.07f;
+    d.chunk_x = CW; d.chunk_y = CH;
+    d.layout = RE_NOISE_GEN_LAYOUT_CHUNKED;
+    d.point_fn = gen_os2d_point;
+    d.out = out;
+
+    RE_NOISE_POOL pool;
+    RE_NOISE_POOL_CREATE(&pool, 4);
+    RE_BOOL ok = RE_NOISE_GEN_RUN(&pool, &d);
+    RE_NOISE_POOL_DESTROY(&pool);
+
+    for (int y = 0; y < NY; y++)
+        for (int x = 0; x < NX; x++)
+        {
+            int c = (y / CH) * CX + (x / CW);
+            RE_f32 v = out[c * CW * CH + (y % CH) * CW + (x % CW)];
+            ok &= v == RE_NOISE_OS2D_SMOOTH_f32(d.ox + d.sx * (RE_f32)x, d.oy + d.sy * (RE_f32)y);
+        }
+
+    test_result("GEN chunked layout, point source", ok);
+}
+
+/* ============================================================================================
+   3. PROGRESS / CANCEL
+   ============================================================================================ */
+
+static void test_gen_progress_cancel(void)
+{
+    enum { NX = 256, NY = 256 };
+    RE_f32 *out = (RE_f32 *)malloc(NX * NY * sizeof(RE_f32));
+
+    RE_NOISE_POOL pool;
+    RE_NOISE_POOL_CREATE(&pool, 4);
+
+    RE_NOISE_FRACTAL_DESC f = { RE_NOISE_BASIS_VALUE3, RE_NOISE_FRACTAL_RIDGED, 5, 2.0f, 0.5f, 1.0f, 0.0f };
+    RE_NOISE_GEN_DESC d;
+    memset(&d, 0, sizeof(d));
+    d.nx = NX;  d.ny = NY;  d.nz = 1;
+    d.sx = d.sy = 0.02f;
+    d.chunk_x = d.chunk_y = 16;
+    d.fractal = &f;
+    d.out = out;
+
+    RE_NOISE_GEN_JOB job;
+    RE_BOOL ok = RE_NOISE_GEN_START(&pool, &job, &d);
+    ok &= !RE_NOISE_GEN_START(&pool, &job, &d);          /* one job per pool */
+
+    RE_f32 last = 0.0f;
+    RE_BOOL monotonic = RE_TRUE;
+    while (!RE_NOISE_GEN_IS_DONE(&job))
+    {
+        RE_f32 p = RE_NOISE_GEN_PROGRESS(&job);
+        monotonic &= p >= last && p <= 1.0f;
+        last = p;
+    }
+    ok &= RE_NOISE_GEN_WAIT(&pool, &job);
+    ok &= RE_NOISE_GEN_PROGRESS(&job) == 1.0f;
+    test_result("GEN progress reaches 1", ok && monotonic);
+
+    /* Cancelled from the first chunk: every worker stops after at most one chunk */
+    d.fractal  = NULL;
+    d.point_fn = gen_cancel_point;
+    d.user     = &job;
+    RE_BOOL started = RE_NOISE_GEN_START(&pool, &job, &d);
+    RE_BOOL full    = RE_NOISE_GEN_WAIT(&pool, &job);
+    test_result("GEN cancel stops early",
+                started && !full && RE_NOISE_GEN_CHUNKS_DONE(&job) <= pool.thread_count &&
+                RE_NOISE_GEN_PROGRESS(&job) < 1.0f);
+
+    RE_NOISE_POOL_DESTROY(&pool);
+    free(out);
+}
+
+/* ============================================================================================
+   TEST RUNNER
+   ============================================================================================ */
+
+void run_noise_gen_tests(void)
+{
+    printf("=== re_noise_gen tests start ===\n");
+
+    test_gen_thread_independent();
+    test_gen_chunked_layout();
+    test_gen_progress_cancel();
+
+    printf("=== re_noise_gen tests finished ===\n");
+}
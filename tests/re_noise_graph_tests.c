@@ -0,0 +1,172 @@
+/**
+ * @file re_noise_graph_tests.c
+ * @brief Unit tests for noise graphs.
+ *
+ *  - fused evaluation against the same chain written by hand
+ *  - compiler: dead-node removal, buffer reuse, invalid input
+ *  - grid fill and the threaded generator with a graph source
+ */
+
+#include "../include/re_noise_graph.h"
+#include "../include/re_noise_gen.h"
+#include "../include/re_test_core.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+static const RE_NOISE_FRACTAL_DESC g_graph_fbm = {
+    RE_NOISE_BASIS_PERLIN3, RE_NOISE_FRACTAL_FBM, 4, 2.0f, 0.5f, 1.0f, 0.0f
+};
+
+/* Warped, remapped, clamped FBM blended with cellular F1 */
+static int build_terrain(RE_NOISE_GRAPH *g)
+{
+    static const RE_f32 cx[3] = { 0.0f, 0.5f, 1.0f };
+    static const RE_f32 cy[3] = { 0.0f, 0.2f, 1.0f };
+
+    RE_NOISE_GRAPH_INIT(g);
+    int w  = RE_NOISE_GRAPH_NOISE(g, RE_NOISE_BASIS_OS3D_SMOOTH, 0.5f, RE_NOISE_GRAPH_X, RE_NOISE_GRAPH_Y, RE_NOISE_GRAPH_Z);
+    int wx = RE_NOISE_GRAPH_WARP(g, RE_NOISE_GRAPH_X, w, 1.5f);
+    int f  = RE_NOISE_GRAPH_FRACTAL(g, &g_graph_fbm, 0.25f, wx, RE_NOISE_GRAPH_Y, RE_NOISE_GRAPH_Z);
+    int r  = RE_NOISE_GRAPH_REMAP(g, f, -1.0f, 1.0f, 0.0f, 1.0f);
+    int c  = RE_NOISE_GRAPH_CLAMP(g, r, 0.0f, 1.0f);
+    int cu = RE_NOISE_GRAPH_CURVE(g, c, cx, cy, 3);
+    int wo = RE_NOISE_GRAPH_WORLEY(g, RE_NOISE_GRAPH_WORLEY_F1, 0.3f, RE_NOISE_GRAPH_X, RE_NOISE_GRAPH_Y, RE_NOISE_GRAPH_Z);
+    return RE_NOISE_GRAPH_SELECT(g, cu, wo, w, 0.0f, 0.25f);
+}
+
+static RE_f32 terrain_by_hand(RE_f32 x, RE_f32 y, RE_f32 z)
+{
+    RE_f32 w  = RE_NOISE_OS3D_SMOOTH_f32(x * 0.5f, y * 0.5f, z * 0.5f);
+    RE_f32 wx = x + w * 1.5f;
+    RE_f32 f  = RE_NOISE_FRACTAL3_f32(&g_graph_fbm, wx * 0.25f, y * 0.25f, z * 0.25f);
+    RE_f32 c  = RE_CLAMP_f32(RE_REMAP_f32(f, -1.0f, 1.0f, 0.0f, 1.0f), 0.0f, 1.0f);
+    RE_f32 cu = (c < 0.5f) ? c * 0.4f : 0.2f + (c - 0.5f) * 1.6f;
+    RE_f32 wo = RE_NOISE_WORLEY3_f32(x * 0.3f, y * 0.3f, z * 0.3f).f1;
+    RE_f32 t  = RE_SMOOTHSTP_f32(-0.25f, 0.25f, w);
+    return cu + (wo - cu) * t;
+}
+
+/* ============================================================================================
+   1. EVALUATION
+   ============================================================================================ */
+
+static void test_graph_matches_hand_chain(void)
+{
+    enum { N = 700 };
+    static RE_f32 xs[N], ys[N], zs[N], out[N];
+    RE_NOISE_GRAPH g;
+
+    int root = build_terrain(&g);
+    RE_BOOL ok = root >= 0 && RE_NOISE_GRAPH_COMPILE(&g, root);
+
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] = (RE_f32)i * 0.071f - 20.0f;
+        ys[i] = (RE_f32)(i % 17) * 0.33f;
+        zs[i] = (RE_f32)(i % 5) * 1.7f - 3.0f;
+    }
+
+    RE_NOISE_GRAPH_EVAL_f32(&g, xs, ys, zs, out, N);
+
+    for (int i = 0; i < N; i++)
+        ok &= fabsf(out[i] - terrain_by_hand(xs[i], ys[i], zs[i])) < 1e-4f;
+
+    test_result("GRAPH fused eval == hand chain", ok);
+}
+
+/* ============================================================================================
+   2. COMPILER
+   ============================================================================================ */
+
+static void test_graph_compiler(void)
+{
+    RE_NOISE_GRAPH g;
+    RE_NOISE_GRAPH_INIT(&g);
+
+    /* A 40-stage chain needs two buffers; the unused branch is dropped */
+    int dead = RE_NOISE_GRAPH_NOISE(&g, RE_NOISE_BASIS_VALUE3, 1.0f, RE_NOISE_GRAPH_X, RE_NOISE_GRAPH_Y, RE_NOISE_GRAPH_Z);
+    int n    = RE_NOISE_GRAPH_SCALE_BIAS(&g, RE_NOISE_GRAPH_X, 1.0f, 0.0f);
+    for (int k = 0; k < 40; k++)
+        n = RE_NOISE_GRAPH_SCALE_BIAS(&g, n, 1.0f, 0.5f);
+
+    RE_BOOL ok = dead >= 0 && RE_NOISE_GRAPH_COMPILE(&g, n);
+    ok &= g.steps == 42 && g.slots <= 2;
+
+    RE_f32 x = 1.0f, y = 0.0f, z = 0.0f, out = 0.0f;
+    RE_NOISE_GRAPH_EVAL_f32(&g, &x, &y, &z, &out, 1);
+    ok &= out == 21.0f;
+
+    /* Invalid inputs, propagation, capacity */
+    RE_BOOL bad_ok = RE_NOISE_GRAPH_ADD(&g, n, 999) == -1;
+    bad_ok &= RE_NOISE_GRAPH_CLAMP(&g, RE_NOISE_GRAPH_ADD(&g, -1, n), 0.0f, 1.0f) == -1;
+    while (g.count < RE_NOISE_GRAPH_MAX_NODES)
+        RE_NOISE_GRAPH_CONST(&g, 1.0f);
+    bad_ok &= RE_NOISE_GRAPH_CONST(&g, 1.0f) == -1;
+    bad_ok &= !RE_NOISE_GRAPH_COMPILE(&g, RE_NOISE_GRAPH_MAX_NODES);
+
+    /* An edit invalidates the compiled form: evaluation leaves out untouched */
+    RE_NOISE_GRAPH_INIT(&g);
+    RE_NOISE_GRAPH_COMPILE(&g, RE_NOISE_GRAPH_Y);
+    RE_NOISE_GRAPH_CONST(&g, 3.0f);
+    out = -7.0f;
+    RE_NOISE_GRAPH_EVAL_f32(&g, &x, &y, &z, &out, 1);
+    bad_ok &= out == -7.0f;
+
+    test_result("GRAPH compile: dead nodes dropped, buffers reused", ok);
+    test_result("GRAPH invalid input / full graph rejected", bad_ok);
+}
+
+/* ============================================================================================
+   3. GRID / GENERATOR
+   ============================================================================================ */
+
+static void test_graph_grid_and_gen(void)
+{
+    enum { NX = 45, NY = 23, NZ = 3, N = NX * NY * NZ };
+    static RE_f32 grid[N], gen[N];
+    const RE_f32 ox = -4.0f, oy = 2.0f, oz = 0.5f, sx = 0.37f, sy = 0.29f, sz = 0.8f;
+    RE_NOISE_GRAPH g;
+
+    RE_NOISE_GRAPH_COMPILE(&g, build_terrain(&g));
+    RE_NOISE_GRAPH_FILL_GRID_f32(&g, grid, ox, oy, oz, sx, sy, sz, NX, NY, NZ);
+
+    RE_BOOL grid_ok = RE_TRUE;
+    for (int k = 0; k < NZ; k++)
+    for (int j = 0; j < NY; j++)
+    for (int i = 0; i < NX; i++)
+        grid_ok &= fabsf(grid[(k * NY + j) * NX + i]
+                         - terrain_by_hand(ox + i * sx, oy + j * sy, oz + k * sz)) < 1e-4f;
+
+    RE_NOISE_GEN_DESC d;
+    memset(&d, 0, sizeof(d));
+    d.nx = NX;  d.ny = NY;  d.nz = NZ;
+    d.ox = ox;  d.oy = oy;  d.oz = oz;
+    d.sx = sx;  d.sy = sy;  d.sz = sz;
+    d.chunk_x = 16; d.chunk_y = 8; d.chunk_z = 2;
+    d.graph = &g;
+    d.out = gen;
+
+    RE_NOISE_POOL pool;
+    RE_BOOL gen_ok = RE_NOISE_POOL_CREATE(&pool, 3);
+    gen_ok &= RE_NOISE_GEN_RUN(&pool, &d);
+    RE_NOISE_POOL_DESTROY(&pool);
+
+    for (int i = 0; i < N; i++)
+        gen_ok &= fabsf(gen[i] - grid[i]) < 1e-5f;
+
+    test_result("GRAPH fill grid == per-point", grid_ok);
+    test_result("GRAPH as generator source == fill grid", gen_ok);
+}
+
+void run_noise_graph_tests(void)
+{
+    printf("=== re_noise_graph tests start ===\n");
+
+    test_graph_matches_hand_chain();
+    test_graph_compiler();
+    test_graph_grid_and_gen();
+
+    printf("=== re_noise_graph tests finished ===\n");
+}
@@ -0,0 +1,144 @@
+/**
+ * @file re_noise_lod_tests.c
+ * @brief Unit tests for LOD noise pyramids.
+ *
+ *  - per-level octave counts from the Nyquist rule, level dimensions
+ *  - one-pass pyramid == each level evaluated on its own == the fractal with that level's octaves
+ */
+
+#include "../include/re_noise_lod.h"
+#include "../include/re_test_core.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/* ============================================================================================
+   1. LEVELS
+   ============================================================================================ */
+
+static void test_lod_levels(void)
+{
+    static const RE_NOISE_FRACTAL_DESC fbm = {
+        RE_NOISE_BASIS_VALUE3, RE_NOISE_FRACTAL_FBM, 8, 2.0f, 0.5f, 1.0f, 0.0f
+    };
+
+    RE_NOISE_LOD_DESC d;
+    memset(&d, 0, sizeof(d));
+    d.fractal = &fbm;
+    d.nx = 67;  d.ny = 33;  d.nz = 1;
+    d.sx = d.sy = 1.0f / 32.0f;
+    d.levels = 6;
+
+    /* step 1/32: octaves 1..16 fit (16 / 32 = 0.5), each level halves it */
+    static const int expect[6] = { 5, 4, 3, 2, 1, 1 };
+    RE_BOOL ok = RE_TRUE;
+    for (int L = 0; L < 6; L++) ok &= RE_NOISE_LOD_LEVEL_OCTAVES(&d, L) == expect[L];
+
+    /* A looser limit keeps one more octave; amp_epsilon still caps the count */
+    d.nyquist = 1.0f;
+    ok &= RE_NOISE_LOD_LEVEL_OCTAVES(&d, 0) == 6;
+
+    /* Mirrored axes: the step magnitude decides, whatever the sign */
+    d.nyquist = 0.0f;
+    d.sx = -1.0f / 32.0f;  d.sy = 1.0f / 128.0f;
+    ok &= RE_NOISE_LOD_LEVEL_OCTAVES(&d, 0) == 5 && RE_NOISE_LOD_LEVEL_OCTAVES(&d, 2) == 3;
+    d.sx = d.sy = -1.0f / 32.0f;
+    ok &= RE_NOISE_LOD_LEVEL_OCTAVES(&d, 1) == 4;
+    d.sx = d.sy = 1.0f / 128.0f;  d.sz = -1.0f / 32.0f;  d.nz = 4;
+    ok &= RE_NOISE_LOD_LEVEL_OCTAVES(&d, 0) == 5;
+    d.sx = d.sy = 1.0f / 32.0f;  d.sz = 0.0f;  d.nz = 1;
+    d.nyquist = 1.0f;
+
+    RE_NOISE_FRACTAL_DESC cut = fbm;
+    cut.amp_epsilon = 0.1f;
+    d.fractal = &cut;
+    ok &= RE_NOISE_LOD_LEVEL_OCTAVES(&d, 0) == 4;
+
+    int nx, ny, nz;
+    RE_NOISE_LOD_LEVEL_DIMS(&d, 3, &nx, &ny, &nz);
+    RE_BOOL dims_ok = nx == 9 && ny == 5 && nz == 1;
+    d.nz = 5;
+    RE_NOISE_LOD_LEVEL_DIMS(&d, 2, &nx, &ny, &nz);
+    dims_ok &= nx == 17 && ny == 9 && nz == 2;
+
+    test_result("LOD octaves per level follow the Nyquist limit", ok);
+    test_result("LOD level dimensions", dims_ok);
+}
+
+/* ============================================================================================
+   2. PYRAMID
+   ============================================================================================ */
+
+static RE_BOOL check_pyramid(const RE_NOISE_FRACTAL_DESC *f, int nx, int ny, int nz, int levels)
+{
+    enum { MAX = 80 * 40 * 12 };
+    static RE_f32 build[RE_NOISE_LOD_MAX_LEVELS][MAX], single[MAX];
+
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 31u);
+
+    RE_NOISE_LOD_DESC d;
+    memset(&d, 0, sizeof(d));
+    d.fractal = f;
+    d.ctx = &ctx;
+    d.nx = nx;  d.ny = ny;  d.nz = nz;
+    d.ox = -5.3f;  d.oy = 2.1f;  d.oz = 0.7f;
+    d.sx = d.sy = d.sz = 0.03f;
+    d.levels = levels;
+    for (int L = 0; L < levels; L++) d.out[L] = build[L];
+
+    RE_NOISE_LOD_BUILD(&d);
+
+    RE_BOOL ok = RE_TRUE;
+    for (int L = 0; L < levels; L++)
+    {
+        int lx, ly, lz;
+        RE_NOISE_LOD_LEVEL_DIMS(&d, L, &lx, &ly, &lz);
+
+        RE_NOISE_LOD_DESC one = d;
+        one.out[L] = single;
+        RE_NOISE_LOD_FILL_LEVEL(&one, L);
+
+        RE_NOISE_FRACTAL_DESC ref = *f;
+        ref.octaves = RE_NOISE_LOD_LEVEL_OCTAVES(&d, L);
+        RE_f32 s = 0.03f * (RE_f32)(1 << L);
+
+        for (int k = 0; k < lz; k++)
+        for (int j = 0; j < ly; j++)
+        for (int i = 0; i < lx; i++)
+        {
+            int idx = (k * ly + j) * lx + i;
+            RE_f32 r = RE_NOISE_FRACTAL3_CTX_f32(&ctx, &ref, d.ox + s * (RE_f32)i, d.oy + s * (RE_f32)j, d.oz + s * (RE_f32)k);
+            ok &= fabsf(build[L][idx] - r) < 1e-4f && fabsf(single[idx] - r) < 1e-4f;
+        }
+    }
+    return ok;
+}
+
+static void test_lod_pyramid(void)
+{
+    static const RE_NOISE_FRACTAL_DESC fbm = {
+        RE_NOISE_BASIS_PERLIN3, RE_NOISE_FRACTAL_FBM, 7, 2.0f, 0.5f, 1.0f, 0.0f
+    };
+    static const RE_NOISE_FRACTAL_DESC ridged = {
+        RE_NOISE_BASIS_OS3D_FAST, RE_NOISE_FRACTAL_RIDGED, 6, 2.1f, 0.55f, 1.0f, 0.0f
+    };
+
+    /* 2D with odd sizes and rows wider than one band block; 3D ridged */
+    RE_BOOL ok2 = check_pyramid(&fbm, 300, 21, 1, 5);
+    RE_BOOL ok3 = check_pyramid(&ridged, 37, 19, 11, 4);
+
+    test_result("LOD 2D pyramid == per-level fill == fractal with level octaves", ok2);
+    test_result("LOD 3D ridged pyramid == per-level fill == fractal with level octaves", ok3);
+}
+
+void run_noise_lod_tests(void)
+{
+    printf("=== re_noise_lod tests start ===\n");
+
+    test_lod_levels();
+    test_lod_pyramid();
+
+    printf("=== re_noise_lod tests finished ===\n");
+}
@@ -15,6 +15,7 @@
 
 #include <stdio.h>
 #include <math.h>
+#include <string.h>
 
 /* ============================================================================================
    Helpers
@@ -57,6 +58,74 @@ static void test_hash_float(void)
    2. VALUE NOISE
    ============================================================================================ */
 
+/* Mode-3 SIMD hashes == RE_PCG_MIX32 / RE_HASH3D_PCG_SEED / RE_HASH_TO_GRAD12, lane for lane */
+static void test_pcg_hash_simd_matches_scalar(void)
+{
+    RE_BOOL ok = RE_TRUE;
+
+    /* Scalar-only builds have no SIMD hash to compare */
+#if !defined(RE_SIMD_NONE)
+    RE_u32 s = 0xC0FFEE11u;
+
+    for (int it = 0; it < 4096; it++)
+    {
+        /* Lattice-sized coordinates on even rounds, the full 32-bit range on odd ones */
+        RE_i32 x[8], y[8], z[8];
+        RE_u32 m[8], h[8], g[8], seed;
+        for (int l = 0; l < 8; l++)
+        {
+            s = s * 1664525u + 1013904223u;  x[l] = (it & 1) ? (RE_i32)s : (RE_i32)(s >> 20) - 2048;
+            s = s * 1664525u + 1013904223u;  y[l] = (it & 1) ? (RE_i32)s : (RE_i32)(s >> 20) - 2048;
+            s = s * 1664525u + 1013904223u;  z[l] = (it & 1) ? (RE_i32)s : (RE_i32)(s >> 20) - 2048;
+        }
+        s = s * 1664525u + 1013904223u;
+        seed = (it & 7) ? s : 0u;
+
+#if defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+        for (int q = 0; q < 8; q += 4)
+        {
+            __m128i vx = _mm_loadu_si128((const __m128i *)(x + q));
+            __m128i vh = RE_HASH3D_PCG_SEED_X4_sse(seed, vx, _mm_loadu_si128((const __m128i *)(y + q)),
+                                                   _mm_loadu_si128((const __m128i *)(z + q)));
+            _mm_storeu_si128((__m128i *)(m + q), RE_PCG_MIX32_X4_sse(vx));
+            _mm_storeu_si128((__m128i *)(h + q), vh);
+            _mm_storeu_si128((__m128i *)(g + q), RE_HASH_TO_GRAD12_X4_sse(vh));
+        }
+        for (int l = 0; l < 8; l++)
+            ok &= m[l] == RE_PCG_MIX32((RE_u32)x[l]) && h[l] == RE_HASH3D_PCG_SEED(seed, x[l], y[l], z[l])
+               && g[l] == RE_HASH_TO_GRAD12(h[l]);
+#endif
+
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+        __m256i wx = _mm256_loadu_si256((const __m256i *)x);
+        __m256i wh = RE_HASH3D_PCG_SEED_X8_avx2(seed, wx, _mm256_loadu_si256((const __m256i *)y),
+                                                _mm256_loadu_si256((const __m256i *)z));
+        _mm256_storeu_si256((__m256i *)m, RE_PCG_MIX32_X8_avx2(wx));
+        _mm256_storeu_si256((__m256i *)h, wh);
+        _mm256_storeu_si256((__m256i *)g, RE_HASH_TO_GRAD12_X8_avx2(wh));
+        for (int l = 0; l < 8; l++)
+            ok &= m[l] == RE_PCG_MIX32((RE_u32)x[l]) && h[l] == RE_HASH3D_PCG_SEED(seed, x[l], y[l], z[l])
+               && g[l] == RE_HASH_TO_GRAD12(h[l]);
+#endif
+
+#if defined(RE_SIMD_NEON)
+        for (int q = 0; q < 8; q += 4)
+        {
+            uint32x4_t vh = RE_HASH3D_PCG_SEED_X4_neon(seed, vld1q_s32(x + q), vld1q_s32(y + q), vld1q_s32(z + q));
+            vst1q_u32(m + q, RE_PCG_MIX32_X4_neon(vreinterpretq_u32_s32(vld1q_s32(x + q))));
+            vst1q_u32(h + q, vh);
+            vst1q_u32(g + q, RE_HASH_TO_GRAD12_X4_neon(vh));
+        }
+        for (int l = 0; l < 8; l++)
+            ok &= m[l] == RE_PCG_MIX32((RE_u32)x[l]) && h[l] == RE_HASH3D_PCG_SEED(seed, x[l], y[l], z[l])
+               && g[l] == RE_HASH_TO_GRAD12(h[l]);
+#endif
+    }
+#endif
+
+    test_result("HASH PCG mix / seeded hash / grad12 SIMD == scalar", ok);
+}
+
 static void test_value2(void)
 {
     RE_f32 a = RE_NOISE_VALUE2_f32(10.1f, 20.5f);
@@ -102,6 +171,218 @@ static void test_perlin3_smoothness(void)
     test_result("PERLIN smoothness", fabsf(a - b) < 0.2f);
 }
 
+static void test_perlin3_continuity(void)
+{
+    /* Crossing every cube face must not jump */
+    RE_BOOL ok = RE_TRUE;
+    for (int i = -3; i <= 3; i++)
+    {
+        RE_f32 c = (RE_f32)i;
+        ok &= approx_f32(RE_NOISE_PERLIN3_f32_scalar(c - 1e-4f, 0.3f, 0.6f),
+                         RE_NOISE_PERLIN3_f32_scalar(c + 1e-4f, 0.3f, 0.6f), 1e-2f);
+        ok &= approx_f32(RE_NOISE_PERLIN3_f32_scalar(0.3f, c - 1e-4f, 0.6f),
+                         RE_NOISE_PERLIN3_f32_scalar(0.3f, c + 1e-4f, 0.6f), 1e-2f);
+        ok &= approx_f32(RE_NOISE_PERLIN3_f32_scalar(0.3f, 0.6f, c - 1e-4f),
+                         RE_NOISE_PERLIN3_f32_scalar(0.3f, 0.6f, c + 1e-4f), 1e-2f);
+    }
+    test_result("PERLIN continuous across cells", ok);
+}
+
+static void test_perlin3_simd_matches_scalar(void)
+{
+    enum { N = 67 };
+    RE_f32 xs[N], ys[N], zs[N], out[N];
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] = -20.0f + (RE_f32)i * 0.731f;
+        ys[i] =  13.0f - (RE_f32)i * 0.377f;
+        zs[i] =  (RE_f32)(i % 7) * 1.913f - 5.0f;
+    }
+
+    RE_NOISE_PERLIN3_BATCH_f32(xs, ys, zs, out, N);
+
+    RE_BOOL batch_ok = RE_TRUE, point_ok = RE_TRUE;
+    for (int i = 0; i < N; i++)
+    {
+        RE_f32 ref = RE_NOISE_PERLIN3_f32_scalar(xs[i], ys[i], zs[i]);
+        batch_ok &= approx_f32(out[i], ref, 1e-5f);
+        point_ok &= approx_f32(RE_NOISE_PERLIN3_f32(xs[i], ys[i], zs[i]), ref, 1e-5f);
+    }
+
+    test_result("PERLIN batch == scalar", batch_ok);
+    test_result("PERLIN dispatch == scalar", point_ok);
+}
+
+static void test_perlin3_f64(void)
+{
+    enum { N = 71 };
+    RE_f64 xs[N], ys[N], zs[N], out[N];
+
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 8u);
+
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] = -20.0 + (RE_f64)i * 0.731;
+        ys[i] =  13.0 - (RE_f64)i * 0.377;
+        zs[i] =  (RE_f64)(i % 7) * 1.913 - 5.0;
+    }
+
+    RE_NOISE_PERLIN3_BATCH_CTX_f64(&ctx, xs, ys, zs, out, N);
+
+    RE_BOOL f32_ok = RE_TRUE, batch_ok = RE_TRUE;
+    for (int i = 0; i < N; i++)
+    {
+        RE_f64 p = RE_NOISE_PERLIN3_CTX_f64(&ctx, xs[i], ys[i], zs[i]);
+        f32_ok   &= fabs(p - (RE_f64)RE_NOISE_PERLIN3_CTX_f32_scalar(&ctx, (RE_f32)xs[i], (RE_f32)ys[i],
+                                                                      (RE_f32)zs[i])) < 1e-5;
+        batch_ok &= fabs(out[i] - p) < 1e-12;
+    }
+
+    /* Far from the origin: same batch/point agreement, and a 2^40 offset keeps full resolution */
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] += 1099511627776.0;
+        zs[i] -= 3298534883328.0;
+    }
+    RE_NOISE_PERLIN3_BATCH_CTX_f64(&ctx, xs, ys, zs, out, N);
+    for (int i = 0; i < N; i++)
+        batch_ok &= fabs(out[i] - RE_NOISE_PERLIN3_CTX_f64(&ctx, xs[i], ys[i], zs[i])) < 1e-12;
+
+    test_result("PERLIN3 f64 == f32", f32_ok);
+    test_result("PERLIN3 f64 batch == per-point", batch_ok);
+}
+
+static void test_f64_large_coordinates(void)
+{
+    const RE_f64 B = 4294967296.0;   /* 2^32: the old RE_i32 lattice wrapped here */
+    RE_BOOL cont_ok = RE_TRUE;
+    int differ = 0, n = 0;
+
+    /* Continuous across the 2^31 / 2^32 / 2^40 lattice lines. The probes sit 1e-3 either side
+       (the ulp at 2^40 is 2.4e-4), so a and b straddle the line; over that 2e-3 step the noise
+       moves by < 1e-2, while a lattice break jumps by ~0.5. */
+    const RE_f64 lines[3] = { 2147483648.0, B, 1099511627776.0 };
+    for (int k = 0; k < 3; k++)
+    {
+        RE_f64 a = lines[k] - 1e-3, b = lines[k] + 1e-3;
+        cont_ok &= a < lines[k] && lines[k] < b;
+        cont_ok &= fabs(RE_NOISE_PERLIN3_f64(a, 0.3, 0.6)   - RE_NOISE_PERLIN3_f64(b, 0.3, 0.6))   < 2e-2;
+        cont_ok &= fabs(RE_NOISE_PERLIN2_f64(0.3, a)        - RE_NOISE_PERLIN2_f64(0.3, b))        < 2e-2;
+        cont_ok &= fabs(RE_NOISE_PERLIN1_f64(a)             - RE_NOISE_PERLIN1_f64(b))             < 2e-2;
+        cont_ok &= fabs(RE_NOISE_VALUE2_f64(a, 0.7)         - RE_NOISE_VALUE2_f64(b, 0.7))         < 2e-2;
+        cont_ok &= fabs(RE_NOISE_OS2D_SMOOTH_f64(a, 0.7)    - RE_NOISE_OS2D_SMOOTH_f64(b, 0.7))    < 2e-2;
+        cont_ok &= fabs(RE_NOISE_OS2D_FAST_f64(a, 0.7)      - RE_NOISE_OS2D_FAST_f64(b, 0.7))      < 2e-2;
+        cont_ok &= fabs(RE_NOISE_OS3D_SMOOTH_f64(a, 0.2, 0.9) - RE_NOISE_OS3D_SMOOTH_f64(b, 0.2, 0.9)) < 2e-2;
+        cont_ok &= fabs(RE_NOISE_OS3D_FAST_f64(a, 0.2, 0.9) - RE_NOISE_OS3D_FAST_f64(b, 0.2, 0.9)) < 2e-2;
+    }
+
+    /* One 2^32 period away is a different field, not a copy */
+    for (int i = 0; i < 50; i++)
+    {
+        RE_f64 x = (RE_f64)i * 0.617 + 0.21, y = (RE_f64)i * 0.293 + 0.37, z = 0.45;
+        differ += fabs(RE_NOISE_PERLIN3_f64(x, y, z)   - RE_NOISE_PERLIN3_f64(x + B, y, z))   > 1e-6;
+        differ += fabs(RE_NOISE_PERLIN2_f64(x, y)      - RE_NOISE_PERLIN2_f64(x, y + B))      > 1e-6;
+        differ += fabs(RE_NOISE_VALUE2_f64(x, y)       - RE_NOISE_VALUE2_f64(x + B, y))       > 1e-6;
+        differ += fabs(RE_NOISE_OS2D_SMOOTH_f64(x, y)  - RE_NOISE_OS2D_SMOOTH_f64(x + B, y))  > 1e-6;
+        differ += fabs(RE_NOISE_OS3D_SMOOTH_f64(x, y, z) - RE_NOISE_OS3D_SMOOTH_f64(x + B, y, z)) > 1e-6;
+        n += 5;
+    }
+
+    test_result("f64 noise continuous across 64-bit lattice lines", cont_ok);
+    test_result("f64 noise does not alias at 2^32", differ > n * 8 / 10);
+}
+
+static void test_perlin2_perlin1(void)
+{
+    enum { N = 75 };
+    RE_f32 xs[N], ys[N], out2[N], out1[N];
+    RE_f64 xd[N], yd[N], o2d[N], o1d[N];
+
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 42u);
+
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] = -30.0f + (RE_f32)i * 0.813f;
+        ys[i] =  11.0f - (RE_f32)i * 0.291f;
+        xd[i] = xs[i];
+        yd[i] = ys[i];
+    }
+
+    RE_NOISE_PERLIN2_BATCH_CTX_f32(&ctx, xs, ys, out2, N);
+    RE_NOISE_PERLIN1_BATCH_CTX_f32(&ctx, xs, out1, N);
+    RE_NOISE_PERLIN2_BATCH_CTX_f64(&ctx, xd, yd, o2d, N);
+    RE_NOISE_PERLIN1_BATCH_CTX_f64(&ctx, xd, o1d, N);
+
+    RE_BOOL batch_ok = RE_TRUE, f64_ok = RE_TRUE;
+    for (int i = 0; i < N; i++)
+    {
+        batch_ok &= approx_f32(out2[i], RE_NOISE_PERLIN2_CTX_f32(&ctx, xs[i], ys[i]), 1e-5f);
+        batch_ok &= approx_f32(out1[i], RE_NOISE_PERLIN1_CTX_f32(&ctx, xs[i]), 1e-5f);
+        f64_ok   &= fabs(o2d[i] - (RE_f64)out2[i]) < 1e-4 && fabs(o1d[i] - (RE_f64)out1[i]) < 1e-4;
+    }
+
+    /* Zero on the lattice, bounded, continuous across cell edges */
+    RE_BOOL shape_ok = RE_TRUE;
+    for (int i = -4; i <= 4; i++)
+    {
+        RE_f32 c = (RE_f32)i;
+        shape_ok &= RE_NOISE_PERLIN2_f32(c, 2.0f) == 0.0f && RE_NOISE_PERLIN1_f32(c) == 0.0f;
+        shape_ok &= approx_f32(RE_NOISE_PERLIN2_f32(c - 1e-4f, 0.37f), RE_NOISE_PERLIN2_f32(c + 1e-4f, 0.37f), 1e-2f);
+        shape_ok &= approx_f32(RE_NOISE_PERLIN2_f32(0.61f, c - 1e-4f), RE_NOISE_PERLIN2_f32(0.61f, c + 1e-4f), 1e-2f);
+        shape_ok &= approx_f32(RE_NOISE_PERLIN1_f32(c - 1e-4f), RE_NOISE_PERLIN1_f32(c + 1e-4f), 1e-2f);
+    }
+
+    RE_f32 lo = 0.0f, hi = 0.0f;
+    for (int k = 0; k < 4000; k++)
+    {
+        RE_f32 p = RE_NOISE_PERLIN2_f32((RE_f32)(k % 63) * 0.173f, (RE_f32)(k / 63) * 0.219f);
+        RE_f32 q = RE_NOISE_PERLIN1_f32((RE_f32)k * 0.0571f);
+        lo = (p < lo) ? p : lo;  hi = (p > hi) ? p : hi;
+        lo = (q < lo) ? q : lo;  hi = (q > hi) ? q : hi;
+    }
+    shape_ok &= lo >= -1.0f && hi <= 1.0f && hi - lo > 1.0f;
+
+    test_result("PERLIN2 / PERLIN1 batch == per-point", batch_ok);
+    test_result("PERLIN2 / PERLIN1 f64 == f32", f64_ok);
+    test_result("PERLIN2 / PERLIN1 zero on lattice, bounded, continuous", shape_ok);
+}
+
+static void test_fill_grid_matches_point(void)
+{
+    enum { NX = 37, NY = 5, NZ = 3 };
+    static RE_f32 grid[NX * NY * NZ];
+    const RE_f32 ox = -3.3f, oy = 1.7f, oz = -0.45f;
+    const RE_f32 sx = 0.137f, sy = 0.61f, sz = 0.8f;
+
+    RE_BOOL v2_ok = RE_TRUE, v3_ok = RE_TRUE, p3_ok = RE_TRUE;
+
+    RE_NOISE_VALUE2_FILL_GRID_f32(grid, ox, oy, sx, sy, NX, NY);
+    for (int j = 0; j < NY; j++)
+        for (int i = 0; i < NX; i++)
+            v2_ok &= approx_f32(grid[j * NX + i],
+                                RE_NOISE_VALUE2_f32(ox + i * sx, oy + j * sy), 1e-5f);
+
+    RE_NOISE_VALUE3_FILL_GRID_f32(grid, ox, oy, oz, sx, sy, sz, NX, NY, NZ);
+    for (int k = 0; k < NZ; k++)
+        for (int j = 0; j < NY; j++)
+            for (int i = 0; i < NX; i++)
+                v3_ok &= approx_f32(grid[(k * NY + j) * NX + i],
+                                    RE_NOISE_VALUE3_f32(ox + i * sx, oy + j * sy, oz + k * sz), 1e-5f);
+
+    RE_NOISE_PERLIN3_FILL_GRID_f32(grid, ox, oy, oz, sx, sy, sz, NX, NY, NZ);
+    for (int k = 0; k < NZ; k++)
+        for (int j = 0; j < NY; j++)
+            for (int i = 0; i < NX; i++)
+                p3_ok &= approx_f32(grid[(k * NY + j) * NX + i],
+                                    RE_NOISE_PERLIN3_f32_scalar(ox + i * sx, oy + j * sy, oz + k * sz), 1e-5f);
+
+    test_result("VALUE2 fill grid == per-point", v2_ok);
+    test_result("VALUE3 fill grid == per-point", v3_ok);
+    test_result("PERLIN3 fill grid == per-point", p3_ok);
+}
+
 /* ============================================================================================
    4. OpenSimplex3D (FAST + SMOOTH)
    ============================================================================================ */
@@ -114,6 +395,59 @@ static void test_os3d_fast(void)
     test_result("OS3D FAST deterministic", approx_f32(a, b, 1e-6f));
 }
 
+static void test_os3d_fast_continuity(void)
+{
+    RE_BOOL ok = RE_TRUE;
+    int nonzero = 0;
+
+    RE_f32 prev = RE_NOISE_OS3D_FAST_f32(-3.0f, -1.0f, 0.25f);
+    for (int i = 1; i <= 6000; i++)
+    {
+        RE_f32 t = (RE_f32)i * 1e-3f;
+        RE_f32 n = RE_NOISE_OS3D_FAST_f32(-3.0f + t, -1.0f + 0.61f * t, 0.25f + 0.37f * t);
+
+        ok &= fabsf(n - prev) < 2e-2f && fabsf(n) <= 1.05f;
+        nonzero += (n != 0.0f);
+        prev = n;
+    }
+
+    test_result("OS3D FAST continuous, in range", ok && nonzero > 5900);
+    test_result("OPENSIMPLEX3D_FAST == OS3D_FAST",
+                RE_NOISE_OPENSIMPLEX3D_FAST_f32(1.3f, -2.2f, 0.4f) == RE_NOISE_OS3D_FAST_f32(1.3f, -2.2f, 0.4f));
+}
+
+static void test_os3d_batch_matches_scalar(void)
+{
+    enum { N = 45 };
+    RE_f32 xs[N], ys[N], zs[N], fast[N], smooth[N];
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] = -7.3f + (RE_f32)i * 0.377f;
+        ys[i] =  2.1f - (RE_f32)i * 0.219f;
+        zs[i] = (RE_f32)(i % 5) * 1.13f - 2.0f;
+    }
+
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 4242u);
+
+    RE_BOOL ok_fast = RE_TRUE, ok_smooth = RE_TRUE;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        const RE_NOISE_CONTEXT *c = pass ? &ctx : &RE_NOISE_DEFAULT_CONTEXT;
+        RE_NOISE_OS3D_FAST_BATCH_CTX_f32(c, xs, ys, zs, fast, N);
+        RE_NOISE_OS3D_SMOOTH_BATCH_CTX_f32(c, xs, ys, zs, smooth, N);
+
+        for (int i = 0; i < N; i++)
+        {
+            ok_fast   &= approx_f32(fast[i],   RE_NOISE_OS3D_FAST_CTX_f32(c, xs[i], ys[i], zs[i]), 1e-5f);
+            ok_smooth &= approx_f32(smooth[i], RE_NOISE_OS3D_SMOOTH_CTX_f32(c, xs[i], ys[i], zs[i]), 1e-5f);
+        }
+    }
+
+    test_result("OS3D FAST batch == scalar", ok_fast);
+    test_result("OS3D SMOOTH batch == scalar", ok_smooth);
+}
+
 static void test_os3d_smooth(void)
 {
     RE_f32 a = RE_NOISE_OS3D_SMOOTH_f32(0.5f, 0.25f, 0.75f);
@@ -142,6 +476,69 @@ static void test_os2d_smooth(void)
     test_result("OS2D SMOOTH deterministic", approx_f32(a, b, 1e-6f));
 }
 
+static void test_os_smooth_continuity(void)
+{
+    /* Dense walk: consecutive samples may only differ by a bounded slope */
+    RE_BOOL ok3 = RE_TRUE, ok2 = RE_TRUE;
+    int nonzero = 0;
+
+    RE_f32 p3 = RE_NOISE_OS3D_SMOOTH_f32(-3.0f, -1.0f, 0.25f);
+    RE_f32 p2 = RE_NOISE_OS2D_SMOOTH_f32(-3.0f, -1.0f);
+    for (int i = 1; i <= 6000; i++)
+    {
+        RE_f32 t  = (RE_f32)i * 1e-3f;
+        RE_f32 n3 = RE_NOISE_OS3D_SMOOTH_f32(-3.0f + t, -1.0f + 0.61f * t, 0.25f + 0.37f * t);
+        RE_f32 n2 = RE_NOISE_OS2D_SMOOTH_f32(-3.0f + t, -1.0f + 0.61f * t);
+
+        ok3 &= fabsf(n3 - p3) < 2e-2f && fabsf(n3) <= 1.05f;
+        ok2 &= fabsf(n2 - p2) < 2e-2f && fabsf(n2) <= 1.05f;
+        nonzero += (n3 != 0.0f);
+        p3 = n3;
+        p2 = n2;
+    }
+
+    test_result("OS3D SMOOTH continuous, in range", ok3 && nonzero > 5900);
+    test_result("OS2D SMOOTH continuous, in range", ok2);
+}
+
+static void test_periodic_tiles(void)
+{
+    const RE_f32 U2 = 0.211324865405187f;
+    RE_BOOL wrap_ok = RE_TRUE, inner_ok = RE_TRUE;
+
+    for (int k = 0; k < 200; k++)
+    {
+        RE_f32 x = (RE_f32)(k % 20) * 0.31f + 0.013f;
+        RE_f32 y = (RE_f32)(k / 20) * 0.47f + 0.029f;
+        RE_f32 z = (RE_f32)k * 0.023f;
+
+        /* One period apart (either direction) → same value */
+        RE_f32 p3 = RE_NOISE_PERLIN3_PERIODIC_f32(x, y, z, 6, 5, 4);
+        wrap_ok &= approx_f32(p3, RE_NOISE_PERLIN3_PERIODIC_f32(x + 6.f, y - 5.f, z + 8.f, 6, 5, 4), 1e-4f);
+
+        RE_f32 v2 = RE_NOISE_VALUE2_PERIODIC_f32(x, y, 6, 5);
+        wrap_ok &= approx_f32(v2, RE_NOISE_VALUE2_PERIODIC_f32(x - 12.f, y + 5.f, 6, 5), 1e-4f);
+
+        RE_f32 o2 = RE_NOISE_OS2D_SMOOTH_PERIODIC_f32(x, y, 6, 5);
+        wrap_ok &= approx_f32(o2, RE_NOISE_OS2D_SMOOTH_PERIODIC_f32(x + 6.f, y + 10.f, 6, 5), 1e-4f);
+
+        /* Unwrapped axes (period 0) reproduce the regular functions */
+        inner_ok &= approx_f32(RE_NOISE_PERLIN3_PERIODIC_f32(x, y, z, 0, 0, 0),
+                               RE_NOISE_PERLIN3_f32_scalar(x, y, z), 1e-5f);
+        inner_ok &= approx_f32(RE_NOISE_VALUE2_PERIODIC_f32(x, y, 0, 0), RE_NOISE_VALUE2_f32(x, y), 1e-5f);
+        RE_f32 t = (x + y) * U2;
+        inner_ok &= approx_f32(RE_NOISE_OS2D_SMOOTH_PERIODIC_f32(x, y, 0, 0),
+                               RE_NOISE_OS2D_SMOOTH_f32(x - t, y - t), 1e-4f);
+    }
+
+    /* Inside the first period, away from the wrapped cells, nothing changes */
+    inner_ok &= approx_f32(RE_NOISE_PERLIN3_PERIODIC_f32(1.3f, 2.6f, 0.4f, 8, 8, 8),
+                           RE_NOISE_PERLIN3_f32_scalar(1.3f, 2.6f, 0.4f), 1e-6f);
+
+    test_result("PERIODIC noise repeats every period", wrap_ok);
+    test_result("PERIODIC noise == regular when unwrapped", inner_ok);
+}
+
 /* ============================================================================================
    6. FRACTAL VARIANTS
    ============================================================================================ */
@@ -164,8 +561,191 @@ static void test_ridged(void)
     test_result("RIDGED non-negative", v >= 0.f);
 }
 
+static void test_fractal_batch(void)
+{
+    enum { N = 43 };
+    RE_f32 xs[N], ys[N], zs[N], out[N];
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] =  1.3f + (RE_f32)i * 0.271f;
+        ys[i] = -2.9f + (RE_f32)i * 0.113f;
+        zs[i] =  (RE_f32)(i % 4) * 0.77f;
+    }
+
+    RE_NOISE_FRACTAL_DESC d = { RE_NOISE_BASIS_VALUE3, RE_NOISE_FRACTAL_FBM, 6, 2.0f, 0.5f, 1.0f, 0.0f };
+
+    /* Value basis reproduces the scalar fractal functions */
+    RE_BOOL fbm_ok = RE_TRUE, turb_ok = RE_TRUE, ridged_ok = RE_TRUE;
+
+    RE_NOISE_FRACTAL3_BATCH_f32(&d, xs, ys, zs, out, N);
+    for (int i = 0; i < N; i++)
+        fbm_ok &= approx_f32(out[i], RE_NOISE_VALUE3_FBM_f32(xs[i], ys[i], zs[i], 6, 2.0f, 0.5f), 1e-4f);
+
+    d.type = RE_NOISE_FRACTAL_TURBULENCE;
+    RE_NOISE_FRACTAL3_BATCH_f32(&d, xs, ys, zs, out, N);
+    for (int i = 0; i < N; i++)
+        turb_ok &= approx_f32(out[i], RE_NOISE_VALUE3_TURBULENCE_f32(xs[i], ys[i], zs[i], 6, 2.0f, 0.5f), 1e-4f);
+
+    d.type = RE_NOISE_FRACTAL_RIDGED;
+    RE_NOISE_FRACTAL3_BATCH_f32(&d, xs, ys, zs, out, N);
+    for (int i = 0; i < N; i++)
+        ridged_ok &= approx_f32(out[i], RE_NOISE_VALUE3_RIDGED_f32(xs[i], ys[i], zs[i], 6, 2.0f, 0.5f, 1.0f), 1e-4f);
+
+    test_result("FRACTAL batch FBM == scalar", fbm_ok);
+    test_result("FRACTAL batch TURB == scalar", turb_ok);
+    test_result("FRACTAL batch RIDGED == scalar", ridged_ok);
+
+    /* Every basis: batch == single point */
+    RE_BOOL basis_ok = RE_TRUE;
+    d.type = RE_NOISE_FRACTAL_FBM;
+    d.lacunarity = 1.97f;
+    for (int b = RE_NOISE_BASIS_VALUE3; b <= RE_NOISE_BASIS_OS3D_SMOOTH; b++)
+    {
+        d.basis = b;
+        RE_NOISE_FRACTAL3_BATCH_f32(&d, xs, ys, zs, out, N);
+        for (int i = 0; i < N; i++)
+            basis_ok &= approx_f32(out[i], RE_NOISE_FRACTAL3_f32(&d, xs[i], ys[i], zs[i]), 1e-4f);
+    }
+    test_result("FRACTAL batch == point (all bases)", basis_ok);
+
+    /* Amplitude cut: gain 0.5 from 1.0 → octaves 0..3 have amp >= 0.1 */
+    RE_NOISE_FRACTAL_DESC full = { RE_NOISE_BASIS_PERLIN3, RE_NOISE_FRACTAL_FBM, 4, 2.0f, 0.5f, 0.0f, 0.0f };
+    RE_NOISE_FRACTAL_DESC cut  = { RE_NOISE_BASIS_PERLIN3, RE_NOISE_FRACTAL_FBM, 12, 2.0f, 0.5f, 0.0f, 0.1f };
+    RE_f32 freq[RE_NOISE_FRACTAL_MAX_OCTAVES], amp[RE_NOISE_FRACTAL_MAX_OCTAVES];
+
+    RE_BOOL cut_ok = RE_NOISE_FRACTAL_OCTAVES(&cut, freq, amp) == 4;
+    for (int i = 0; i < N; i++)
+        cut_ok &= RE_NOISE_FRACTAL3_f32(&cut, xs[i], ys[i], zs[i]) == RE_NOISE_FRACTAL3_f32(&full, xs[i], ys[i], zs[i]);
+    test_result("FRACTAL amplitude epsilon drops octaves", cut_ok);
+}
+
+/* ============================================================================================
+   7. Analytic derivatives
+   ============================================================================================ */
+
+typedef RE_f32 (*noise3_fn)(RE_f32, RE_f32, RE_f32);
+typedef RE_f32 (*noise3_deriv_fn)(RE_f32, RE_f32, RE_f32, RE_f32 *);
+
+/* Value must equal the plain function; gradient must match central differences */
+static RE_BOOL check_deriv3(noise3_fn f, noise3_deriv_fn df)
+{
+    const RE_f32 h = 1e-3f;
+    RE_BOOL ok = RE_TRUE;
+
+    for (int i = 0; i < 40; i++)
+    {
+        RE_f32 x = 0.37f + (RE_f32)i * 0.419f;
+        RE_f32 y = 1.21f - (RE_f32)i * 0.263f;
+        RE_f32 z = 0.55f + (RE_f32)(i % 6) * 0.731f;
+
+        RE_f32 g[3];
+        RE_f32 n = df(x, y, z, g);
+        ok &= approx_f32(n, f(x, y, z), 1e-5f);
+
+        RE_f32 fd[3] = {
+            (f(x + h, y, z) - f(x - h, y, z)) / (2.f * h),
+            (f(x, y + h, z) - f(x, y - h, z)) / (2.f * h),
+            (f(x, y, z + h) - f(x, y, z - h)) / (2.f * h)
+        };
+
+        /* a step that crosses a cell/simplex boundary may see a kink: skip those samples */
+        RE_f32 fd2 = (f(x + 2.f * h, y, z) - f(x - 2.f * h, y, z)) / (4.f * h);
+        if (!approx_f32(fd[0], fd2, 2e-2f)) continue;
+
+        for (int k = 0; k < 3; k++)
+            ok &= approx_f32(g[k], fd[k], 2e-2f * (1.f + fabsf(fd[k])));
+    }
+    return ok;
+}
+
+static RE_f32 os2d_as3(RE_f32 x, RE_f32 y, RE_f32 z) { (void)z; return RE_NOISE_OS2D_SMOOTH_f32(x, y); }
+
+static RE_f32 os2d_deriv_as3(RE_f32 x, RE_f32 y, RE_f32 z, RE_f32 *g)
+{
+    (void)z;
+    g[2] = 0.f;
+    return RE_NOISE_OS2D_SMOOTH_DERIV_f32(x, y, g);
+}
+
+static void test_noise_derivatives(void)
+{
+    test_result("VALUE3 deriv == finite diff", check_deriv3(RE_NOISE_VALUE3_f32, RE_NOISE_VALUE3_DERIV_f32));
+    test_result("PERLIN3 deriv == finite diff", check_deriv3(RE_NOISE_PERLIN3_f32_scalar, RE_NOISE_PERLIN3_DERIV_f32));
+    test_result("OS3D deriv == finite diff", check_deriv3(RE_NOISE_OS3D_SMOOTH_f32, RE_NOISE_OS3D_SMOOTH_DERIV_f32));
+    test_result("OS2D deriv == finite diff", check_deriv3(os2d_as3, os2d_deriv_as3));
+}
+
 /* ============================================================================================
-   7. MASTER TEST RUNNER
+   8. Seeded context
+   ============================================================================================ */
+
+static void test_context_seed0_matches_global(void)
+{
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 0u);
+
+    RE_BOOL ok = RE_TRUE;
+    for (int i = 0; i < 32; i++)
+    {
+        RE_f32 x = -7.1f + (RE_f32)i * 0.593f;
+        RE_f32 y =  3.3f - (RE_f32)i * 0.271f;
+        RE_f32 z =  (RE_f32)(i % 5) * 1.37f;
+
+        ok &= RE_NOISE_VALUE3_CTX_f32(&ctx, x, y, z) == RE_NOISE_VALUE3_f32(x, y, z);
+        ok &= RE_NOISE_PERLIN3_CTX_f32_scalar(&ctx, x, y, z) == RE_NOISE_PERLIN3_f32_scalar(x, y, z);
+        ok &= RE_NOISE_OS2D_SMOOTH_CTX_f32(&ctx, x, y) == RE_NOISE_OS2D_SMOOTH_f32(x, y);
+    }
+
+    test_result("CONTEXT seed 0 == global tables", ok);
+}
+
+static void test_context_seeds_differ(void)
+{
+    RE_NOISE_CONTEXT a, b;
+    RE_NOISE_CONTEXT_INIT(&a, 1u);
+    RE_NOISE_CONTEXT_INIT(&b, 2u);
+
+    int differ = 0;
+    for (int i = 0; i < 32; i++)
+    {
+        RE_f32 x = 0.37f + (RE_f32)i * 0.91f;
+        RE_f32 y = 1.13f + (RE_f32)i * 0.47f;
+        RE_f32 z = 2.71f - (RE_f32)i * 0.33f;
+
+        differ += RE_NOISE_PERLIN3_CTX_f32(&a, x, y, z) != RE_NOISE_PERLIN3_CTX_f32(&b, x, y, z);
+    }
+
+    RE_NOISE_CONTEXT a2;
+    RE_NOISE_CONTEXT_INIT(&a2, 1u);
+
+    test_result("CONTEXT seeds differ", differ > 16);
+    test_result("CONTEXT init deterministic", memcmp(a.perm, a2.perm, sizeof a.perm) == 0);
+}
+
+static void test_context_batch_matches_scalar(void)
+{
+    enum { N = 29 };
+    RE_f32 xs[N], ys[N], zs[N], out[N];
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] = -4.0f + (RE_f32)i * 0.417f;
+        ys[i] =  9.0f - (RE_f32)i * 0.813f;
+        zs[i] =  (RE_f32)(i % 3) * 2.11f;
+    }
+
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 0xC0FFEEu);
+    RE_NOISE_PERLIN3_BATCH_CTX_f32(&ctx, xs, ys, zs, out, N);
+
+    RE_BOOL ok = RE_TRUE;
+    for (int i = 0; i < N; i++)
+        ok &= approx_f32(out[i], RE_NOISE_PERLIN3_CTX_f32_scalar(&ctx, xs[i], ys[i], zs[i]), 1e-5f);
+
+    test_result("CONTEXT PERLIN batch == scalar", ok);
+}
+
+/* ============================================================================================
+   9. MASTER TEST RUNNER
    ============================================================================================ */
 
 void run_noise_tests(void)
@@ -175,6 +755,7 @@ void run_noise_tests(void)
     /* Hash tests */
     test_hash_determinism();
     test_hash_float();
+    test_pcg_hash_simd_matches_scalar();
 
     /* Value noise */
     test_value2();
@@ -184,19 +765,42 @@ void run_noise_tests(void)
     /* Perlin 3D */
     test_perlin3_basic();
     test_perlin3_smoothness();
+    test_perlin3_continuity();
+    test_perlin3_simd_matches_scalar();
+    test_perlin3_f64();
+    test_f64_large_coordinates();
+    test_perlin2_perlin1();
+
+    /* Grid fill */
+    test_fill_grid_matches_point();
 
     /* OpenSimplex3D */
     test_os3d_fast();
+    test_os3d_fast_continuity();
+    test_os3d_batch_matches_scalar();
     test_os3d_smooth();
     test_os3d_compare_fast_vs_smooth();
 
     /* OpenSimplex 2D */
     test_os2d_smooth();
+    test_os_smooth_continuity();
+
+    /* Periodic */
+    test_periodic_tiles();
 
     /* Fractal */
     test_fbm();
     test_turbulence();
     test_ridged();
+    test_fractal_batch();
+
+    /* Derivatives */
+    test_noise_derivatives();
+
+    /* Seeded context */
+    test_context_seed0_matches_global();
+    test_context_seeds_differ();
+    test_context_batch_matches_scalar();
 
     printf("=== re_noise tests finished ===\n");
 }
@@ -0,0 +1,184 @@
+/**
+ * @file re_noise_warp_tests.c
+ * @brief Unit tests for domain-warped noise.
+ *
+ *  - shared-lattice vector fields against the scalar noise they extend
+ *  - SIMD lanes against the single-point fields
+ *  - warped noise against the same chain written by hand, batch against point
+ */
+
+#include "../include/re_noise_warp.h"
+#include "../include/re_test_core.h"
+
+#include <stdio.h>
+#include <math.h>
+
+static const RE_NOISE_FRACTAL_DESC g_warp_fbm = {
+    RE_NOISE_BASIS_OS3D_SMOOTH, RE_NOISE_FRACTAL_FBM, 3, 2.0f, 0.5f, 1.0f, 0.0f
+};
+
+/* ============================================================================================
+   1. VECTOR FIELDS
+   ============================================================================================ */
+
+static void test_warp_vector_fields(void)
+{
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 21u);
+
+    RE_BOOL ch0_ok = RE_TRUE;
+    int distinct = 0;
+
+    for (int n = 0; n < 500; n++)
+    {
+        RE_f32 x = (RE_f32)n * 0.137f - 30.0f;
+        RE_f32 y = (RE_f32)(n % 23) * -0.41f;
+        RE_f32 z = (RE_f32)(n % 7) * 0.59f + 0.3f;
+        RE_f32 v[3], p[3];
+
+        RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(&ctx, x, y, z, v);
+        ch0_ok &= fabsf(v[0] - RE_NOISE_OS3D_SMOOTH_CTX_f32(&ctx, x, y, z)) < 1e-5f;
+
+        RE_NOISE_PERLIN3_VEC3_CTX_f32(&ctx, x, y, z, p);
+        distinct += fabsf(v[0] - v[1]) > 1e-3f && fabsf(v[1] - v[2]) > 1e-3f
+                 && fabsf(p[0] - p[1]) > 1e-3f && fabsf(p[1] - p[2]) > 1e-3f;
+        ch0_ok &= fabsf(p[0]) <= 1.5f && fabsf(p[1]) <= 1.5f && fabsf(p[2]) <= 1.5f;
+    }
+
+    test_result("WARP OS3D vec3 channel 0 == OS3D smooth", ch0_ok);
+    test_result("WARP vec3 channels are independent", distinct > 400);
+}
+
+/* ============================================================================================
+   2. SIMD LANES
+   ============================================================================================ */
+
+static void test_warp_simd_lanes(void)
+{
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 3u);
+
+    RE_BOOL ok = RE_TRUE;
+    RE_ALIGN(32) RE_f32 xs[8], ys[8], zs[8], lane[3][8];
+
+    for (int n = 0; n < 40; n++)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            xs[i] = (RE_f32)(n * 8 + i) * 0.113f - 17.0f;
+            ys[i] = (RE_f32)((n + i) % 11) * -0.37f + 2.0f;
+            zs[i] = (RE_f32)(i % 3) * 0.81f - 0.4f;
+        }
+
+        for (int field = 0; field < 2; field++)
+        {
+#if defined(RE_SIMD_AVX) && defined(__AVX2__)
+            __m256 o8[3];
+            if (field) RE_NOISE_OS3D_SMOOTH_VEC3_X8_CTX_f32_avx2(&ctx, _mm256_load_ps(xs), _mm256_load_ps(ys), _mm256_load_ps(zs), o8);
+            else       RE_NOISE_PERLIN3_VEC3_X8_CTX_f32_avx2(&ctx, _mm256_load_ps(xs), _mm256_load_ps(ys), _mm256_load_ps(zs), o8);
+            for (int c = 0; c < 3; c++) _mm256_store_ps(lane[c], o8[c]);
+#elif defined(RE_SIMD_SSE) || defined(RE_SIMD_AVX)
+            for (int h = 0; h < 8; h += 4)
+            {
+                __m128 o4[3];
+                if (field) RE_NOISE_OS3D_SMOOTH_VEC3_X4_CTX_f32_sse(&ctx, _mm_load_ps(xs + h), _mm_load_ps(ys + h), _mm_load_ps(zs + h), o4);
+                else       RE_NOISE_PERLIN3_VEC3_X4_CTX_f32_sse(&ctx, _mm_load_ps(xs + h), _mm_load_ps(ys + h), _mm_load_ps(zs + h), o4);
+                for (int c = 0; c < 3; c++) _mm_store_ps(lane[c] + h, o4[c]);
+            }
+#else
+            for (int i = 0; i < 8; i++)
+            {
+                RE_f32 v[3];
+                RE_NOISE_WARP_FIELD_CTX_f32(&ctx, field, xs[i], ys[i], zs[i], v);
+                for (int c = 0; c < 3; c++) lane[c][i] = v[c];
+            }
+#endif
+            for (int i = 0; i < 8; i++)
+            {
+                RE_f32 v[3];
+                RE_NOISE_WARP_FIELD_CTX_f32(&ctx, field, xs[i], ys[i], zs[i], v);
+                for (int c = 0; c < 3; c++)
+                    ok &= fabsf(lane[c][i] - v[c]) < 1e-5f;
+            }
+        }
+    }
+
+    test_result("WARP vec3 SIMD lanes == scalar", ok);
+}
+
+/* ============================================================================================
+   3. WARPED NOISE
+   ============================================================================================ */
+
+static void test_warp_point_and_batch(void)
+{
+    enum { N = 613 };
+    static RE_f32 xs[N], ys[N], zs[N], out3[N], out2[N];
+
+    RE_NOISE_CONTEXT ctx;
+    RE_NOISE_CONTEXT_INIT(&ctx, 77u);
+
+    RE_NOISE_WARP_DESC d;
+    d.warp           = RE_NOISE_WARP_OS3D_SMOOTH;
+    d.warp_frequency = 0.35f;
+    d.strength       = 2.5f;
+    d.base_frequency = 0.8f;
+    d.base           = g_warp_fbm;
+
+    /* One point against the chain written out by hand */
+    RE_BOOL hand_ok = RE_TRUE;
+    for (int n = 0; n < 200; n++)
+    {
+        RE_f32 x = (RE_f32)n * 0.29f - 20.0f, y = (RE_f32)(n % 9) * 0.7f, z = -1.25f;
+        RE_f32 wx = RE_NOISE_OS3D_SMOOTH_CTX_f32(&ctx, x * 0.35f, y * 0.35f, z * 0.35f);
+        RE_f32 v[3];
+        RE_NOISE_OS3D_SMOOTH_VEC3_CTX_f32(&ctx, x * 0.35f, y * 0.35f, z * 0.35f, v);
+
+        RE_f32 e = RE_NOISE_FRACTAL3_CTX_f32(&ctx, &g_warp_fbm, (x + 2.5f * wx) * 0.8f,
+                                             (y + 2.5f * v[1]) * 0.8f, (z + 2.5f * v[2]) * 0.8f);
+        hand_ok &= fabsf(RE_NOISE_WARP3_CTX_f32(&ctx, &d, x, y, z) - e) < 1e-5f;
+    }
+
+    for (int i = 0; i < N; i++)
+    {
+        xs[i] = (RE_f32)i * 0.083f - 25.0f;
+        ys[i] = (RE_f32)(i % 19) * 0.47f - 3.0f;
+        zs[i] = (RE_f32)(i % 5) * 1.3f;
+    }
+
+    RE_BOOL batch_ok = RE_TRUE;
+    for (int field = 0; field < 2; field++)
+    {
+        d.warp = field;
+        RE_NOISE_WARP3_BATCH_CTX_f32(&ctx, &d, xs, ys, zs, out3, N);
+        RE_NOISE_WARP2_BATCH_CTX_f32(&ctx, &d, xs, ys, out2, N);
+
+        for (int i = 0; i < N; i++)
+        {
+            batch_ok &= fabsf(out3[i] - RE_NOISE_WARP3_CTX_f32(&ctx, &d, xs[i], ys[i], zs[i])) < 1e-4f;
+            batch_ok &= fabsf(out2[i] - RE_NOISE_WARP2_CTX_f32(&ctx, &d, xs[i], ys[i])) < 1e-4f;
+        }
+    }
+
+    /* Zero strength is the base noise */
+    d.strength = 0.0f;
+    RE_BOOL zero_ok = RE_TRUE;
+    for (int i = 0; i < 64; i++)
+        zero_ok &= fabsf(RE_NOISE_WARP3_f32(&d, xs[i], ys[i], zs[i])
+                         - RE_NOISE_FRACTAL3_f32(&g_warp_fbm, xs[i] * 0.8f, ys[i] * 0.8f, zs[i] * 0.8f)) < 1e-6f;
+
+    test_result("WARP point == hand chain", hand_ok);
+    test_result("WARP 2D/3D batch == per-point", batch_ok);
+    test_result("WARP zero strength == base noise", zero_ok);
+}
+
+void run_noise_warp_tests(void)
+{
+    printf("=== re_noise_warp tests start ===\n");
+
+    test_warp_vector_fields();
+    test_warp_simd_lanes();
+    test_warp_point_and_batch();
+
+    printf("=== re_noise_warp tests finished ===\n");
+}
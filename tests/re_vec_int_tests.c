@@ -0,0 +1,219 @@
+/**
+ * @file re_vec_int_tests.c
+ * @brief Unit tests for the RE_V2/V3/V4_i32 SIMD batch ops.
+ *
+ *  - every batch op bit-identical to a scalar reference, odd counts (SIMD bodies + tails)
+ *  - floor division / modulo by powers of two for negative coordinates
+ *  - i32 <-> f32 conversions, integer LERP endpoints and monotonicity
+ */
+
+#include "../include/re_vec_int.h"
+#include "../include/re_test_core.h"
+
+#include <math.h>
+#include <stdio.h>
+
+enum { INT_N = 517 };
+
+static RE_V3_i32 g_a[INT_N], g_b[INT_N], g_o[INT_N];
+
+/* Coordinates in [-2^20, 2^20) plus a few extremes, from an LCG */
+static void int_points(void)
+{
+    RE_u32 s = 0x9E3779B9u;
+    RE_i32 *a = &g_a[0].x, *b = &g_b[0].x;
+    for (int i = 0; i < 3 * INT_N; i++)
+    {
+        s = s * 1664525u + 1013904223u;  a[i] = (RE_i32)(s >> 11) - (1 << 20);
+        s = s * 1664525u + 1013904223u;  b[i] = (RE_i32)(s >> 11) - (1 << 20);
+    }
+    a[7] = (RE_i32)0x7FFFFFFF;  a[8] = (RE_i32)0x80000000;  a[9] = -1;  b[9] = 0;
+}
+
+/* floor(v / 2^s) and v mod 2^s through C division */
+static RE_i32 ref_floordiv(RE_i32 v, int s)
+{
+    RE_i64 d = (RE_i64)1 << s, q = (RE_i64)v / d;
+    return (RE_i32)((q * d > v) ? q - 1 : q);
+}
+
+static RE_i32 ref_floormod(RE_i32 v, int s)
+{
+    return (RE_i32)((RE_i64)v - (RE_i64)ref_floordiv(v, s) * ((RE_i64)1 << s));
+}
+
+static RE_i32 imin(RE_i32 a, RE_i32 b) { return a < b ? a : b; }
+static RE_i32 imax(RE_i32 a, RE_i32 b) { return a > b ? a : b; }
+
+static RE_BOOL same3(RE_V3_i32 a, RE_V3_i32 b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+
+/* ============================================================================================
+   1. ARITHMETIC / CLAMP
+   ============================================================================================ */
+
+static void test_int_arith(void)
+{
+    RE_BOOL add_ok = RE_TRUE, mul_ok = RE_TRUE, mm_ok = RE_TRUE, clamp_ok = RE_TRUE;
+    const int counts[3] = { INT_N, INT_N - 2, 5 };
+
+    for (int c = 0; c < 3; c++)
+    {
+        int n = counts[c];
+
+        RE_V3_ADD_BATCH_i32(g_o, g_a, g_b, n);
+        for (int i = 0; i < n; i++) add_ok &= same3(g_o[i], RE_V3_MAKE_i32((RE_i32)((RE_u32)g_a[i].x + (RE_u32)g_b[i].x),
+                                                                           (RE_i32)((RE_u32)g_a[i].y + (RE_u32)g_b[i].y),
+                                                                           (RE_i32)((RE_u32)g_a[i].z + (RE_u32)g_b[i].z)));
+        RE_V3_SUB_BATCH_i32(g_o, g_a, g_b, n);
+        for (int i = 0; i < n; i++) add_ok &= same3(g_o[i], RE_V3_MAKE_i32((RE_i32)((RE_u32)g_a[i].x - (RE_u32)g_b[i].x),
+                                                                           (RE_i32)((RE_u32)g_a[i].y - (RE_u32)g_b[i].y),
+                                                                           (RE_i32)((RE_u32)g_a[i].z - (RE_u32)g_b[i].z)));
+        RE_V3_HADAMARD_BATCH_i32(g_o, g_a, g_b, n);
+        for (int i = 0; i < n; i++) mul_ok &= same3(g_o[i], RE_V3_MAKE_i32((RE_i32)((RE_u32)g_a[i].x * (RE_u32)g_b[i].x),
+                                                                           (RE_i32)((RE_u32)g_a[i].y * (RE_u32)g_b[i].y),
+                                                                           (RE_i32)((RE_u32)g_a[i].z * (RE_u32)g_b[i].z)));
+        RE_V3_SCALE_BATCH_i32(g_o, g_a, -37, n);
+        for (int i = 0; i < n; i++) mul_ok &= same3(g_o[i], RE_V3_MAKE_i32((RE_i32)((RE_u32)g_a[i].x * (RE_u32)-37),
+                                                                           (RE_i32)((RE_u32)g_a[i].y * (RE_u32)-37),
+                                                                           (RE_i32)((RE_u32)g_a[i].z * (RE_u32)-37)));
+        RE_V3_MIN_BATCH_i32(g_o, g_a, g_b, n);
+        for (int i = 0; i < n; i++) mm_ok &= g_o[i].x == imin(g_a[i].x, g_b[i].x) && g_o[i].y == imin(g_a[i].y, g_b[i].y)
+                                          && g_o[i].z == imin(g_a[i].z, g_b[i].z);
+        RE_V3_MAX_BATCH_i32(g_o, g_a, g_b, n);
+        for (int i = 0; i < n; i++) mm_ok &= g_o[i].x == imax(g_a[i].x, g_b[i].x) && g_o[i].y == imax(g_a[i].y, g_b[i].y)
+                                          && g_o[i].z == imax(g_a[i].z, g_b[i].z);
+
+        /* Distinct bounds per component, so a lane / component mix-up shows */
+        RE_V3_i32 mn = RE_V3_MAKE_i32(-1000, -200000, 0), mx = RE_V3_MAKE_i32(1000, 5, 300000);
+        RE_V3_CLAMP_BATCH_i32(g_o, g_a, mn, mx, n);
+        for (int i = 0; i < n; i++) clamp_ok &= same3(g_o[i], RE_V3_CLAMP_i32(g_a[i], mn, mx));
+    }
+
+    /* V2 / V4 share the kernels with a different component period */
+    RE_V2_i32 *a2 = (RE_V2_i32 *)g_a, *o2 = (RE_V2_i32 *)g_o;
+    RE_V2_i32 mn2 = RE_V2_MAKE_i32(-7, 3), mx2 = RE_V2_MAKE_i32(9, 400);
+    RE_V2_CLAMP_BATCH_i32(o2, a2, mn2, mx2, INT_N);
+    for (int i = 0; i < INT_N; i++)
+        clamp_ok &= o2[i].x == RE_V2_CLAMP_i32(a2[i], mn2, mx2).x && o2[i].y == RE_V2_CLAMP_i32(a2[i], mn2, mx2).y;
+
+    RE_V4_i32 *a4 = (RE_V4_i32 *)g_a, *o4 = (RE_V4_i32 *)g_o;
+    RE_V4_i32 mn4 = RE_V4_MAKE_i32(-7, 3, -100, 0), mx4 = RE_V4_MAKE_i32(9, 400, 100, 1);
+    RE_V4_CLAMP_BATCH_i32(o4, a4, mn4, mx4, INT_N / 2);
+    for (int i = 0; i < INT_N / 2; i++)
+    {
+        RE_V4_i32 r = RE_V4_CLAMP_i32(a4[i], mn4, mx4);
+        clamp_ok &= o4[i].x == r.x && o4[i].y == r.y && o4[i].z == r.z && o4[i].w == r.w;
+    }
+
+    test_result("VINT add / sub bit-identical (wrapping), tails", add_ok);
+    test_result("VINT hadamard / scale bit-identical (wrapping)", mul_ok);
+    test_result("VINT min / max", mm_ok);
+    test_result("VINT clamp V2/V3/V4 == RE_V*_CLAMP_i32", clamp_ok);
+}
+
+/* ============================================================================================
+   2. SHIFTS / POWER-OF-TWO FLOOR DIV
+   ============================================================================================ */
+
+static void test_int_shift(void)
+{
+    RE_BOOL shift_ok = RE_TRUE, div_ok = RE_TRUE;
+    const int shifts[5] = { 0, 1, 4, 5, 31 };
+
+    for (int k = 0; k < 5; k++)
+    {
+        int s = shifts[k];
+        const RE_i32 *a = &g_a[0].x;
+        RE_i32 *o = &g_o[0].x;
+
+        RE_V3_SHL_BATCH_i32(g_o, g_a, s, INT_N);
+        for (int i = 0; i < 3 * INT_N; i++) shift_ok &= o[i] == (RE_i32)((RE_u32)a[i] << s);
+
+        RE_V3_SHR_BATCH_i32(g_o, g_a, s, INT_N);
+        for (int i = 0; i < 3 * INT_N; i++) shift_ok &= o[i] == ref_floordiv(a[i], s);
+
+        RE_V3_FLOORDIV_POW2_BATCH_i32(g_o, g_a, s, INT_N - 1);
+        for (int i = 0; i < 3 * (INT_N - 1); i++) div_ok &= o[i] == ref_floordiv(a[i], s);
+
+        RE_V3_FLOORMOD_POW2_BATCH_i32(g_o, g_a, s, INT_N - 1);
+        for (int i = 0; i < 3 * (INT_N - 1); i++) div_ok &= o[i] == ref_floormod(a[i], s) && o[i] >= 0;
+    }
+
+    /* Chunk / cell split of negative world coordinates, 16^3 chunks */
+    RE_V3_i32 w[2] = { { -1, -16, -17 }, { 15, 16, 0 } }, chunk[2], cell[2];
+    RE_V3_FLOORDIV_POW2_BATCH_i32(chunk, w, 4, 2);
+    RE_V3_FLOORMOD_POW2_BATCH_i32(cell, w, 4, 2);
+    div_ok &= same3(chunk[0], RE_V3_MAKE_i32(-1, -1, -2)) && same3(cell[0], RE_V3_MAKE_i32(15, 0, 15));
+    div_ok &= same3(chunk[1], RE_V3_MAKE_i32(0, 1, 0))    && same3(cell[1], RE_V3_MAKE_i32(15, 0, 0));
+
+    test_result("VINT shl / shr (arithmetic), s = 0..31", shift_ok);
+    test_result("VINT floor div / mod by 2^s, negatives", div_ok);
+}
+
+/* ============================================================================================
+   3. CONVERSIONS / INTEGER LERP
+   ============================================================================================ */
+
+static void test_int_convert_lerp(void)
+{
+    static RE_V3_f32 f[INT_N];
+    static RE_V3_i32 r[INT_N];
+    RE_BOOL cvt_ok = RE_TRUE, lerp_ok = RE_TRUE;
+
+    /* int -> float is exact below 2^24 */
+    RE_V3_i32 small[INT_N];
+    for (int i = 0; i < INT_N; i++)
+        small[i] = RE_V3_MAKE_i32(ref_floordiv(g_a[i].x, 8), ref_floordiv(g_a[i].y, 8), ref_floordiv(g_a[i].z, 8));
+    RE_V3_TO_f32_BATCH_i32(f, small, INT_N);
+    RE_V3_FLOOR_FROM_f32_BATCH_i32(r, f, INT_N);
+    for (int i = 0; i < INT_N; i++)
+        cvt_ok &= f[i].x == (RE_f32)small[i].x && f[i].y == (RE_f32)small[i].y && same3(r[i], small[i]);
+
+    /* Fractional positions floor toward -inf */
+    for (int i = 0; i < INT_N; i++)
+        f[i] = RE_V3_MAKE_f32((RE_f32)small[i].x * 0.37f, -0.5f - (RE_f32)i, (RE_f32)i + 0.999f);
+    RE_V3_FLOOR_FROM_f32_BATCH_i32(r, f, INT_N - 2);
+    for (int i = 0; i < INT_N - 2; i++)
+        cvt_ok &= r[i].x == (RE_i32)floorf(f[i].x) && r[i].y == (RE_i32)floorf(f[i].y) && r[i].z == (RE_i32)floorf(f[i].z);
+
+    /* Batch LERP == per-vector LERP_Q16; the extremes at 7/8 are skipped (|b - a| > 2^31) */
+    const RE_i32 ts[5] = { 0, 1, 32768, 65535, 65536 };
+    for (int k = 0; k < 5; k++)
+    {
+        RE_V3_LERP_Q16_BATCH_i32(g_o, g_a, g_b, ts[k], INT_N);
+        for (int i = 0; i < INT_N; i++)
+        {
+            if (i == 2) continue;
+            lerp_ok &= same3(g_o[i], RE_V3_LERP_Q16_i32(g_a[i], g_b[i], ts[k]));
+        }
+        lerp_ok &= (ts[k] != 0     || same3(g_o[0], g_a[0]));
+        lerp_ok &= (ts[k] != 65536 || same3(g_o[0], g_b[0]));
+    }
+
+    /* Per-vector LERP: exact endpoints over the full range, monotone, floor rounding */
+    RE_V3_i32 lo = RE_V3_MAKE_i32((RE_i32)0x80000000, -3, 10), hi = RE_V3_MAKE_i32(0x7FFFFFFF, 4, 10);
+    lerp_ok &= same3(RE_V3_LERP_Q16_i32(lo, hi, 0), lo) && same3(RE_V3_LERP_Q16_i32(lo, hi, 65536), hi);
+    RE_V3_i32 prev = lo;
+    for (RE_i32 t = 0; t <= 65536; t += 256)
+    {
+        RE_V3_i32 v = RE_V3_LERP_Q16_i32(lo, hi, t);
+        lerp_ok &= v.x >= prev.x && v.y >= prev.y && v.z == 10;
+        prev = v;
+    }
+    lerp_ok &= RE_LERP_Q16_i32(0, -1, 32768) == -1 && RE_LERP_Q16_i32(0, 1, 32768) == 0;
+
+    test_result("VINT i32 <-> f32, floor conversion", cvt_ok);
+    test_result("VINT LERP_Q16 batch == per-vector, endpoints, monotone", lerp_ok);
+}
+
+void run_vec_int_tests(void)
+{
+    printf("=== re_vec_int tests start ===\n");
+
+    int_points();
+    test_int_arith();
+    test_int_shift();
+    test_int_convert_lerp();
+
+    printf("=== re_vec_int tests finished ===\n");
+}
@@ -0,0 +1,194 @@
+/**
+ * @file re_vec_simd_tests.c
+ * @brief Unit tests for the register-backed RE_V4A_f32 / RE_V3A_f32.
+ *
+ *  - every op against the RE_V4_f32 / RE_V3_f32 functions (exact where re_vec is exact)
+ *  - V3A padding lane stays 0, including cross / refract / conversions
+ *  - load / store round trips, alignment
+ */
+
+#include "../include/re_vec_simd.h"
+#include "../include/re_test_core.h"
+
+#include <math.h>
+#include <stdio.h>
+
+enum { SIMD_N = 257 };
+
+static RE_f32 fabs_f32(RE_f32 v) { return v < 0.0f ? -v : v; }
+
+static RE_BOOL near(RE_f32 a, RE_f32 b, RE_f32 tol)
+{
+    return fabs_f32(a - b) <= tol * (1.0f + fabs_f32(b));
+}
+
+static RE_BOOL same4(RE_V4_f32 a, RE_V4_f32 b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+}
+
+static RE_BOOL near4(RE_V4_f32 a, RE_V4_f32 b, RE_f32 tol)
+{
+    return near(a.x, b.x, tol) && near(a.y, b.y, tol) && near(a.z, b.z, tol) && near(a.w, b.w, tol);
+}
+
+static RE_BOOL near3(RE_V3_f32 a, RE_V3_f32 b, RE_f32 tol)
+{
+    return near(a.x, b.x, tol) && near(a.y, b.y, tol) && near(a.z, b.z, tol);
+}
+
+/* V3A lane w, read through memory */
+static RE_f32 pad_lane(RE_V3A_f32 v)
+{
+    RE_ALIGN(16) RE_f32 f[4];
+    RE_V4A_STORE_f32(f, RE_V3A_TO_V4A_f32(v, 0.0f));
+    return f[3];
+}
+
+static RE_u32 g_seed = 0x9E3779B9u;
+
+static RE_f32 rnd(void)
+{
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (RE_f32)(g_seed >> 8) * (8.0f / 16777216.0f) - 4.0f;
+}
+
+/* ============================================================================================
+   1. V4A
+   ============================================================================================ */
+
+static void test_v4a_ops(void)
+{
+    RE_BOOL exact = RE_TRUE, approx = RE_TRUE;
+
+    for (int i = 0; i < SIMD_N; i++)
+    {
+        RE_V4_f32 a = RE_V4_MAKE_f32(rnd(), rnd(), rnd(), rnd());
+        RE_V4_f32 b = RE_V4_MAKE_f32(rnd(), rnd(), rnd(), rnd());
+        if (i == 0) a = RE_V4_ZERO_f32();
+        RE_f32 s = rnd(), t = (RE_f32)i / (RE_f32)SIMD_N;
+
+        RE_V4A_f32 A = RE_V4A_FROM_V4_f32(a), B = RE_V4A_FROM_V4_f32(b);
+        RE_V4_f32 mn = RE_V4_BROADCAST_f32(-1.0f), mx = RE_V4_MAKE_f32(1.0f, 2.0f, 0.5f, 3.0f);
+
+        exact &= same4(RE_V4A_TO_V4_f32(A), a);
+        exact &= same4(RE_V4A_TO_V4_f32(RE_V4A_ADD_f32(A, B)), RE_V4_ADD_f32(a, b));
+        exact &= same4(RE_V4A_TO_V4_f32(RE_V4A_SUB_f32(A, B)), RE_V4_SUB_f32(a, b));
+        exact &= same4(RE_V4A_TO_V4_f32(RE_V4A_SCALE_f32(A, s)), RE_V4_SCALE_f32(a, s));
+        exact &= same4(RE_V4A_TO_V4_f32(RE_V4A_HADAMARD_f32(A, B)), RE_V4_HADAMARD_f32(a, b));
+        exact &= same4(RE_V4A_TO_V4_f32(RE_V4A_CLAMP_f32(A, RE_V4A_FROM_V4_f32(mn), RE_V4A_FROM_V4_f32(mx))),
+                       RE_V4_CLAMP_f32(a, mn, mx));
+        exact &= same4(RE_V4A_TO_V4_f32(RE_V4A_DIV_f32(A, 0.0f)), RE_V4_ZERO_f32());
+
+        approx &= near4(RE_V4A_TO_V4_f32(RE_V4A_DIV_f32(A, s)), RE_V4_DIV_f32(a, s), 1e-6f);
+        approx &= near4(RE_V4A_TO_V4_f32(RE_V4A_LERP_f32(A, B, t)), RE_V4_LERP_f32(a, b, t), 1e-6f);
+        approx &= near(RE_V4A_DOT_f32(A, B), RE_V4_DOT_f32(a, b), 1e-5f);
+        approx &= near(RE_V4A_TO_V4_f32(RE_V4A_DOT_SPLAT_f32(A, B)).w, RE_V4_DOT_f32(a, b), 1e-5f);
+        approx &= near4(RE_V4A_TO_V4_f32(RE_V4A_REFLECT_f32(A, B)), RE_V4_REFLECT_f32(a, b), 1e-5f);
+        approx &= near4(RE_V4A_TO_V4_f32(RE_V4A_PROJECT_f32(A, B)), RE_V4_PROJECT_f32(a, b), 1e-5f);
+
+        /* Against libm: re_vec's LENGTH / NORMALIZE use the RE_INVSQRT estimate */
+        RE_f32 len = sqrtf(a.x * a.x + a.y * a.y + a.z * a.z + a.w * a.w);
+        approx &= near(RE_V4A_LENGTH_f32(A), len, 1e-6f);
+        approx &= near(RE_V4A_DISTANCE_f32(A, B), RE_V4_DISTANCE_f32(a, b), 5e-3f);
+        if (len > 0.0f)
+        {
+            approx &= near4(RE_V4A_TO_V4_f32(RE_V4A_NORMALIZE_f32(A)),
+                            RE_V4_MAKE_f32(a.x / len, a.y / len, a.z / len, a.w / len), 1e-6f);
+            approx &= fabs_f32(RE_V4A_ANGLE_f32(A, B) - RE_V4_ANGLE_f32(a, b)) < 1e-2f;
+        }
+        else exact &= same4(RE_V4A_TO_V4_f32(RE_V4A_NORMALIZE_f32(A)), RE_V4_ZERO_f32())
+                    && RE_V4A_ANGLE_f32(A, B) == 0.0f;
+    }
+
+    /* Projection onto the zero vector */
+    exact &= same4(RE_V4A_TO_V4_f32(RE_V4A_PROJECT_f32(RE_V4A_BROADCAST_f32(2.0f), RE_V4A_ZERO_f32())), RE_V4_ZERO_f32());
+
+    /* Loads / stores */
+    RE_ALIGN(16) RE_f32 buf[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
+    RE_V4A_f32 arr[3];
+    arr[1] = RE_V4A_LOAD_f32(buf);
+    arr[2] = RE_V4A_LOADU_f32(buf + 1);
+    RE_V4A_STOREU_f32(buf + 5, RE_V4A_ADD_f32(arr[1], arr[2]));
+    RE_V4A_STORE_f32(buf, RE_V4A_MAKE_f32(-1.0f, -2.0f, -3.0f, -4.0f));
+    exact &= buf[0] == -1.0f && buf[3] == -4.0f && buf[4] == 5.0f && buf[5] == 3.0f && buf[8] == 9.0f;
+    exact &= sizeof(RE_V4A_f32) == 16 && ((uintptr_t)&arr[1] % 16) == 0;
+
+    test_result("V4A add/sub/scale/hadamard/clamp/div0/load/store == RE_V4 (exact)", exact);
+    test_result("V4A div/lerp/dot/reflect/project/length/normalize/angle == reference", approx);
+}
+
+/* ============================================================================================
+   2. V3A
+   ============================================================================================ */
+
+static void test_v3a_ops(void)
+{
+    RE_BOOL exact = RE_TRUE, approx = RE_TRUE, pad = RE_TRUE;
+
+    for (int i = 0; i < SIMD_N; i++)
+    {
+        RE_V3_f32 a = RE_V3_MAKE_f32(rnd(), rnd(), rnd());
+        RE_V3_f32 b = RE_V3_MAKE_f32(rnd(), rnd(), rnd());
+        if (i == 0) b = RE_V3_ZERO_f32();
+        RE_f32 s = rnd(), t = (RE_f32)i / (RE_f32)SIMD_N;
+
+        RE_V3A_f32 A = RE_V3A_FROM_V3_f32(a), B = RE_V3A_FROM_V3_f32(b);
+        RE_V3A_f32 N = RE_V3A_NORMALIZE_f32(B);
+        RE_V3A_f32 I = RE_V3A_NORMALIZE_f32(A);
+
+        RE_V3_f32 c = RE_V3_CROSS_f32(a, b);
+        RE_V3A_f32 C = RE_V3A_CROSS_f32(A, B);
+        approx &= near3(RE_V3A_TO_V3_f32(C), c, 1e-5f);
+        exact  &= RE_V3A_TO_V3_f32(RE_V3A_ADD_f32(A, B)).y == RE_V3_ADD_f32(a, b).y;
+        exact  &= RE_V3A_TO_V3_f32(RE_V3A_HADAMARD_f32(A, B)).z == RE_V3_HADAMARD_f32(a, b).z;
+        approx &= near3(RE_V3A_TO_V3_f32(RE_V3A_LERP_f32(A, B, t)), RE_V3_LERP_f32(a, b, t), 1e-6f);
+        approx &= near(RE_V3A_DOT_f32(A, B), RE_V3_DOT_f32(a, b), 1e-5f);
+        approx &= near(RE_V3A_LENGTH_f32(A), sqrtf(a.x * a.x + a.y * a.y + a.z * a.z), 1e-6f);
+        approx &= near3(RE_V3A_TO_V3_f32(RE_V3A_PROJECT_f32(A, B)), RE_V3_PROJECT_f32(a, b), 1e-5f);
+
+        /* Refract a unit direction through a unit normal, as re_vec (its RE_SQRT is approximate) */
+        RE_f32 eta = 0.5f + t;
+        RE_V3_f32 r = RE_V3_REFRACT_f32(RE_V3A_TO_V3_f32(I), RE_V3A_TO_V3_f32(N), eta);
+        approx &= near3(RE_V3A_TO_V3_f32(RE_V3A_REFRACT_f32(I, N, eta)), r, 5e-3f);
+
+        RE_V3A_f32 ops[12] = {
+            A, C, N, RE_V3A_SCALE_f32(A, s), RE_V3A_DIV_f32(A, s), RE_V3A_SUB_f32(A, B),
+            RE_V3A_LERP_f32(A, B, t), RE_V3A_REFLECT_f32(A, N), RE_V3A_REFRACT_f32(I, N, eta),
+            RE_V3A_CLAMP_f32(A, RE_V3A_BROADCAST_f32(-1.0f), RE_V3A_BROADCAST_f32(1.0f)),
+            RE_V3A_FROM_V4A_f32(RE_V4A_MAKE_f32(a.x, a.y, a.z, 1.0f / 0.0f)),
+            RE_V3A_LOADU_f32(&a.x)
+        };
+        for (int k = 0; k < 12; k++) pad &= pad_lane(ops[k]) == 0.0f;
+    }
+
+    /* Non-finite scalars must not reach the padding lane */
+    RE_V3A_f32 one = RE_V3A_BROADCAST_f32(1.0f);
+    RE_f32 inf = 1.0f / 0.0f, nan = inf - inf;
+    RE_V3A_f32 nf[5] = {
+        RE_V3A_SCALE_f32(one, inf), RE_V3A_SCALE_f32(one, nan), RE_V3A_DIV_f32(one, nan),
+        RE_V3A_LERP_f32(one, RE_V3A_ZERO_f32(), inf), RE_V3A_LERP_f32(one, one, nan)
+    };
+    for (int k = 0; k < 5; k++) pad &= pad_lane(nf[k]) == 0.0f;
+    pad &= RE_V3A_TO_V3_f32(nf[0]).x == inf && RE_V3A_DOT_f32(nf[0], nf[0]) == inf;
+
+    /* Stores write three floats only */
+    RE_f32 f[4] = { 0.0f, 0.0f, 0.0f, 7.0f };
+    RE_V3A_STOREU_f32(f, RE_V3A_MAKE_f32(1.0f, 2.0f, 3.0f));
+    exact &= f[0] == 1.0f && f[1] == 2.0f && f[2] == 3.0f && f[3] == 7.0f;
+    exact &= RE_V4A_TO_V4_f32(RE_V3A_TO_V4A_f32(RE_V3A_MAKE_f32(1.0f, 2.0f, 3.0f), 1.0f)).w == 1.0f;
+
+    test_result("V3A add/hadamard/store == RE_V3 (exact)", exact);
+    test_result("V3A cross/lerp/dot/length/project/refract == reference", approx);
+    test_result("V3A padding lane stays 0", pad);
+}
+
+void run_vec_simd_tests(void)
+{
+    printf("=== re_vec_simd tests start ===\n");
+
+    test_v4a_ops();
+    test_v3a_ops();
+
+    printf("=== re_vec_simd tests finished ===\n");
+}
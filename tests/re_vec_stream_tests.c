@@ -0,0 +1,376 @@
+/**
+ * @file re_vec_stream_tests.c
+ * @brief Unit tests for the SoA vector streams.
+ *
+ *  - INIT: aligned component arrays inside the caller's memory
+ *  - every V3 / V4 batch op against the per-vector re_vec functions, odd counts, aliasing
+ *  - NORMALIZE / LENGTH against libm sqrt, zero vectors
+ *  - AoS <-> SoA round trips and the AoS batch wrappers against the stream ops
+ *  - fast (rsqrt) normalize: APPROX / REFINED error bounds, tiny and zero vectors, tails
+ */
+
+#include "../include/re_vec_stream.h"
+#include "../include/re_test_core.h"
+
+#include <math.h>
+#include <stdio.h>
+
+enum { STREAM_N = 1037 };
+
+static unsigned char g_mem[5][STREAM_N * 16 + 256];
+
+static RE_f32 fabs_f32(RE_f32 v) { return v < 0.0f ? -v : v; }
+
+static RE_BOOL near(RE_f32 a, RE_f32 b, RE_f32 tol)
+{
+    return fabs_f32(a - b) <= tol * (1.0f + fabs_f32(b));
+}
+
+/* Values in [-8, 8) from an LCG; every 97th vector is zero */
+static void fill_v4(RE_V4_STREAM_f32 *s, RE_u32 seed)
+{
+    for (int i = 0; i < STREAM_N; i++)
+    {
+        RE_f32 c[4];
+        for (int k = 0; k < 4; k++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            c[k] = (i % 97 == 0) ? 0.0f : (RE_f32)(seed >> 8) * (16.0f / 16777216.0f) - 8.0f;
+        }
+        RE_V4_STREAM_SET_f32(s, i, RE_V4_MAKE_f32(c[0], c[1], c[2], c[3]));
+    }
+    s->count = STREAM_N;
+}
+
+/* ============================================================================================
+   1. CONTAINERS
+   ============================================================================================ */
+
+static void test_stream_init(void)
+{
+    RE_V3_STREAM_f32 s;
+    void *mem = g_mem[0] + 3;                                  /* deliberately misaligned */
+    size_t bytes = RE_V3_STREAM_BYTES_f32(STREAM_N);
+    int cap = RE_V3_STREAM_INIT_f32(&s, mem, bytes);
+
+    RE_BOOL ok = cap >= STREAM_N && s.count == 0;
+    ok &= ((uintptr_t)s.x % RE_VEC_STREAM_ALIGN) == 0;
+    ok &= ((uintptr_t)s.y % RE_VEC_STREAM_ALIGN) == 0;
+    ok &= ((uintptr_t)s.z % RE_VEC_STREAM_ALIGN) == 0;
+    ok &= (unsigned char *)(s.z + cap) <= (unsigned char *)mem + bytes;
+
+    RE_V3_STREAM_SET_f32(&s, cap - 1, RE_V3_MAKE_f32(1.0f, 2.0f, 3.0f));
+    RE_V3_f32 back = RE_V3_STREAM_GET_f32(&s, cap - 1);
+    ok &= back.x == 1.0f && back.y == 2.0f && back.z == 3.0f;
+
+    RE_V4_STREAM_f32 tiny;
+    ok &= RE_V4_STREAM_INIT_f32(&tiny, g_mem[1], 16) == 0 && tiny.x == NULL;
+
+    test_result("STREAM init: aligned arrays within caller memory", ok);
+}
+
+/* ============================================================================================
+   2. BATCH OPS
+   ============================================================================================ */
+
+static void test_stream_v3_ops(void)
+{
+    RE_V4_STREAM_f32 a4, b4;
+    RE_V4_STREAM_INIT_f32(&a4, g_mem[0], sizeof g_mem[0]);
+    RE_V4_STREAM_INIT_f32(&b4, g_mem[1], sizeof g_mem[1]);
+    fill_v4(&a4, 11u);
+    fill_v4(&b4, 29u);
+
+    /* The V3 views share the first three arrays of the V4 streams */
+    RE_V3_STREAM_f32 a, b, o;
+    RE_V3_STREAM_WRAP_f32(&a, a4.x, a4.y, a4.z, STREAM_N);
+    RE_V3_STREAM_WRAP_f32(&b, b4.x, b4.y, b4.z, STREAM_N);
+    RE_V3_STREAM_INIT_f32(&o, g_mem[2], sizeof g_mem[2]);
+
+    static RE_f32 r[STREAM_N];
+    const RE_V3_f32 mn = RE_V3_MAKE_f32(-1.0f, -2.0f, -3.0f), mx = RE_V3_MAKE_f32(1.0f, 2.0f, 3.0f);
+    RE_BOOL exact = RE_TRUE, approx = RE_TRUE;
+
+    #define EACH(OP) for (int i = 0; i < STREAM_N; i++) { \
+        RE_V3_f32 va = RE_V3_STREAM_GET_f32(&a, i), vb = RE_V3_STREAM_GET_f32(&b, i), vo = RE_V3_STREAM_GET_f32(&o, i); \
+        (void)va; (void)vb; (void)vo; OP; }
+    #define SAME(E) exact &= vo.x == (E).x && vo.y == (E).y && vo.z == (E).z
+
+    RE_V3_STREAM_ADD_f32(&o, &a, &b);           EACH(SAME(RE_V3_ADD_f32(va, vb)))
+    RE_V3_STREAM_SUB_f32(&o, &a, &b);           EACH(SAME(RE_V3_SUB_f32(va, vb)))
+    RE_V3_STREAM_HADAMARD_f32(&o, &a, &b);      EACH(SAME(RE_V3_HADAMARD_f32(va, vb)))
+    RE_V3_STREAM_SCALE_f32(&o, &a, -1.5f);      EACH(SAME(RE_V3_SCALE_f32(va, -1.5f)))
+    RE_V3_STREAM_CLAMP_f32(&o, &a, mn, mx);     EACH(SAME(RE_V3_CLAMP_f32(va, mn, mx)))
+
+    /* Within an ulp of the scalar functions: those may be contracted to FMA */
+    RE_V3_STREAM_CROSS_f32(&o, &a, &b);
+    EACH(RE_V3_f32 e = RE_V3_CROSS_f32(va, vb);
+         approx &= near(vo.x, e.x, 1e-5f) && near(vo.y, e.y, 1e-5f) && near(vo.z, e.z, 1e-5f))
+
+    RE_V3_STREAM_LERP_f32(&o, &a, &b, 0.3f);
+    EACH(RE_V3_f32 e = RE_V3_LERP_f32(va, vb, 0.3f);
+         approx &= near(vo.x, e.x, 1e-6f) && near(vo.y, e.y, 1e-6f) && near(vo.z, e.z, 1e-6f))
+
+    RE_V3_STREAM_DOT_f32(r, &a, &b);
+    EACH(approx &= near(r[i], (RE_f32)RE_V3_DOT_f32(va, vb), 1e-5f))
+
+    RE_V3_STREAM_LENGTH_f32(r, &a);
+    EACH(approx &= near(r[i], sqrtf(va.x * va.x + va.y * va.y + va.z * va.z), 1e-6f))
+
+    RE_V3_STREAM_NORMALIZE_f32(&o, &a);
+    EACH(RE_f32 len = sqrtf(va.x * va.x + va.y * va.y + va.z * va.z);
+         if (len == 0.0f) exact &= vo.x == 0.0f && vo.y == 0.0f && vo.z == 0.0f;
+         else approx &= near(vo.x, va.x / len, 1e-6f) && near(vo.y, va.y / len, 1e-6f) && near(vo.z, va.z / len, 1e-6f))
+
+    /* In place with a scalar tail: matches out of place, the vector past count untouched */
+    RE_V3_STREAM_f32 c = a;
+    RE_f32 guard = a.x[STREAM_N - 2];
+    c.count = STREAM_N - 2;
+    RE_V3_STREAM_CROSS_f32(&o, &c, &b);
+    RE_V3_STREAM_CROSS_f32(&c, &c, &b);
+    for (int i = 0; i < STREAM_N - 2; i++)
+        exact &= c.x[i] == o.x[i] && c.y[i] == o.y[i] && c.z[i] == o.z[i];
+    exact &= a.x[STREAM_N - 2] == guard && c.count == STREAM_N - 2;
+
+    #undef EACH
+    #undef SAME
+
+    test_result("STREAM V3 add/sub/hadamard/scale/clamp == RE_V3 (exact)", exact);
+    test_result("STREAM V3 cross/lerp/dot/length/normalize == reference, in place", approx);
+}
+
+static void test_stream_v4_ops(void)
+{
+    RE_V4_STREAM_f32 a, b, o;
+    RE_V4_STREAM_INIT_f32(&a, g_mem[0], sizeof g_mem[0]);
+    RE_V4_STREAM_INIT_f32(&b, g_mem[1], sizeof g_mem[1]);
+    RE_V4_STREAM_INIT_f32(&o, g_mem[3], sizeof g_mem[3]);
+    fill_v4(&a, 7u);
+    fill_v4(&b, 3u);
+
+    static RE_f32 r[STREAM_N];
+    const RE_V4_f32 mn = RE_V4_BROADCAST_f32(-0.5f), mx = RE_V4_BROADCAST_f32(4.0f);
+    RE_BOOL exact = RE_TRUE, approx = RE_TRUE;
+
+    #define EACH(OP) for (int i = 0; i < STREAM_N; i++) { \
+        RE_V4_f32 va = RE_V4_STREAM_GET_f32(&a, i), vb = RE_V4_STREAM_GET_f32(&b, i), vo = RE_V4_STREAM_GET_f32(&o, i); \
+        (void)va; (void)vb; (void)vo; OP; }
+    #define SAME(E) exact &= vo.x == (E).x && vo.y == (E).y && vo.z == (E).z && vo.w == (E).w
+
+    RE_V4_STREAM_ADD_f32(&o, &a, &b);           EACH(SAME(RE_V4_ADD_f32(va, vb)))
+    RE_V4_STREAM_SUB_f32(&o, &a, &b);           EACH(SAME(RE_V4_SUB_f32(va, vb)))
+    RE_V4_STREAM_HADAMARD_f32(&o, &a, &b);      EACH(SAME(RE_V4_HADAMARD_f32(va, vb)))
+    RE_V4_STREAM_SCALE_f32(&o, &a, 0.25f);      EACH(SAME(RE_V4_SCALE_f32(va, 0.25f)))
+    RE_V4_STREAM_CLAMP_f32(&o, &a, mn, mx);     EACH(SAME(RE_V4_CLAMP_f32(va, mn, mx)))
+
+    RE_V4_STREAM_LERP_f32(&o, &a, &b, 0.75f);
+    EACH(RE_V4_f32 e = RE_V4_LERP_f32(va, vb, 0.75f);
+         approx &= near(vo.x, e.x, 1e-6f) && near(vo.y, e.y, 1e-6f) && near(vo.z, e.z, 1e-6f) && near(vo.w, e.w, 1e-6f))
+
+    RE_V4_STREAM_DOT_f32(r, &a, &b);
+    EACH(approx &= near(r[i], (RE_f32)RE_V4_DOT_f32(va, vb), 1e-5f))
+
+    RE_V4_STREAM_LENGTH_f32(r, &a);
+    EACH(approx &= near(r[i], sqrtf(va.x * va.x + va.y * va.y + va.z * va.z + va.w * va.w), 1e-6f))
+
+    /* Normalize in place */
+    RE_V4_STREAM_NORMALIZE_f32(&o, &a);
+    RE_V4_STREAM_NORMALIZE_f32(&a, &a);
+    EACH(exact &= va.x == vo.x && va.y == vo.y && va.z == vo.z && va.w == vo.w;
+         RE_f32 l = va.x * va.x + va.y * va.y + va.z * va.z + va.w * va.w;
+         approx &= (i % 97 == 0) ? l == 0.0f : near(l, 1.0f, 1e-5f))
+
+    #undef EACH
+    #undef SAME
+
+    test_result("STREAM V4 add/sub/hadamard/scale/clamp == RE_V4 (exact)", exact);
+    test_result("STREAM V4 lerp/dot/length/normalize == reference, in place", approx);
+}
+
+/* ============================================================================================
+   3. AoS <-> SoA
+   ============================================================================================ */
+
+static void test_stream_aos(void)
+{
+    static RE_V3_f32 a3[STREAM_N], b3[STREAM_N], o3[STREAM_N];
+    static RE_V4_f32 a4[STREAM_N], o4[STREAM_N];
+    static RE_f32 r[STREAM_N];
+
+    RE_V4_STREAM_f32 s4, t4;
+    RE_V4_STREAM_INIT_f32(&s4, g_mem[0], sizeof g_mem[0]);
+    RE_V4_STREAM_INIT_f32(&t4, g_mem[1], sizeof g_mem[1]);
+    fill_v4(&s4, 5u);
+    fill_v4(&t4, 17u);
+    for (int i = 0; i < STREAM_N; i++)
+    {
+        a4[i] = RE_V4_STREAM_GET_f32(&s4, i);
+        a3[i] = RE_V3_MAKE_f32(a4[i].x, a4[i].y, a4[i].z);
+        b3[i] = RE_V3_MAKE_f32(t4.x[i], t4.y[i], t4.z[i]);
+    }
+
+    /* Round trips at every length up to 40 (all transpose / tail splits), then the full array */
+    RE_BOOL trip = RE_TRUE;
+    RE_V3_STREAM_f32 s3, u3;
+    RE_V3_STREAM_INIT_f32(&s3, g_mem[2], sizeof g_mem[2]);
+    RE_V3_STREAM_INIT_f32(&u3, g_mem[3], sizeof g_mem[3]);
+    for (int n = 0; n <= 40; n++)
+    {
+        for (int i = 0; i <= n && i < STREAM_N; i++) o3[i] = RE_V3_ZERO_f32();
+        trip &= RE_V3_STREAM_FROM_AOS_f32(&s3, a3 + 1, n) == n;
+        RE_V3_STREAM_TO_AOS_f32(o3, &s3);
+        for (int i = 0; i < n; i++)
+            trip &= s3.x[i] == a3[i + 1].x && s3.y[i] == a3[i + 1].y && s3.z[i] == a3[i + 1].z
+                 && o3[i].x == a3[i + 1].x && o3[i].y == a3[i + 1].y && o3[i].z == a3[i + 1].z;
+        trip &= o3[n].x == 0.0f && o3[n].y == 0.0f && o3[n].z == 0.0f;
+    }
+    RE_V4_STREAM_FROM_AOS_f32(&t4, a4, STREAM_N);
+    RE_V4_STREAM_TO_AOS_f32(o4, &t4);
+    for (int i = 0; i < STREAM_N; i++)
+        trip &= t4.x[i] == a4[i].x && t4.w[i] == a4[i].w && o4[i].x == a4[i].x && o4[i].y == a4[i].y
+             && o4[i].z == a4[i].z && o4[i].w == a4[i].w;
+
+    test_result("STREAM AoS <-> SoA round trip V3 (4x3 / 8x3) and V4 (4x4)", trip);
+
+    /* AoS wrappers == stream ops, bit for bit */
+    RE_BOOL same = RE_TRUE;
+    RE_V3_STREAM_FROM_AOS_f32(&s3, a3, STREAM_N);
+    RE_V3_STREAM_FROM_AOS_f32(&u3, b3, STREAM_N);
+    RE_V3_STREAM_f32 v3;
+    RE_V3_STREAM_INIT_f32(&v3, g_mem[4], sizeof g_mem[4]);
+
+    #define SAME3(STREAM_OP, BATCH_OP)                                                         \
+        STREAM_OP;  BATCH_OP;                                                                  \
+        for (int i = 0; i < STREAM_N; i++)                                                     \
+            same &= o3[i].x == v3.x[i] && o3[i].y == v3.y[i] && o3[i].z == v3.z[i];
+
+    SAME3(RE_V3_STREAM_ADD_f32(&v3, &s3, &u3),          RE_V3_ADD_BATCH_f32(o3, a3, b3, STREAM_N))
+    SAME3(RE_V3_STREAM_LERP_f32(&v3, &s3, &u3, 0.6f),   RE_V3_LERP_BATCH_f32(o3, a3, b3, 0.6f, STREAM_N))
+    SAME3(RE_V3_STREAM_CROSS_f32(&v3, &s3, &u3),        RE_V3_CROSS_BATCH_f32(o3, a3, b3, STREAM_N))
+    SAME3(RE_V3_STREAM_CLAMP_f32(&v3, &s3, RE_V3_BROADCAST_f32(-1.0f), RE_V3_BROADCAST_f32(2.0f)),
+          RE_V3_CLAMP_BATCH_f32(o3, a3, RE_V3_BROADCAST_f32(-1.0f), RE_V3_BROADCAST_f32(2.0f), STREAM_N))
+    SAME3(RE_V3_STREAM_NORMALIZE_f32(&v3, &s3),         RE_V3_NORMALIZE_BATCH_f32(o3, a3, STREAM_N))
+
+    #undef SAME3
+
+    RE_V3_STREAM_DOT_f32(v3.x, &s3, &u3);
+    RE_V3_DOT_BATCH_f32(r, a3, b3, STREAM_N);
+    for (int i = 0; i < STREAM_N; i++) same &= r[i] == v3.x[i];
+
+    RE_V4_STREAM_LENGTH_f32(v3.x, &t4);
+    RE_V4_LENGTH_BATCH_f32(r, a4, STREAM_N);
+    for (int i = 0; i < STREAM_N; i++) same &= r[i] == v3.x[i];
+
+    /* In place on the AoS array */
+    RE_V4_STREAM_NORMALIZE_f32(&t4, &t4);
+    RE_V4_NORMALIZE_BATCH_f32(a4, a4, STREAM_N);
+    for (int i = 0; i < STREAM_N; i++)
+        same &= a4[i].x == t4.x[i] && a4[i].y == t4.y[i] && a4[i].z == t4.z[i] && a4[i].w == t4.w[i];
+
+    test_result("STREAM AoS batch wrappers == stream ops (exact), in place", same);
+}
+
+/* ============================================================================================
+   4. FAST NORMALIZE
+   ============================================================================================ */
+
+static void test_stream_normalize_fast(void)
+{
+    static RE_V2_f32 a2[STREAM_N], o2[STREAM_N];
+    static RE_V3_f32 a3[STREAM_N], o3[STREAM_N];
+    static RE_V4_f32 a4[STREAM_N], o4[STREAM_N];
+
+    RE_V4_STREAM_f32 s4;
+    RE_V4_STREAM_INIT_f32(&s4, g_mem[0], sizeof g_mem[0]);
+    fill_v4(&s4, 23u);
+    for (int i = 0; i < STREAM_N; i++)
+    {
+        /* every 97th is zero (fill_v4); a few below FLT_MIN in length */
+        RE_f32 k = (i % 89 == 5) ? 1e-25f : 1.0f;
+        a4[i] = RE_V4_SCALE_f32(RE_V4_STREAM_GET_f32(&s4, i), k);
+        a3[i] = RE_V3_MAKE_f32(a4[i].x, a4[i].y, a4[i].z);
+        a2[i] = RE_V2_MAKE_f32(a4[i].x, a4[i].y);
+    }
+
+    RE_f32 err[2] = { 0.0f, 0.0f };
+    RE_BOOL zero = RE_TRUE;
+
+    for (int p = 0; p < 2; p++)
+    {
+        int prec = p ? RE_VEC_NORMALIZE_REFINED : RE_VEC_NORMALIZE_APPROX;
+        RE_V2_NORMALIZE_FAST_BATCH_f32(o2, a2, STREAM_N, prec);
+        RE_V3_NORMALIZE_FAST_BATCH_f32(o3, a3, STREAM_N, prec);
+        RE_V4_NORMALIZE_FAST_BATCH_f32(o4, a4, STREAM_N, prec);
+
+        for (int i = 0; i < STREAM_N; i++)
+        {
+            RE_f64 d2 = (RE_f64)a2[i].x * a2[i].x + (RE_f64)a2[i].y * a2[i].y;
+            RE_f64 d3 = d2 + (RE_f64)a3[i].z * a3[i].z;
+            RE_f64 d4 = d3 + (RE_f64)a4[i].w * a4[i].w;
+            RE_f64 r[3] = { d2, d3, d4 };
+            RE_f32 got[3][4] = { { o2[i].x, o2[i].y, 0, 0 }, { o3[i].x, o3[i].y, o3[i].z, 0 },
+                                 { o4[i].x, o4[i].y, o4[i].z, o4[i].w } };
+            RE_f32 src[4] = { a4[i].x, a4[i].y, a4[i].z, a4[i].w };
+
+            for (int k = 0; k < 3; k++)
+            {
+                if (r[k] < (RE_f64)FLT_MIN)
+                {
+                    for (int c = 0; c < 4; c++) zero &= got[k][c] == 0.0f;
+                    continue;
+                }
+                RE_f64 inv = 1.0 / sqrt(r[k]);
+                for (int c = 0; c < k + 2; c++)
+                {
+                    RE_f64 e = fabs((RE_f64)got[k][c] - src[c] * inv);
+                    if ((RE_f32)e > err[p]) err[p] = (RE_f32)e;
+                }
+            }
+        }
+    }
+
+    /* Position independence: the padded tail gives the same bits as a full SIMD group, and the
+       stream variant matches the AoS one (to an ulp when the compiler contracts to FMA) */
+#if defined(__FMA__)
+    #define EQ(a, b) near((a), (b), 1e-6f)
+#else
+    #define EQ(a, b) ((a) == (b))
+#endif
+    RE_BOOL same = RE_TRUE;
+    RE_V3_STREAM_f32 s3, t3;
+    RE_V3_STREAM_INIT_f32(&s3, g_mem[1], sizeof g_mem[1]);
+    RE_V3_STREAM_INIT_f32(&t3, g_mem[2], sizeof g_mem[2]);
+    RE_V3_STREAM_FROM_AOS_f32(&s3, a3, STREAM_N);
+    RE_V3_STREAM_NORMALIZE_FAST_f32(&t3, &s3, RE_VEC_NORMALIZE_REFINED);
+    RE_V3_NORMALIZE_FAST_BATCH_f32(o3, a3, STREAM_N, RE_VEC_NORMALIZE_REFINED);
+    for (int i = 0; i < STREAM_N; i++)
+    {
+        RE_V2_f32 one2;
+        RE_V3_f32 one3;
+        RE_V4_f32 one4;
+        RE_V2_NORMALIZE_FAST_BATCH_f32(&one2, &a2[i], 1, RE_VEC_NORMALIZE_REFINED);
+        RE_V3_NORMALIZE_FAST_BATCH_f32(&one3, &a3[i], 1, RE_VEC_NORMALIZE_REFINED);
+        RE_V4_NORMALIZE_FAST_BATCH_f32(&one4, &a4[i], 1, RE_VEC_NORMALIZE_REFINED);
+        same &= EQ(one2.x, o2[i].x) && EQ(one2.y, o2[i].y);
+        same &= EQ(one3.x, o3[i].x) && EQ(one3.y, o3[i].y) && EQ(one3.z, o3[i].z);
+        same &= EQ(one4.x, o4[i].x) && EQ(one4.w, o4[i].w);
+        same &= EQ(t3.x[i], o3[i].x) && EQ(t3.y[i], o3[i].y) && EQ(t3.z[i], o3[i].z);
+    }
+    #undef EQ
+
+    test_result("STREAM fast normalize: approx < 2^-11, refined < 2^-21", err[0] < 4.9e-4f && err[1] < 4.8e-7f);
+    test_result("STREAM fast normalize: zero / tiny -> 0, tails and streams bit-identical", zero && same);
+}
+
+void run_vec_stream_tests(void)
+{
+    printf("=== re_vec_stream tests start ===\n");
+
+    test_stream_init();
+    test_stream_v3_ops();
+    test_stream_v4_ops();
+    test_stream_aos();
+    test_stream_normalize_fast();
+
+    printf("=== re_vec_stream tests finished ===\n");
+}